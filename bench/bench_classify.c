@@ -0,0 +1,208 @@
+/*
+ *
+ *      Filename: bench_classify.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 17:40:26
+ * Last Modified: 2026-10-18 17:40:26
+ */
+
+#include "xm_bench.h"
+#include "xm_classify.h"
+
+#define CLS_KEYS 1024
+
+static const char *cls_conf =
+	"ClassifyDefault ignore\n"
+	"ClassifyTcp SA success\n"
+	"ClassifyTcp R/R failure\n"
+	"ClassifyTcp SAR failure\n"
+	"ClassifyUdp success\n"
+	"ClassifyIcmp 3 * filtered\n"
+	"ClassifyIcmp 3 3 failure\n"
+	"ClassifyIcmp 0 0 success\n"
+	"ClassifyIcmp6 1 * filtered\n"
+	"ClassifyIcmp6 129 0 success\n";
+
+typedef struct {
+
+	xm_classify_t *cls;
+	uint8_t proto[CLS_KEYS];
+	uint32_t key[CLS_KEYS];
+} cls_ctx_t;
+
+static xm_classify_t *cls_load(xm_pool_t *mp,const char *conf,const char **err){
+
+	xm_classify_t *cls;
+	char name[64];
+	FILE *fp;
+
+	snprintf(name,sizeof(name),"/tmp/xm_bench_cls.%d",(int)getpid());
+
+	fp = fopen(name,"w");
+	if(fp == NULL)
+		return NULL;
+
+	fputs(conf,fp);
+	fclose(fp);
+
+	cls = xm_classify_create(mp);
+	if(cls)
+		*err = xm_classify_load(cls,mp,name);
+
+	unlink(name);
+
+	return cls;
+}
+
+static void *cls_setup(xm_pool_t *mp){
+
+	static const uint8_t protos[] = {IPPROTO_TCP,IPPROTO_UDP,IPPROTO_ICMP,IPPROTO_ICMPV6,IPPROTO_SCTP};
+	cls_ctx_t *cc = (cls_ctx_t*)xm_pcalloc(mp,sizeof(*cc));
+	const char *err = NULL;
+	uint64_t seed = 11;
+	int i;
+
+	cc->cls = cls_load(mp,cls_conf,&err);
+	if(cc->cls == NULL||err)
+		return NULL;
+
+	for(i = 0;i<CLS_KEYS;i++){
+
+		cc->proto[i] = protos[xm_bench_rand(&seed)%5];
+		cc->key[i] = xm_bench_rand(&seed)&0xffff;
+	}
+
+	return cc;
+}
+
+static void tcp_run(void *ctx,uint64_t iters){
+
+	cls_ctx_t *cc = (cls_ctx_t*)ctx;
+	uint64_t i;
+	uint32_t sum = 0;
+
+	for(i = 0;i<iters;i++)
+		sum += xm_classify_tcp(cc->cls,(uint8_t)cc->key[i&(CLS_KEYS-1)]);
+
+	xm_bench_use((void*)(uintptr_t)sum);
+}
+
+static void mixed_run(void *ctx,uint64_t iters){
+
+	cls_ctx_t *cc = (cls_ctx_t*)ctx;
+	uint64_t i;
+	uint32_t sum = 0;
+
+	for(i = 0;i<iters;i++)
+		sum += xm_classify(cc->cls,cc->proto[i&(CLS_KEYS-1)],cc->key[i&(CLS_KEYS-1)]);
+
+	xm_bench_use((void*)(uintptr_t)sum);
+}
+
+/*the rules one by one, the last match wins*/
+static uint8_t cls_slow(const xm_classify_t *cls,uint8_t proto,uint32_t key){
+
+	const xm_classify_rule_t *rule = (const xm_classify_rule_t*)cls->rules->elts;
+	uint8_t verdict = cls->default_verdict;
+	int i;
+
+	for(i = 0;i<cls->rules->nelts;i++,rule++){
+
+		if(rule->proto != proto)
+			continue;
+
+		switch(proto){
+
+		case IPPROTO_TCP:
+			if(((key&0xff)&rule->mask) == (rule->value&rule->mask))
+				verdict = rule->verdict;
+			break;
+
+		case IPPROTO_UDP:
+			verdict = rule->verdict;
+			break;
+
+		default:
+			if((key>>8) == rule->value&&(rule->code == XM_CLS_ANY||(key&0xff) == rule->code))
+				verdict = rule->verdict;
+			break;
+		}
+	}
+
+	return verdict;
+}
+
+static int table_check(xm_pool_t *mp){
+
+	xm_classify_t *cls;
+	const char *err = NULL;
+	uint32_t proto,key,n;
+
+	cls = cls_load(mp,cls_conf,&err);
+	if(cls == NULL||err||cls->rules->nelts != 9)
+		return -1;
+
+	for(proto = 0;proto<256;proto++){
+
+		n = proto == IPPROTO_TCP?256:(proto == IPPROTO_ICMP||proto == IPPROTO_ICMPV6)?65536:1;
+
+		for(key = 0;key<n;key++){
+
+			if(xm_classify(cls,(uint8_t)proto,key) != cls_slow(cls,(uint8_t)proto,key)){
+
+				fprintf(stderr,"classify: proto %u key 0x%x: %s, the rules say %s\n",proto,key,
+					xm_classify_verdict_name(xm_classify(cls,(uint8_t)proto,key)),
+					xm_classify_verdict_name(cls_slow(cls,(uint8_t)proto,key)));
+				return -1;
+			}
+		}
+	}
+
+	/*spot checks against the config text*/
+	if(xm_classify_tcp(cls,XM_CLS_TCP_SYN|XM_CLS_TCP_ACK) != XM_CLS_SUCCESS||
+		xm_classify_tcp(cls,XM_CLS_TCP_RST|XM_CLS_TCP_ACK) != XM_CLS_FAILURE||
+		xm_classify_icmp(cls,3,1) != XM_CLS_FILTERED||xm_classify_icmp(cls,3,3) != XM_CLS_FAILURE||
+		xm_classify_icmp6(cls,129,0) != XM_CLS_SUCCESS||xm_classify(cls,IPPROTO_SCTP,1) != XM_CLS_IGNORE)
+		return -1;
+
+	return 0;
+}
+
+/*a bad directive is reported, never taken as a rule*/
+static int error_check(xm_pool_t *mp){
+
+	static const char *bad[] = {
+		"ClassifyTcp SA maybe\n",
+		"ClassifyTcp SX success\n",
+		"ClassifyIcmp 300 * filtered\n",
+		"ClassifyIcmp 3 x filtered\n",
+		"ClassifyDefault never\n",
+		NULL
+	};
+	const char **b;
+	const char *err;
+
+	for(b = bad;*b;b++){
+
+		err = NULL;
+
+		if(cls_load(mp,*b,&err) == NULL||err == NULL){
+
+			fprintf(stderr,"classify: '%.*s' accepted\n",(int)strlen(*b)-1,*b);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+const xm_bench_case_t xm_bench_classify_cases[] = {
+
+	XM_BENCH_CASE("classify/tcp",0,cls_setup,tcp_run,NULL),
+	XM_BENCH_CASE("classify/mixed",0,cls_setup,mixed_run,NULL),
+	XM_BENCH_CHECK("classify/table",table_check),
+	XM_BENCH_CHECK("classify/errors",error_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,219 @@
+/*
+ *
+ *      Filename: bench_cpu.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 12:31:45
+ * Last Modified: 2026-10-18 12:31:45
+ */
+
+#include "xm_bench.h"
+#include "xm_cpu.h"
+#include "xm_utf8.h"
+#include "xm_slice.h"
+#include "xm_util.h"
+
+#define CPU_LEN 65536
+
+typedef struct {
+
+	xm_pool_t *pool;
+	size_t len;
+	unsigned char buf[CPU_LEN+1];
+} cpu_ctx_t;
+
+/*mostly ascii with a euro sign, a quote, '&' and '=' now and then*/
+static void cpu_fill(unsigned char *buf,size_t len,uint64_t *seed){
+
+	static const char *frag[] = {"\xe2\x82\xac","\"","&","=","\t","\xc3\xa9"};
+	size_t i = 0,l;
+	uint32_t r;
+
+	while(i<len){
+
+		r = xm_bench_rand(seed);
+
+		if(r%23 == 0){
+
+			l = strlen(frag[r%6]);
+			if(l>len-i)
+				break;
+
+			memcpy(buf+i,frag[r%6],l);
+			i += l;
+		}
+		else{
+
+			buf[i++] = 'a'+r%26;
+		}
+	}
+
+	while(i<len)
+		buf[i++] = 'x';
+
+	buf[len] = '\0';
+}
+
+/*NULL when the cpu does not reach the level, the case is not run*/
+static void *cpu_setup(xm_pool_t *mp,int level){
+
+	cpu_ctx_t *cc;
+	uint64_t seed = 3;
+
+	if(level>xm_cpu_level_detected())
+		return NULL;
+
+	cc = (cpu_ctx_t*)xm_pcalloc(mp,sizeof(*cc));
+	cc->pool = xm_pool_create(16384);
+	cc->len = CPU_LEN;
+	cpu_fill(cc->buf,cc->len,&seed);
+
+	xm_cpu_level_set(level);
+
+	return cc;
+}
+
+static void cpu_teardown(void *ctx){
+
+	xm_pool_destroy(((cpu_ctx_t*)ctx)->pool);
+	xm_cpu_level_set(XM_CPU_LEVELS);
+}
+
+#define CPU_SETUP(name,level) \
+	static void *name(xm_pool_t *mp){ return cpu_setup(mp,level); }
+
+CPU_SETUP(scalar_setup,XM_CPU_SCALAR)
+CPU_SETUP(sse2_setup,XM_CPU_SSE2)
+CPU_SETUP(ssse3_setup,XM_CPU_SSSE3)
+CPU_SETUP(sse42_setup,XM_CPU_SSE42)
+CPU_SETUP(avx2_setup,XM_CPU_AVX2)
+CPU_SETUP(avx512_setup,XM_CPU_AVX512)
+
+static void utf8_valid_run(void *ctx,uint64_t iters){
+
+	cpu_ctx_t *cc = (cpu_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++)
+		xm_bench_use((void*)(long)xm_utf8_valid(cc->buf,cc->len));
+}
+
+static void ascii_prefix_run(void *ctx,uint64_t iters){
+
+	cpu_ctx_t *cc = (cpu_ctx_t*)ctx;
+	uint64_t i;
+	size_t j;
+
+	for(i = 0;i<iters;i++){
+
+		for(j = 0;j<cc->len;j++)
+			j += xm_utf8_ascii_prefix(cc->buf+j,cc->len-j);
+	}
+}
+
+static void find_any_run(void *ctx,uint64_t iters){
+
+	cpu_ctx_t *cc = (cpu_ctx_t*)ctx;
+	xm_byteset_t set;
+	xm_str_t rest,tok;
+	uint64_t i;
+
+	xm_byteset_init(&set,"&=");
+
+	for(i = 0;i<iters;i++){
+
+		xm_str_set(&rest,cc->buf,cc->len);
+		while(xm_str_next_token(&rest,&set,&tok))
+			xm_bench_use(tok.data);
+	}
+}
+
+static void log_escape_run(void *ctx,uint64_t iters){
+
+	cpu_ctx_t *cc = (cpu_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_bench_use(xm_log_escape_ex(cc->pool,(const char*)cc->buf,cc->len));
+		xm_pool_reset(cc->pool);
+	}
+}
+
+/*every level the cpu has gives what the scalar code gives*/
+static int kernels_check(xm_pool_t *mp){
+
+	unsigned char buf[4096+1];
+	xm_byteset_t set;
+	xm_str_t s;
+	uint64_t seed;
+	size_t n,pos;
+	const char *esc;
+	char *want_esc;
+	int it,level,valid,rv = 0;
+	ssize_t any;
+
+	xm_byteset_init(&set,"&=\"");
+
+	for(it = 0;it<3000&&rv == 0;it++){
+
+		seed = (uint64_t)it*7919+1;
+		n = xm_bench_rand(&seed)%(it%10?200:4096);
+		cpu_fill(buf,n,&seed);
+
+		/*break a sequence now and then*/
+		if(n&&it%3 == 0)
+			buf[xm_bench_rand(&seed)%n] = (unsigned char)(0x80|xm_bench_rand(&seed));
+
+		pos = n?xm_bench_rand(&seed)%n:0;
+
+		xm_cpu_level_set(XM_CPU_SCALAR);
+
+		valid = xm_utf8_valid(buf,n);
+		xm_str_set(&s,buf+pos,n-pos);
+		any = xm_str_find_any(&s,&set);
+		want_esc = xm_pstrdup(mp,xm_log_escape_ex(mp,(const char*)buf,n));
+
+		for(level = XM_CPU_SSE2;level<=xm_cpu_level_detected();level++){
+
+			xm_cpu_level_set(level);
+
+			esc = xm_log_escape_ex(mp,(const char*)buf,n);
+
+			if(xm_utf8_valid(buf,n) != valid||xm_str_find_any(&s,&set) != any||
+				xm_utf8_ascii_prefix(buf+pos,n-pos) != (pos<n?strspn((const char*)buf+pos,
+					"abcdefghijklmnopqrstuvwxyz\"&=\tx"):0)||
+				esc == NULL||strcmp(esc,want_esc)){
+
+				fprintf(stderr,"cpu: %s differs from scalar at iteration %d\n",xm_cpu_level_name(level),it);
+				rv = -1;
+				break;
+			}
+		}
+
+		xm_pool_reset(mp);
+	}
+
+	xm_cpu_level_set(XM_CPU_LEVELS);
+
+	return rv;
+}
+
+const xm_bench_case_t xm_bench_cpu_cases[] = {
+
+	XM_BENCH_CASE("cpu/utf8_valid_64k_scalar",CPU_LEN,scalar_setup,utf8_valid_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/utf8_valid_64k_ssse3",CPU_LEN,ssse3_setup,utf8_valid_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/utf8_valid_64k_avx2",CPU_LEN,avx2_setup,utf8_valid_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/ascii_prefix_64k_sse2",CPU_LEN,sse2_setup,ascii_prefix_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/ascii_prefix_64k_avx2",CPU_LEN,avx2_setup,ascii_prefix_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/ascii_prefix_64k_avx512",CPU_LEN,avx512_setup,ascii_prefix_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/find_any_64k_scalar",CPU_LEN,scalar_setup,find_any_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/find_any_64k_sse2",CPU_LEN,sse2_setup,find_any_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/find_any_64k_sse4.2",CPU_LEN,sse42_setup,find_any_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/find_any_64k_avx2",CPU_LEN,avx2_setup,find_any_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/log_escape_64k_sse2",CPU_LEN,sse2_setup,log_escape_run,cpu_teardown),
+	XM_BENCH_CASE("cpu/log_escape_64k_avx2",CPU_LEN,avx2_setup,log_escape_run,cpu_teardown),
+	XM_BENCH_CHECK("cpu/kernels_agree",kernels_check),
+	XM_BENCH_END
+};
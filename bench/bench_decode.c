@@ -0,0 +1,337 @@
+/*
+ *
+ *      Filename: bench_decode.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:12:09
+ * Last Modified: 2026-10-18 23:12:09
+ */
+
+#include "xm_bench.h"
+#include "xm_util.h"
+#include "xm_utf8.h"
+
+#define DECODE_LEN 4096
+#define DECODE_NFRAG 10
+
+/*padding past XM_DECODE_STREAM_HOLD, a numeric reference may carry any*/
+#define DECODE_ZEROS "00000000000000000000000000000000000000000000000000000000000000000000000000000000"
+
+/*per decoder, the escapes it handles, broken ones and plain text*/
+static const char *decode_frag[6][DECODE_NFRAG] = {
+	{"%41","%4","%","+","%zz","abc","%u0041","%%41","b c","%7e"},
+	{"\\u0041","\\uff21","\\x41","\\101","\\477","\\n","\\","abc","\\\\","\\u00"},
+	{"\\41 ","\\0000ff21","\\ff21","\\a","\\\n","\\","xyz","\\123456 ","\\zz","\\4\t"},
+	{"\\x41","\\101","\\n","\\\\","\\q","\\","abc","\\x4","\\777","b"},
+	{"&lt;","&amp","&#65;","&#x"DECODE_ZEROS"41;","&notit;","&","&#","&nbsp","&CounterClockwiseContourIntegral;","&#"DECODE_ZEROS"60;"},
+	{"\xc3\xa9","\xe4\xb8\xad","\xf0\x9f\x98\x80","\xc0\xaf","\xed\xa0\x80","\xf5\x80\x80\x80","\x80\x80\x80\x80","\xff","\xe4\xb8","abc"}
+};
+
+typedef struct {
+
+	xm_pool_t *pool;
+	int type;
+	size_t len;
+	unsigned char in[DECODE_LEN+1];
+	unsigned char buf[XM_DECODE_STREAM_OUT_SIZE(DECODE_LEN)];
+} decode_ctx_t;
+
+/*mostly plain text, one escape every few words*/
+static size_t decode_gen(unsigned char *out,size_t max,int type,int density,uint64_t *seed){
+
+	static const char words[] = "the quick brown fox jumps over the lazy dog ";
+	const char *f;
+	size_t n = 0,l;
+
+	while(n<max){
+
+		if((int)(xm_bench_rand(seed)%100)<density){
+
+			f = decode_frag[type][xm_bench_rand(seed)%DECODE_NFRAG];
+			l = strlen(f);
+		}
+		else{
+
+			f = words+xm_bench_rand(seed)%(sizeof(words)-8);
+			l = 8;
+		}
+
+		if(l>max-n)
+			l = max-n;
+
+		memcpy(out+n,f,l);
+		n += l;
+	}
+
+	out[n] = '\0';
+
+	return n;
+}
+
+/*the one decoder that is not in place: s must have room for 4n*/
+static long utf8_u_whole(xm_pool_t *mp,unsigned char *s,long n,int *changed){
+
+	char *r = xm_utf8_unicode_escape(mp,s,n,changed);
+
+	if(r == NULL)
+		return -1;
+
+	n = (long)strlen(r);
+	memcpy(s,r,n+1);
+
+	return n;
+}
+
+static long decode_whole(xm_pool_t *mp,int type,unsigned char *s,long n,int *inv,int *changed){
+
+	*inv = *changed = 0;
+
+	switch(type){
+
+	case XM_DECODE_URL: return xm_urldecode_nonstrict_inplace_ex(s,n,inv,changed);
+	case XM_DECODE_JS: return xm_js_decode_nonstrict_inplace(s,n);
+	case XM_DECODE_CSS: return xm_css_decode_inplace(s,n);
+	case XM_DECODE_ANSI_C: return xm_ansi_c_sequences_decode_inplace(s,n);
+	case XM_DECODE_UTF8_U: return utf8_u_whole(mp,s,n,changed);
+	default: return n?xm_html_entities_decode_inplace(mp,s,n):0;
+	}
+}
+
+static void *decode_setup_type(xm_pool_t *mp,int type){
+
+	decode_ctx_t *dc = (decode_ctx_t*)xm_pcalloc(mp,sizeof(*dc));
+	uint64_t seed = 42;
+
+	dc->pool = xm_pool_create(16384);
+	dc->type = type;
+	dc->len = decode_gen(dc->in,DECODE_LEN,type,20,&seed);
+
+	return dc;
+}
+
+static void *url_setup(xm_pool_t *mp){ return decode_setup_type(mp,XM_DECODE_URL); }
+static void *js_setup(xm_pool_t *mp){ return decode_setup_type(mp,XM_DECODE_JS); }
+static void *css_setup(xm_pool_t *mp){ return decode_setup_type(mp,XM_DECODE_CSS); }
+static void *ansi_c_setup(xm_pool_t *mp){ return decode_setup_type(mp,XM_DECODE_ANSI_C); }
+static void *html_setup(xm_pool_t *mp){ return decode_setup_type(mp,XM_DECODE_HTML); }
+
+static void decode_teardown(void *ctx){
+
+	xm_pool_destroy(((decode_ctx_t*)ctx)->pool);
+}
+
+/*the copy every in-place case pays, to subtract*/
+static void memcpy_run(void *ctx,uint64_t iters){
+
+	decode_ctx_t *dc = (decode_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		memcpy(dc->buf,dc->in,dc->len+1);
+		xm_bench_use(dc->buf);
+	}
+}
+
+static void inplace_run(void *ctx,uint64_t iters){
+
+	decode_ctx_t *dc = (decode_ctx_t*)ctx;
+	uint64_t i;
+	int inv,changed;
+
+	for(i = 0;i<iters;i++){
+
+		memcpy(dc->buf,dc->in,dc->len+1);
+		decode_whole(dc->pool,dc->type,dc->buf,dc->len,&inv,&changed);
+		xm_bench_use(dc->buf);
+
+		if((i&63) == 63)
+			xm_pool_reset(dc->pool);
+	}
+}
+
+/*the same text fed in 512 byte chunks*/
+static void stream_run(void *ctx,uint64_t iters){
+
+	decode_ctx_t *dc = (decode_ctx_t*)ctx;
+	xm_decode_stream_t *ds;
+	uint64_t i;
+	size_t off,n;
+
+	for(i = 0;i<iters;i++){
+
+		ds = xm_decode_stream_create(dc->pool,dc->type);
+
+		for(off = 0;off<dc->len;off += n){
+
+			n = dc->len-off<512?dc->len-off:512;
+			xm_decode_stream_feed(ds,dc->in+off,n,dc->buf);
+		}
+
+		xm_decode_stream_finish(ds,dc->buf);
+		xm_bench_use(dc->buf);
+
+		if((i&63) == 63)
+			xm_pool_reset(dc->pool);
+	}
+}
+
+static void *escape_setup(xm_pool_t *mp){
+
+	decode_ctx_t *dc = (decode_ctx_t*)xm_pcalloc(mp,sizeof(*dc));
+	uint64_t seed = 7;
+	size_t i;
+
+	dc->pool = xm_pool_create(16384);
+	dc->len = decode_gen(dc->in,DECODE_LEN,XM_DECODE_URL,5,&seed);
+
+	/*a quote or control char now and then, the rest is clean*/
+	for(i = 0;i<dc->len;i += 97)
+		dc->in[i] = i%2?'"':'\t';
+
+	return dc;
+}
+
+static void log_escape_run(void *ctx,uint64_t iters){
+
+	decode_ctx_t *dc = (decode_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_bench_use(xm_log_escape_ex(dc->pool,(const char*)dc->in,dc->len));
+		xm_pool_reset(dc->pool);
+	}
+}
+
+static void log_escape_hex_run(void *ctx,uint64_t iters){
+
+	decode_ctx_t *dc = (decode_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_bench_use(xm_log_escape_hex(dc->pool,dc->in,dc->len));
+		xm_pool_reset(dc->pool);
+	}
+}
+
+/*a stream cut at random places must give what the whole-buffer decoder gives*/
+static int stream_check(xm_pool_t *mp){
+
+	unsigned char in[1024],whole[4*1024],out[XM_DECODE_STREAM_UTF8_OUT_SIZE(1024)];
+	unsigned char acc[4*1024+XM_DECODE_STREAM_HOLD];
+	xm_decode_stream_t *ds;
+	uint64_t seed = 11;
+	long wl,al,r;
+	size_t n,pos,c;
+	int it,type,inv,changed;
+
+	for(it = 0;it<100000;it++){
+
+		type = it%6;
+		n = decode_gen(in,xm_bench_rand(&seed)%200,type,60,&seed);
+
+		memcpy(whole,in,n+1);
+		wl = decode_whole(mp,type,whole,n,&inv,&changed);
+
+		ds = xm_decode_stream_create(mp,type);
+		al = 0;
+
+		for(pos = 0;pos<n;pos += c){
+
+			c = 1+xm_bench_rand(&seed)%(it%3?5:50);
+			if(c>n-pos)
+				c = n-pos;
+
+			r = xm_decode_stream_feed(ds,in+pos,c,out);
+			memcpy(acc+al,out,r);
+			al += r;
+		}
+
+		r = xm_decode_stream_finish(ds,out);
+		memcpy(acc+al,out,r);
+		al += r;
+
+		if(al != wl||memcmp(acc,whole,wl))
+			return -1;
+
+		if(type == XM_DECODE_URL&&(inv != ds->invalid_count||changed != ds->changed))
+			return -1;
+
+		if(type == XM_DECODE_UTF8_U&&changed != ds->changed)
+			return -1;
+
+		if(it%500 == 0)
+			xm_pool_reset(mp);
+	}
+
+	return 0;
+}
+
+/*the historic names first, HTML5 for the rest, all of it UTF-8*/
+static int html_check(xm_pool_t *mp){
+
+	static const char *cases[][2] = {
+		{"&lt;script","<script"},
+		{"&Lt;script","<script"},
+		{"&LT;&Gt;&gT","<>>"},
+		{"&QuOt;&AMP;&NbSp;","\"&\xc2\xa0"},
+		{"&gt1",">1"},
+		{"&ltscript","<script"},
+		{"&LTscript","<script"},
+		{"&ampfoo;","&foo;"},
+		{"&Ltx;","&Ltx;"},
+		{"&ltimes;","\xe2\x8b\x89"},
+		{"&notit;","\xc2\xacit;"},
+		{"&NotLess;","\xe2\x89\xae"},
+		{"&xyzzy;","&xyzzy;"},
+		{"&Cconint;","\xe2\x88\xb0"},
+		{"&eacute; &euro;","\xc3\xa9 \xe2\x82\xac"},
+		{"&#60;&#x3e;","<>"},
+		{"&#233;&#xE9;","\xc3\xa9\xc3\xa9"},
+		{"&#128;&#x9f;","\xe2\x82\xac\xc5\xb8"},
+		{"&#0;&#xd800;&#x110000;","\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbd"},
+		{"&#99999999999999999999;","\xef\xbf\xbd"},
+		{"&#x1F600;","\xf0\x9f\x98\x80"},
+		{"&#0000000000000000066;","B"},
+		{"&;&#;&#x;","&;&#;&#x;"}
+	};
+	unsigned char buf[64];
+	size_t i,wl;
+	int n;
+
+	for(i = 0;i<sizeof(cases)/sizeof(cases[0]);i++){
+
+		n = (int)strlen(cases[i][0]);
+		memcpy(buf,cases[i][0],n+1);
+		n = xm_html_entities_decode_inplace(mp,buf,n);
+		wl = strlen(cases[i][1]);
+
+		if((size_t)n != wl||memcmp(buf,cases[i][1],wl)){
+
+			fprintf(stderr,"decode: html '%s' gave '%.*s'\n",cases[i][0],n,buf);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+const xm_bench_case_t xm_bench_decode_cases[] = {
+
+	XM_BENCH_CASE("decode/memcpy_4k",DECODE_LEN,url_setup,memcpy_run,decode_teardown),
+	XM_BENCH_CASE("decode/url_4k",DECODE_LEN,url_setup,inplace_run,decode_teardown),
+	XM_BENCH_CASE("decode/js_4k",DECODE_LEN,js_setup,inplace_run,decode_teardown),
+	XM_BENCH_CASE("decode/css_4k",DECODE_LEN,css_setup,inplace_run,decode_teardown),
+	XM_BENCH_CASE("decode/ansi_c_4k",DECODE_LEN,ansi_c_setup,inplace_run,decode_teardown),
+	XM_BENCH_CASE("decode/html_4k",DECODE_LEN,html_setup,inplace_run,decode_teardown),
+	XM_BENCH_CASE("decode/stream_url_4k",DECODE_LEN,url_setup,stream_run,decode_teardown),
+	XM_BENCH_CASE("decode/stream_html_4k",DECODE_LEN,html_setup,stream_run,decode_teardown),
+	XM_BENCH_CASE("decode/log_escape_4k",DECODE_LEN,escape_setup,log_escape_run,decode_teardown),
+	XM_BENCH_CASE("decode/log_escape_hex_4k",DECODE_LEN,escape_setup,log_escape_hex_run,decode_teardown),
+	XM_BENCH_CHECK("decode/stream_vs_whole",stream_check),
+	XM_BENCH_CHECK("decode/html_names",html_check),
+	XM_BENCH_END
+};
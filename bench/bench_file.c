@@ -0,0 +1,135 @@
+/*
+ *
+ *      Filename: bench_file.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:36:02
+ * Last Modified: 2026-10-18 23:36:02
+ */
+
+#include "xm_bench.h"
+#include "xm_file.h"
+
+#define FILE_BLOCK 4096
+/*rewind after 1MB so the file stays in the page cache*/
+#define FILE_BLOCKS 256
+
+typedef struct {
+
+	xm_pool_t *pool;
+	xm_file_t *f;
+	int32_t flags;
+	char name[64];
+	char buf[FILE_BLOCK];
+} file_ctx_t;
+
+/*xm_file_seek has no unix implementation, so rewind by reopening*/
+static int file_reopen(file_ctx_t *fc,int32_t extra){
+
+	if(fc->f){
+
+		xm_file_close(fc->f);
+		xm_pool_reset(fc->pool);
+	}
+
+	return xm_file_open(&fc->f,fc->name,XM_FOPEN_READ|XM_FOPEN_WRITE|fc->flags|extra,
+		XM_FPROT_OS_DEFAULT,fc->pool);
+}
+
+static void *file_setup(xm_pool_t *mp,int32_t flags){
+
+	file_ctx_t *fc = (file_ctx_t*)xm_pcalloc(mp,sizeof(*fc));
+	size_t n;
+	int i;
+
+	fc->pool = xm_pool_create(16384);
+	fc->flags = flags;
+	snprintf(fc->name,sizeof(fc->name),"/tmp/xm_bench.%d",(int)getpid());
+	memset(fc->buf,'x',sizeof(fc->buf));
+
+	if(file_reopen(fc,XM_FOPEN_CREATE|XM_FOPEN_TRUNCATE)){
+
+		xm_pool_destroy(fc->pool);
+		return NULL;
+	}
+
+	/*the read case needs a whole cycle of blocks on disk*/
+	for(i = 0;i<FILE_BLOCKS;i++){
+
+		n = FILE_BLOCK;
+		xm_file_write(fc->f,fc->buf,&n);
+	}
+
+	return fc;
+}
+
+static void *buffered_setup(xm_pool_t *mp){
+
+	return file_setup(mp,XM_FOPEN_BUFFERED);
+}
+
+static void *unbuffered_setup(xm_pool_t *mp){
+
+	return file_setup(mp,0);
+}
+
+static void file_teardown(void *ctx){
+
+	file_ctx_t *fc = (file_ctx_t*)ctx;
+
+	xm_file_close(fc->f);
+	xm_file_remove(fc->name,fc->pool);
+	xm_pool_destroy(fc->pool);
+}
+
+static void file_rewind(file_ctx_t *fc,uint64_t i){
+
+	if(i%FILE_BLOCKS == 0)
+		file_reopen(fc,0);
+}
+
+/*small appends, as a log does*/
+static void write_4k_run(void *ctx,uint64_t iters){
+
+	file_ctx_t *fc = (file_ctx_t*)ctx;
+	uint64_t i;
+	size_t n;
+	int j;
+
+	for(i = 0;i<iters;i++){
+
+		file_rewind(fc,i);
+
+		for(j = 0;j<FILE_BLOCK/128;j++){
+
+			n = 128;
+			xm_file_write(fc->f,fc->buf,&n);
+		}
+	}
+}
+
+static void read_4k_run(void *ctx,uint64_t iters){
+
+	file_ctx_t *fc = (file_ctx_t*)ctx;
+	uint64_t i;
+	size_t n;
+
+	for(i = 0;i<iters;i++){
+
+		file_rewind(fc,i);
+
+		n = FILE_BLOCK;
+		xm_file_read(fc->f,fc->buf,&n);
+		xm_bench_use(fc->buf);
+	}
+}
+
+const xm_bench_case_t xm_bench_file_cases[] = {
+
+	XM_BENCH_CASE("file/write_4k_buffered",FILE_BLOCK,buffered_setup,write_4k_run,file_teardown),
+	XM_BENCH_CASE("file/write_4k",FILE_BLOCK,unbuffered_setup,write_4k_run,file_teardown),
+	XM_BENCH_CASE("file/read_4k_buffered",FILE_BLOCK,buffered_setup,read_4k_run,file_teardown),
+	XM_BENCH_CASE("file/read_4k",FILE_BLOCK,unbuffered_setup,read_4k_run,file_teardown),
+	XM_BENCH_END
+};
@@ -0,0 +1,353 @@
+/*
+ *
+ *      Filename: bench_fmt.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:25:47
+ * Last Modified: 2026-10-18 23:25:47
+ */
+
+#include <float.h>
+#include <math.h>
+#include "xm_bench.h"
+#include "xm_string.h"
+#include "xm_fmt.h"
+#include "xm_numfmt.h"
+
+#define LOG_LINE "[%s][%d][%s][%s] %s\n"
+#define NUMBERS "%lu %d %x %ld %u %c"
+
+XM_FMT_DEFINE(bench_log_fmt,LOG_LINE);
+XM_FMT_DEFINE(bench_num_fmt,NUMBERS);
+
+static char fmt_buf[512];
+
+static void snprintf_log_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_snprintf(fmt_buf,sizeof(fmt_buf),LOG_LINE,"2026-10-18 23:25:47",(int)i,
+			"info","xm_bench.c","request from 203.0.113.7 took too long");
+		xm_bench_use(fmt_buf);
+	}
+}
+
+static void fmt_log_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_fmt_snprintf(&bench_log_fmt,fmt_buf,sizeof(fmt_buf),"2026-10-18 23:25:47",(int)i,
+			"info","xm_bench.c","request from 203.0.113.7 took too long");
+		xm_bench_use(fmt_buf);
+	}
+}
+
+static void snprintf_num_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_snprintf(fmt_buf,sizeof(fmt_buf),NUMBERS,
+			(unsigned long)i*7919,(int)i,(unsigned)i,(long)i-1000000,(unsigned)i>>3,'x');
+		xm_bench_use(fmt_buf);
+	}
+}
+
+static void fmt_num_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_fmt_snprintf(&bench_num_fmt,fmt_buf,sizeof(fmt_buf),
+			(unsigned long)i*7919,(int)i,(unsigned)i,(long)i-1000000,(unsigned)i>>3,'x');
+		xm_bench_use(fmt_buf);
+	}
+}
+
+static void dtoa_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_dtoa((double)i*0.1+1e-7,fmt_buf);
+		xm_bench_use(fmt_buf);
+	}
+}
+
+/*compiled formats against xm_snprintf, every length of buffer*/
+static int fmt_check(xm_pool_t *mp){
+
+	static const char *strs[] = {"","a","hello world",NULL,"%s%d","\xff\x01"};
+	xm_fmt_t f1 = XM_FMT_INIT("%s=%d;%u|%x%X %lu %ld %lx %c%%");
+	xm_fmt_t f2 = XM_FMT_INIT("plain text");
+	xm_fmt_t f3 = XM_FMT_INIT("%5d fallback %s");
+	char want[256],got[256];
+	uint64_t seed = 3;
+	const char *s;
+	long l;
+	int it,d,rw,rg;
+	size_t len;
+
+	mp = mp;
+
+	for(it = 0;it<200000;it++){
+
+		s = strs[xm_bench_rand(&seed)%6];
+		d = (int)xm_bench_rand(&seed)-(1<<30);
+		l = (long)(((uint64_t)xm_bench_rand(&seed)<<32)|xm_bench_rand(&seed));
+		len = xm_bench_rand(&seed)%80;
+
+		memset(want,'#',sizeof(want));
+		memset(got,'#',sizeof(got));
+
+		switch(it%3){
+
+		case 0:
+			rw = xm_snprintf(want,len,"%s=%d;%u|%x%X %lu %ld %lx %c%%",s,d,(unsigned)d,
+				(unsigned)d,(unsigned)l,(unsigned long)l,l,(unsigned long)l,'a'+it%26);
+			rg = xm_fmt_snprintf(&f1,got,len,s,d,(unsigned)d,
+				(unsigned)d,(unsigned)l,(unsigned long)l,l,(unsigned long)l,'a'+it%26);
+			break;
+
+		case 1:
+			rw = xm_snprintf(want,len,"plain text");
+			rg = xm_fmt_snprintf(&f2,got,len);
+			break;
+
+		default:
+			rw = xm_snprintf(want,len,"%5d fallback %s",d,s);
+			rg = xm_fmt_snprintf(&f3,got,len,d,s);
+			break;
+		}
+
+		if(rw != rg||memcmp(want,got,sizeof(want)))
+			return -1;
+	}
+
+	return 0;
+}
+
+/*strings from a few bytes to well past pool->max, kept intact by later allocations*/
+static int psprintf_check(xm_pool_t *mp){
+
+	static const size_t lens[] = {0,1,63,64,100,1000,4000,4095,4096,5000,10000,40000};
+	const size_t n = sizeof(lens)/sizeof(lens[0]);
+	xm_pool_t *pool;
+	char *src,*want,*got[sizeof(lens)/sizeof(lens[0])];
+	size_t i,j;
+	int rv = 0;
+
+	mp = mp;
+
+	src = (char*)malloc(lens[n-1]+1);
+	want = (char*)malloc(lens[n-1]+32);
+	pool = xm_pool_create(4096);
+
+	if(src == NULL||want == NULL||pool == NULL){
+
+		rv = -1;
+		goto out;
+	}
+
+	for(i = 0;i<lens[n-1];i++)
+		src[i] = 'A'+i%26;
+
+	for(i = 0;i<n;i++){
+
+		got[i] = xm_psprintf(pool,"%.*s|%d",(int)lens[i],src,(int)i);
+
+		/*anything allocated next must land beside the string*/
+		memset(xm_palloc(pool,100),'#',100);
+		memset(xm_palloc(pool,pool->max+1),'#',pool->max+1);
+	}
+
+	for(i = 0;i<n&&rv == 0;i++){
+
+		j = snprintf(want,lens[n-1]+32,"%.*s|%d",(int)lens[i],src,(int)i);
+
+		if(got[i] == NULL||strlen(got[i]) != j||memcmp(got[i],want,j+1)){
+
+			fprintf(stderr,"fmt: psprintf of %lu bytes gave %lu\n",(unsigned long)j,
+				got[i]?(unsigned long)strlen(got[i]):0UL);
+			rv = -1;
+		}
+	}
+
+out:
+	if(pool)
+		xm_pool_destroy(pool);
+
+	free(src);
+	free(want);
+
+	return rv;
+}
+
+/*the significant digits of a number's text, no sign, point, exponent or padding zeros*/
+static size_t dtoa_digits(const char *s,char *out){
+
+	size_t n = 0;
+
+	for(;*s&&*s != 'e';s++){
+
+		if(*s>='0'&&*s<='9'&&(n||*s != '0'))
+			out[n++] = *s;
+	}
+
+	while(n&&out[n-1] == '0')
+		n--;
+
+	out[n] = '\0';
+
+	return n;
+}
+
+/*
+ * Reads back as exactly v, and has the digits of the shortest %.*e that
+ * does: the closest of the fewest digits.
+ */
+static int dtoa_one(double v){
+
+	char got[XM_DTOA_BUF_SIZE],want[40],gd[24],wd[24];
+	double r;
+	int p;
+
+	xm_dtoa(v,got);
+	r = strtod(got,NULL);
+
+	if(memcmp(&r,&v,sizeof(v))){
+
+		fprintf(stderr,"fmt: xm_dtoa(%.17g) gave '%s'\n",v,got);
+		return -1;
+	}
+
+	for(p = 1;p<=17;p++){
+
+		snprintf(want,sizeof(want),"%.*e",p-1,v);
+		r = strtod(want,NULL);
+		if(memcmp(&r,&v,sizeof(v)) == 0)
+			break;
+	}
+
+	dtoa_digits(got,gd);
+	dtoa_digits(want,wd);
+
+	if(strcmp(gd,wd)){
+
+		fprintf(stderr,"fmt: xm_dtoa(%.17g) gave '%s', the shortest is '%s'\n",v,got,want);
+		return -1;
+	}
+
+	/*and %pD is the same text*/
+	xm_snprintf(want,sizeof(want),"%pD",&v);
+
+	return strcmp(want,got)?-1:0;
+}
+
+static int dtoa_check(xm_pool_t *mp){
+
+	static const struct {
+		double v;
+		const char *s;
+	} fixed[] = {
+		{0.0,"0"},
+		{-0.0,"-0"},
+		{1.0,"1"},
+		{0.1,"0.1"},
+		{-1.5,"-1.5"},
+		{1e-6,"0.000001"},
+		{5e-7,"5e-7"},
+		{1e20,"100000000000000000000"},
+		{1e21,"1e+21"},
+		{123456789012345680000.0,"123456789012345680000"},
+		{DBL_MAX,"1.7976931348623157e+308"},
+		{-DBL_MAX,"-1.7976931348623157e+308"},
+		{DBL_MIN,"2.2250738585072014e-308"},
+		{4.9406564584124654e-324,"5e-324"},
+		{2.2250738585072009e-308,"2.225073858507201e-308"},
+		{HUGE_VAL,"inf"},
+		{-HUGE_VAL,"-inf"},
+		{NAN,"nan"},
+		{-NAN,"nan"},
+	};
+	char buf[XM_DTOA_BUF_SIZE];
+	uint64_t seed = 17,bits;
+	double v;
+	size_t i;
+	int it;
+
+	mp = mp;
+
+	for(i = 0;i<sizeof(fixed)/sizeof(fixed[0]);i++){
+
+		if(xm_dtoa(fixed[i].v,buf) != strlen(fixed[i].s)||strcmp(buf,fixed[i].s)){
+
+			fprintf(stderr,"fmt: xm_dtoa gave '%s', want '%s'\n",buf,fixed[i].s);
+			return -1;
+		}
+	}
+
+	for(it = 0;it<200000;it++){
+
+		bits = ((uint64_t)xm_bench_rand(&seed)<<32)|xm_bench_rand(&seed);
+
+		/*every bit pattern, then short decimals and subnormals, where the ties are*/
+		switch(it%4){
+
+		case 0:
+		case 1:
+			memcpy(&v,&bits,sizeof(v));
+			break;
+
+		case 2:
+			v = (double)(int64_t)(bits%2000001-1000000)/(double)(1ULL<<(bits>>58));
+			v = v/1000;
+			break;
+
+		default:
+			bits &= (1ULL<<52)-1;
+			bits |= (uint64_t)(it&0x80000000);
+			memcpy(&v,&bits,sizeof(v));
+			break;
+		}
+
+		if(isnan(v)||isinf(v))
+			continue;
+
+		if(dtoa_one(v))
+			return -1;
+	}
+
+	return 0;
+}
+
+const xm_bench_case_t xm_bench_fmt_cases[] = {
+
+	XM_BENCH_CASE("fmt/snprintf_log_line",0,NULL,snprintf_log_run,NULL),
+	XM_BENCH_CASE("fmt/fmt_log_line",0,NULL,fmt_log_run,NULL),
+	XM_BENCH_CASE("fmt/snprintf_numbers",0,NULL,snprintf_num_run,NULL),
+	XM_BENCH_CASE("fmt/fmt_numbers",0,NULL,fmt_num_run,NULL),
+	XM_BENCH_CASE("fmt/dtoa",0,NULL,dtoa_run,NULL),
+	XM_BENCH_CHECK("fmt/fmt_vs_snprintf",fmt_check),
+	XM_BENCH_CHECK("fmt/psprintf",psprintf_check),
+	XM_BENCH_CHECK("fmt/dtoa_roundtrip",dtoa_check),
+	XM_BENCH_END
+};
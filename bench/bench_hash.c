@@ -0,0 +1,105 @@
+/*
+ *
+ *      Filename: bench_hash.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:51:26
+ * Last Modified: 2026-10-18 23:51:26
+ */
+
+#include "xm_bench.h"
+#include "xm_jhash.h"
+
+static unsigned char hash_buf[1024+16] __attribute__((aligned(16)));
+static volatile uint32_t hash_sink;
+
+static void *hash_setup(xm_pool_t *mp){
+
+	uint64_t seed = 5;
+	size_t i;
+
+	for(i = 0;i<sizeof(hash_buf);i++)
+		hash_buf[i] = (unsigned char)xm_bench_rand(&seed);
+
+	return mp;
+}
+
+/*vary the key a little per call so nothing is hoisted out of the loop*/
+static inline void jhash_loop(uint64_t iters,uint32_t len){
+
+	uint32_t h = 0;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++)
+		h = xm_jhash(hash_buf+(i&15),len,h);
+
+	hash_sink = h;
+}
+
+static void jhash_16_run(void *ctx,uint64_t iters){ ctx = ctx; jhash_loop(iters,16); }
+static void jhash_64_run(void *ctx,uint64_t iters){ ctx = ctx; jhash_loop(iters,64); }
+static void jhash_1k_run(void *ctx,uint64_t iters){ ctx = ctx; jhash_loop(iters,1024); }
+
+static void jhash2_16_run(void *ctx,uint64_t iters){
+
+	const uint32_t *k = (const uint32_t*)hash_buf;
+	uint32_t h = 0;
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++)
+		h = xm_jhash2(k+(i&3),4,h);
+
+	hash_sink = h;
+}
+
+/*a flow key, the common case in the scanner*/
+static void jhash_3words_run(void *ctx,uint64_t iters){
+
+	uint32_t h = 0;
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++)
+		h = xm_jhash_3words((uint32_t)i,0xc0a80001,(uint32_t)(i>>7)|443,h);
+
+	hash_sink = h;
+}
+
+/*the byte version must not care where the key sits*/
+static int jhash_check(xm_pool_t *mp){
+
+	unsigned char copy[1024+16];
+	uint32_t len,h;
+	int off;
+
+	hash_setup(mp);
+
+	for(len = 0;len<=1024;len++){
+
+		h = xm_jhash(hash_buf,len,JHASH_INITVAL);
+
+		for(off = 1;off<16;off++){
+
+			memcpy(copy+off,hash_buf,len);
+			if(xm_jhash(copy+off,len,JHASH_INITVAL) != h)
+				return -1;
+		}
+	}
+
+	return 0;
+}
+
+const xm_bench_case_t xm_bench_hash_cases[] = {
+
+	XM_BENCH_CASE("hash/jhash_16",16,hash_setup,jhash_16_run,NULL),
+	XM_BENCH_CASE("hash/jhash_64",64,hash_setup,jhash_64_run,NULL),
+	XM_BENCH_CASE("hash/jhash_1k",1024,hash_setup,jhash_1k_run,NULL),
+	XM_BENCH_CASE("hash/jhash2_16",16,hash_setup,jhash2_16_run,NULL),
+	XM_BENCH_CASE("hash/jhash_3words",12,NULL,jhash_3words_run,NULL),
+	XM_BENCH_CHECK("hash/jhash_unaligned",jhash_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,144 @@
+/*
+ *
+ *      Filename: bench_lock.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:44:31
+ * Last Modified: 2026-10-18 23:44:31
+ */
+
+#include "xm_bench.h"
+#include "xm_spinlock.h"
+#include "xm_rwlock.h"
+#include "xm_atomic.h"
+
+typedef struct {
+
+	xm_spinlock_t sl;
+	xm_rwlock_t rwl;
+	xm_atomic32_t cnt;
+	pthread_mutex_t mtx;
+
+	/*the other side of the contended case*/
+	pthread_t peer;
+	volatile int stop;
+	uint64_t shared;
+} lock_ctx_t;
+
+static void *lock_setup(xm_pool_t *mp){
+
+	lock_ctx_t *lc = (lock_ctx_t*)xm_pcalloc(mp,sizeof(*lc));
+
+	xm_spinlock_init(&lc->sl);
+	xm_rwlock_init(&lc->rwl);
+	xm_atomic32_init(&lc->cnt);
+	pthread_mutex_init(&lc->mtx,NULL);
+
+	return lc;
+}
+
+static void *peer_loop(void *arg){
+
+	lock_ctx_t *lc = (lock_ctx_t*)arg;
+
+	while(!lc->stop){
+
+		xm_spinlock_lock(&lc->sl);
+		lc->shared++;
+		xm_spinlock_unlock(&lc->sl);
+	}
+
+	return NULL;
+}
+
+static void *contended_setup(xm_pool_t *mp){
+
+	lock_ctx_t *lc = (lock_ctx_t*)lock_setup(mp);
+
+	if(pthread_create(&lc->peer,NULL,peer_loop,lc))
+		return NULL;
+
+	return lc;
+}
+
+static void contended_teardown(void *ctx){
+
+	lock_ctx_t *lc = (lock_ctx_t*)ctx;
+
+	lc->stop = 1;
+	pthread_join(lc->peer,NULL);
+}
+
+static void spinlock_run(void *ctx,uint64_t iters){
+
+	lock_ctx_t *lc = (lock_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_spinlock_lock(&lc->sl);
+		lc->shared++;
+		xm_spinlock_unlock(&lc->sl);
+	}
+}
+
+static void rwlock_read_run(void *ctx,uint64_t iters){
+
+	lock_ctx_t *lc = (lock_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_rwlock_read_lock(&lc->rwl);
+		xm_bench_use(&lc->shared);
+		xm_rwlock_read_unlock(&lc->rwl);
+	}
+}
+
+static void rwlock_write_run(void *ctx,uint64_t iters){
+
+	lock_ctx_t *lc = (lock_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_rwlock_write_lock(&lc->rwl);
+		lc->shared++;
+		xm_rwlock_write_unlock(&lc->rwl);
+	}
+}
+
+static void atomic_inc_run(void *ctx,uint64_t iters){
+
+	lock_ctx_t *lc = (lock_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++)
+		xm_atomic32_inc(&lc->cnt);
+}
+
+/*libc for reference*/
+static void mutex_run(void *ctx,uint64_t iters){
+
+	lock_ctx_t *lc = (lock_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		pthread_mutex_lock(&lc->mtx);
+		lc->shared++;
+		pthread_mutex_unlock(&lc->mtx);
+	}
+}
+
+const xm_bench_case_t xm_bench_lock_cases[] = {
+
+	XM_BENCH_CASE("lock/spinlock",0,lock_setup,spinlock_run,NULL),
+	XM_BENCH_CASE("lock/spinlock_contended",0,contended_setup,spinlock_run,contended_teardown),
+	XM_BENCH_CASE("lock/rwlock_read",0,lock_setup,rwlock_read_run,NULL),
+	XM_BENCH_CASE("lock/rwlock_write",0,lock_setup,rwlock_write_run,NULL),
+	XM_BENCH_CASE("lock/atomic32_inc",0,lock_setup,atomic_inc_run,NULL),
+	XM_BENCH_CASE("lock/pthread_mutex",0,lock_setup,mutex_run,NULL),
+	XM_BENCH_END
+};
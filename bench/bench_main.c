@@ -0,0 +1,258 @@
+/*
+ *
+ *      Filename: bench_main.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 22:40:12
+ * Last Modified: 2026-10-18 22:40:12
+ */
+
+#include "xm_bench.h"
+#include "xm_getopt.h"
+#include "xm_errno.h"
+#include "xm_prof.h"
+
+static const xm_bench_suite_t bench_suites[] = {
+
+	{"pool",xm_bench_pool_cases},
+	{"table",xm_bench_table_cases},
+	{"decode",xm_bench_decode_cases},
+	{"fmt",xm_bench_fmt_cases},
+	{"file",xm_bench_file_cases},
+	{"lock",xm_bench_lock_cases},
+	{"hash",xm_bench_hash_cases},
+	{"time",xm_bench_time_cases},
+	{"string",xm_bench_string_cases},
+	{"trace",xm_bench_trace_cases},
+	{"cpu",xm_bench_cpu_cases},
+	{"prof",xm_bench_prof_cases},
+	{"shm",xm_bench_shm_cases},
+	{"stats",xm_bench_stats_cases},
+	{"xsk",xm_bench_xsk_cases},
+	{"classify",xm_bench_classify_cases},
+	{"manifest",xm_bench_manifest_cases},
+	{"ratectl",xm_bench_ratectl_cases},
+	{"srcpool",xm_bench_srcpool_cases},
+	{NULL,NULL}
+};
+
+static const xm_getopt_option_t bench_opts[] = {
+
+	{"filter",'f',1,"run the cases whose name starts with this"},
+	{"reps",'r',1,"samples per case (30)"},
+	{"warmup",'w',1,"warmup per case in ms (50)"},
+	{"sample",'s',1,"length of one sample in ms (2)"},
+	{"json",'j',1,"write the results to this file"},
+	{"compare",'c',1,"compare the medians with this --json baseline"},
+	{"threshold",'t',1,"percent slower that counts as a regression (5)"},
+	{"check",'k',0,"run the differential checks instead of timing"},
+	{"no-counters",'n',0,"do not open the hardware counters"},
+	{"profile",'p',1,"write folded stacks of the timed runs to this file"},
+	{"list",'l',0,"list the cases"},
+	{"help",'h',0,"this text"},
+	{NULL,0,0,NULL}
+};
+
+static void usage(const char *prog){
+
+	const xm_getopt_option_t *o;
+
+	fprintf(stderr,"usage: %s [options]\n",prog);
+
+	for(o = bench_opts;o->name;o++)
+		fprintf(stderr,"  -%c, --%-12s %s\n",o->optch,o->name,o->description);
+}
+
+static char *load_file(const char *fname){
+
+	FILE *fp = fopen(fname,"r");
+	char *text;
+	long n;
+
+	if(fp == NULL)
+		return NULL;
+
+	fseek(fp,0,SEEK_END);
+	n = ftell(fp);
+	fseek(fp,0,SEEK_SET);
+
+	text = (char*)malloc(n+1);
+	if(text&&fread(text,1,n,fp) == (size_t)n){
+
+		text[n] = '\0';
+		fclose(fp);
+		return text;
+	}
+
+	free(text);
+	fclose(fp);
+
+	return NULL;
+}
+
+static int run_checks(const xm_bench_conf_t *conf,xm_pool_t *mp){
+
+	const xm_bench_suite_t *s;
+	const xm_bench_case_t *c;
+	int failed = 0,rc;
+
+	for(s = bench_suites;s->name;s++){
+
+		for(c = s->cases;c->name;c++){
+
+			if(c->check == NULL||!xm_bench_match(conf->filter,c->name))
+				continue;
+
+			rc = c->check(mp);
+			xm_pool_reset(mp);
+
+			printf("%-34s %s\n",c->name,rc?"FAIL":"ok");
+			failed |= rc != 0;
+		}
+	}
+
+	return failed;
+}
+
+int main(int argc,const char *const *argv){
+
+	xm_bench_conf_t conf = {NULL,30,50,2,1,0};
+	const xm_bench_suite_t *s;
+	const xm_bench_case_t *c;
+	xm_bench_result_t res;
+	xm_getopt_t *opt;
+	xm_pool_t *mp;
+	const char *arg,*json = NULL,*compare = NULL,*profile = NULL;
+	char *baseline = NULL;
+	double threshold = 5;
+	FILE *out = NULL;
+	int ch,rc,check = 0,list = 0,first = 1,regressed = 0;
+
+	mp = xm_pool_create(16384);
+	if(mp == NULL)
+		return 1;
+
+	xm_getopt_init(&opt,mp,argc,argv);
+
+	while((rc = xm_getopt_long(opt,bench_opts,&ch,&arg)) == 0){
+
+		switch(ch){
+
+		case 'f': conf.filter = arg; break;
+		case 'r': conf.reps = atoi(arg); break;
+		case 'w': conf.warmup_ms = atof(arg); break;
+		case 's': conf.sample_ms = atof(arg); break;
+		case 'j': json = arg; break;
+		case 'c': compare = arg; break;
+		case 't': threshold = atof(arg); break;
+		case 'k': check = 1; break;
+		case 'n': conf.counters = 0; break;
+		case 'p': profile = arg; break;
+		case 'l': list = 1; break;
+		default: usage(argv[0]); return ch == 'h'?0:1;
+		}
+	}
+
+	if(rc != XM_EOF){
+
+		usage(argv[0]);
+		return 1;
+	}
+
+	if(list){
+
+		for(s = bench_suites;s->name;s++)
+			for(c = s->cases;c->name;c++)
+				printf("%s%s\n",c->name,c->check?" (check)":"");
+		return 0;
+	}
+
+	if(check)
+		return run_checks(&conf,mp);
+
+	if(compare){
+
+		baseline = load_file(compare);
+		if(baseline == NULL){
+
+			fprintf(stderr,"cannot read baseline %s\n",compare);
+			return 1;
+		}
+	}
+
+	if(json){
+
+		out = fopen(json,"w");
+		if(out == NULL){
+
+			fprintf(stderr,"cannot write %s\n",json);
+			return 1;
+		}
+	}
+
+	if(conf.counters&&xm_bench_counters_open()){
+
+		fprintf(stderr,"hardware counters unavailable, timing only\n");
+		conf.counters = 0;
+	}
+
+	if(profile&&(rc = xm_prof_start(XM_PROF_HZ_DEFAULT))){
+
+		fprintf(stderr,"cannot start the profiler: %s\n",strerror(rc));
+		return 1;
+	}
+
+	if(out)
+		fprintf(out,"{\"version\":1,\"counters\":%s,\"results\":[\n",conf.counters?"true":"false");
+
+	for(s = bench_suites;s->name;s++){
+
+		for(c = s->cases;c->name;c++){
+
+			if(c->run == NULL||!xm_bench_match(conf.filter,c->name))
+				continue;
+
+			if(xm_bench_run_case(&conf,c,mp,&res)){
+
+				fprintf(stderr,"%s: not run, setup failed or the cpu lacks the level\n",c->name);
+				continue;
+			}
+
+			xm_pool_reset(mp);
+
+			if(baseline)
+				regressed |= xm_bench_compare(stdout,baseline,&res,threshold);
+			else
+				xm_bench_result_print(stdout,&res);
+
+			if(out){
+
+				fprintf(out,first?"":",\n");
+				xm_bench_result_json(out,&res);
+				first = 0;
+			}
+
+			fflush(stdout);
+		}
+	}
+
+	if(profile){
+
+		xm_prof_stop();
+		if((rc = xm_prof_dump(profile,0)))
+			fprintf(stderr,"cannot write %s: %s\n",profile,strerror(rc));
+	}
+
+	if(out){
+
+		fprintf(out,"\n]}\n");
+		fclose(out);
+	}
+
+	xm_bench_counters_close();
+	free(baseline);
+	xm_pool_destroy(mp);
+
+	return regressed;
+}
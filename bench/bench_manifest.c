@@ -0,0 +1,191 @@
+/*
+ *
+ *      Filename: bench_manifest.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 18:02:44
+ * Last Modified: 2026-10-18 18:02:44
+ */
+
+#include "xm_bench.h"
+#include "xm_manifest.h"
+
+/*3 is a primitive root of the Fermat prime 65537*/
+#define MF_PRIME     65537
+#define MF_GENERATOR 3
+#define MF_MAX       50000
+#define MF_SHARDS    3
+#define MF_THREADS   2
+
+typedef struct {
+
+	uint32_t thread;
+	uint64_t index;
+} mf_probe_t;
+
+typedef struct {
+
+	mf_probe_t *probes;
+	size_t n;
+	size_t max;
+	size_t mismatch;
+	uint8_t *seen;
+} mf_sink_ctx_t;
+
+/*the probes in the order the sender threads would make them*/
+static size_t mf_iterate(const xm_manifest_t *m,mf_probe_t *probes){
+
+	xm_cyclic_t it;
+	uint32_t t;
+	uint64_t idx;
+	size_t n = 0;
+
+	for(t = 0;t<m->threads;t++){
+
+		if(xm_cyclic_init(&it,m->prime,m->generator,m->seed,m->shard_id*m->threads+t,
+			m->shard_num*m->threads,m->max_index))
+			return 0;
+
+		while((idx = xm_cyclic_next(&it)) != 0){
+
+			probes[n].thread = t;
+			probes[n].index = idx;
+			n++;
+		}
+	}
+
+	return n;
+}
+
+static int mf_sink(void *ctx,uint32_t thread,uint64_t index){
+
+	mf_sink_ctx_t *sc = (mf_sink_ctx_t*)ctx;
+
+	if(sc->n == sc->max)
+		return 1;
+
+	if(sc->probes[sc->n].thread != thread||sc->probes[sc->n].index != index)
+		sc->mismatch++;
+
+	sc->seen[index]++;
+	sc->n++;
+
+	return 0;
+}
+
+static int mf_table_same(const xm_table_t *a,const xm_table_t *b){
+
+	const xm_table_entry_t *e = (const xm_table_entry_t*)xm_table_elts(a)->elts;
+	const char *v;
+	int i;
+
+	if(xm_table_elts(a)->nelts != xm_table_elts(b)->nelts)
+		return 0;
+
+	for(i = 0;i<xm_table_elts(a)->nelts;i++){
+
+		v = xm_table_get(b,e[i].key);
+		if(v == NULL||strcmp(v,e[i].val))
+			return 0;
+	}
+
+	return 1;
+}
+
+/*write, read back with the directive table, replay against the original walk*/
+static int roundtrip_check(xm_pool_t *mp){
+
+	xm_manifest_t *m,*r;
+	mf_sink_ctx_t sc;
+	char name[64];
+	const char *err;
+	uint32_t shard;
+	uint64_t i;
+	size_t walk;
+	int rv = 0;
+
+	snprintf(name,sizeof(name),"/tmp/xm_bench_manifest.%d",(int)getpid());
+
+	sc.max = MF_MAX;
+	sc.probes = (mf_probe_t*)xm_palloc(mp,sc.max*sizeof(mf_probe_t));
+	sc.seen = (uint8_t*)xm_pcalloc(mp,MF_PRIME);
+
+	for(shard = 0;shard<MF_SHARDS&&rv == 0;shard++){
+
+		m = xm_manifest_create(mp);
+		r = xm_manifest_create(mp);
+		if(m == NULL||r == NULL)
+			return -1;
+
+		m->seed = 0x9e3779b97f4a7c15ULL;
+		m->generator = MF_GENERATOR;
+		m->prime = MF_PRIME;
+		m->max_index = MF_MAX;
+		m->shard_id = shard;
+		m->shard_num = MF_SHARDS;
+		m->threads = MF_THREADS;
+		m->rate = 100000;
+		m->blocklist = "/etc/xmap/block list.conf";
+		m->blocklist_hash = 0xfedcba9876543210ULL;
+		m->probe_module = "tcp_synscan";
+
+		xm_manifest_param_set(m,"source-port","40000-40100");
+		xm_manifest_param_set(m,"payload","say \"hi\"\\n");
+		xm_manifest_param_set(m,"empty",NULL);
+		xm_manifest_counter_set(m,"sent",123456789012ULL);
+
+		if(xm_manifest_write(m,name,XM_MANIFEST_PHASE_END))
+			return -1;
+
+		err = xm_process_command_config(xm_manifest_cmds,r,mp,mp,name);
+		unlink(name);
+
+		if(err){
+
+			fprintf(stderr,"manifest: %s\n",err);
+			return -1;
+		}
+
+		if(r->phase != XM_MANIFEST_PHASE_END||r->seed != m->seed||r->generator != m->generator||
+			r->prime != m->prime||r->max_index != m->max_index||r->shard_id != m->shard_id||
+			r->shard_num != m->shard_num||r->threads != m->threads||r->rate != m->rate||
+			r->blocklist_hash != m->blocklist_hash||strcmp(r->blocklist,m->blocklist)||
+			strcmp(r->probe_module,m->probe_module)||r->start_time != m->start_time||
+			r->end_time != m->end_time||!mf_table_same(m->probe_params,r->probe_params)||
+			!mf_table_same(m->counters,r->counters)){
+
+			fprintf(stderr,"manifest: shard %u read back differs\n",shard);
+			return -1;
+		}
+
+		walk = mf_iterate(m,sc.probes);
+		sc.n = 0;
+		sc.mismatch = 0;
+
+		if(walk == 0||xm_manifest_replay(r,mf_sink,&sc) != (int64_t)walk||sc.mismatch){
+
+			fprintf(stderr,"manifest: shard %u replay differs from the walk, %lu mismatches\n",
+				shard,(unsigned long)sc.mismatch);
+			rv = -1;
+		}
+	}
+
+	/*the shards of one seed together are every index once*/
+	for(i = 1;i<MF_PRIME&&rv == 0;i++){
+
+		if(sc.seen[i] != (i<=MF_MAX?1:0)){
+
+			fprintf(stderr,"manifest: index %lu replayed %u times\n",(unsigned long)i,sc.seen[i]);
+			rv = -1;
+		}
+	}
+
+	return rv;
+}
+
+const xm_bench_case_t xm_bench_manifest_cases[] = {
+
+	XM_BENCH_CHECK("manifest/roundtrip",roundtrip_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,266 @@
+/*
+ *
+ *      Filename: bench_pool.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 22:52:40
+ * Last Modified: 2026-10-18 22:52:40
+ */
+
+#include "xm_bench.h"
+#include "xm_strbuf.h"
+
+/*every case gets its own pool, so resets do not touch the harness pool*/
+static void *pool_setup(xm_pool_t *mp){
+
+	mp = mp;
+
+	return xm_pool_create(16384);
+}
+
+static void pool_teardown(void *ctx){
+
+	xm_pool_destroy((xm_pool_t*)ctx);
+}
+
+/*256 small allocations then a reset, like a request*/
+static void palloc_64_run(void *ctx,uint64_t iters){
+
+	xm_pool_t *pool = (xm_pool_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_bench_use(xm_palloc(pool,64));
+
+		if((i&255) == 255)
+			xm_pool_reset(pool);
+	}
+}
+
+static void pnalloc_13_run(void *ctx,uint64_t iters){
+
+	xm_pool_t *pool = (xm_pool_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_bench_use(xm_pnalloc(pool,13));
+
+		if((i&1023) == 1023)
+			xm_pool_reset(pool);
+	}
+}
+
+/*past pool->max, so malloc and the large list*/
+static void large_alloc_free_run(void *ctx,uint64_t iters){
+
+	xm_pool_t *pool = (xm_pool_t*)ctx;
+	uint64_t i;
+	void *p;
+
+	for(i = 0;i<iters;i++){
+
+		p = xm_pnalloc(pool,65536);
+		xm_bench_use(p);
+		xm_pfree(pool,p);
+	}
+}
+
+static void create_destroy_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+	xm_pool_t *pool;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		pool = xm_pool_create(4096);
+		xm_bench_use(xm_palloc(pool,128));
+		xm_pool_destroy(pool);
+	}
+}
+
+/*a 1KB line in 64 appends*/
+static void strbuf_1k_run(void *ctx,uint64_t iters){
+
+	xm_pool_t *pool = (xm_pool_t*)ctx;
+	xm_strbuf_t sb;
+	uint64_t i;
+	int j;
+
+	for(i = 0;i<iters;i++){
+
+		xm_strbuf_init(&sb,pool,0);
+
+		for(j = 0;j<32;j++){
+
+			xm_strbuf_append(&sb,"0123456789abcdef0123456789",26);
+			xm_strbuf_append_u64(&sb,i+j);
+		}
+
+		xm_bench_use(xm_strbuf_finish(&sb,NULL));
+		xm_pool_reset(pool);
+	}
+}
+
+/*scratch inside a long lived pool: a few small pieces and one big buffer*/
+static void scratch_mark_run(void *ctx,uint64_t iters){
+
+	xm_pool_t *pool = (xm_pool_t*)ctx;
+	xm_pool_mark_t mark;
+	uint64_t i;
+	int j;
+
+	for(i = 0;i<iters;i++){
+
+		xm_pool_mark(pool,&mark);
+
+		for(j = 0;j<16;j++)
+			xm_bench_use(xm_palloc(pool,64));
+		xm_bench_use(xm_pnalloc(pool,8192));
+
+		xm_pool_release_to(pool,&mark);
+	}
+}
+
+/*the same with a sub-pool, what callers had to do before*/
+static void scratch_subpool_run(void *ctx,uint64_t iters){
+
+	xm_pool_t *pool;
+	uint64_t i;
+	int j;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		pool = xm_pool_create(4096);
+
+		for(j = 0;j<16;j++)
+			xm_bench_use(xm_palloc(pool,64));
+		xm_bench_use(xm_pnalloc(pool,8192));
+
+		xm_pool_destroy(pool);
+	}
+}
+
+static int cleanup_order[4];
+static int cleanup_n;
+
+static void mark_cleanup(void *data){
+
+	if(cleanup_n<4)
+		cleanup_order[cleanup_n] = *(int*)data;
+	cleanup_n++;
+}
+
+static int add_cleanup(xm_pool_t *pool,int id){
+
+	xm_pool_cleanup_t *c = xm_pool_cleanup_add(pool,sizeof(int));
+
+	if(c == NULL)
+		return -1;
+
+	c->handler = mark_cleanup;
+	*(int*)c->data = id;
+
+	return 0;
+}
+
+static int large_held(xm_pool_t *pool,void *p){
+
+	xm_pool_large_t *l;
+
+	for(l = pool->large;l;l = l->next)
+		if(l->alloc == p)
+			return 1;
+
+	return 0;
+}
+
+/*a release gives back exactly what came after its mark, nested or not*/
+static int mark_check(xm_pool_t *mp){
+
+	xm_pool_t *pool = xm_pool_create(4096);
+	xm_pool_mark_t outer,inner;
+	void *keep,*big,*first,*again,*p;
+	int i,rv = -1;
+
+	mp = mp;
+
+	if(pool == NULL)
+		return -1;
+
+	/*a free slot on the large list from before the mark*/
+	keep = xm_palloc(pool,100);
+	big = xm_pnalloc(pool,65536);
+	xm_pfree(pool,big);
+	add_cleanup(pool,0);
+
+	xm_pool_mark(pool,&outer);
+
+	first = xm_palloc(pool,100);
+	add_cleanup(pool,1);
+	big = xm_pnalloc(pool,65536);
+
+	xm_pool_mark(pool,&inner);
+
+	add_cleanup(pool,2);
+	for(i = 0;i<200;i++)
+		xm_palloc(pool,1000);       /*new blocks*/
+	p = xm_pnalloc(pool,100000);
+
+	xm_pool_release_to(pool,&inner);
+
+	if(cleanup_n != 1||cleanup_order[0] != 2||large_held(pool,p)||!large_held(pool,big))
+		goto out;
+
+	xm_pool_release_to(pool,&outer);
+
+	if(cleanup_n != 2||cleanup_order[1] != 1||large_held(pool,big))
+		goto out;
+
+	/*the space is taken back: the same allocations land in the same places*/
+	again = xm_palloc(pool,100);
+	if(again != first||(char*)keep+100>(char*)again)
+		goto out;
+
+	xm_pool_mark(pool,&outer);
+	for(i = 0;i<200;i++)
+		xm_palloc(pool,1000);
+	p = xm_palloc(pool,1000);
+	xm_pool_release_to(pool,&outer);
+
+	xm_pool_mark(pool,&outer);
+	for(i = 0;i<200;i++)
+		xm_palloc(pool,1000);
+	if(xm_palloc(pool,1000) != p)
+		goto out;
+	xm_pool_release_to(pool,&outer);
+
+	rv = 0;
+
+out:
+	xm_pool_destroy(pool);
+
+	if(rv == 0&&(cleanup_n != 3||cleanup_order[2] != 0))
+		rv = -1;
+
+	return rv;
+}
+
+const xm_bench_case_t xm_bench_pool_cases[] = {
+
+	XM_BENCH_CASE("pool/palloc_64",0,pool_setup,palloc_64_run,pool_teardown),
+	XM_BENCH_CASE("pool/pnalloc_13",0,pool_setup,pnalloc_13_run,pool_teardown),
+	XM_BENCH_CASE("pool/large_alloc_free",0,pool_setup,large_alloc_free_run,pool_teardown),
+	XM_BENCH_CASE("pool/create_destroy",0,NULL,create_destroy_run,NULL),
+	XM_BENCH_CASE("pool/strbuf_1k",1024,pool_setup,strbuf_1k_run,pool_teardown),
+	XM_BENCH_CASE("pool/scratch_mark_release",0,pool_setup,scratch_mark_run,pool_teardown),
+	XM_BENCH_CASE("pool/scratch_subpool",0,NULL,scratch_subpool_run,NULL),
+	XM_BENCH_CHECK("pool/mark_release",mark_check),
+	XM_BENCH_END
+};
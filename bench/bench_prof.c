@@ -0,0 +1,168 @@
+/*
+ *
+ *      Filename: bench_prof.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 13:40:22
+ * Last Modified: 2026-10-18 13:40:22
+ */
+
+#include "xm_bench.h"
+#include "xm_prof.h"
+
+#define PROF_WORK 4096
+
+/*exported and opaque to the optimizer: real calls dladdr can name*/
+uint64_t bench_prof_burn(uint64_t n) __attribute__((noipa));
+uint64_t bench_prof_outer(uint64_t n) __attribute__((noipa));
+
+uint64_t bench_prof_burn(uint64_t n){
+
+	uint64_t h = 14695981039346656037ULL;
+	uint64_t i;
+
+	for(i = 0;i<n;i++)
+		h = (h^i)*1099511628211ULL;
+
+	return h;
+}
+
+uint64_t bench_prof_outer(uint64_t n){
+
+	/*not a tail call, the frame stays*/
+	return bench_prof_burn(n)+1;
+}
+
+/*what the handler costs the code it samples, at ten times the default rate*/
+static void *prof_on_setup(xm_pool_t *mp){
+
+	return xm_prof_start(1000)?NULL:mp;
+}
+
+static void prof_teardown(void *ctx){
+
+	ctx = ctx;
+
+	xm_prof_stop();
+}
+
+static void prof_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++)
+		xm_bench_use((void*)(uintptr_t)bench_prof_outer(PROF_WORK));
+}
+
+static void prof_burn_for(double ms){
+
+	double end = xm_bench_now_ns()+ms*1e6;
+
+	while(xm_bench_now_ns()<end)
+		xm_bench_use((void*)(uintptr_t)bench_prof_outer(PROF_WORK));
+}
+
+static void *prof_thread(void *arg){
+
+	arg = arg;
+
+	if(xm_prof_thread_register("burner") == 0){
+
+		prof_burn_for(150);
+		xm_prof_thread_unregister();
+	}
+
+	return NULL;
+}
+
+/*count the samples of the lines holding want, and of all lines*/
+static int prof_count(FILE *fp,const char *want,uint64_t *hit,uint64_t *all){
+
+	char line[4096],*sp;
+	unsigned long long n;
+
+	*hit = *all = 0;
+	rewind(fp);
+
+	while(fgets(line,sizeof(line),fp)){
+
+		sp = strrchr(line,' ');
+		if(sp == NULL||sscanf(sp+1,"%llu",&n) != 1)
+			return -1;
+
+		*all += n;
+		if(strstr(line,want))
+			*hit += n;
+	}
+
+	return 0;
+}
+
+/*
+ * A cpu bound loop owns the stacks, under main. The burn loop is a
+ * leaf without a frame of its own, so its caller is not asked for.
+ */
+static int folded_check(xm_pool_t *mp){
+
+	pthread_t th;
+	FILE *fp;
+	uint64_t hit,all;
+	int rv = -1;
+
+	mp = mp;
+
+	if(xm_prof_start(1000)){
+
+		fprintf(stderr,"prof: cannot start\n");
+		return -1;
+	}
+
+	prof_burn_for(300);
+
+	if(pthread_create(&th,NULL,prof_thread,NULL) == 0)
+		pthread_join(th,NULL);
+
+	xm_prof_stop();
+
+	fp = tmpfile();
+	if(fp == NULL||xm_prof_dump_fp(fp,XM_PROF_F_THREADS))
+		goto out;
+
+	if(prof_count(fp,"main;",&hit,&all)||all<20){
+
+		fprintf(stderr,"prof: %llu samples, expected more\n",(unsigned long long)all);
+		goto out;
+	}
+
+	if(prof_count(fp,";bench_prof_burn",&hit,&all)||hit*2<all){
+
+		fprintf(stderr,"prof: %llu of %llu samples in the burn loop\n",
+			(unsigned long long)hit,(unsigned long long)all);
+		goto out;
+	}
+
+	if(prof_count(fp,"burner;",&hit,&all)||hit == 0){
+
+		fprintf(stderr,"prof: no samples of the registered thread\n");
+		goto out;
+	}
+
+	rv = 0;
+
+out:
+	if(fp)
+		fclose(fp);
+
+	return rv;
+}
+
+const xm_bench_case_t xm_bench_prof_cases[] = {
+
+	XM_BENCH_CASE("prof/fnv_4k_off",PROF_WORK,NULL,prof_run,NULL),
+	XM_BENCH_CASE("prof/fnv_4k_1khz",PROF_WORK,prof_on_setup,prof_run,prof_teardown),
+	XM_BENCH_CHECK("prof/folded_stacks",folded_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,217 @@
+/*
+ *
+ *      Filename: bench_ratectl.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 18:31:07
+ * Last Modified: 2026-10-18 18:31:07
+ */
+
+#include <math.h>
+#include "xm_bench.h"
+#include "xm_ratectl.h"
+
+#define RC_STEPS 400
+#define RC_SETTLED 50
+
+/*
+ * A path that carries up to capacity pps and drops the rest; half of
+ * the probes that get through are answered.
+ */
+typedef struct {
+
+	uint64_t capacity;
+	xm_ratectl_sample_t sample;
+} rc_responder_t;
+
+static void rc_respond(rc_responder_t *r,uint64_t rate,uint64_t interval){
+
+	uint64_t sent = rate*interval/1000;
+	uint64_t cap = r->capacity*interval/1000;
+	uint64_t passed = sent<cap?sent:cap;
+
+	r->sample.sent += sent;
+	r->sample.drops += sent-passed;
+	r->sample.responses += passed/2;
+}
+
+static xm_ratectl_t *rc_create(xm_pool_t *mp,int policy,uint64_t rate){
+
+	xm_tbucket_t *tb = (xm_tbucket_t*)xm_pcalloc(mp,sizeof(*tb));
+	xm_ratectl_t *ctl;
+
+	xm_tbucket_init(tb,rate,0,0);
+
+	ctl = xm_ratectl_create(mp,tb);
+	ctl->policy = policy;
+	ctl->min_rate = 1000;
+	ctl->max_rate = 200000;
+
+	return xm_ratectl_check(ctl)?NULL:ctl;
+}
+
+static int aimd_check(xm_pool_t *mp){
+
+	xm_ratectl_t *ctl = rc_create(mp,XM_RATECTL_AIMD,10000);
+	rc_responder_t r;
+	uint64_t prev,rate;
+	int i,backoffs = 0,recoveries = 0,was_congested = 0;
+
+	if(ctl == NULL)
+		return -1;
+
+	memset(&r,0,sizeof(r));
+	r.capacity = 50000;
+
+	xm_ratectl_step(ctl,&r.sample);
+
+	for(i = 0;i<RC_STEPS;i++){
+
+		prev = ctl->tb->rate;
+		rc_respond(&r,prev,ctl->interval);
+		rate = xm_ratectl_step(ctl,&r.sample);
+
+		if(rate<ctl->min_rate||rate>ctl->max_rate)
+			return -1;
+
+		if(ctl->congested){
+
+			/*back off by the factor, at once*/
+			if(fabs((double)rate-(double)prev*ctl->decrease)>1&&rate != ctl->min_rate){
+
+				fprintf(stderr,"ratectl: aimd %lu -> %lu on congestion\n",(unsigned long)prev,(unsigned long)rate);
+				return -1;
+			}
+
+			backoffs++;
+		}
+		else{
+
+			/*and climb back by the additive step*/
+			if(fabs((double)rate-(double)(prev+ctl->max_rate/100))>1&&rate != ctl->max_rate){
+
+				fprintf(stderr,"ratectl: aimd %lu -> %lu when quiet\n",(unsigned long)prev,(unsigned long)rate);
+				return -1;
+			}
+
+			if(was_congested)
+				recoveries++;
+		}
+
+		was_congested = ctl->congested;
+
+		/*once settled it saws around the capacity*/
+		if(i>RC_STEPS/2&&(rate<r.capacity/2||rate>r.capacity*3/2)){
+
+			fprintf(stderr,"ratectl: aimd at %lu, capacity %lu\n",(unsigned long)rate,(unsigned long)r.capacity);
+			return -1;
+		}
+	}
+
+	return backoffs>10&&recoveries>10?0:-1;
+}
+
+static int pid_check(xm_pool_t *mp){
+
+	xm_ratectl_t *ctl = rc_create(mp,XM_RATECTL_PID,2000);
+	rc_responder_t r;
+	uint64_t prev,rate;
+	double sum = 0;
+	int i,clamped = 0;
+
+	if(ctl == NULL)
+		return -1;
+
+	memset(&r,0,sizeof(r));
+	r.capacity = 50000;
+
+	xm_ratectl_step(ctl,&r.sample);
+
+	for(i = 0;i<RC_STEPS;i++){
+
+		/*the path narrows half way*/
+		if(i == RC_STEPS/2)
+			r.capacity = 5000;
+
+		prev = ctl->tb->rate;
+		rc_respond(&r,prev,ctl->interval);
+		rate = xm_ratectl_step(ctl,&r.sample);
+
+		/*no step moves the rate by more than the output clamp*/
+		if((double)rate>(double)prev*1.5+1||(double)rate<(double)prev*0.5-1||
+			rate<ctl->min_rate||rate>ctl->max_rate){
+
+			fprintf(stderr,"ratectl: pid %lu -> %lu\n",(unsigned long)prev,(unsigned long)rate);
+			return -1;
+		}
+
+		if(fabs((double)rate-(double)prev*0.5)<=1)
+			clamped++;
+
+		/*a hard wall makes it hunt, on average it sits at the capacity*/
+		if(i%(RC_STEPS/2)>=RC_STEPS/2-RC_SETTLED)
+			sum += (double)rate;
+
+		if(i%(RC_STEPS/2) == RC_STEPS/2-1){
+
+			if(sum/RC_SETTLED<(double)r.capacity*0.8||sum/RC_SETTLED>(double)r.capacity*1.1){
+
+				fprintf(stderr,"ratectl: pid at %.0f, capacity %lu\n",sum/RC_SETTLED,(unsigned long)r.capacity);
+				return -1;
+			}
+
+			sum = 0;
+		}
+	}
+
+	/*the narrowing must have hit the clamp*/
+	return clamped>0?0:-1;
+}
+
+static int bounds_check(xm_pool_t *mp){
+
+	xm_tbucket_t tb;
+	xm_ratectl_t *ctl;
+
+	xm_tbucket_init(&tb,500,0,0);
+
+	ctl = xm_ratectl_create(mp,&tb);
+	ctl->policy = XM_RATECTL_AIMD;
+	ctl->min_rate = 5000;
+	ctl->max_rate = 1000;
+
+	if(xm_ratectl_check(ctl) == NULL)
+		return -1;
+
+	/*a start below the bounds is pulled up into them*/
+	ctl->max_rate = 8000;
+
+	if(xm_ratectl_check(ctl) != NULL||tb.rate != 5000)
+		return -1;
+
+	/*the drop counters are probed once, an interface with none is refused*/
+	ctl->ifname = "lo";
+
+	if(access("/sys/class/net/lo/statistics/tx_dropped",R_OK) == 0&&
+		(xm_ratectl_check(ctl) != NULL||!(ctl->if_counters&1)))
+		return -1;
+
+	ctl->ifname = "xm-bench-none";
+
+	if(xm_ratectl_check(ctl) == NULL)
+		return -1;
+
+	ctl->ifname = NULL;
+	ctl->interval = 0;
+
+	return xm_ratectl_check(ctl) != NULL?0:-1;
+}
+
+const xm_bench_case_t xm_bench_ratectl_cases[] = {
+
+	XM_BENCH_CHECK("ratectl/aimd",aimd_check),
+	XM_BENCH_CHECK("ratectl/pid",pid_check),
+	XM_BENCH_CHECK("ratectl/bounds",bounds_check),
+	XM_BENCH_END
+};
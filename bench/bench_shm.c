@@ -0,0 +1,226 @@
+/*
+ *
+ *      Filename: bench_shm.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 15:02:37
+ * Last Modified: 2026-10-18 15:02:37
+ */
+
+#include <sys/wait.h>
+#include "xm_bench.h"
+#include "xm_shm.h"
+
+#define SHM_SIZE (4<<20)
+#define SHM_LIVE 256
+
+typedef struct {
+
+	xm_shm_t *shm;
+	void *live[SHM_LIVE];
+	uint64_t seed;
+} shm_ctx_t;
+
+static void *shm_setup(xm_pool_t *mp){
+
+	shm_ctx_t *sc = (shm_ctx_t*)xm_pcalloc(mp,sizeof(*sc));
+
+	if(xm_shm_create(&sc->shm,mp,NULL,SHM_SIZE))
+		return NULL;
+
+	sc->seed = 7;
+
+	return sc;
+}
+
+static void shm_teardown(void *ctx){
+
+	xm_shm_detach(((shm_ctx_t*)ctx)->shm);
+}
+
+static void alloc_free_64_run(void *ctx,uint64_t iters){
+
+	shm_ctx_t *sc = (shm_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++)
+		xm_shm_free(sc->shm,xm_shm_alloc(sc->shm,64));
+}
+
+/*a window of live blocks of 16 bytes to 4k, freed out of order*/
+static void alloc_free_mixed_run(void *ctx,uint64_t iters){
+
+	shm_ctx_t *sc = (shm_ctx_t*)ctx;
+	uint64_t i;
+	uint32_t r;
+
+	for(i = 0;i<iters;i++){
+
+		r = xm_bench_rand(&sc->seed);
+
+		xm_shm_free(sc->shm,sc->live[r%SHM_LIVE]);
+		sc->live[r%SHM_LIVE] = xm_shm_alloc(sc->shm,16<<(r>>8)%9);
+	}
+}
+
+/*random traffic keeps the heap sound and gives all of it back*/
+static int heap_check(xm_pool_t *mp){
+
+	void *live[SHM_LIVE] = {NULL};
+	xm_shm_t *shm;
+	uint64_t seed = 11;
+	uint32_t r,it;
+	size_t n;
+
+	if(xm_shm_create(&shm,mp,NULL,4*SHM_SIZE))
+		return -1;
+
+	for(it = 0;it<200000;it++){
+
+		r = xm_bench_rand(&seed);
+
+		if(xm_shm_free(shm,live[r%SHM_LIVE]))
+			return -1;
+
+		n = 1+xm_bench_rand(&seed)%(r&0x100?32768:256);
+		live[r%SHM_LIVE] = xm_shm_alloc(shm,n);
+
+		if(live[r%SHM_LIVE] == NULL||((uintptr_t)live[r%SHM_LIVE]&15)){
+
+			fprintf(stderr,"shm: allocation %u of %lu bytes failed\n",it,(unsigned long)n);
+			return -1;
+		}
+
+		memset(live[r%SHM_LIVE],(int)r,n);
+
+		if(it%5000 == 0&&xm_shm_check(shm)){
+
+			fprintf(stderr,"shm: heap corrupt at iteration %u\n",it);
+			return -1;
+		}
+	}
+
+	for(it = 0;it<SHM_LIVE;it++)
+		xm_shm_free(shm,live[it]);
+
+	if(xm_shm_check(shm)||shm->hdr->top != shm->hdr->hdr_size||shm->hdr->used){
+
+		fprintf(stderr,"shm: the heap did not drain\n");
+		return -1;
+	}
+
+	if(xm_shm_alloc(shm,4*SHM_SIZE) != NULL||xm_shm_free(shm,live[0]) != EINVAL)
+		return -1;
+
+	xm_shm_detach(shm);
+
+	return 0;
+}
+
+/*children die at random points, the heap recovers under the robust lock*/
+static int crash_check(xm_pool_t *mp){
+
+	xm_shm_t *shm;
+	pid_t pid;
+	int round,status;
+
+	if(xm_shm_create(&shm,mp,NULL,SHM_SIZE))
+		return -1;
+
+	for(round = 0;round<20;round++){
+
+		pid = fork();
+		if(pid<0)
+			return -1;
+
+		if(pid == 0){
+
+			void *live[SHM_LIVE] = {NULL};
+			uint64_t seed = (uint64_t)round+1;
+			uint32_t r;
+
+			for(;;){
+
+				r = xm_bench_rand(&seed);
+				xm_shm_free(shm,live[r%SHM_LIVE]);
+				live[r%SHM_LIVE] = xm_shm_alloc(shm,1+r%2000);
+			}
+		}
+
+		usleep(2000+round*500);
+		kill(pid,SIGKILL);
+		waitpid(pid,&status,0);
+
+		if(xm_shm_check(shm)||xm_shm_alloc(shm,100) == NULL){
+
+			fprintf(stderr,"shm: heap unusable after round %d\n",round);
+			return -1;
+		}
+	}
+
+	xm_shm_detach(shm);
+
+	return 0;
+}
+
+/*a structure built once, linked by offsets, read through another mapping*/
+static int attach_check(xm_pool_t *mp){
+
+	typedef struct {
+
+		xm_shm_off_t name;
+		xm_shm_rel_t next;
+		uint32_t id;
+	} item_t;
+
+	char name[64];
+	xm_shm_t *shm,*ro;
+	item_t *it,*head = NULL;
+	int i,rv = -1;
+
+	snprintf(name,sizeof(name),"/xm_bench_%d",(int)getpid());
+
+	if(xm_shm_create(&shm,mp,name,1<<20))
+		return -1;
+
+	for(i = 0;i<100;i++){
+
+		it = (item_t*)xm_shm_calloc(shm,sizeof(*it));
+		it->id = i;
+		it->name = xm_shm_off(shm,xm_shm_strdup(shm,"rule"));
+		xm_shm_rel_set(&it->next,head);
+		head = it;
+	}
+
+	xm_shm_root_set(shm,head);
+
+	if(xm_shm_attach(&ro,mp,name,XM_SHM_F_RDONLY))
+		goto out;
+
+	if(ro->base == shm->base||xm_shm_alloc(ro,16) != NULL||xm_shm_check(ro))
+		goto out;
+
+	for(i = 99,it = (item_t*)xm_shm_root(ro);it;it = (item_t*)xm_shm_rel_get(&it->next),i--){
+
+		if(it->id != (uint32_t)i||strcmp(XM_SHM_PTR(ro,it->name,char),"rule"))
+			goto out;
+	}
+
+	rv = i == -1?0:-1;
+
+out:
+	xm_shm_remove(name);
+
+	return rv;
+}
+
+const xm_bench_case_t xm_bench_shm_cases[] = {
+
+	XM_BENCH_CASE("shm/alloc_free_64",0,shm_setup,alloc_free_64_run,shm_teardown),
+	XM_BENCH_CASE("shm/alloc_free_mixed",0,shm_setup,alloc_free_mixed_run,shm_teardown),
+	XM_BENCH_CHECK("shm/heap",heap_check),
+	XM_BENCH_CHECK("shm/owner_dies",crash_check),
+	XM_BENCH_CHECK("shm/attach_rdonly",attach_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,336 @@
+/*
+ *
+ *      Filename: bench_srcpool.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 19:12:40
+ * Last Modified: 2026-10-18 19:12:40
+ */
+
+#include "xm_bench.h"
+#include "xm_srcpool.h"
+
+#define SP_PORT_FIRST 40000
+#define SP_PORT_LAST  40009
+#define SP_PORTS      (SP_PORT_LAST-SP_PORT_FIRST+1)
+#define SP_KEYS       1024
+
+/*21 ipv4 after duplicates, 16 ipv6*/
+static const char *sp_addrs[] = {
+	"192.0.2.0/28","192.0.2.4-192.0.2.20","192.0.2.7","2001:db8::/124","2001:db8::3",NULL
+};
+
+static xm_srcpool_t *sp_create(xm_pool_t *mp){
+
+	xm_srcpool_t *pool = xm_srcpool_create(mp);
+	const char **a;
+
+	if(pool == NULL)
+		return NULL;
+
+	for(a = sp_addrs;*a;a++){
+
+		if(xm_srcpool_addr_parse(pool,*a))
+			return NULL;
+	}
+
+	if(xm_srcpool_port_add(pool,SP_PORT_FIRST,SP_PORT_LAST)||xm_srcpool_compile(pool))
+		return NULL;
+
+	return pool;
+}
+
+typedef struct {
+
+	xm_srcpool_t *pool;
+	xm_srcaddr_t key[SP_KEYS];
+	uint16_t port[SP_KEYS];
+} sp_ctx_t;
+
+static void *sp_setup(xm_pool_t *mp){
+
+	sp_ctx_t *sc = (sp_ctx_t*)xm_pcalloc(mp,sizeof(*sc));
+	const xm_srcaddr_t *addrs;
+	uint64_t seed = 5;
+	uint32_t r;
+	int i;
+
+	sc->pool = sp_create(mp);
+	if(sc->pool == NULL)
+		return NULL;
+
+	addrs = (const xm_srcaddr_t*)sc->pool->addrs->elts;
+
+	/*members and near misses, as responses would come in*/
+	for(i = 0;i<SP_KEYS;i++){
+
+		r = xm_bench_rand(&seed);
+		sc->key[i] = addrs[r%sc->pool->addrs->nelts];
+		sc->port[i] = SP_PORT_FIRST+r%(2*SP_PORTS);
+
+		if(r&1)
+			sc->key[i].u.addr8[15] ^= 0x40;
+	}
+
+	return sc;
+}
+
+static void match_run(void *ctx,uint64_t iters){
+
+	sp_ctx_t *sc = (sp_ctx_t*)ctx;
+	const xm_srcaddr_t *k;
+	uint64_t i;
+	int sum = 0;
+
+	for(i = 0;i<iters;i++){
+
+		k = &sc->key[i&(SP_KEYS-1)];
+		sum += xm_srcpool_match(sc->pool,k->family,
+			k->family == AF_INET?(const void*)&k->u.addr32[3]:(const void*)k->u.addr8,
+			sc->port[i&(SP_KEYS-1)]);
+	}
+
+	xm_bench_use((void*)(long)sum);
+}
+
+/*the host order low 32 bits of an address, where ranges count*/
+static uint32_t sp_low(const xm_srcaddr_t *a){
+
+	return ntohl(a->u.addr32[3]);
+}
+
+static int parse_check(xm_pool_t *mp){
+
+	static const struct {
+		const char *s;
+		int n;
+		uint32_t first;
+		uint32_t last;
+	} good[] = {
+		{"192.0.2.1",1,0xc0000201,0xc0000201},
+		{"192.0.2.1-192.0.2.9",9,0xc0000201,0xc0000209},
+		{"192.0.2.5-192.0.2.5",1,0xc0000205,0xc0000205},
+		{"192.0.2.0/28",16,0xc0000200,0xc000020f},
+		{"192.0.2.77/28",16,0xc0000240,0xc000024f},
+		{"10.1.0.0/16",65536,0x0a010000,0x0a01ffff},
+		{"2001:db8::1",1,1,1},
+		{"2001:db8::/120",256,0,0xff},
+		{"2001:db8::1:ffff/112",65536,0x10000,0x1ffff},
+	};
+	static const char *bad[] = {
+		"","bogus","192.0.2.300","192.0.2.9-192.0.2.1","192.0.2.1-","192.0.2.1-x",
+		"10.0.0.0/8","192.0.2.0/33","192.0.2.0/","192.0.2.0/2x","2001:db8::/64",
+		"2001:db8::/129","2001:db8::1-2001:db8::2",NULL
+	};
+	xm_srcpool_t *pool;
+	const xm_srcaddr_t *addrs;
+	const char **b;
+	uint8_t v6[16];
+	size_t i;
+	int n,j;
+
+	for(i = 0;i<sizeof(good)/sizeof(good[0]);i++){
+
+		pool = xm_srcpool_create(mp);
+		if(pool == NULL||xm_srcpool_addr_parse(pool,good[i].s))
+			return -1;
+
+		addrs = (const xm_srcaddr_t*)pool->addrs->elts;
+		n = pool->addrs->nelts;
+
+		if(n != good[i].n||sp_low(&addrs[0]) != good[i].first||sp_low(&addrs[n-1]) != good[i].last){
+
+			fprintf(stderr,"srcpool: '%s' gave %d addresses\n",good[i].s,n);
+			return -1;
+		}
+
+		/*consecutive, and the upper 96 bits as written*/
+		inet_pton(AF_INET6,"2001:db8::",v6);
+
+		for(j = 0;j<n;j++){
+
+			if(sp_low(&addrs[j]) != good[i].first+(uint32_t)j||
+				addrs[j].family != (strchr(good[i].s,':')?AF_INET6:AF_INET)||
+				(addrs[j].family == AF_INET6&&memcmp(addrs[j].u.addr8,v6,12)))
+				return -1;
+		}
+	}
+
+	pool = xm_srcpool_create(mp);
+
+	for(b = bad;*b;b++){
+
+		if(xm_srcpool_addr_parse(pool,*b) == 0){
+
+			fprintf(stderr,"srcpool: '%s' accepted\n",*b);
+			return -1;
+		}
+	}
+
+	/*a range that would take the pool past XM_SRCPOOL_ADDR_MAX adds nothing*/
+	if(xm_srcpool_addr_parse(pool,"192.0.2.1")||xm_srcpool_addr_parse(pool,"10.1.0.0/16") == 0||
+		pool->addrs->nelts != 1)
+		return -1;
+
+	return 0;
+}
+
+/*repeats are dropped, the first of each kept in order*/
+static int dedup_check(xm_pool_t *mp){
+
+	xm_srcpool_t *pool = sp_create(mp);
+	const xm_srcaddr_t *addrs;
+	uint32_t want;
+	int i;
+
+	if(pool == NULL||pool->addrs->nelts != 21+16||pool->port_num != SP_PORTS)
+		return -1;
+
+	addrs = (const xm_srcaddr_t*)pool->addrs->elts;
+
+	for(i = 0;i<pool->addrs->nelts;i++){
+
+		want = i<21?0xc0000200+(uint32_t)i:(uint32_t)(i-21);
+
+		if(sp_low(&addrs[i]) != want||addrs[i].family != (i<21?AF_INET:AF_INET6))
+			return -1;
+	}
+
+	/*the same address twice in a row, and nothing else*/
+	pool = xm_srcpool_create(mp);
+
+	if(xm_srcpool_addr_parse(pool,"2001:db8::9")||xm_srcpool_addr_parse(pool,"2001:db8::9")||
+		xm_srcpool_compile(pool)||pool->addrs->nelts != 1)
+		return -1;
+
+	return 0;
+}
+
+/*
+ * Every thread count: the threads' (address, port) pairs, as
+ * xm_srcpool_next hands them out, are each of the pool's pairs once.
+ */
+static int threads_check(xm_pool_t *mp){
+
+	static const char *few[] = {"192.0.2.1","2001:db8::1",NULL};
+	xm_srcpool_t *pools[2];
+	xm_srcpool_thread_t th;
+	const xm_srcaddr_t *a;
+	const char **f;
+	uint8_t *seen;
+	uint16_t port;
+	uint32_t threads,t,k,naddr,idx;
+	int p;
+
+	pools[0] = sp_create(mp);
+	pools[1] = xm_srcpool_create(mp);
+	if(pools[0] == NULL||pools[1] == NULL)
+		return -1;
+
+	for(f = few;*f;f++)
+		xm_srcpool_addr_parse(pools[1],*f);
+
+	if(xm_srcpool_port_add(pools[1],SP_PORT_FIRST,SP_PORT_LAST)||xm_srcpool_compile(pools[1]))
+		return -1;
+
+	for(p = 0;p<2;p++){
+
+		naddr = (uint32_t)pools[p]->addrs->nelts;
+		seen = (uint8_t*)xm_palloc(mp,naddr*SP_PORTS);
+
+		/*past naddr the ports are split, past the port count it cannot be done*/
+		for(threads = 1;threads<=naddr+SP_PORTS;threads++){
+
+			memset(seen,0,naddr*SP_PORTS);
+
+			for(t = 0;t<threads;t++){
+
+				if(xm_srcpool_thread_init(pools[p],&th,t,threads)){
+
+					if(threads>naddr&&threads>SP_PORTS)
+						break;
+
+					fprintf(stderr,"srcpool: thread %u of %u refused\n",t,threads);
+					return -1;
+				}
+
+				if(threads>naddr&&threads>SP_PORTS)
+					return -1;
+
+				for(k = 0;k<th.addr_num*th.port_num;k++){
+
+					a = xm_srcpool_next(&th,&port);
+					idx = (uint32_t)(a-(const xm_srcaddr_t*)pools[p]->addrs->elts);
+
+					if(idx>=naddr||port<SP_PORT_FIRST||port>SP_PORT_LAST||
+						seen[idx*SP_PORTS+port-SP_PORT_FIRST]++){
+
+						fprintf(stderr,"srcpool: %u threads share a source\n",threads);
+						return -1;
+					}
+				}
+			}
+
+			if(t == threads&&memchr(seen,0,naddr*SP_PORTS)){
+
+				fprintf(stderr,"srcpool: %u threads leave a source unused\n",threads);
+				return -1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*every member on every pool port is taken, the neighbours are not*/
+static int match_check(xm_pool_t *mp){
+
+	xm_srcpool_t *pool = sp_create(mp);
+	const xm_srcaddr_t *addrs;
+	static const char *others[] = {"192.0.1.255","192.0.2.21","192.0.3.0","2001:db8::10","2001:db9::1","::ffff:192.0.2.22",NULL};
+	const char **o;
+	uint8_t a[16];
+	uint32_t port;
+	int i,family;
+
+	if(pool == NULL)
+		return -1;
+
+	addrs = (const xm_srcaddr_t*)pool->addrs->elts;
+
+	for(i = 0;i<pool->addrs->nelts;i++){
+
+		for(port = SP_PORT_FIRST-2;port<=SP_PORT_LAST+2;port++){
+
+			if(xm_srcpool_match(pool,addrs[i].family,addrs[i].family == AF_INET?
+				(const void*)&addrs[i].u.addr32[3]:(const void*)addrs[i].u.addr8,(uint16_t)port) !=
+				(port>=SP_PORT_FIRST&&port<=SP_PORT_LAST))
+				return -1;
+		}
+	}
+
+	for(o = others;*o;o++){
+
+		family = strchr(*o,':')?AF_INET6:AF_INET;
+		inet_pton(family,*o,a);
+
+		if(xm_srcpool_match(pool,family,a,SP_PORT_FIRST)){
+
+			fprintf(stderr,"srcpool: %s matched\n",*o);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+const xm_bench_case_t xm_bench_srcpool_cases[] = {
+
+	XM_BENCH_CASE("srcpool/match",0,sp_setup,match_run,NULL),
+	XM_BENCH_CHECK("srcpool/parse",parse_check),
+	XM_BENCH_CHECK("srcpool/dedup",dedup_check),
+	XM_BENCH_CHECK("srcpool/threads",threads_check),
+	XM_BENCH_CHECK("srcpool/match",match_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,185 @@
+/*
+ *
+ *      Filename: bench_stats.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 16:20:41
+ * Last Modified: 2026-10-18 16:20:41
+ */
+
+#include "xm_bench.h"
+#include "xm_stats.h"
+
+#define STATS_N 64
+
+typedef struct {
+
+	xm_stats_t *st;
+	xm_stats_view_t *view;
+	uint64_t *vals[STATS_N];
+	char name[64];
+} stats_ctx_t;
+
+static void *stats_setup(xm_pool_t *mp){
+
+	stats_ctx_t *sc = (stats_ctx_t*)xm_pcalloc(mp,sizeof(*sc));
+	char name[32];
+	int i;
+
+	snprintf(sc->name,sizeof(sc->name),"/xm_bench_stats_%d",(int)getpid());
+
+	sc->st = xm_stats_create(mp,"bench",STATS_N);
+
+	for(i = 0;i<STATS_N;i++){
+
+		snprintf(name,sizeof(name),"bench.counter%d",i);
+		sc->vals[i] = xm_stats_counter(sc->st,name,"ops");
+	}
+
+	if(xm_stats_shm_open(sc->st,sc->name)||xm_stats_view_open(&sc->view,mp,sc->name))
+		return NULL;
+
+	return sc;
+}
+
+static void stats_teardown(void *ctx){
+
+	xm_stats_shm_close(((stats_ctx_t*)ctx)->st);
+}
+
+static void publish_run(void *ctx,uint64_t iters){
+
+	stats_ctx_t *sc = (stats_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		(*sc->vals[i&(STATS_N-1)])++;
+		xm_stats_publish(sc->st);
+	}
+}
+
+static void view_read_run(void *ctx,uint64_t iters){
+
+	stats_ctx_t *sc = (stats_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++)
+		xm_bench_use((void*)(long)xm_stats_view_read(sc->view));
+}
+
+typedef struct {
+
+	xm_stats_t *st;
+	uint64_t *a,*b;
+	volatile int stop;
+} stats_writer_t;
+
+/*a and b always go up together, a torn snapshot shows them apart*/
+static void *stats_writer(void *arg){
+
+	stats_writer_t *w = (stats_writer_t*)arg;
+
+	while(!w->stop){
+
+		(*w->a)++;
+		(*w->b)++;
+		xm_stats_publish(w->st);
+	}
+
+	return NULL;
+}
+
+static int seqlock_check(xm_pool_t *mp){
+
+	stats_writer_t w;
+	xm_stats_view_t *view;
+	pthread_t th;
+	char name[64];
+	uint64_t last = 0;
+	int i,rv = 0,reads = 0;
+
+	snprintf(name,sizeof(name),"/xm_bench_stats_%d",(int)getpid());
+
+	w.st = xm_stats_create(mp,"check",8);
+	w.a = xm_stats_counter(w.st,"a","ops");
+	w.b = xm_stats_counter(w.st,"b","ops");
+	w.stop = 0;
+
+	if(xm_stats_counter(w.st,"a",NULL) != w.a||xm_stats_shm_open(w.st,name))
+		return -1;
+
+	if(xm_stats_view_open(&view,mp,name)||view->n != 2||
+		strcmp(xm_stats_view_desc(view,1)->name,"b")){
+
+		xm_stats_shm_close(w.st);
+		return -1;
+	}
+
+	if(pthread_create(&th,NULL,stats_writer,&w)){
+
+		xm_stats_shm_close(w.st);
+		return -1;
+	}
+
+	for(i = 0;i<200000&&rv == 0;i++){
+
+		if(i%64 == 0)
+			sched_yield();
+
+		if(xm_stats_view_read(view))
+			continue;
+
+		reads++;
+
+		if(view->values[0] != view->values[1]||view->values[0]<last){
+
+			fprintf(stderr,"stats: torn snapshot %llu/%llu\n",(unsigned long long)view->values[0],
+				(unsigned long long)view->values[1]);
+			rv = -1;
+		}
+
+		last = view->values[0];
+	}
+
+	w.stop = 1;
+	pthread_join(th,NULL);
+
+	xm_stats_shm_close(w.st);
+
+	if(reads == 0||last == 0)
+		return -1;
+
+	return rv;
+}
+
+/*a segment of another kind is refused*/
+static int layout_check(xm_pool_t *mp){
+
+	xm_stats_view_t *view;
+	xm_shm_t *shm;
+	char name[64];
+	int rv;
+
+	snprintf(name,sizeof(name),"/xm_bench_stats_%d",(int)getpid());
+
+	if(xm_shm_create(&shm,mp,name,4096))
+		return -1;
+
+	xm_shm_root_set(shm,xm_shm_calloc(shm,256));
+
+	rv = xm_stats_view_open(&view,mp,name);
+	xm_shm_remove(name);
+
+	return rv == EINVAL&&xm_stats_view_open(&view,mp,name) == ENOENT?0:-1;
+}
+
+const xm_bench_case_t xm_bench_stats_cases[] = {
+
+	XM_BENCH_CASE("stats/publish_64",0,stats_setup,publish_run,stats_teardown),
+	XM_BENCH_CASE("stats/view_read_64",0,stats_setup,view_read_run,stats_teardown),
+	XM_BENCH_CHECK("stats/seqlock",seqlock_check),
+	XM_BENCH_CHECK("stats/layout",layout_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,617 @@
+/*
+ *
+ *      Filename: bench_string.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:59:02
+ * Last Modified: 2026-10-18 23:59:02
+ */
+
+#include "xm_bench.h"
+#include "xm_util.h"
+#include "xm_utf8.h"
+#include "xm_slice.h"
+
+#define UTF8_LEN 65536
+
+/*cut at a sequence boundary and the rest of the sequence comes next*/
+static const char *utf8_frag[] = {
+	"a","Z"," ","\xc3\xa9","\xe2\x82\xac","\xf0\x9f\x98\x80",
+	"\xed\xa0\x80","\xc0\x80","\xe0\x80\x80","\xf0\x80\x80\x80","\xf4\x90\x80\x80",
+	"\xf5\x80\x80\x80","\x80","\xff","\xc3","\xe2\x82"
+};
+
+#define UTF8_NVALID 6
+#define UTF8_NFRAG (sizeof(utf8_frag)/sizeof(utf8_frag[0]))
+
+typedef struct {
+
+	xm_pool_t *pool;
+	size_t len;
+	unsigned char buf[UTF8_LEN+1];
+} string_ctx_t;
+
+static size_t utf8_gen(unsigned char *out,size_t max,size_t nfrag,uint64_t *seed){
+
+	const char *f;
+	size_t n = 0,l;
+
+	while(n<max){
+
+		f = utf8_frag[xm_bench_rand(seed)%nfrag];
+		l = strlen(f);
+		if(l>max-n)
+			break;
+
+		memcpy(out+n,f,l);
+		n += l;
+	}
+
+	out[n] = '\0';
+
+	return n;
+}
+
+static string_ctx_t *string_ctx(xm_pool_t *mp){
+
+	string_ctx_t *sc = (string_ctx_t*)xm_pcalloc(mp,sizeof(*sc));
+
+	sc->pool = xm_pool_create(16384);
+
+	return sc;
+}
+
+static void *ascii_setup(xm_pool_t *mp){
+
+	string_ctx_t *sc = string_ctx(mp);
+	size_t i;
+
+	for(i = 0;i<UTF8_LEN;i++)
+		sc->buf[i] = 'a'+i%26;
+	sc->len = UTF8_LEN;
+
+	return sc;
+}
+
+/*one euro sign in every ten bytes*/
+static void *mixed_setup(xm_pool_t *mp){
+
+	string_ctx_t *sc = string_ctx(mp);
+	size_t i = 0;
+
+	while(i+3<=UTF8_LEN){
+
+		if(i%10 == 0){
+
+			memcpy(sc->buf+i,"\xe2\x82\xac",3);
+			i += 3;
+		}
+		else{
+
+			sc->buf[i++] = 'x';
+		}
+	}
+	sc->len = i;
+
+	return sc;
+}
+
+static void string_teardown(void *ctx){
+
+	xm_pool_destroy(((string_ctx_t*)ctx)->pool);
+}
+
+static void utf8_valid_run(void *ctx,uint64_t iters){
+
+	string_ctx_t *sc = (string_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++)
+		xm_bench_use((void*)(long)xm_utf8_valid(sc->buf,sc->len));
+}
+
+static void utf8_escape_run(void *ctx,uint64_t iters){
+
+	string_ctx_t *sc = (string_ctx_t*)ctx;
+	uint64_t i;
+	int changed;
+
+	for(i = 0;i<iters;i++){
+
+		xm_bench_use(xm_utf8_unicode_escape(sc->pool,sc->buf,sc->len,&changed));
+		xm_pool_reset(sc->pool);
+	}
+}
+
+static const char *clean_paths[] = {
+	"/","/index.html","/static/js/app.4f2a9c.min.js","/api/v2/users/12345/orders",
+	"/images/products/large/sku-99812-front.jpg","/account/settings/notifications/email",
+	"/wp-content/themes/twentytwenty/assets/css/style.css","/favicon.ico"
+};
+
+static const char *dirty_paths[] = {
+	"/../etc/passwd","/foo//bar/baz","/a/./b/../c/","/static/js/../../admin/./login.php",
+	"//double//slashes//everywhere//","/x/y/z/../../../..","relative/./path/../file","/trailing/dot/."
+};
+
+#define NPATHS 8
+
+static void path_loop(const char **paths,uint64_t iters,int win){
+
+	unsigned char buf[128];
+	uint64_t i;
+	size_t len;
+	int changed;
+
+	for(i = 0;i<iters;i++){
+
+		len = strlen(paths[i%NPATHS]);
+		memcpy(buf,paths[i%NPATHS],len+1);
+		xm_normalize_path_inplace(buf,(int)len,win,&changed);
+		xm_bench_use(buf);
+	}
+}
+
+static void path_clean_run(void *ctx,uint64_t iters){ ctx = ctx; path_loop(clean_paths,iters,0); }
+static void path_dirty_run(void *ctx,uint64_t iters){ ctx = ctx; path_loop(dirty_paths,iters,0); }
+static void path_dirty_win_run(void *ctx,uint64_t iters){ ctx = ctx; path_loop(dirty_paths,iters,1); }
+
+static const char query[] = "id=12345&name=some+user&lang=en&theme=dark&page=7&sort=desc&q=%22quoted%22&ref=home";
+
+static void slice_split_run(void *ctx,uint64_t iters){
+
+	xm_str_t s,toks[16];
+	uint64_t i;
+
+	ctx = ctx;
+	xm_str_set(&s,query,sizeof(query)-1);
+
+	for(i = 0;i<iters;i++){
+
+		xm_bench_use((void*)(long)xm_str_split(&s,'&',toks,16));
+		xm_bench_use(toks);
+	}
+}
+
+static void slice_token_run(void *ctx,uint64_t iters){
+
+	xm_byteset_t set;
+	xm_str_t rest,tok;
+	uint64_t i;
+
+	ctx = ctx;
+	xm_byteset_init(&set,"&=");
+
+	for(i = 0;i<iters;i++){
+
+		xm_str_set(&rest,query,sizeof(query)-1);
+		while(xm_str_next_token(&rest,&set,&tok))
+			xm_bench_use(tok.data);
+	}
+}
+
+/*a config line: indented, the name, padding, the arguments, trailing blanks*/
+static const char conf_line[] = "\t\t    ClassifyIcmp6                     129 0 success  \t  \r\n";
+
+static void slice_space_run(void *ctx,uint64_t iters){
+
+	xm_str_t rest,tok;
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_str_set(&rest,conf_line,sizeof(conf_line)-1);
+		while(xm_str_next_token(&rest,&xm_byteset_space,&tok))
+			xm_bench_use(tok.data);
+
+		xm_str_set(&rest,conf_line,sizeof(conf_line)-1);
+		xm_str_trim(&rest);
+		xm_bench_use(rest.data);
+	}
+}
+
+/*the whitespace scans against isspace(), bytes near the range included*/
+static int slice_space_check(xm_pool_t *mp){
+
+	static const unsigned char alpha[] = " \t\n\v\f\r\x08\x0e\x1f!a\x80\x89\x8d\xa0\xff";
+	unsigned char buf[128];
+	uint64_t seed = 31;
+	xm_str_t s,t;
+	ssize_t any,other;
+	size_t n,i,lo,hi;
+	int it;
+
+	mp = mp;
+
+	for(it = 0;it<200000;it++){
+
+		n = xm_bench_rand(&seed)%sizeof(buf);
+
+		/*long blank runs, so the scans see whole blocks of them*/
+		for(i = 0;i<n;i++)
+			buf[i] = alpha[xm_bench_rand(&seed)%(it%2?6:sizeof(alpha)-1)];
+		if(n&&it%4 == 1)
+			buf[xm_bench_rand(&seed)%n] = 'x';
+
+		for(i = 0,any = other = -1;i<n;i++){
+
+			if(any<0&&isspace(buf[i]))
+				any = (ssize_t)i;
+			if(other<0&&!isspace(buf[i]))
+				other = (ssize_t)i;
+		}
+
+		for(lo = 0;lo<n&&isspace(buf[lo]);lo++);
+		for(hi = n;hi>lo&&isspace(buf[hi-1]);hi--);
+
+		xm_str_set(&s,buf,n);
+		t = s;
+		xm_str_trim(&t);
+
+		if(xm_str_find_any(&s,&xm_byteset_space) != any||xm_str_find_not(&s,&xm_byteset_space) != other||
+			t.data != buf+lo||t.len != hi-lo){
+
+			fprintf(stderr,"string: whitespace scan differs at iteration %d\n",it);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/*the strict RFC 3629 decoder, one byte at a time*/
+static int utf8_ref_valid(const unsigned char *s,size_t n){
+
+	size_t i = 0,k,l;
+	uint32_t cp;
+	unsigned c;
+
+	while(i<n){
+
+		c = s[i];
+		if(c<0x80){
+
+			i++;
+			continue;
+		}
+
+		if(c>=0xc2&&c<=0xdf){ l = 2; cp = c&0x1f; }
+		else if(c>=0xe0&&c<=0xef){ l = 3; cp = c&0x0f; }
+		else if(c>=0xf0&&c<=0xf4){ l = 4; cp = c&0x07; }
+		else return 0;
+
+		if(i+l>n)
+			return 0;
+
+		for(k = 1;k<l;k++){
+
+			if((s[i+k]&0xc0) != 0x80)
+				return 0;
+			cp = (cp<<6)|(s[i+k]&0x3f);
+		}
+
+		if((l == 3&&cp<0x800)||(l == 4&&cp<0x10000)||cp>0x10ffff||(cp>=0xd800&&cp<=0xdfff))
+			return 0;
+
+		i += l;
+	}
+
+	return 1;
+}
+
+static int utf8_valid_check(xm_pool_t *mp){
+
+	unsigned char buf[5000];
+	uint64_t seed = 5;
+	size_t n,i;
+	int it,mode;
+
+	mp = mp;
+
+	for(it = 0;it<100000;it++){
+
+		mode = it%3;
+		n = xm_bench_rand(&seed)%(it%10?100:4000);
+
+		if(mode == 0){
+
+			for(i = 0;i<n;i++)
+				buf[i] = (unsigned char)xm_bench_rand(&seed);
+		}
+		else{
+
+			n = utf8_gen(buf,n,mode == 1?UTF8_NVALID:UTF8_NFRAG,&seed);
+		}
+
+		if(xm_utf8_valid(buf,n) != utf8_ref_valid(buf,n))
+			return -1;
+	}
+
+	return 0;
+}
+
+/*on well formed input every code point of two bytes or more is %uXXXX*/
+static int utf8_escape_check(xm_pool_t *mp){
+
+	unsigned char buf[5000];
+	char want[5000*3+1],*w;
+	const char *got;
+	uint64_t seed = 17;
+	size_t n,i,k,l;
+	uint32_t cp;
+	int it,changed,want_changed;
+
+	for(it = 0;it<20000;it++){
+
+		n = utf8_gen(buf,xm_bench_rand(&seed)%(it%10?100:4000),UTF8_NVALID,&seed);
+
+		/*NULs are dropped; only an ASCII byte is overwritten, to stay well formed*/
+		if(n&&it%7 == 0){
+
+			i = xm_bench_rand(&seed)%n;
+			if(buf[i]<0x80)
+				buf[i] = '\0';
+		}
+
+		w = want;
+		want_changed = 0;
+
+		for(i = 0;i<n;i += l){
+
+			if(buf[i]<0x80){
+
+				if(buf[i])
+					*w++ = buf[i];
+				l = 1;
+				continue;
+			}
+
+			l = buf[i]>=0xf0?4:buf[i]>=0xe0?3:2;
+			cp = buf[i]&(0x7f>>l);
+			for(k = 1;k<l;k++)
+				cp = (cp<<6)|(buf[i+k]&0x3f);
+
+			w += sprintf(w,"%%u%04x",cp);
+			want_changed = 1;
+		}
+		*w = '\0';
+
+		got = xm_utf8_unicode_escape(mp,buf,n,&changed);
+		if(got == NULL||strcmp(got,want)||changed != want_changed)
+			return -1;
+
+		xm_pool_reset(mp);
+	}
+
+	return 0;
+}
+
+/*no trigger: untouched, unchanged, full length*/
+static int path_clean_check(xm_pool_t *mp){
+
+	static const char alpha[] = "abc-_.~%/";
+	unsigned char buf[256],copy[256];
+	uint64_t seed = 23;
+	size_t n,i;
+	int it,changed,r;
+
+	mp = mp;
+
+	for(it = 0;it<200000;it++){
+
+		n = 1+xm_bench_rand(&seed)%200;
+
+		for(i = 0;i<n;i++){
+
+			buf[i] = alpha[xm_bench_rand(&seed)%(sizeof(alpha)-1)];
+
+			/*no "//" or "./", no '.' at the end of a segment*/
+			if(i&&buf[i] == '/'&&(buf[i-1] == '/'||buf[i-1] == '.'))
+				buf[i] = 'x';
+		}
+		if(buf[n-1] == '.')
+			buf[n-1] = 'y';
+		buf[n] = '\0';
+
+		memcpy(copy,buf,n+1);
+		r = xm_normalize_path_inplace(buf,(int)n,it&1,&changed);
+
+		if(r != (int)n||changed||memcmp(buf,copy,n+1))
+			return -1;
+	}
+
+	return 0;
+}
+
+/*the state machine xm_normalize_path_inplace ran on every path before the fast paths*/
+static int path_ref_normalize(unsigned char *input,int input_len,int win,int *changed){
+
+	unsigned char *src,*dst,*end,*oldsrc;
+	int ldst,hitroot = 0,done = 0,relative,trailing;
+
+	*changed = 0;
+
+	if(input_len<=0)
+		return 0;
+
+	src = dst = input;
+	end = input+(input_len-1);
+	ldst = 1;
+
+	relative = (*input == '/'||(win&&*input == '\\'))?0:1;
+	trailing = (*end == '/'||(win&&*end == '\\'))?1:0;
+
+	while(!done&&src<=end&&dst<=end){
+
+		if(win){
+
+			if(*src == '\\'){
+
+				*src = '/';
+				*changed = 1;
+			}
+
+			if(src<end&&*(src+1) == '\\'){
+
+				*(src+1) = '/';
+				*changed = 1;
+			}
+		}
+
+		if(src == end)
+			done = 1;
+		else if(*(src+1) != '/')
+			goto copy;
+
+		if(src != end&&*src == '/'){
+
+			*changed = 1;
+			goto copy;
+		}
+		else if(*src == '.'){
+
+			if(dst>input&&*(dst-1) == '.'){
+
+				if(relative&&(hitroot||(dst-2)<=input)){
+
+					hitroot = 1;
+					goto copy;
+				}
+
+				dst -= 3;
+				while(dst>input&&*dst != '/')
+					dst--;
+
+				if(dst<=input){
+
+					hitroot = 1;
+					dst = input;
+
+					if(!relative&&src == end)
+						dst++;
+				}
+
+				if(done)
+					goto length;
+				src++;
+
+				*changed = 1;
+			}
+			else if(dst == input){
+
+				*changed = 1;
+
+				if(done)
+					goto length;
+				src++;
+			}
+			else if(*(dst-1) == '/'){
+
+				*changed = 1;
+
+				if(done)
+					goto length;
+				dst--;
+				src++;
+			}
+		}
+		else if(dst>input){
+
+			hitroot = 0;
+		}
+
+copy:
+		if(*src == '/'){
+
+			oldsrc = src;
+
+			while(src<end&&(*(src+1) == '/'||(win&&*(src+1) == '\\')))
+				src++;
+			if(oldsrc != src)
+				*changed = 1;
+
+			if(relative&&dst == input){
+
+				src++;
+				goto length;
+			}
+		}
+
+		*(dst++) = *(src++);
+
+length:
+		ldst = dst-input;
+	}
+
+	if(!trailing&&dst>input&&*(dst-1) == '/'){
+
+		ldst--;
+		dst--;
+	}
+
+	*dst = '\0';
+
+	return ldst;
+}
+
+/*random token strings, dirty or not, through both: same length, flag and bytes*/
+static int path_ref_check(xm_pool_t *mp){
+
+	static const char *tok[] = {"/",".","\\","..","./","//","a","bc","d.e","/x/"};
+	unsigned char buf[512],ref[512],orig[512];
+	uint64_t seed = 29;
+	size_t n,l;
+	int it,win,changed,ref_changed,r,rr;
+	const char *t;
+
+	mp = mp;
+
+	for(it = 0;it<1000000;it++){
+
+		win = it&1;
+		l = xm_bench_rand(&seed)%(it%8?24:160);
+
+		for(n = 0;l--;n += strlen(t)){
+
+			t = tok[xm_bench_rand(&seed)%(sizeof(tok)/sizeof(tok[0]))];
+			memcpy(buf+n,t,strlen(t));
+		}
+		buf[n] = '\0';
+
+		memcpy(ref,buf,n+1);
+		memcpy(orig,buf,n+1);
+		r = xm_normalize_path_inplace(buf,(int)n,win,&changed);
+		rr = path_ref_normalize(ref,(int)n,win,&ref_changed);
+
+		if(r != rr||changed != ref_changed||memcmp(buf,ref,(size_t)r+1)){
+
+			fprintf(stderr,"string: path '%s' win %d: %d/%d, the old code %d/%d\n",
+				(char*)orig,win,r,changed,rr,ref_changed);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+const xm_bench_case_t xm_bench_string_cases[] = {
+
+	XM_BENCH_CASE("string/utf8_valid_ascii_64k",UTF8_LEN,ascii_setup,utf8_valid_run,string_teardown),
+	XM_BENCH_CASE("string/utf8_valid_mixed_64k",UTF8_LEN,mixed_setup,utf8_valid_run,string_teardown),
+	XM_BENCH_CASE("string/utf8_escape_mixed_64k",UTF8_LEN,mixed_setup,utf8_escape_run,string_teardown),
+	XM_BENCH_CASE("string/path_clean",0,NULL,path_clean_run,NULL),
+	XM_BENCH_CASE("string/path_dirty",0,NULL,path_dirty_run,NULL),
+	XM_BENCH_CASE("string/path_dirty_win",0,NULL,path_dirty_win_run,NULL),
+	XM_BENCH_CASE("string/slice_split",sizeof(query)-1,NULL,slice_split_run,NULL),
+	XM_BENCH_CASE("string/slice_next_token",sizeof(query)-1,NULL,slice_token_run,NULL),
+	XM_BENCH_CASE("string/slice_space",sizeof(conf_line)-1,NULL,slice_space_run,NULL),
+	XM_BENCH_CHECK("string/utf8_valid_vs_ref",utf8_valid_check),
+	XM_BENCH_CHECK("string/utf8_escape_valid",utf8_escape_check),
+	XM_BENCH_CHECK("string/path_clean_unchanged",path_clean_check),
+	XM_BENCH_CHECK("string/path_vs_ref",path_ref_check),
+	XM_BENCH_CHECK("string/slice_space",slice_space_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,184 @@
+/*
+ *
+ *      Filename: bench_table.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:01:18
+ * Last Modified: 2026-10-18 23:01:18
+ */
+
+#include "xm_bench.h"
+#include "xm_tables.h"
+
+#define TABLE_N 16
+
+/*a typical request header block*/
+static const char *table_keys[TABLE_N] = {
+	"Host","User-Agent","Accept","Accept-Language","Accept-Encoding","Referer",
+	"Cookie","Connection","Upgrade-Insecure-Requests","Cache-Control","Pragma",
+	"X-Forwarded-For","X-Request-Id","Content-Type","Content-Length","Origin"
+};
+
+static const char *table_vals[TABLE_N] = {
+	"www.example.com","Mozilla/5.0 (X11; Linux x86_64; rv:128.0) Gecko/20100101 Firefox/128.0",
+	"text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8","en-US,en;q=0.5",
+	"gzip, deflate, br","https://www.example.com/index.html",
+	"session=4f2a9c61e0b8d7a5; theme=dark; lang=en","keep-alive","1","max-age=0","no-cache",
+	"203.0.113.7, 198.51.100.23","6a1f0c2e-9d7b-4c55-8f3e-2b1a0d9c8e7f",
+	"application/x-www-form-urlencoded","42","https://www.example.com"
+};
+
+typedef struct {
+
+	xm_pool_t *pool;
+	xm_table_t *t;
+	char buf[4096];
+	struct iovec iov[4*TABLE_N+1];
+} table_ctx_t;
+
+static xm_table_t *table_fill(xm_pool_t *pool){
+
+	xm_table_t *t = xm_table_make(pool,TABLE_N);
+	int i;
+
+	for(i = 0;i<TABLE_N;i++)
+		xm_table_setn(t,table_keys[i],table_vals[i]);
+
+	return t;
+}
+
+static void *table_setup(xm_pool_t *mp){
+
+	table_ctx_t *tc = (table_ctx_t*)xm_pcalloc(mp,sizeof(*tc));
+
+	tc->pool = xm_pool_create(16384);
+	tc->t = table_fill(tc->pool);
+
+	return tc;
+}
+
+static void table_teardown(void *ctx){
+
+	xm_pool_destroy(((table_ctx_t*)ctx)->pool);
+}
+
+/*build a header table and look every header up, per request*/
+static void set_get_16_run(void *ctx,uint64_t iters){
+
+	table_ctx_t *tc = (table_ctx_t*)ctx;
+	xm_table_t *t;
+	uint64_t i;
+	int j;
+
+	for(i = 0;i<iters;i++){
+
+		t = table_fill(tc->pool);
+
+		for(j = 0;j<TABLE_N;j++)
+			xm_bench_use(xm_table_get(t,table_keys[j]));
+
+		xm_pool_reset(tc->pool);
+	}
+}
+
+static void get_miss_run(void *ctx,uint64_t iters){
+
+	table_ctx_t *tc = (table_ctx_t*)ctx;
+	uint64_t i;
+
+	for(i = 0;i<iters;i++)
+		xm_bench_use(xm_table_get(tc->t,"X-Not-There"));
+}
+
+static void serialize_16_run(void *ctx,uint64_t iters){
+
+	table_ctx_t *tc = (table_ctx_t*)ctx;
+	const xm_array_header_t *arr = xm_table_elts(tc->t);
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_table_serialize(arr,&xm_table_sep_headers,tc->buf,sizeof(tc->buf));
+		xm_bench_use(tc->buf);
+	}
+}
+
+static void iovec_16_run(void *ctx,uint64_t iters){
+
+	table_ctx_t *tc = (table_ctx_t*)ctx;
+	const xm_array_header_t *arr = xm_table_elts(tc->t);
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_table_serialize_iovec(arr,&xm_table_sep_headers,tc->iov,4*TABLE_N+1);
+		xm_bench_use(tc->iov);
+	}
+}
+
+/*the serialisers against a plain snprintf of each line*/
+static int serialize_check(xm_pool_t *mp){
+
+	xm_table_t *t = table_fill(mp);
+	const xm_array_header_t *arr = xm_table_elts(t);
+	struct iovec iov[4*TABLE_N+1];
+	char want[4096],got[4096],vec[4096];
+	xm_data_output_t dout;
+	size_t wlen = 0,vlen = 0,used;
+	ssize_t n;
+	int i,niov,rc;
+
+	for(i = 0;i<TABLE_N;i++)
+		wlen += snprintf(want+wlen,sizeof(want)-wlen,"%s: %s\n",table_keys[i],table_vals[i]);
+	want[wlen++] = '\n';
+
+	n = xm_table_serialize(arr,&xm_table_sep_headers,NULL,0);
+	if(n != (ssize_t)wlen)
+		return -1;
+
+	n = xm_table_serialize(arr,&xm_table_sep_headers,got,sizeof(got));
+	if(n != (ssize_t)wlen||memcmp(got,want,wlen))
+		return -1;
+
+	if(xm_table_serialize(arr,&xm_table_sep_headers,got,wlen-1) != -1)
+		return -1;
+
+	/*appended after what is there, a few bytes short of the end so it grows*/
+	if(xm_dout_init(&dout))
+		return -1;
+
+	used = XM_DOUT_SIZE(&dout)-wlen/2;
+	memset(dout.base,'x',used);
+	XM_DOUT_POS_UPDATE(&dout,used);
+
+	n = xm_table_serialize_dout(arr,&xm_table_sep_headers,&dout);
+	rc = n != (ssize_t)wlen||XM_DOUT_CONTENT_SIZE(&dout) != (ssize_t)(used+wlen)||
+		((char*)dout.base)[used-1] != 'x'||memcmp((char*)dout.base+used,want,wlen);
+	free(dout.base);
+
+	if(rc)
+		return -1;
+
+	niov = xm_table_serialize_iovec(arr,&xm_table_sep_headers,iov,4*TABLE_N+1);
+	if(niov != xm_table_iovec_count(arr,&xm_table_sep_headers))
+		return -1;
+
+	for(i = 0;i<niov;i++){
+
+		memcpy(vec+vlen,iov[i].iov_base,iov[i].iov_len);
+		vlen += iov[i].iov_len;
+	}
+
+	return vlen == wlen&&memcmp(vec,want,wlen) == 0?0:-1;
+}
+
+const xm_bench_case_t xm_bench_table_cases[] = {
+
+	XM_BENCH_CASE("table/set_get_16",0,table_setup,set_get_16_run,table_teardown),
+	XM_BENCH_CASE("table/get_miss",0,table_setup,get_miss_run,table_teardown),
+	XM_BENCH_CASE("table/serialize_16",0,table_setup,serialize_16_run,table_teardown),
+	XM_BENCH_CASE("table/iovec_16",0,table_setup,iovec_16_run,table_teardown),
+	XM_BENCH_CHECK("table/serialize",serialize_check),
+	XM_BENCH_END
+};
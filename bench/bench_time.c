@@ -0,0 +1,326 @@
+/*
+ *
+ *      Filename: bench_time.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 23:58:14
+ * Last Modified: 2026-10-18 23:58:14
+ */
+
+#include "xm_bench.h"
+#include "xm_time.h"
+
+#define NOW_SEC 1760000000LL
+
+static char time_buf[64];
+
+static void exp_gmt_run(void *ctx,uint64_t iters){
+
+	xm_time_exp_t xt;
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_time_exp_gmt(&xt,xm_time_from_sec(NOW_SEC+i));
+		xm_bench_use(&xt);
+	}
+}
+
+static void exp_lt_run(void *ctx,uint64_t iters){
+
+	xm_time_exp_t xt;
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_time_exp_lt(&xt,xm_time_from_sec(NOW_SEC+i));
+		xm_bench_use(&xt);
+	}
+}
+
+/*what the lib replaced, for reference*/
+static void localtime_r_run(void *ctx,uint64_t iters){
+
+	struct tm tm;
+	time_t t;
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		t = (time_t)(NOW_SEC+i);
+		localtime_r(&t,&tm);
+		xm_bench_use(&tm);
+	}
+}
+
+static void rfc822_date_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		xm_rfc822_date(time_buf,xm_time_from_sec(NOW_SEC+i));
+		xm_bench_use(time_buf);
+	}
+}
+
+static void parse_loop(const char *s,uint64_t iters){
+
+	xm_time_t t;
+	size_t len = strlen(s);
+	uint64_t i;
+
+	for(i = 0;i<iters;i++){
+
+		xm_parse_http_date(&t,s,len);
+		xm_bench_use(&t);
+	}
+}
+
+static void parse_1123_run(void *ctx,uint64_t iters){
+
+	ctx = ctx;
+	parse_loop("Sun, 06 Nov 1994 08:49:37 GMT",iters);
+}
+
+static void parse_850_run(void *ctx,uint64_t iters){
+
+	ctx = ctx;
+	parse_loop("Wednesday, 09-Nov-94 08:49:37 GMT",iters);
+}
+
+static void parse_asctime_run(void *ctx,uint64_t iters){
+
+	ctx = ctx;
+	parse_loop("Sun Nov  6 08:49:37 1994",iters);
+}
+
+static int tm_differs(const struct tm *tm,const xm_time_exp_t *xt){
+
+	return tm->tm_sec != xt->tm_sec||tm->tm_min != xt->tm_min||tm->tm_hour != xt->tm_hour||
+		tm->tm_mday != xt->tm_mday||tm->tm_mon != xt->tm_mon||tm->tm_year != xt->tm_year||
+		tm->tm_wday != xt->tm_wday||tm->tm_yday != xt->tm_yday;
+}
+
+/*the arithmetic explode against libc, in whatever TZ the run has*/
+static int exp_check(xm_pool_t *mp){
+
+	xm_time_exp_t xt;
+	struct tm tm;
+	xm_time_t back;
+	uint64_t seed = 9;
+	int64_t s;
+	time_t t;
+	int it;
+
+	mp = mp;
+
+	for(it = 0;it<300000;it++){
+
+		/*1906..2100, and densely around now for the offset cache*/
+		if(it%3 == 0)
+			s = (int64_t)(((uint64_t)xm_bench_rand(&seed)<<16)^xm_bench_rand(&seed))%4102444800LL-2000000000LL;
+		else
+			s = NOW_SEC+(int64_t)(xm_bench_rand(&seed)%(86400*800));
+
+		t = (time_t)s;
+
+		gmtime_r(&t,&tm);
+		xm_time_exp_gmt(&xt,xm_time_from_sec(s));
+		if(tm_differs(&tm,&xt))
+			return -1;
+
+		if(s>=0&&(xm_time_exp_gmt_get(&back,&xt)||back != xm_time_from_sec(s)))
+			return -1;
+
+		localtime_r(&t,&tm);
+		xm_time_exp_lt(&xt,xm_time_from_sec(s));
+		if(tm_differs(&tm,&xt)||(tm.tm_isdst>0) != xt.tm_isdst||tm.tm_gmtoff != xt.tm_gmtoff)
+			return -1;
+	}
+
+	return 0;
+}
+
+/*parse(format(t)) == t for every form, and strptime agrees*/
+static int http_date_check(xm_pool_t *mp){
+
+	static const char *lnames[7] = {"Sunday","Monday","Tuesday","Wednesday","Thursday","Friday","Saturday"};
+	xm_time_exp_t xt;
+	struct tm tm;
+	xm_time_t t;
+	uint64_t seed = 13;
+	int64_t s;
+	int it;
+
+	mp = mp;
+
+	for(it = 0;it<300000;it++){
+
+		s = (int64_t)(((uint64_t)xm_bench_rand(&seed)<<16)^xm_bench_rand(&seed))%253402300799LL;
+		xm_time_exp_gmt(&xt,xm_time_from_sec(s));
+
+		switch(it%3){
+
+		case 0:
+			xm_rfc822_date(time_buf,xm_time_from_sec(s));
+			break;
+
+		case 1:
+			/*two digit years only cover 1969..2068*/
+			if(xt.tm_year<69||xt.tm_year>=169)
+				continue;
+			snprintf(time_buf,sizeof(time_buf),"%s, %02d-%s-%02d %02d:%02d:%02d GMT",
+				lnames[xt.tm_wday],xt.tm_mday,xm_month_snames[xt.tm_mon],xt.tm_year%100,
+				xt.tm_hour,xt.tm_min,xt.tm_sec);
+			break;
+
+		default:
+			snprintf(time_buf,sizeof(time_buf),"%s %s %2d %02d:%02d:%02d %04d",
+				xm_day_snames[xt.tm_wday],xm_month_snames[xt.tm_mon],xt.tm_mday,
+				xt.tm_hour,xt.tm_min,xt.tm_sec,xt.tm_year+1900);
+			break;
+		}
+
+		if(xm_parse_http_date(&t,time_buf,strlen(time_buf))||t != xm_time_from_sec(s))
+			return -1;
+
+		/*anything we accept strptime must read the same*/
+		memset(&tm,0,sizeof(tm));
+		if(it%3 == 0&&(strptime(time_buf,"%a, %d %b %Y %H:%M:%S GMT",&tm) == NULL||
+			xm_time_from_sec(timegm(&tm)) != t))
+			return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * One byte of a valid date changed: whatever is still accepted must be
+ * what strptime+timegm reads from the whole string.
+ */
+static int http_date_fuzz_check(xm_pool_t *mp){
+
+	static const char *forms[3] = {
+		"%a, %d %b %Y %H:%M:%S GMT",
+		"%A, %d-%b-%y %H:%M:%S GMT",
+		"%a %b %e %H:%M:%S %Y"
+	};
+	static const char *lnames[7] = {"Sunday","Monday","Tuesday","Wednesday","Thursday","Friday","Saturday"};
+	static const char alpha[] = "0123456789 ,:-GMTUCadnouvbeFJSy\t\xff";
+	static const char *bad[] = {
+		"Tue, 31 Feb 2015 08:49:37 GMT",
+		"Thu, 29 Feb 1900 00:00:00 GMT",
+		"Sun, 06 Nov 1994 24:00:00 GMT",
+		"Sun, 06 Nov 1994 08:60:37 GMT",
+		"Sun, 06 Nov 1994 08:49:37 UTC",
+		"Sun, 06 nov 1994 08:49:37 GMT",
+		"Sun, 06 Nov 1994 08:49:37 GMT ",
+		" Sun, 06 Nov 1994 08:49:37 GMT",
+		"Sun, 6 Nov 1994 08:49:37 GMT",
+		"Sun, 00 Nov 1994 08:49:37 GMT",
+		"Sunday, 31-Apr-94 08:49:37 GMT",
+		"Sunday, 06-nov-94 08:49:37 GMT",
+		"Sunday, 06-Nov-94 08:49:37 UTC",
+		"Sun Feb 29 08:49:37 1900",
+		"Sun Nov  6 24:49:37 1994",
+		"Sun Nov  6 08:49:37 1994 ",
+		"sun Nov  6 08:49:37 1994",
+		NULL
+	};
+	char buf[64];
+	const char **b,*end;
+	xm_time_exp_t xt;
+	struct tm tm;
+	xm_time_t t;
+	uint64_t seed = 19;
+	int64_t s;
+	size_t len;
+	int it,form,accepted = 0;
+
+	mp = mp;
+
+	for(b = bad;*b;b++){
+
+		if(xm_parse_http_date(&t,*b,strlen(*b)) == 0){
+
+			fprintf(stderr,"time: '%s' accepted\n",*b);
+			return -1;
+		}
+	}
+
+	if(xm_parse_http_date(&t,"Tue, 29 Feb 2000 12:00:00 GMT",29)||t != xm_time_from_sec(951825600LL))
+		return -1;
+
+	for(it = 0;it<300000;it++){
+
+		s = (int64_t)(((uint64_t)xm_bench_rand(&seed)<<16)^xm_bench_rand(&seed))%3155760000LL;
+		xm_time_exp_gmt(&xt,xm_time_from_sec(s));
+
+		form = it%3;
+
+		switch(form){
+
+		case 0:
+			xm_rfc822_date(buf,xm_time_from_sec(s));
+			break;
+
+		case 1:
+			snprintf(buf,sizeof(buf),"%s, %02d-%s-%02d %02d:%02d:%02d GMT",
+				lnames[xt.tm_wday],xt.tm_mday,xm_month_snames[xt.tm_mon],xt.tm_year%100,
+				xt.tm_hour,xt.tm_min,xt.tm_sec);
+			break;
+
+		default:
+			snprintf(buf,sizeof(buf),"%s %s %2d %02d:%02d:%02d %04d",
+				xm_day_snames[xt.tm_wday],xm_month_snames[xt.tm_mon],xt.tm_mday,
+				xt.tm_hour,xt.tm_min,xt.tm_sec,xt.tm_year+1900);
+			break;
+		}
+
+		len = strlen(buf);
+		buf[xm_bench_rand(&seed)%len] = alpha[xm_bench_rand(&seed)%(sizeof(alpha)-1)];
+
+		if(xm_parse_http_date(&t,buf,len))
+			continue;
+
+		accepted++;
+
+		memset(&tm,0,sizeof(tm));
+		end = strptime(buf,forms[form],&tm);
+
+		if(end == NULL||*end != '\0'||xm_time_from_sec(timegm(&tm)) != t){
+
+			fprintf(stderr,"time: '%s' accepted, strptime reads it %s\n",buf,
+				end == NULL||*end != '\0'?"not at all":"otherwise");
+			return -1;
+		}
+	}
+
+	/*most mutations leave a valid date: a digit for a digit, a weekday letter*/
+	return accepted>10000?0:-1;
+}
+
+const xm_bench_case_t xm_bench_time_cases[] = {
+
+	XM_BENCH_CASE("time/exp_gmt",0,NULL,exp_gmt_run,NULL),
+	XM_BENCH_CASE("time/exp_lt",0,NULL,exp_lt_run,NULL),
+	XM_BENCH_CASE("time/localtime_r",0,NULL,localtime_r_run,NULL),
+	XM_BENCH_CASE("time/rfc822_date",0,NULL,rfc822_date_run,NULL),
+	XM_BENCH_CASE("time/parse_rfc1123",0,NULL,parse_1123_run,NULL),
+	XM_BENCH_CASE("time/parse_rfc850",0,NULL,parse_850_run,NULL),
+	XM_BENCH_CASE("time/parse_asctime",0,NULL,parse_asctime_run,NULL),
+	XM_BENCH_CHECK("time/exp_vs_libc",exp_check),
+	XM_BENCH_CHECK("time/http_date_roundtrip",http_date_check),
+	XM_BENCH_CHECK("time/http_date_fuzz",http_date_fuzz_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,181 @@
+/*
+ *
+ *      Filename: bench_trace.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 10:02:17
+ * Last Modified: 2026-10-18 10:02:17
+ */
+
+#include "xm_bench.h"
+#include "xm_trace.h"
+
+XM_TRACE_SITE(trace_bench,"bench","span");
+XM_TRACE_SITE(trace_bench_inner,"bench","inner");
+
+static void *trace_on_setup(xm_pool_t *mp){
+
+	xm_trace_enable(1);
+
+	return mp;
+}
+
+static void trace_on_teardown(void *ctx){
+
+	ctx = ctx;
+	xm_trace_enable(0);
+}
+
+static void span_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++){
+
+		XM_TRACE_BEGIN(trace_bench);
+		xm_bench_use(&i);
+		XM_TRACE_END(trace_bench);
+	}
+}
+
+/*an instrumented lib path, to see the cost in context*/
+static void pool_create_run(void *ctx,uint64_t iters){
+
+	uint64_t i;
+
+	ctx = ctx;
+
+	for(i = 0;i<iters;i++)
+		xm_pool_destroy(xm_pool_create(4096));
+}
+
+typedef struct {
+
+	int spans;
+	const char *name;
+	int tid;
+} trace_worker_t;
+
+static void *trace_worker(void *arg){
+
+	trace_worker_t *w = (trace_worker_t*)arg;
+	int i;
+
+	xm_trace_thread_name(w->name);
+	w->tid = xm_trace_buf->tid;
+
+	for(i = 0;i<w->spans;i++){
+
+		XM_TRACE_BEGIN(trace_bench);
+		XM_TRACE_BEGIN(trace_bench_inner);
+		XM_TRACE_END(trace_bench_inner);
+		XM_TRACE_END(trace_bench);
+	}
+
+	return NULL;
+}
+
+/*count the B and E events of one thread, -1 when an E comes first*/
+static int trace_count(const char *json,const char *tid,int *nb,int *ne){
+
+	const char *p = json;
+	int depth = 0;
+
+	*nb = *ne = 0;
+
+	while((p = strstr(p,tid)) != NULL){
+
+		const char *ph = p;
+
+		while(ph>json&&*ph != '{')
+			ph--;
+
+		ph = strstr(ph,"\"ph\":\"");
+		p += strlen(tid);
+
+		if(ph == NULL||ph>p)
+			continue;
+
+		if(ph[6] == 'B'){
+
+			depth++;
+			(*nb)++;
+		}
+		else if(ph[6] == 'E'){
+
+			if(depth-- == 0)
+				return -1;
+			(*ne)++;
+		}
+	}
+
+	return 0;
+}
+
+/*two named threads, one on a small ring that wraps, dumped as json*/
+static int trace_dump_check(xm_pool_t *mp){
+
+	trace_worker_t w[2] = {{100,"worker-a",0},{1000,"worker-b",0}};
+	pthread_t th[2];
+	char tid[2][32],*json;
+	size_t len;
+	FILE *fp;
+	int i,nb,ne,rv = 0;
+
+	mp = mp;
+
+	xm_trace_enable(1);
+
+	for(i = 0;i<2;i++){
+
+		/*the second thread gets a 64 event ring*/
+		xm_trace_init(i?64:XM_TRACE_EVENTS_DEFAULT);
+
+		if(pthread_create(&th[i],NULL,trace_worker,&w[i]))
+			return -1;
+		pthread_join(th[i],NULL);
+	}
+
+	xm_trace_init(XM_TRACE_EVENTS_DEFAULT);
+	xm_trace_enable(0);
+
+	fp = open_memstream(&json,&len);
+	if(fp == NULL||xm_trace_dump_fp(fp)){
+
+		if(fp)
+			fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+
+	for(i = 0;i<2;i++)
+		snprintf(tid[i],sizeof(tid[i]),"\"tid\":%d,",w[i].tid);
+
+	if(strncmp(json,"{\"displayTimeUnit\"",18)||strstr(json,"\"name\":\"worker-a\"") == NULL||
+		strstr(json,"\"name\":\"worker-b\"") == NULL)
+		rv = -1;
+
+	/*every span of a; of b only the whole ones among its last 64 events*/
+	if(trace_count(json,tid[0],&nb,&ne)||nb != 200||ne != 200)
+		rv = -1;
+
+	if(trace_count(json,tid[1],&nb,&ne)||ne>32||ne<28||nb != ne)
+		rv = -1;
+
+	free(json);
+
+	return rv;
+}
+
+const xm_bench_case_t xm_bench_trace_cases[] = {
+
+	XM_BENCH_CASE("trace/span_off",0,NULL,span_run,NULL),
+	XM_BENCH_CASE("trace/span_on",0,trace_on_setup,span_run,trace_on_teardown),
+	XM_BENCH_CASE("trace/pool_create_off",0,NULL,pool_create_run,NULL),
+	XM_BENCH_CASE("trace/pool_create_on",0,trace_on_setup,pool_create_run,trace_on_teardown),
+	XM_BENCH_CHECK("trace/dump_json",trace_dump_check),
+	XM_BENCH_END
+};
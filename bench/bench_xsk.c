@@ -0,0 +1,204 @@
+/*
+ *
+ *      Filename: bench_xsk.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 17:05:12
+ * Last Modified: 2026-10-18 17:05:12
+ */
+
+#include "xm_bench.h"
+#include "xm_xsk.h"
+
+#define XSK_RING_SIZE 8
+#define XSK_FRAME_SIZE 2048
+
+/*
+ * The rings without a socket: the indexes and slots live in pool memory,
+ * the kernel's side is played by a second ring struct over them.
+ */
+typedef struct {
+
+	uint32_t producer;
+	uint32_t consumer;
+	uint64_t slots[XSK_RING_SIZE];
+} xsk_fake_ring_t;
+
+static void xsk_ring_init(xm_xsk_ring_t *prod,xm_xsk_ring_t *cons,xsk_fake_ring_t *fr){
+
+	memset(prod,0,sizeof(*prod));
+
+	prod->size = XSK_RING_SIZE;
+	prod->mask = XSK_RING_SIZE-1;
+	prod->producer = &fr->producer;
+	prod->consumer = &fr->consumer;
+	prod->ring = fr->slots;
+	prod->cached_cons = XSK_RING_SIZE;
+
+	*cons = *prod;
+	cons->cached_cons = 0;
+}
+
+static void *xsk_ring_setup(xm_pool_t *mp){
+
+	xm_xsk_ring_t *r = (xm_xsk_ring_t*)xm_pcalloc(mp,2*sizeof(*r));
+	xsk_fake_ring_t *fr = (xsk_fake_ring_t*)xm_pcalloc(mp,sizeof(*fr));
+
+	xsk_ring_init(&r[0],&r[1],fr);
+
+	return r;
+}
+
+static void ring_burst_run(void *ctx,uint64_t iters){
+
+	xm_xsk_ring_t *prod = (xm_xsk_ring_t*)ctx,*cons = prod+1;
+	uint32_t i,n,idx = 0;
+	uint64_t it;
+
+	for(it = 0;it<iters;it++){
+
+		n = xm_xsk_ring_prod_reserve(prod,XSK_RING_SIZE,&idx);
+		for(i = 0;i<n;i++)
+			*xm_xsk_ring_addr(prod,idx++) = it;
+
+		xm_xsk_ring_prod_submit(prod,n);
+
+		n = xm_xsk_ring_cons_peek(cons,XSK_RING_SIZE,&idx);
+		for(i = 0;i<n;i++)
+			xm_bench_use(xm_xsk_ring_addr(cons,idx++));
+
+		xm_xsk_ring_cons_release(cons,n);
+	}
+}
+
+/*reserve, submit, peek and release across the wrap of the 32 bit indexes*/
+static int ring_check(xm_pool_t *mp){
+
+	xsk_fake_ring_t *fr = (xsk_fake_ring_t*)xm_pcalloc(mp,sizeof(*fr));
+	xm_xsk_ring_t prod,cons;
+	uint32_t i,k,n,idx = 0,next = 0,want = 0;
+
+	fr->producer = fr->consumer = 0xfffffff0;
+	xsk_ring_init(&prod,&cons,fr);
+	prod.cached_prod = cons.cached_prod = prod.cached_cons = fr->producer;
+	prod.cached_cons += XSK_RING_SIZE;
+	cons.cached_cons = fr->consumer;
+
+	for(k = 0;k<64;k++){
+
+		/*a full ring refuses the whole batch*/
+		if(xm_xsk_ring_prod_reserve(&prod,XSK_RING_SIZE+1,&idx) != 0)
+			return -1;
+
+		n = k%XSK_RING_SIZE+1;
+		if(xm_xsk_ring_prod_reserve(&prod,n,&idx) != n)
+			return -1;
+
+		for(i = 0;i<n;i++)
+			*xm_xsk_ring_addr(&prod,idx++) = next++;
+
+		xm_xsk_ring_prod_submit(&prod,n);
+
+		if(xm_xsk_prod_nb_free(&prod,XSK_RING_SIZE) != XSK_RING_SIZE-n)
+			return -1;
+
+		/*take them in two helpings*/
+		n = xm_xsk_ring_cons_peek(&cons,(n+1)/2,&idx);
+		for(i = 0;i<n;i++){
+
+			if(*xm_xsk_ring_addr(&cons,idx++) != want++)
+				return -1;
+		}
+
+		xm_xsk_ring_cons_release(&cons,n);
+
+		n = xm_xsk_ring_cons_peek(&cons,XSK_RING_SIZE,&idx);
+		for(i = 0;i<n;i++){
+
+			if(*xm_xsk_ring_addr(&cons,idx++) != want++)
+				return -1;
+		}
+
+		xm_xsk_ring_cons_release(&cons,n);
+
+		if(xm_xsk_ring_cons_peek(&cons,1,&idx) != 0)
+			return -1;
+	}
+
+	return want == next&&fr->producer<0xfffffff0?0:-1;
+}
+
+typedef struct {
+
+	xm_xsk_ring_t ring;
+	uint64_t *seen;
+	uint32_t n;
+	uint32_t got;
+} xsk_drain_t;
+
+/*the kernel's part: take what the fill ring is given*/
+static void *xsk_drain(void *arg){
+
+	xsk_drain_t *d = (xsk_drain_t*)arg;
+	uint32_t i,n,idx = 0;
+
+	while(d->got<d->n){
+
+		n = xm_xsk_ring_cons_peek(&d->ring,XSK_RING_SIZE,&idx);
+		for(i = 0;i<n;i++)
+			d->seen[d->got++] = *xm_xsk_ring_addr(&d->ring,idx++);
+
+		xm_xsk_ring_cons_release(&d->ring,n);
+
+		if(n == 0)
+			sched_yield();
+	}
+
+	return NULL;
+}
+
+/*releasing more frames than the fill ring holds must not spin forever*/
+static int release_check(xm_pool_t *mp){
+
+	xsk_fake_ring_t *fr = (xsk_fake_ring_t*)xm_pcalloc(mp,sizeof(*fr));
+	xm_xsk_t *xsk = (xm_xsk_t*)xm_pcalloc(mp,sizeof(*xsk));
+	xm_xsk_frame_t frames[5*XSK_RING_SIZE+3];
+	xsk_drain_t d;
+	pthread_t th;
+	uint32_t i,n = sizeof(frames)/sizeof(frames[0]);
+
+	xsk->fd = -1;
+	xsk->frame_size = XSK_FRAME_SIZE;
+	xsk_ring_init(&xsk->fill,&d.ring,fr);
+
+	/*frames come back with an offset into them, the ring gets the start*/
+	for(i = 0;i<n;i++)
+		frames[i].addr = (uint64_t)i*XSK_FRAME_SIZE+i;
+
+	d.seen = (uint64_t*)xm_pcalloc(mp,n*sizeof(uint64_t));
+	d.n = n;
+	d.got = 0;
+
+	if(pthread_create(&th,NULL,xsk_drain,&d))
+		return -1;
+
+	xm_xsk_rx_release(xsk,frames,n);
+	pthread_join(th,NULL);
+
+	for(i = 0;i<n;i++){
+
+		if(d.seen[i] != (uint64_t)i*XSK_FRAME_SIZE)
+			return -1;
+	}
+
+	return fr->producer == n&&fr->consumer == n?0:-1;
+}
+
+const xm_bench_case_t xm_bench_xsk_cases[] = {
+
+	XM_BENCH_CASE("xsk/ring_burst_8",0,xsk_ring_setup,ring_burst_run,NULL),
+	XM_BENCH_CHECK("xsk/ring",ring_check),
+	XM_BENCH_CHECK("xsk/rx_release",release_check),
+	XM_BENCH_END
+};
@@ -0,0 +1,327 @@
+/*
+ *
+ *      Filename: xm_bench.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 22:14:50
+ * Last Modified: 2026-10-18 22:14:50
+ */
+
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "xm_bench.h"
+
+#define XM_BENCH_MAX_REPS 1000
+
+const char *xm_bench_counter_names[XM_BENCH_NCOUNTERS] = {
+	"cycles","instructions","cache_misses","branch_misses"
+};
+
+static const uint64_t counter_config[XM_BENCH_NCOUNTERS] = {
+
+	PERF_COUNT_HW_CPU_CYCLES,
+	PERF_COUNT_HW_INSTRUCTIONS,
+	PERF_COUNT_HW_CACHE_MISSES,
+	PERF_COUNT_HW_BRANCH_MISSES
+};
+
+/*one group led by the first counter that opened, read in one syscall*/
+static int counter_fd[XM_BENCH_NCOUNTERS] = {-1,-1,-1,-1};
+static int counter_slot[XM_BENCH_NCOUNTERS];
+static int counter_leader = -1;
+static int counter_nr;
+
+double xm_bench_now_ns(void){
+
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+
+	return (double)ts.tv_sec*1e9+(double)ts.tv_nsec;
+}
+
+int xm_bench_counters_open(void){
+
+	struct perf_event_attr attr;
+	int i,fd;
+
+	for(i = 0;i<XM_BENCH_NCOUNTERS;i++){
+
+		memset(&attr,0,sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = PERF_TYPE_HARDWARE;
+		attr.config = counter_config[i];
+		attr.disabled = counter_leader<0;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_GROUP;
+
+		fd = (int)syscall(__NR_perf_event_open,&attr,0,-1,counter_leader,0);
+		if(fd<0){
+
+			/*a vm often lacks one event, keep the others*/
+			counter_slot[i] = -1;
+			continue;
+		}
+
+		if(counter_leader<0)
+			counter_leader = fd;
+
+		counter_fd[i] = fd;
+		counter_slot[i] = counter_nr++;
+	}
+
+	if(counter_leader<0)
+		return -1;
+
+	ioctl(counter_leader,PERF_EVENT_IOC_RESET,PERF_IOC_FLAG_GROUP);
+	ioctl(counter_leader,PERF_EVENT_IOC_ENABLE,PERF_IOC_FLAG_GROUP);
+
+	return 0;
+}
+
+void xm_bench_counters_close(void){
+
+	int i;
+
+	for(i = XM_BENCH_NCOUNTERS-1;i>=0;i--){
+
+		if(counter_fd[i]>=0)
+			close(counter_fd[i]);
+		counter_fd[i] = -1;
+	}
+
+	counter_leader = -1;
+	counter_nr = 0;
+}
+
+static int counters_read(uint64_t *v){
+
+	uint64_t buf[1+XM_BENCH_NCOUNTERS];
+	ssize_t n;
+
+	if(counter_leader<0)
+		return -1;
+
+	n = read(counter_leader,buf,sizeof(uint64_t)*(1+counter_nr));
+	if(n<(ssize_t)sizeof(uint64_t)*(1+counter_nr))
+		return -1;
+
+	memcpy(v,buf+1,sizeof(uint64_t)*counter_nr);
+
+	return 0;
+}
+
+static int _cmp_double(const void *a,const void *b){
+
+	double x = *(const double*)a,y = *(const double*)b;
+
+	return (x>y)-(x<y);
+}
+
+/*nearest rank*/
+static inline double _percentile(const double *sorted,int n,double p){
+
+	double rank = ceil(p*n);
+	int i = (int)rank-1;
+
+	return sorted[i<0?0:i];
+}
+
+/*grow iters until one call of run() lasts about a sample*/
+static uint64_t _calibrate(const xm_bench_case_t *c,void *ctx,double target){
+
+	uint64_t iters = 1;
+	double t,scale;
+
+	for(;;){
+
+		t = xm_bench_now_ns();
+		c->run(ctx,iters);
+		t = xm_bench_now_ns()-t;
+
+		if(t>=target*0.5||iters>=(1ULL<<40))
+			break;
+
+		scale = t>0?target/t*1.2:100;
+		if(scale>100)
+			scale = 100;
+		if(scale<2)
+			scale = 2;
+
+		iters = (uint64_t)((double)iters*scale);
+	}
+
+	return iters;
+}
+
+int xm_bench_run_case(const xm_bench_conf_t *conf,const xm_bench_case_t *c,xm_pool_t *mp,xm_bench_result_t *res){
+
+	double samples[XM_BENCH_MAX_REPS];
+	uint64_t before[XM_BENCH_NCOUNTERS],after[XM_BENCH_NCOUNTERS];
+	uint64_t total[XM_BENCH_NCOUNTERS];
+	void *ctx = NULL;
+	double t,start,sum = 0;
+	int i,j,reps = conf->reps,counted = 0;
+
+	if(reps>XM_BENCH_MAX_REPS)
+		reps = XM_BENCH_MAX_REPS;
+	if(reps<1)
+		reps = 1;
+
+	if(c->setup){
+
+		ctx = c->setup(mp);
+		if(ctx == NULL)
+			return -1;
+	}
+
+	memset(res,0,sizeof(*res));
+	memset(total,0,sizeof(total));
+	res->name = c->name;
+	res->bytes = c->bytes;
+	res->reps = reps;
+	res->iters = _calibrate(c,ctx,conf->sample_ms*1e6);
+
+	start = xm_bench_now_ns();
+	while(xm_bench_now_ns()-start<conf->warmup_ms*1e6)
+		c->run(ctx,res->iters);
+
+	for(i = 0;i<reps;i++){
+
+		int ok = conf->counters&&counters_read(before) == 0;
+
+		t = xm_bench_now_ns();
+		c->run(ctx,res->iters);
+		t = xm_bench_now_ns()-t;
+
+		if(ok&&counters_read(after) == 0){
+
+			for(j = 0;j<counter_nr;j++)
+				total[j] += after[j]-before[j];
+			counted++;
+		}
+
+		samples[i] = t/(double)res->iters;
+		sum += samples[i];
+	}
+
+	if(c->teardown)
+		c->teardown(ctx);
+
+	qsort(samples,reps,sizeof(double),_cmp_double);
+
+	res->min = samples[0];
+	res->p50 = _percentile(samples,reps,0.50);
+	res->p90 = _percentile(samples,reps,0.90);
+	res->p99 = _percentile(samples,reps,0.99);
+	res->mean = sum/reps;
+
+	if(counted == reps){
+
+		res->has_counters = 1;
+		for(j = 0;j<XM_BENCH_NCOUNTERS;j++){
+
+			res->counters[j] = counter_slot[j]<0?-1:
+				(double)total[counter_slot[j]]/((double)res->iters*counted);
+		}
+	}
+
+	return 0;
+}
+
+void xm_bench_result_json(FILE *fp,const xm_bench_result_t *res){
+
+	int j;
+
+	fprintf(fp,"{\"name\":\"%s\",\"iters\":%llu,\"reps\":%d,\"bytes\":%lu,"
+		"\"min_ns\":%.3f,\"p50_ns\":%.3f,\"p90_ns\":%.3f,\"p99_ns\":%.3f,\"mean_ns\":%.3f",
+		res->name,(unsigned long long)res->iters,res->reps,(unsigned long)res->bytes,
+		res->min,res->p50,res->p90,res->p99,res->mean);
+
+	for(j = 0;j<XM_BENCH_NCOUNTERS;j++){
+
+		if(res->has_counters&&res->counters[j]>=0)
+			fprintf(fp,",\"%s\":%.3f",xm_bench_counter_names[j],res->counters[j]);
+		else
+			fprintf(fp,",\"%s\":null",xm_bench_counter_names[j]);
+	}
+
+	fprintf(fp,"}");
+}
+
+void xm_bench_result_print(FILE *fp,const xm_bench_result_t *res){
+
+	fprintf(fp,"%-34s %10.2f ns  [min %.2f p90 %.2f p99 %.2f]",
+		res->name,res->p50,res->min,res->p90,res->p99);
+
+	if(res->bytes)
+		fprintf(fp," %9.1f MB/s",(double)res->bytes*1e3/res->p50);
+
+	if(res->has_counters){
+
+		if(res->counters[0]>0&&res->counters[1]>=0)
+			fprintf(fp,"  %.1f cyc %.2f ipc",res->counters[0],res->counters[1]/res->counters[0]);
+		if(res->counters[2]>=0)
+			fprintf(fp," %.3f cmiss",res->counters[2]);
+		if(res->counters[3]>=0)
+			fprintf(fp," %.3f bmiss",res->counters[3]);
+	}
+
+	fprintf(fp,"\n");
+}
+
+/*the median of name in a baseline, -1 if it has none*/
+static double _baseline_p50(const char *baseline,const char *name){
+
+	char key[256];
+	const char *p,*eol,*v;
+
+	/*the closing quote keeps "a/b" from matching "a/bc"*/
+	snprintf(key,sizeof(key),"\"name\":\"%s\"",name);
+
+	p = strstr(baseline,key);
+	if(p == NULL)
+		return -1;
+
+	eol = strchr(p,'\n');
+	v = strstr(p,"\"p50_ns\":");
+
+	if(v == NULL||(eol&&v>eol))
+		return -1;
+
+	return strtod(v+9,NULL);
+}
+
+int xm_bench_compare(FILE *fp,const char *baseline,const xm_bench_result_t *res,double threshold){
+
+	double base = _baseline_p50(baseline,res->name),delta;
+
+	if(base<=0){
+
+		fprintf(fp,"%-34s %10.2f ns  (not in baseline)\n",res->name,res->p50);
+		return 0;
+	}
+
+	delta = (res->p50-base)*100/base;
+
+	fprintf(fp,"%-34s %10.2f ns  base %10.2f ns  %+7.1f%%%s\n",
+		res->name,res->p50,base,delta,delta>threshold?"  REGRESSION":"");
+
+	return delta>threshold;
+}
+
+int xm_bench_match(const char *filter,const char *name){
+
+	size_t n;
+
+	if(filter == NULL||*filter == '\0')
+		return 1;
+
+	/*"pool" runs pool/..., "pool/palloc" a single case or prefix*/
+	n = strlen(filter);
+
+	return strncmp(filter,name,n) == 0;
+}
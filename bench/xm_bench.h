@@ -0,0 +1,150 @@
+/*
+ *
+ *      Filename: xm_bench.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: microbenchmark harness with hardware counters
+ *        Create: 2026-10-18 22:05:31
+ * Last Modified: 2026-10-18 22:05:31
+ */
+
+#ifndef XM_BENCH_H
+#define XM_BENCH_H
+
+typedef struct xm_bench_case_t xm_bench_case_t;
+typedef struct xm_bench_suite_t xm_bench_suite_t;
+typedef struct xm_bench_conf_t xm_bench_conf_t;
+typedef struct xm_bench_result_t xm_bench_result_t;
+
+#include "xm_constants.h"
+#include "xm_mpool.h"
+
+/*cycles, instructions, cache misses, branch misses*/
+#define XM_BENCH_NCOUNTERS 4
+
+/**
+ * One measured operation. run() performs iters operations back to back;
+ * setup() and teardown() are outside the timing. check() compares the
+ * code against a reference over random input and runs with --check.
+ */
+struct xm_bench_case_t {
+
+	const char *name;
+	/*bytes one operation handles, for the MB/s column, 0 if none*/
+	size_t bytes;
+
+	void *(*setup)(xm_pool_t *mp);
+	void (*run)(void *ctx,uint64_t iters);
+	void (*teardown)(void *ctx);
+	int (*check)(xm_pool_t *mp);
+};
+
+#define XM_BENCH_CASE(name,bytes,setup,run,teardown) {name,bytes,setup,run,teardown,NULL}
+#define XM_BENCH_CHECK(name,check) {name,0,NULL,NULL,NULL,check}
+#define XM_BENCH_END {NULL,0,NULL,NULL,NULL,NULL}
+
+struct xm_bench_suite_t {
+
+	const char *name;
+	const xm_bench_case_t *cases;
+};
+
+struct xm_bench_conf_t {
+
+	const char *filter;
+	int reps;
+	/*warmup and the length one sample aims at, in ms*/
+	double warmup_ms;
+	double sample_ms;
+	int counters;
+	int verbose;
+};
+
+struct xm_bench_result_t {
+
+	const char *name;
+	uint64_t iters;
+	int reps;
+	size_t bytes;
+
+	/*ns per operation over the samples*/
+	double min;
+	double p50;
+	double p90;
+	double p99;
+	double mean;
+
+	/*per operation, valid if has_counters*/
+	int has_counters;
+	double counters[XM_BENCH_NCOUNTERS];
+};
+
+extern const char *xm_bench_counter_names[XM_BENCH_NCOUNTERS];
+
+/**
+ * Open the hardware counters for this thread. Counters are optional:
+ * without perf_event_open access the results carry timings only.
+ * @return 0, or -1 if the counters are not available
+ */
+extern int xm_bench_counters_open(void);
+
+extern void xm_bench_counters_close(void);
+
+/**
+ * Calibrate, warm up and measure c.
+ * @return 0, or -1 if the setup failed
+ */
+extern int xm_bench_run_case(const xm_bench_conf_t *conf,const xm_bench_case_t *c,xm_pool_t *mp,xm_bench_result_t *res);
+
+/*the result as one JSON object on one line, so baselines can be grepped*/
+extern void xm_bench_result_json(FILE *fp,const xm_bench_result_t *res);
+
+extern void xm_bench_result_print(FILE *fp,const xm_bench_result_t *res);
+
+/**
+ * Compare res with the same named result in the text of a baseline
+ * written by --json and print the change of the median.
+ * @return 1 if slower by more than threshold percent, 0 if not or if the
+ *         baseline has no such case
+ */
+extern int xm_bench_compare(FILE *fp,const char *baseline,const xm_bench_result_t *res,double threshold);
+
+extern int xm_bench_match(const char *filter,const char *name);
+
+/*keep the compiler from dropping a result the run never uses*/
+static inline void xm_bench_use(const void *p){
+
+	__asm__ __volatile__("" : : "r"(p) : "memory");
+}
+
+/*a deterministic generator so every run measures the same input*/
+static inline uint32_t xm_bench_rand(uint64_t *state){
+
+	*state = *state*6364136223846793005ULL+1442695040888963407ULL;
+	return (uint32_t)(*state>>33);
+}
+
+extern double xm_bench_now_ns(void);
+
+/*the suites, one per area of the lib*/
+extern const xm_bench_case_t xm_bench_pool_cases[];
+extern const xm_bench_case_t xm_bench_table_cases[];
+extern const xm_bench_case_t xm_bench_decode_cases[];
+extern const xm_bench_case_t xm_bench_fmt_cases[];
+extern const xm_bench_case_t xm_bench_file_cases[];
+extern const xm_bench_case_t xm_bench_lock_cases[];
+extern const xm_bench_case_t xm_bench_hash_cases[];
+extern const xm_bench_case_t xm_bench_time_cases[];
+extern const xm_bench_case_t xm_bench_string_cases[];
+extern const xm_bench_case_t xm_bench_trace_cases[];
+extern const xm_bench_case_t xm_bench_cpu_cases[];
+extern const xm_bench_case_t xm_bench_prof_cases[];
+extern const xm_bench_case_t xm_bench_shm_cases[];
+extern const xm_bench_case_t xm_bench_stats_cases[];
+extern const xm_bench_case_t xm_bench_xsk_cases[];
+extern const xm_bench_case_t xm_bench_classify_cases[];
+extern const xm_bench_case_t xm_bench_manifest_cases[];
+extern const xm_bench_case_t xm_bench_ratectl_cases[];
+extern const xm_bench_case_t xm_bench_srcpool_cases[];
+
+#endif /*XM_BENCH_H*/
@@ -144,7 +144,7 @@ xm_atomic16_set(xm_atomic16_t *v, int16_t new_value)
 static inline void
 xm_atomic16_add(xm_atomic16_t *v, int16_t inc)
 {
-	__sync_fetxm_and_add(&v->cnt, inc);
+	__sync_fetch_and_add(&v->cnt, inc);
 }
 
 /**
@@ -158,7 +158,7 @@ xm_atomic16_add(xm_atomic16_t *v, int16_t inc)
 static inline void
 xm_atomic16_sub(xm_atomic16_t *v, int16_t dec)
 {
-	__sync_fetxm_and_sub(&v->cnt, dec);
+	__sync_fetch_and_sub(&v->cnt, dec);
 }
 
 /**
@@ -373,7 +373,7 @@ xm_atomic32_set(xm_atomic32_t *v, int32_t new_value)
 static inline void
 xm_atomic32_add(xm_atomic32_t *v, int32_t inc)
 {
-	__sync_fetxm_and_add(&v->cnt, inc);
+	__sync_fetch_and_add(&v->cnt, inc);
 }
 
 /**
@@ -387,7 +387,7 @@ xm_atomic32_add(xm_atomic32_t *v, int32_t inc)
 static inline void
 xm_atomic32_sub(xm_atomic32_t *v, int32_t dec)
 {
-	__sync_fetxm_and_sub(&v->cnt, dec);
+	__sync_fetch_and_sub(&v->cnt, dec);
 }
 
 static inline void
@@ -0,0 +1,422 @@
+/*
+ *
+ *      Filename: xm_classify.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 11:26:03
+ * Last Modified: 2026-10-18 11:26:03
+ */
+
+#include "xm_classify.h"
+#include "xm_string.h"
+#include "xm_log.h"
+
+/*table layout: [default][tcp flags:256][udp:1][icmp type<<8|code:65536][icmp6:65536]*/
+#define CLS_DEFAULT_BASE 0
+#define CLS_TCP_BASE     1
+#define CLS_TCP_SIZE     256
+#define CLS_UDP_BASE     (CLS_TCP_BASE+CLS_TCP_SIZE)
+#define CLS_UDP_SIZE     1
+#define CLS_ICMP_BASE    (CLS_UDP_BASE+CLS_UDP_SIZE)
+#define CLS_ICMP_SIZE    65536
+#define CLS_ICMP6_BASE   (CLS_ICMP_BASE+CLS_ICMP_SIZE)
+#define CLS_ICMP6_SIZE   65536
+#define CLS_TABLE_SIZE   (CLS_ICMP6_BASE+CLS_ICMP6_SIZE)
+
+static const char *verdict_names[XM_CLS_MAX] = {
+	"ignore",
+	"success",
+	"failure",
+	"filtered"
+};
+
+static const char tcp_flag_chars[] = "FSRPAUEC";
+
+int xm_classify_verdict_parse(const char *name){
+
+	int i;
+
+	for(i = 0;i<XM_CLS_MAX;i++){
+
+		if(strcasecmp(name,verdict_names[i]) == 0)
+			return i;
+	}
+
+	return -1;
+}
+
+const char *xm_classify_verdict_name(int verdict){
+
+	if(verdict<0||verdict>=XM_CLS_MAX)
+		return "unknown";
+
+	return verdict_names[verdict];
+}
+
+/*one flags term: letters from "FSRPAUEC" or a number*/
+static int _tcp_flags_term(const char *s,const char *e,uint32_t *flags){
+
+	const char *p,*c;
+	char *end;
+	uint32_t v = 0;
+
+	if(s == e)
+		return -1;
+
+	if(xm_isdigit(*s)){
+
+		v = (uint32_t)strtoul(s,&end,0);
+		if(end != e||v>0xff)
+			return -1;
+	}
+	else{
+
+		for(p = s;p<e;p++){
+
+			c = strchr(tcp_flag_chars,xm_toupper(*p));
+			if(c == NULL||*c == '\0')
+				return -1;
+
+			v |= 1U<<(c-tcp_flag_chars);
+		}
+	}
+
+	*flags = v;
+
+	return 0;
+}
+
+/*"SA", "SA/SAR", "0x12", "*"*/
+static int _tcp_flags_parse(const char *s,uint32_t *value,uint32_t *mask){
+
+	const char *slash,*e;
+
+	if(strcmp(s,"*") == 0){
+
+		*value = 0;
+		*mask = 0;
+		return 0;
+	}
+
+	e = s+strlen(s);
+	slash = strchr(s,'/');
+
+	if(_tcp_flags_term(s,slash?slash:e,value))
+		return -1;
+
+	if(slash){
+
+		if(_tcp_flags_term(slash+1,e,mask))
+			return -1;
+	}
+	else{
+
+		*mask = XM_CLS_TCP_DEFAULT_MASK|*value;
+	}
+
+	*value &= *mask;
+
+	return 0;
+}
+
+xm_classify_t *xm_classify_create(xm_pool_t *mp){
+
+	xm_classify_t *cls = (xm_classify_t*)xm_pcalloc(mp,sizeof(*cls));
+
+	if(cls == NULL)
+		return NULL;
+
+	cls->mp = mp;
+	cls->default_verdict = XM_CLS_IGNORE;
+
+	cls->rules = xm_array_make(mp,16,sizeof(xm_classify_rule_t));
+	if(cls->rules == NULL)
+		return NULL;
+
+	/*an empty table still answers every lookup*/
+	if(xm_classify_compile(cls))
+		return NULL;
+
+	return cls;
+}
+
+int xm_classify_rule_add(xm_classify_t *cls,uint8_t proto,uint32_t value,
+	uint32_t mask,uint32_t code,uint8_t verdict){
+
+	xm_classify_rule_t *rule;
+
+	if(verdict>=XM_CLS_MAX)
+		return -1;
+
+	if(proto != IPPROTO_TCP&&proto != IPPROTO_UDP&&
+		proto != IPPROTO_ICMP&&proto != IPPROTO_ICMPV6)
+		return -1;
+
+	rule = (xm_classify_rule_t*)xm_array_push(cls->rules);
+	if(rule == NULL)
+		return -1;
+
+	rule->proto = proto;
+	rule->value = value;
+	rule->mask = mask;
+	rule->code = code;
+	rule->verdict = verdict;
+
+	return 0;
+}
+
+static void _rule_apply(uint8_t *verdict,const xm_classify_rule_t *rule){
+
+	uint32_t f,base,first,n;
+
+	switch(rule->proto){
+
+	case IPPROTO_TCP:
+		for(f = 0;f<CLS_TCP_SIZE;f++){
+
+			if((f&rule->mask) == (rule->value&rule->mask))
+				verdict[CLS_TCP_BASE+f] = rule->verdict;
+		}
+		break;
+
+	case IPPROTO_UDP:
+		verdict[CLS_UDP_BASE] = rule->verdict;
+		break;
+
+	case IPPROTO_ICMP:
+	case IPPROTO_ICMPV6:
+		base = rule->proto == IPPROTO_ICMP?CLS_ICMP_BASE:CLS_ICMP6_BASE;
+
+		if(rule->code == XM_CLS_ANY){
+
+			first = rule->value<<8;
+			n = 256;
+		}
+		else{
+
+			first = (rule->value<<8)|rule->code;
+			n = 1;
+		}
+
+		memset(verdict+base+first,rule->verdict,n);
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void _proto_set(xm_classify_t *cls,uint8_t proto,uint32_t base,uint32_t mask){
+
+	cls->protos[proto].base = base;
+	cls->protos[proto].mask = mask;
+}
+
+int xm_classify_compile(xm_classify_t *cls){
+
+	int i;
+	const xm_classify_rule_t *rules;
+
+	if(cls->verdict == NULL){
+
+		cls->verdict = (uint8_t*)xm_palloc(cls->mp,CLS_TABLE_SIZE);
+		if(cls->verdict == NULL)
+			return -1;
+
+		cls->verdict_size = CLS_TABLE_SIZE;
+	}
+
+	memset(cls->verdict,cls->default_verdict,cls->verdict_size);
+	memset(cls->protos,0,sizeof(cls->protos));
+
+	_proto_set(cls,IPPROTO_TCP,CLS_TCP_BASE,CLS_TCP_SIZE-1);
+	_proto_set(cls,IPPROTO_UDP,CLS_UDP_BASE,0);
+	_proto_set(cls,IPPROTO_ICMP,CLS_ICMP_BASE,CLS_ICMP_SIZE-1);
+	_proto_set(cls,IPPROTO_ICMPV6,CLS_ICMP6_BASE,CLS_ICMP6_SIZE-1);
+
+	rules = (const xm_classify_rule_t*)cls->rules->elts;
+
+	for(i = 0;i<cls->rules->nelts;i++)
+		_rule_apply(cls->verdict,&rules[i]);
+
+	return 0;
+}
+
+static const char *_verdict_get(cmd_parms *cmd,const char *name,uint8_t *verdict){
+
+	int v = xm_classify_verdict_parse(name);
+	const char *err;
+
+	if(v<0){
+
+		err = xm_pstrcat(cmd->pool,cmd->cmd->name,": unknown verdict '",name,
+			"', expect success, failure, filtered or ignore",NULL);
+
+		/*NULL would read as success to the caller*/
+		return err?err:"Unknown classification verdict";
+	}
+
+	*verdict = (uint8_t)v;
+
+	return NULL;
+}
+
+static const char *set_default(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_classify_t *cls = (xm_classify_t*)mconfig;
+
+	return _verdict_get(cmd,w,&cls->default_verdict);
+}
+
+static const char *set_tcp(cmd_parms *cmd,void *mconfig,const char *w,const char *w2){
+
+	xm_classify_t *cls = (xm_classify_t*)mconfig;
+	uint32_t value,mask;
+	uint8_t verdict = XM_CLS_IGNORE;
+	const char *err;
+
+	if(_tcp_flags_parse(w,&value,&mask))
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad tcp flags '",w,"'",NULL);
+
+	if((err = _verdict_get(cmd,w2,&verdict)) != NULL)
+		return err;
+
+	if(xm_classify_rule_add(cls,IPPROTO_TCP,value,mask,0,verdict))
+		return "No memory to add a classification rule";
+
+	return NULL;
+}
+
+static const char *set_udp(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_classify_t *cls = (xm_classify_t*)mconfig;
+	uint8_t verdict = XM_CLS_IGNORE;
+	const char *err;
+
+	if((err = _verdict_get(cmd,w,&verdict)) != NULL)
+		return err;
+
+	if(xm_classify_rule_add(cls,IPPROTO_UDP,0,0,0,verdict))
+		return "No memory to add a classification rule";
+
+	return NULL;
+}
+
+static const char *set_icmp(cmd_parms *cmd,void *mconfig,const char *w,
+	const char *w2,const char *w3){
+
+	xm_classify_t *cls = (xm_classify_t*)mconfig;
+	uint8_t proto = (uint8_t)(uintptr_t)cmd->info;
+	uint32_t type,code;
+	uint8_t verdict = XM_CLS_IGNORE;
+	char *end;
+	const char *err;
+
+	type = (uint32_t)strtoul(w,&end,0);
+	if(*w == '\0'||*end != '\0'||type>255)
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad icmp type '",w,"'",NULL);
+
+	if(strcmp(w2,"*") == 0){
+
+		code = XM_CLS_ANY;
+	}
+	else{
+
+		code = (uint32_t)strtoul(w2,&end,0);
+		if(*w2 == '\0'||*end != '\0'||code>255)
+			return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad icmp code '",w2,"'",NULL);
+	}
+
+	if((err = _verdict_get(cmd,w3,&verdict)) != NULL)
+		return err;
+
+	if(xm_classify_rule_add(cls,proto,type,0,code,verdict))
+		return "No memory to add a classification rule";
+
+	return NULL;
+}
+
+const command_rec xm_classify_cmds[] = {
+
+	XM_INIT_TAKE1("ClassifyDefault",set_default,NULL,0,
+		"verdict for responses no rule matches"),
+
+	XM_INIT_TAKE2("ClassifyTcp",set_tcp,NULL,0,
+		"tcp flags (e.g. SA, R, SA/SAR, 0x12 or *) and a verdict"),
+
+	XM_INIT_TAKE1("ClassifyUdp",set_udp,NULL,0,
+		"verdict for udp responses"),
+
+	XM_INIT_TAKE3("ClassifyIcmp",set_icmp,(void*)IPPROTO_ICMP,0,
+		"icmp type, code (or *) and a verdict"),
+
+	XM_INIT_TAKE3("ClassifyIcmp6",set_icmp,(void*)IPPROTO_ICMPV6,0,
+		"icmpv6 type, code (or *) and a verdict"),
+
+	{NULL}
+};
+
+const char *xm_classify_load(xm_classify_t *cls,xm_pool_t *ptemp,const char *fname){
+
+	const char *err;
+
+	err = xm_process_command_config(xm_classify_cmds,cls,cls->mp,ptemp,fname);
+	if(err)
+		return err;
+
+	if(xm_classify_compile(cls))
+		return "No memory to compile classification table";
+
+	return NULL;
+}
+
+static void _tcp_flags_format(char *buf,uint32_t flags){
+
+	int i;
+
+	for(i = 0;i<8;i++){
+
+		if(flags&(1U<<i))
+			*buf++ = tcp_flag_chars[i];
+	}
+
+	*buf = '\0';
+}
+
+void xm_classify_dump(xm_classify_t *cls,FILE *fp){
+
+	int i;
+	char v[16],m[16];
+	const xm_classify_rule_t *rule;
+
+	fprintf(fp,"Dump classify rules-------------------------------------------\n");
+	fprintf(fp,"default:%s\n",xm_classify_verdict_name(cls->default_verdict));
+
+	rule = (const xm_classify_rule_t*)cls->rules->elts;
+
+	for(i = 0;i<cls->rules->nelts;i++,rule++){
+
+		switch(rule->proto){
+
+		case IPPROTO_TCP:
+			_tcp_flags_format(v,rule->value);
+			_tcp_flags_format(m,rule->mask);
+			fprintf(fp,"tcp flags:%s/%s => %s\n",v,m,xm_classify_verdict_name(rule->verdict));
+			break;
+
+		case IPPROTO_UDP:
+			fprintf(fp,"udp => %s\n",xm_classify_verdict_name(rule->verdict));
+			break;
+
+		default:
+			if(rule->code == XM_CLS_ANY)
+				fprintf(fp,"%s type:%u code:* => %s\n",rule->proto == IPPROTO_ICMP?"icmp":"icmp6",
+					rule->value,xm_classify_verdict_name(rule->verdict));
+			else
+				fprintf(fp,"%s type:%u code:%u => %s\n",rule->proto == IPPROTO_ICMP?"icmp":"icmp6",
+					rule->value,rule->code,xm_classify_verdict_name(rule->verdict));
+			break;
+		}
+	}
+}
@@ -0,0 +1,138 @@
+/*
+ *
+ *      Filename: xm_classify.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: response classification compiled from config directives
+ *        Create: 2026-10-18 11:05:27
+ * Last Modified: 2026-10-18 11:05:27
+ */
+
+#ifndef XM_CLASSIFY_H
+#define XM_CLASSIFY_H
+
+typedef struct xm_classify_t xm_classify_t;
+typedef struct xm_classify_rule_t xm_classify_rule_t;
+typedef struct xm_classify_proto_t xm_classify_proto_t;
+
+#include <netinet/in.h>
+#include "xm_mpool.h"
+#include "xm_tables.h"
+#include "xm_config.h"
+
+/*verdicts*/
+#define XM_CLS_IGNORE    0
+#define XM_CLS_SUCCESS   1
+#define XM_CLS_FAILURE   2
+#define XM_CLS_FILTERED  3
+#define XM_CLS_MAX       4
+
+/*tcp flags as on the wire*/
+#define XM_CLS_TCP_FIN 0x01
+#define XM_CLS_TCP_SYN 0x02
+#define XM_CLS_TCP_RST 0x04
+#define XM_CLS_TCP_PSH 0x08
+#define XM_CLS_TCP_ACK 0x10
+#define XM_CLS_TCP_URG 0x20
+#define XM_CLS_TCP_ECE 0x40
+#define XM_CLS_TCP_CWR 0x80
+
+/*flags compared when a rule gives no explicit mask*/
+#define XM_CLS_TCP_DEFAULT_MASK (XM_CLS_TCP_FIN|XM_CLS_TCP_SYN|XM_CLS_TCP_RST|XM_CLS_TCP_ACK)
+
+#define XM_CLS_ANY 0xffffffff
+
+struct xm_classify_rule_t {
+
+	uint8_t proto;
+	uint8_t verdict;
+
+	/*tcp: flags value/mask; icmp: type and code (XM_CLS_ANY for any code)*/
+	uint32_t value;
+	uint32_t mask;
+	uint32_t code;
+};
+
+/*
+ * One slot per IP protocol number: a response is classified by
+ * verdict[base + (key & mask)], so unknown protocols (base 0,mask 0)
+ * land on the default verdict without a branch.
+ */
+struct xm_classify_proto_t {
+
+	uint32_t base;
+	uint32_t mask;
+};
+
+struct xm_classify_t {
+
+	xm_pool_t *mp;
+
+	xm_array_header_t *rules;
+
+	uint8_t default_verdict;
+
+	xm_classify_proto_t protos[256];
+
+	uint8_t *verdict;
+	size_t verdict_size;
+};
+
+/*config directives, mconfig must be the xm_classify_t*/
+extern const command_rec xm_classify_cmds[];
+
+extern xm_classify_t *xm_classify_create(xm_pool_t *mp);
+
+/**
+ * Add a rule; later rules win over earlier ones where they overlap.
+ * The table must be recompiled with xm_classify_compile afterwards.
+ */
+extern int xm_classify_rule_add(xm_classify_t *cls,uint8_t proto,uint32_t value,
+	uint32_t mask,uint32_t code,uint8_t verdict);
+
+/**
+ * Build the decision table from the default verdict and the rules.
+ * @return 0 on success, -1 if the table cannot be allocated
+ */
+extern int xm_classify_compile(xm_classify_t *cls);
+
+/**
+ * Load rules from a config file and compile them.
+ * @return NULL on success, otherwise the error message
+ */
+extern const char *xm_classify_load(xm_classify_t *cls,xm_pool_t *ptemp,const char *fname);
+
+extern int xm_classify_verdict_parse(const char *name);
+
+extern const char *xm_classify_verdict_name(int verdict);
+
+extern void xm_classify_dump(xm_classify_t *cls,FILE *fp);
+
+static inline uint8_t xm_classify(const xm_classify_t *cls,uint8_t proto,uint32_t key){
+
+	const xm_classify_proto_t *p = &cls->protos[proto];
+
+	return cls->verdict[p->base + (key & p->mask)];
+}
+
+static inline uint8_t xm_classify_tcp(const xm_classify_t *cls,uint8_t flags){
+
+	return xm_classify(cls,IPPROTO_TCP,flags);
+}
+
+static inline uint8_t xm_classify_icmp(const xm_classify_t *cls,uint8_t type,uint8_t code){
+
+	return xm_classify(cls,IPPROTO_ICMP,((uint32_t)type<<8)|code);
+}
+
+static inline uint8_t xm_classify_icmp6(const xm_classify_t *cls,uint8_t type,uint8_t code){
+
+	return xm_classify(cls,IPPROTO_ICMPV6,((uint32_t)type<<8)|code);
+}
+
+static inline uint8_t xm_classify_udp(const xm_classify_t *cls){
+
+	return xm_classify(cls,IPPROTO_UDP,0);
+}
+
+#endif /*XM_CLASSIFY_H*/
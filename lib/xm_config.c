@@ -15,6 +15,12 @@
 #include "xm_errno.h"
 #include "xm_string.h"
 #include "xm_fnmatch.h"
+#include "xm_slice.h"
+#include "xm_trace.h"
+
+XM_TRACE_SITE(trace_cfg_process,"config","process_command_config");
+XM_TRACE_SITE(trace_cfg_getline,"config","getline");
+XM_TRACE_SITE(trace_cfg_directive,"config","directive");
 
 #define MAX_STRING_LEN 8192
 
@@ -268,6 +274,39 @@ const command_rec * xm_find_command(const char *name,
     return NULL;
 }
 
+static const command_rec *find_command_slice(const xm_str_t *name,
+                                             const command_rec *cmds)
+{
+    while (cmds->name) {
+        if (xm_str_caseeq_cstr(name, cmds->name))
+            return cmds;
+
+        ++cmds;
+    }
+
+    return NULL;
+}
+
+/* The directive name of a line as a slice of it, nothing is copied
+ * unless the name is quoted.
+ */
+static void getword_name(xm_pool_t *p, const char **line, xm_str_t *name)
+{
+    xm_str_t rest;
+
+    if (**line == '"' || **line == '\'') {
+        xm_str_from_cstr(name, xm_getword_conf(p, line));
+        return;
+    }
+
+    xm_str_from_cstr(&rest, *line);
+    if (!xm_str_next_token(&rest, &xm_byteset_space, name))
+        xm_str_set(name, rest.data, 0);
+
+    xm_str_ltrim(&rest);
+    *line = (const char *)rest.data;
+}
+
 #define XM_MAX_ARGC 64
 
 static const char *invoke_cmd(const command_rec *cmd, cmd_parms *parms,
@@ -723,7 +762,8 @@ const char *xm_process_command_config(const command_rec *cmds,
     const char *errmsg;
     char *l = xm_palloc (ptemp, MAX_STRING_LEN);
     const char *args = l;
-    char *cmd_name, *w;
+    char *w;
+    xm_str_t cmd_name;
 	const command_rec *cmd;
 	xm_array_header_t *arr = xm_array_make(p, 1, sizeof(cmd_parms));
 	xm_array_header_t *ari = xm_array_make(p, 1, sizeof(char *));
@@ -734,6 +774,8 @@ const char *xm_process_command_config(const command_rec *cmds,
 	char *rootpath, *incpath;
 	int li;
 
+	XM_TRACE_BEGIN(trace_cfg_process);
+
 	errmsg = xm_populate_include_files(p, ptemp, ari, filename, 0);
 
 	if(errmsg != NULL)
@@ -771,24 +813,31 @@ const char *xm_process_command_config(const command_rec *cmds,
 		if(parms == NULL)
 			break;
 
-		while (!(xm_cfg_getline(l, MAX_STRING_LEN, parms->config_file))) {
+		for (;;) {
+			XM_TRACE_BEGIN(trace_cfg_getline);
+			status = xm_cfg_getline(l, MAX_STRING_LEN, parms->config_file);
+			XM_TRACE_END(trace_cfg_getline);
+
+			if (status)
+				break;
+
 			if (*l == '#' || *l == '\0')
 				continue;
 
 			args = l;
 
-			cmd_name = xm_getword_conf(p, &args);
+			getword_name(p, &args, &cmd_name);
 
-			if (*cmd_name == '\0')
+			if (cmd_name.len == 0)
 				continue;
 
-			if (!strcasecmp(cmd_name, "IncludeOptional"))
+			if (xm_str_caseeq_cstr(&cmd_name, "IncludeOptional"))
 			{
 				optional = 1;
 				goto ProcessInclude;
 			}
 
-			if (!strcasecmp(cmd_name, "Include"))
+			if (xm_str_caseeq_cstr(&cmd_name, "Include"))
 			{
 				optional = 0;
 ProcessInclude:
@@ -835,18 +884,21 @@ ProcessInclude:
 				break;
 			}
 
-			cmd = xm_find_command(cmd_name, cmds);
+			cmd = find_command_slice(&cmd_name, cmds);
 
 			if(cmd == NULL)
 			{
 				// unknown command, should error
 				//
 				xm_cfg_closefile(parms->config_file);
-				errmsg = xm_pstrcat(p, "Unknown command in config: ", cmd_name, NULL);
+				errmsg = xm_pstrcat(p, "Unknown command in config: ",
+                                  xm_str_pdup(p, &cmd_name), NULL);
 				goto Exit;
 			}
 
-				errmsg = invoke_cmd(cmd, parms, mconfig, args);
+			XM_TRACE_BEGIN(trace_cfg_directive);
+			errmsg = invoke_cmd(cmd, parms, mconfig, args);
+			XM_TRACE_END(trace_cfg_directive);
 
 			if(errmsg != NULL)
 				break;
@@ -877,6 +929,8 @@ Exit:
 		xm_cfg_closefile(parms->config_file);
 	}
 
+	XM_TRACE_END(trace_cfg_process);
+
 	return errmsg;
 }
 
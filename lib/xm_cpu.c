@@ -0,0 +1,259 @@
+/*
+ *
+ *      Filename: xm_cpu.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 11:20:06
+ * Last Modified: 2026-10-18 11:20:06
+ */
+
+#include <cpuid.h>
+#include "xm_cpu.h"
+#include "xm_atomic.h"
+#include "xm_spinlock.h"
+
+static const char *cpu_level_names[XM_CPU_LEVELS] = {
+	"scalar","sse2","ssse3","sse4.2","avx2","avx512"
+};
+
+static int cpu_ready;
+static int cpu_detected;
+static int cpu_cap = -1;
+static int cpu_env_cap;
+static int cpu_flags;
+
+static xm_cpu_kernel_t *cpu_kernels;
+static xm_spinlock_t cpu_lock = RTE_SPINLOCK_INITIALIZER;
+
+static uint64_t cpu_xgetbv(void){
+
+	uint32_t lo,hi;
+
+	asm volatile("xgetbv" : "=a"(lo),"=d"(hi) : "c"(0));
+
+	return ((uint64_t)hi<<32)|lo;
+}
+
+static int cpu_detect(void){
+
+	unsigned int a,b,c,d,max;
+	uint64_t xcr0;
+
+	max = __get_cpuid_max(0,NULL);
+	if(max<1)
+		return XM_CPU_SCALAR;
+
+	__cpuid(1,a,b,c,d);
+
+	if(!(d&bit_SSE2))
+		return XM_CPU_SCALAR;
+	if(!(c&bit_SSSE3))
+		return XM_CPU_SSE2;
+	if(!(c&bit_SSE4_2)||!(c&bit_POPCNT))
+		return XM_CPU_SSSE3;
+
+	/*the cpu having avx is not enough, the os must save the registers*/
+	if(!(c&bit_OSXSAVE)||!(c&bit_AVX)||max<7)
+		return XM_CPU_SSE42;
+
+	xcr0 = cpu_xgetbv();
+	if((xcr0&0x6) != 0x6)
+		return XM_CPU_SSE42;
+
+	__cpuid_count(7,0,a,b,c,d);
+
+	if(!(b&bit_AVX2)||!(b&bit_BMI2))
+		return XM_CPU_SSE42;
+
+	/*opmask, upper zmm0-15 and zmm16-31*/
+	if((xcr0&0xe0) != 0xe0||!(b&bit_AVX512F)||!(b&bit_AVX512BW)||!(b&bit_AVX512VL))
+		return XM_CPU_AVX2;
+
+	return XM_CPU_AVX512;
+}
+
+/*racing threads compute the same values, no lock needed*/
+static void cpu_setup(void){
+
+	const char *env;
+	int level;
+
+	if(cpu_ready)
+		return;
+
+	cpu_detected = cpu_detect();
+
+	env = getenv(XM_CPU_LEVEL_ENV);
+	if(env&&(level = xm_cpu_level_parse(env))>=0){
+
+		cpu_cap = level;
+		cpu_env_cap = 1;
+	}
+
+	env = getenv(XM_CPU_BENCH_ENV);
+	if(env&&*env&&*env != '0')
+		cpu_flags |= XM_CPU_F_BENCH;
+
+	xm_smp_wmb();
+	cpu_ready = 1;
+}
+
+int xm_cpu_level_detected(void){
+
+	cpu_setup();
+
+	return cpu_detected;
+}
+
+int xm_cpu_level(void){
+
+	cpu_setup();
+
+	return cpu_cap>=0&&cpu_cap<cpu_detected?cpu_cap:cpu_detected;
+}
+
+const char *xm_cpu_level_name(int level){
+
+	if(level<0||level>=XM_CPU_LEVELS)
+		return "unknown";
+
+	return cpu_level_names[level];
+}
+
+int xm_cpu_level_parse(const char *name){
+
+	int i;
+
+	for(i = 0;i<XM_CPU_LEVELS;i++){
+
+		if(strcasecmp(name,cpu_level_names[i]) == 0)
+			return i;
+	}
+
+	/*"sse42" as well as "sse4.2"*/
+	if(strcasecmp(name,"sse42") == 0)
+		return XM_CPU_SSE42;
+
+	return -1;
+}
+
+void xm_cpu_init(int flags){
+
+	cpu_setup();
+
+	cpu_flags |= flags;
+}
+
+void xm_cpu_level_set(int level){
+
+	xm_cpu_kernel_t *k;
+
+	cpu_setup();
+
+	cpu_cap = level;
+
+	xm_spinlock_lock(&cpu_lock);
+
+	for(k = cpu_kernels;k;k = k->next)
+		*k->slot = k->resolver;
+
+	xm_spinlock_unlock(&cpu_lock);
+}
+
+static double cpu_bench_time(xm_cpu_kernel_t *k,xm_cpu_fn_t fn){
+
+	struct timespec t0,t1;
+	double t,best = -1;
+	int r;
+
+	/*the first round warms the caches and the clock*/
+	for(r = 0;r<6;r++){
+
+		clock_gettime(CLOCK_MONOTONIC,&t0);
+		k->bench(fn,16);
+		clock_gettime(CLOCK_MONOTONIC,&t1);
+
+		t = (double)(t1.tv_sec-t0.tv_sec)*1e9+(double)(t1.tv_nsec-t0.tv_nsec);
+		if(r&&(best<0||t<best))
+			best = t;
+	}
+
+	return best;
+}
+
+/*the fastest variant the level allows; a lower level must win by 3%*/
+static int cpu_bench(xm_cpu_kernel_t *k,int top){
+
+	double t,best_t;
+	int i,best = top;
+
+	best_t = cpu_bench_time(k,k->impls[top].fn);
+
+	for(i = top-1;i>=0;i--){
+
+		t = cpu_bench_time(k,k->impls[i].fn);
+		if(t<best_t*0.97){
+
+			best = i;
+			best_t = t;
+		}
+	}
+
+	return best;
+}
+
+xm_cpu_fn_t xm_cpu_resolve(xm_cpu_kernel_t *k){
+
+	int level = xm_cpu_level(),i,best = 0;
+
+	for(i = 0;i<k->nimpls;i++){
+
+		if(k->impls[i].level<=level)
+			best = i;
+	}
+
+	/*a level forced from the environment is a test, take it as is*/
+	if((cpu_flags&XM_CPU_F_BENCH)&&!cpu_env_cap&&k->bench&&best>0)
+		best = cpu_bench(k,best);
+
+	k->chosen = best;
+
+	xm_spinlock_lock(&cpu_lock);
+
+	*k->slot = k->impls[best].fn;
+
+	if(!k->registered){
+
+		k->next = cpu_kernels;
+		cpu_kernels = k;
+		k->registered = 1;
+	}
+
+	xm_spinlock_unlock(&cpu_lock);
+
+	return k->impls[best].fn;
+}
+
+void xm_cpu_dump(FILE *fp){
+
+	xm_cpu_kernel_t *k;
+	int i;
+
+	fprintf(fp,"cpu: detected %s, using %s%s\n",xm_cpu_level_name(xm_cpu_level_detected()),
+		xm_cpu_level_name(xm_cpu_level()),cpu_flags&XM_CPU_F_BENCH?", self benchmark on":"");
+
+	xm_spinlock_lock(&cpu_lock);
+
+	for(k = cpu_kernels;k;k = k->next){
+
+		fprintf(fp,"  %-20s %-8s (",k->name,xm_cpu_level_name(k->impls[k->chosen].level));
+
+		for(i = 0;i<k->nimpls;i++)
+			fprintf(fp,"%s%s",i?" ":"",xm_cpu_level_name(k->impls[i].level));
+
+		fprintf(fp,")\n");
+	}
+
+	xm_spinlock_unlock(&cpu_lock);
+}
@@ -0,0 +1,109 @@
+/*
+ *
+ *      Filename: xm_cpu.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: cpu feature levels and per kernel dispatch
+ *        Create: 2026-10-18 11:20:06
+ * Last Modified: 2026-10-18 11:20:06
+ */
+
+#ifndef XM_CPU_H
+#define XM_CPU_H
+
+typedef struct xm_cpu_impl_t xm_cpu_impl_t;
+typedef struct xm_cpu_kernel_t xm_cpu_kernel_t;
+
+#include "xm_constants.h"
+
+/*each level implies the ones below it*/
+#define XM_CPU_SCALAR 0
+#define XM_CPU_SSE2   1
+#define XM_CPU_SSSE3  2
+#define XM_CPU_SSE42  3   /*and popcnt*/
+#define XM_CPU_AVX2   4   /*and bmi2, with the os saving ymm*/
+#define XM_CPU_AVX512 5   /*f, bw and vl, with the os saving zmm*/
+#define XM_CPU_LEVELS 6
+
+/*time the variants on first use and keep the fastest*/
+#define XM_CPU_F_BENCH 0x1
+
+/*the caps below the detected level, e.g. XM_CPU_LEVEL=sse2*/
+#define XM_CPU_LEVEL_ENV "XM_CPU_LEVEL"
+#define XM_CPU_BENCH_ENV "XM_CPU_BENCH"
+
+/**
+ * The generic function type of a kernel slot. gcc lets void (*)(void)
+ * be cast to and from any function type without a warning; a slot is
+ * always cast back to the real type before the call.
+ */
+typedef void (*xm_cpu_fn_t)(void);
+
+struct xm_cpu_impl_t {
+
+	int level;
+	xm_cpu_fn_t fn;
+};
+
+/**
+ * One dispatched kernel. Callers go through *slot, which starts out as
+ * resolver: the first call picks an implementation with
+ * xm_cpu_resolve, stores it in the slot and forwards the call.
+ */
+struct xm_cpu_kernel_t {
+
+	const char *name;
+
+	xm_cpu_fn_t *slot;
+	xm_cpu_fn_t resolver;
+
+	/*ascending levels, impls[0] runs anywhere*/
+	const xm_cpu_impl_t *impls;
+	int nimpls;
+
+	/*n calls of fn on a fixed input, for the self benchmark, may be NULL*/
+	void (*bench)(xm_cpu_fn_t fn,unsigned n);
+
+	/*set by xm_cpu_resolve*/
+	xm_cpu_kernel_t *next;
+	int registered;
+	int chosen;                 /*index into impls*/
+};
+
+#define XM_CPU_NIMPLS(impls) ((int)(sizeof(impls)/sizeof((impls)[0])))
+
+/**
+ * The level the kernels may use: what cpuid and xgetbv report, capped
+ * by XM_CPU_LEVEL_ENV or xm_cpu_level_set. Detected once.
+ */
+extern int xm_cpu_level(void);
+
+/*the level cpuid reports, whatever the cap*/
+extern int xm_cpu_level_detected(void);
+
+extern const char *xm_cpu_level_name(int level);
+
+/*@return The level or -1 for a name that is none of the level names*/
+extern int xm_cpu_level_parse(const char *name);
+
+/**
+ * Set the flags and read XM_CPU_LEVEL_ENV and XM_CPU_BENCH_ENV. Call
+ * it early; kernels resolved before keep their choice. Without it the
+ * kernels take the best level and the environment is still honoured.
+ */
+extern void xm_cpu_init(int flags);
+
+/**
+ * Cap the level, at most at the detected one, and send every kernel
+ * resolved so far back through its resolver. For tests: a call racing
+ * the reset may still run the previous implementation.
+ */
+extern void xm_cpu_level_set(int level);
+
+/*pick, store and return the implementation of k*/
+extern xm_cpu_fn_t xm_cpu_resolve(xm_cpu_kernel_t *k);
+
+/*the level and the choice of each kernel resolved so far*/
+extern void xm_cpu_dump(FILE *fp);
+
+#endif /*XM_CPU_H*/
@@ -10,6 +10,12 @@
 #include "xm_file.h"
 #include "xm_errno.h"
 #include "xm_string.h"
+#include "xm_trace.h"
+
+/*the syscalls, buffered hits stay untraced*/
+XM_TRACE_SITE(trace_file_read,"file","read");
+XM_TRACE_SITE(trace_file_write,"file","write");
+XM_TRACE_SITE(trace_file_flush,"file","flush");
 
 static int file_read_buffered(xm_file_t *thefile, void *buf,
                                        size_t *nbytes)
@@ -38,8 +44,12 @@ static int file_read_buffered(xm_file_t *thefile, void *buf,
     }
     while (rv == 0 && size > 0) {
         if (thefile->bufpos >= thefile->dataRead) {
-            int bytesread = read(thefile->filedes, thefile->buffer, 
+            int bytesread;
+
+            XM_TRACE_BEGIN(trace_file_read);
+            bytesread = read(thefile->filedes, thefile->buffer, 
                                  thefile->bufsize);
+            XM_TRACE_END(trace_file_read);
             if (bytesread == 0) {
                 thefile->eof_hit = 1;
                 rv = XM_EOF;
@@ -96,9 +106,11 @@ int xm_file_read(xm_file_t *thefile, void *buf, size_t *nbytes)
             }
         }
 
+        XM_TRACE_BEGIN(trace_file_read);
         do {
             rv = read(thefile->filedes, buf, *nbytes);
         } while (rv == -1 && errno == EINTR);
+        XM_TRACE_END(trace_file_read);
 
         *nbytes = bytes_read;
         if (rv == 0) {
@@ -150,9 +162,11 @@ int xm_file_write(xm_file_t *thefile, const void *buf, size_t *nbytes)
         return rv;
     }
     else {
+        XM_TRACE_BEGIN(trace_file_write);
         do {
             rv = write(thefile->filedes, buf, *nbytes);
         } while (rv == (size_t)-1 && errno == EINTR);
+        XM_TRACE_END(trace_file_write);
 
         if (rv == (size_t)-1) {
             (*nbytes) = 0;
@@ -233,6 +247,7 @@ int xm_file_flush_locked(xm_file_t *thefile)
         size_t written = 0;
 		ssize_t ret;
 
+        XM_TRACE_BEGIN(trace_file_flush);
         do {
             ret = write(thefile->filedes, thefile->buffer + written,
                         thefile->bufpos - written);
@@ -240,6 +255,7 @@ int xm_file_flush_locked(xm_file_t *thefile)
                 written += ret;
         } while (written < thefile->bufpos &&
                  (ret > 0 || (ret == -1 && errno == EINTR)));
+        XM_TRACE_END(trace_file_flush);
         if (ret == -1) {
             rv = errno;
         } else {
@@ -0,0 +1,45 @@
+/*
+ *
+ *      Filename: xm_filesystem.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 14:48:12
+ * Last Modified: 2026-10-18 14:48:12
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "xm_filesystem.h"
+#include "xm_log.h"
+
+int xm_parse_sysfs_value(const char *filename, unsigned long *val)
+{
+	FILE *f;
+	char buf[BUFSIZ];
+	char *end = NULL;
+
+	if ((f = fopen(filename, "r")) == NULL) {
+		xm_log(XM_LOG_ERR, "%s(): cannot open sysfs value %s",
+			__func__, filename);
+		return -1;
+	}
+
+	if (fgets(buf, sizeof(buf), f) == NULL) {
+		xm_log(XM_LOG_ERR, "%s(): cannot read sysfs value %s",
+			__func__, filename);
+		fclose(f);
+		return -1;
+	}
+
+	*val = strtoul(buf, &end, 0);
+	if ((buf[0] == '\0') || (end == NULL) || (*end != '\n')) {
+		xm_log(XM_LOG_ERR, "%s(): cannot parse sysfs value %s",
+				__func__, filename);
+		fclose(f);
+		return -1;
+	}
+
+	fclose(f);
+	return 0;
+}
@@ -0,0 +1,263 @@
+/*
+ *
+ *      Filename: xm_fmt.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 16:20:48
+ * Last Modified: 2026-10-18 16:20:48
+ */
+
+#include "xm_fmt.h"
+#include "xm_atomic.h"
+#include "xm_numfmt.h"
+
+static const char null_string[] = "(null)";
+
+static const char hex_lower[] = "0123456789abcdef";
+static const char hex_upper[] = "0123456789ABCDEF";
+
+static int _op_add(xm_fmt_t *fm,uint8_t type,uint8_t upper,const char *lit,size_t len){
+
+	xm_fmt_op_t *op;
+
+	if(fm->nops == XM_FMT_OPS_MAX||len>UINT16_MAX)
+		return -1;
+
+	op = &fm->ops[fm->nops++];
+	op->type = type;
+	op->upper = upper;
+	op->lit = lit;
+	op->len = (uint16_t)len;
+
+	return 0;
+}
+
+static int _compile(xm_fmt_t *fm){
+
+	const char *p = fm->fmt,*lit;
+	int is_long;
+	uint8_t type;
+
+	fm->nops = 0;
+
+	while(*p){
+
+		lit = p;
+		while(*p&&*p != '%')
+			p++;
+
+		if(p>lit&&_op_add(fm,XM_FMT_OP_LIT,0,lit,p-lit))
+			return -1;
+
+		if(*p == '\0')
+			break;
+
+		/*"%%" is a literal percent*/
+		if(p[1] == '%'){
+
+			if(_op_add(fm,XM_FMT_OP_LIT,0,p+1,1))
+				return -1;
+			p += 2;
+			continue;
+		}
+
+		p++;
+
+		/*as in xm_vformatter, 'l' means 64 bits since XM_INT64_T_FMT is "ld"*/
+		is_long = *p == 'l';
+		if(is_long)
+			p++;
+
+		switch(*p){
+
+		case 's':
+			if(is_long)
+				return -1;
+			type = XM_FMT_OP_STR;
+			break;
+
+		case 'c':
+			if(is_long)
+				return -1;
+			type = XM_FMT_OP_CHAR;
+			break;
+
+		case 'd':
+		case 'i':
+			type = is_long?XM_FMT_OP_INT64:XM_FMT_OP_INT;
+			break;
+
+		case 'u':
+			type = is_long?XM_FMT_OP_UINT64:XM_FMT_OP_UINT;
+			break;
+
+		case 'x':
+		case 'X':
+			type = is_long?XM_FMT_OP_HEX64:XM_FMT_OP_HEX;
+			break;
+
+		default:
+			/*flags, width, precision, floats and the rest*/
+			return -1;
+		}
+
+		if(_op_add(fm,type,*p == 'X',NULL,0))
+			return -1;
+
+		p++;
+	}
+
+	return 0;
+}
+
+int xm_fmt_compile(xm_fmt_t *fm){
+
+	if(fm->state == XM_FMT_COMPILED)
+		return 0;
+
+	if(fm->state != XM_FMT_RAW||
+		!xm_atomic32_cmpset(&fm->state,XM_FMT_RAW,XM_FMT_COMPILING))
+		return -1;
+
+	if(_compile(fm)){
+
+		fm->state = XM_FMT_FALLBACK;
+		return -1;
+	}
+
+	/*ops must be visible before the state says so*/
+	xm_smp_wmb();
+	fm->state = XM_FMT_COMPILED;
+
+	return 0;
+}
+
+static char *_hex_emit(char *end,uint64_t v,int upper){
+
+	const char *digits = upper?hex_upper:hex_lower;
+
+	do{
+		*--end = digits[v&0xf];
+		v >>= 4;
+	}while(v);
+
+	return end;
+}
+
+int xm_fmt_vsnprintf(xm_fmt_t *fm,char *buf,size_t len,va_list ap){
+
+	char num[24];
+	char *end = num+sizeof(num);
+	const xm_fmt_op_t *op,*last;
+	const char *s;
+	char *q,*d = buf;
+	char *e = len?buf+len-1:buf;
+	size_t n,total = 0,room;
+	int64_t i64;
+
+	if(fm->state != XM_FMT_COMPILED&&xm_fmt_compile(fm))
+		return xm_vsnprintf(buf,len,fm->fmt,ap);
+
+	xm_smp_rmb();
+
+	for(op = fm->ops,last = op+fm->nops;op<last;op++){
+
+		switch(op->type){
+
+		case XM_FMT_OP_LIT:
+			s = op->lit;
+			n = op->len;
+			break;
+
+		case XM_FMT_OP_STR:
+			s = va_arg(ap,const char*);
+			if(s == NULL)
+				s = null_string;
+			n = strlen(s);
+			break;
+
+		case XM_FMT_OP_INT:
+			i64 = va_arg(ap,int);
+			goto signed_emit;
+
+		case XM_FMT_OP_INT64:
+			i64 = va_arg(ap,int64_t);
+
+		signed_emit:
+			if(i64<0){
+
+				q = xm_u64_to_dec_end(end,(uint64_t)0-(uint64_t)i64);
+				*--q = '-';
+			}
+			else{
+
+				q = xm_u64_to_dec_end(end,(uint64_t)i64);
+			}
+			s = q;
+			n = end-s;
+			break;
+
+		case XM_FMT_OP_UINT:
+			s = xm_u64_to_dec_end(end,va_arg(ap,unsigned int));
+			n = end-s;
+			break;
+
+		case XM_FMT_OP_UINT64:
+			s = xm_u64_to_dec_end(end,va_arg(ap,uint64_t));
+			n = end-s;
+			break;
+
+		case XM_FMT_OP_HEX:
+			s = _hex_emit(end,va_arg(ap,unsigned int),op->upper);
+			n = end-s;
+			break;
+
+		case XM_FMT_OP_HEX64:
+			s = _hex_emit(end,va_arg(ap,uint64_t),op->upper);
+			n = end-s;
+			break;
+
+		default: /*XM_FMT_OP_CHAR*/
+			num[0] = (char)va_arg(ap,int);
+			s = num;
+			n = 1;
+			break;
+		}
+
+		total += n;
+
+		if(len == 0)
+			continue;
+
+		room = e-d;
+		if(n>room){
+
+			/*truncated like xm_snprintf: fill up and report len-1*/
+			memcpy(d,s,room);
+			d += room;
+			*d = '\0';
+			return (int)len-1;
+		}
+
+		memcpy(d,s,n);
+		d += n;
+	}
+
+	if(len)
+		*d = '\0';
+
+	return (int)total;
+}
+
+int xm_fmt_snprintf(xm_fmt_t *fm,char *buf,size_t len,...){
+
+	va_list ap;
+	int cc;
+
+	va_start(ap,len);
+	cc = xm_fmt_vsnprintf(fm,buf,len,ap);
+	va_end(ap);
+
+	return cc;
+}
@@ -0,0 +1,81 @@
+/*
+ *
+ *      Filename: xm_fmt.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: precompiled formats for hot xm_snprintf call sites
+ *        Create: 2026-10-18 16:04:33
+ * Last Modified: 2026-10-18 16:04:33
+ */
+
+#ifndef XM_FMT_H
+#define XM_FMT_H
+
+typedef struct xm_fmt_t xm_fmt_t;
+typedef struct xm_fmt_op_t xm_fmt_op_t;
+
+#include <stdarg.h>
+#include "xm_constants.h"
+#include "xm_string.h"
+
+#define XM_FMT_OPS_MAX 16
+
+/*op types*/
+#define XM_FMT_OP_LIT    0
+#define XM_FMT_OP_STR    1   /*%s*/
+#define XM_FMT_OP_INT    2   /*%d %i*/
+#define XM_FMT_OP_UINT   3   /*%u*/
+#define XM_FMT_OP_INT64  4   /*%ld %li*/
+#define XM_FMT_OP_UINT64 5   /*%lu*/
+#define XM_FMT_OP_HEX    6   /*%x %X*/
+#define XM_FMT_OP_HEX64  7   /*%lx %lX*/
+#define XM_FMT_OP_CHAR   8   /*%c*/
+
+/*compile states*/
+#define XM_FMT_RAW       0
+#define XM_FMT_COMPILING 1
+#define XM_FMT_COMPILED  2
+#define XM_FMT_FALLBACK  3
+
+struct xm_fmt_op_t {
+
+	uint8_t type;
+	uint8_t upper;
+	uint16_t len;
+	const char *lit;
+};
+
+/**
+ * A format string and the typed emit ops it compiles to. Only plain
+ * conversions without flags, width or precision are compiled; any other
+ * format is marked fallback and goes through xm_vformatter, so the
+ * output is always the same as xm_snprintf's.
+ */
+struct xm_fmt_t {
+
+	const char *fmt;
+	volatile uint32_t state;
+	int nops;
+	xm_fmt_op_t ops[XM_FMT_OPS_MAX];
+};
+
+#define XM_FMT_INIT(f) {(f),XM_FMT_RAW,0,{{0,0,0,NULL}}}
+
+/*declare a format compiled on its first use*/
+#define XM_FMT_DEFINE(name,f) static xm_fmt_t name = XM_FMT_INIT(f)
+
+/**
+ * Compile fm->fmt. Safe to race: one caller compiles, the others see
+ * XM_FMT_COMPILING and format through xm_vformatter meanwhile.
+ * @return 0 if compiled, -1 if the format needs the generic formatter
+ */
+extern int xm_fmt_compile(xm_fmt_t *fm);
+
+/**
+ * Same contract as xm_vsnprintf for fm->fmt.
+ */
+extern int xm_fmt_vsnprintf(xm_fmt_t *fm,char *buf,size_t len,va_list ap);
+
+extern int xm_fmt_snprintf(xm_fmt_t *fm,char *buf,size_t len,...);
+
+#endif /*XM_FMT_H*/
@@ -0,0 +1,2420 @@
+/*
+ *
+ *      Filename: xm_html_entities.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: HTML5 named character references
+ *        Create: 2026-10-18 19:36:51
+ * Last Modified: 2026-10-18 19:36:51
+ */
+
+#ifndef XM_HTML_ENTITIES_H
+#define XM_HTML_ENTITIES_H
+
+/*
+ * Generated from the WHATWG named character reference list, do not edit.
+ * A minimal perfect hash over the names without the ';':
+ *   bucket = fnv1a(name, 0) % XM_HTML_ENT_BUCKETS
+ *   slot   = fnv1a(name, xm_html_ent_disp[bucket]) % XM_HTML_ENT_COUNT
+ * where fnv1a(s, seed) starts from 2166136261 ^ seed. legacy is set for
+ * the names a browser also accepts without the ';'.
+ */
+
+#define XM_HTML_ENT_COUNT 2125
+#define XM_HTML_ENT_BUCKETS 532
+#define XM_HTML_ENT_NAME_MAX 31
+#define XM_HTML_ENT_LEGACY_MAX 6
+
+typedef struct {
+	uint16_t off;
+	uint8_t len;
+	uint8_t legacy;
+	uint32_t cp1;
+	uint32_t cp2;
+} xm_html_ent_t;
+
+static const char xm_html_ent_names[] =
+	"downdownarrowsgscrbigsqcupduarroSoltlaquogammadZacuteSOFTcyLessFullEqual"
+	"acyForAllifrapEiinfinaeligmpquotEacutenotinImpliessubPsitfrproptoDScy"
+	"ZeroWidthSpacetrianglerighteqsearhksmashpUnderBracketCircleDotElementKcy"
+	"varepsilontimesdLeftTeeArrowbigoplusLongleftarrowmfrFilledSmallSquare"
+	"subEszligRscrbethhstrokgtlParmeasuredanglecuescmDDotsupGreaterGreater"
+	"rtrisdoteoastglEIJligointboxvLicircrpargtlfloorHscracdblacktriangleleft"
+	"FcyPartialDLcaronffligNotGreaterFullEqualAmacrsfriumlplustwoapidffllig"
+	"homthtvpropgvnEngeqslantafrcylctyboxURthksimcirclearrowrightnsqsubesharp"
+	"doublebarwedgeLongLeftRightArrowecirvscrtcaronsubnEcongNotCupCapbumpe"
+	"nvgensubshyDiacriticalDotLowerLeftArrowsuccneqqitildenleqqboxhdeasterlg"
+	"rbracesup2DZcyRightDownTeeVectornVdashbbrktbrkprofsurfuarrCirclePlus"
+	"DiacriticalGravelparltnsubEnleftrightarrowiquesttimesscapldquoofrYfr"
+	"lsquoDownRightTeeVectorheartscdotSubsetEqualpuncspordmbottomLscr"
+	"OverBraceBernoullisvarsigmasuccsimProportionalparslkappartimesDarrblk12"
+	"UpsiprgesdotInvisibleTimesCayleyswcirclrarrlangNotRightTriangleEqual"
+	"lozengeltrifharrcirimofldquorecolonsupdotisinvKopfGreaterTildedopfldca"
+	"eDDotMediumSpacephivurcornercopysrLacuteboxUlRfrMinusPlusbkarowsmeparsl"
+	"OacutecupcapboxhUrAarrboxVrTildeTildeUparrowtridotvartriangleleftHARDcy"
+	"scErarrfsangmsdcheckOopfUacutexcircgtnlarrhellipodashduharsqufcapcup"
+	"rbrkslutrianglelefteqCircleMinusThereforeOcircotildefjligNotGreaterEqual"
+	"uwangletritimeHumpEqualdrcropQUOTboxDLRightDownVectorvsupnePoincareplane"
+	"mcommawrEgravexotimeRightCeilingnmidltdotAcyrarrapzigrarrltribacksimnles"
+	"zfrIukcylbbrknotinvbintsimgErlarrLeftRightVectorotimesboxboxZetancedil"
+	"lcaronnearhkctdotvsupnEswarrSquareIntersectionangrtvbxwedgertrifutrifSfr"
+	"notUbrevenvapngeqNestedGreaterGreaterDoubleLongRightArrownGtngefllig"
+	"divonxGJcylrcornerrsquonsubseteqqsqcapsshortparallelShortLeftArrowscaron"
+	"ScboxVHuscrccaronNotExistsvfrwreathcommatiiLeftArrowBarphiLopfEfrtwixt"
+	"angmsdabmapstodownvsubneNcyOverParenthesisRopfjukcyntildedeltaYUcyDot"
+	"THORNcwconintomicronregDcynsuccBfrverbarEscrhscrRarrtlycircnsupseteqq"
+	"UopfswarhkleftrightharpoonsYAcySacutelneqqcircledcircUpDownArrowcacute"
+	"leftrightarrowstoplarrtlisinEiiintsceyfrvarrhonLeftrightarrowsupseteqSum"
+	"CloseCurlyDoubleQuotezcyangmsdadRrightarrowJscrcomplexesnltriehcircmap"
+	"mapstoNtildedownharpoonleftgcircAlphaNegativeThinSpaceOfrLambdaConint"
+	"GammanleRightUpVectorBarkfriocyrarrbfssolbGturtrirightarrowtail"
+	"nshortparallelGghairspparauArrTauntrianglelefteqReverseUpEquilibrium"
+	"leftarrowlooparrowleftPhileqOmacrMopfcircledRbumpcupdotAgrave"
+	"NotLeftTriangleBarmapstoupdalethNotEqualTildelesgesuplusLTdaggerggboxUL"
+	"isinsmapstoleftfrac25BscrLeftTeeVectoraacutesmilemodelsjcirctriangleleft"
+	"ratailldrdharinfinprecsimDoubleLeftTeeNotSquareSupersetEqual"
+	"leftleftarrowsnleqslantGTsolbarfnofLleftarrowlbracehookleftarrowkjcy"
+	"rtrielessdotncupimpedGreaterLessgnEdharrSucceedsEquallobrktimesbarsmtes"
+	"downarrowcapcapzwjTcaronSucceedsSlantEqualHfrkcyxuplusfcyxhArrNopfcurarr"
+	"NotHumpEqualgsimlnldrffiligoopfscykscrnsupDownTeeforkAssign"
+	"leftrightarrowNotEqualsqsubsetmaleNotSquareSubsetEqualnequivlmidotBumpeq"
+	"SHcyxrarrkhcygtrdotiecybseminearrdlcornlatxniscurlyeqprecngtboxDRdrcorn"
+	"kgreenGreaterEqualLmidotzcaronTripleDotintlarhksbquolEgnsubseteqbarwed"
+	"esimboxdRoscrcfrlarrplnshortmidnablavarpidemptyvUmacrOdblaccupbrcap"
+	"curlyveeVvdashbowtienLeftarrowNuumacrlarrfsAumlGdotbigcapNotSuperset"
+	"suphsubNegativeVeryThinSpaceVscrwedgeDiacriticalAcutesuccapproxexist"
+	"acutecudarrlNegativeThickSpaceemspDownArrowUpArrowChiomidveeeqawintlarr"
+	"gtccbigodotxsqcupcirfnintocirsqsupdivprnsimtrpeziumnotnicurarrmAscrel"
+	"dscynsparlesdotlrmrdcaoacuteangnsupsetcircledastsimdotveebarniIcyropar"
+	"nangrsaquolcynsubeinfintieboxHDolarrpartepsivLeftCeilinggnesdotlBarr"
+	"periodVerticalBarBetamultimapDoubleLongLeftArrowScynharrbnotThinSpace"
+	"trisbboxhDKcedilrparcommatbrkcaroniiotalongleftrightarrow"
+	"LeftDownVectorBarUcyufishtforkvcsupRightVectorBarnGtvhorbarisinsvgimel"
+	"cscrccircNotLessLessLeftTriangleBarTcedilVbarimageCdotVfrgesccvarpropto"
+	"LeftUpTeeVectornvgtemptyvintercalsimgeqcolongdotnltrinapidLJcynvrArrnsc"
+	"efremptysetUnderBarboxdrthkapNegativeMediumSpaceeogonPrecedesTilde"
+	"cudarrrloplusnvdashcularrpDoubleDownArrowogonhamiltCscrBopfnrtrie"
+	"ShortUpArrowdegchcynhparprecnsimdstrokdbkarowraquoohbargcyclubsuitrect"
+	"suplarrracutendashdiamondsuitPiUpTeecsupethickapproxfltnsUarrvartheta"
+	"conintharrwRightTeeeqslantgtrDiamondVopfDcaroneqslantlessvarsupsetneq"
+	"zdotflatOmegacapUscrXscrtprimeDownLeftRightVectorsolbigcupInvisibleComma"
+	"longleftarrownaturplussimanddPrecedesEqualcirsciriiiintwfrsextxcup"
+	"rarrsimtrianglerightltimesPrecedescedilFilledVerySmallSquaresup1NotTilde"
+	"angsphzacuteDoubleLeftRightArrowrightarrowqfrOEligAbreveccupssm"
+	"NotNestedLessLessgfrCupCapnvsimgtrapproxnotindotEmacrminusdsup3Tscrepar"
+	"HaceknotinvcgvertneqqnvDashcirclearrowleftutildeorarrLongLeftArrowsstarf"
+	"ThetalArrprecNotGreaterGreatertriminusamalgwedbariexclnprcuemusupmult"
+	"fopfminusNotSupersetEquallmoustpcylsqberDotccupsbumpeqGreaterFullEqual"
+	"tshcyolinehopfupsihulcropexponentialedcycupNotVerticalBarfiligcircledS"
+	"UnderParenthesissemiDownLeftVectorBarColonlbrkengsimswnwarbullnbumpe"
+	"frac56DstrokNotPrecedesEqualsubdottradedrbkarowIOcyedotfrac45gtreqqless"
+	"NcedilrbrackrnmidlbrksludtriDoubleLongLeftRightArrowgeparUnionPlusiota"
+	"intcalplusdulcubmstposntlgZfrEmptySmallSquarewpupharpoonleftohmvarrdtrif"
+	"lbarrlscrCoproductbemptyvnearrowrAtailVeryThinSpaceapltrPar"
+	"SquareSubsetEqualharrlhblklarrbnparornapproxaringlHareopfgesllambda"
+	"awconintUpsilonrcaronvarphirdquoProportionbbrkEdoticypreangmsdag"
+	"rightleftharpoonsldrusharnivnsucceqlbrackpertenkSHCHcysimeqNacutevnsup"
+	"blacktriangledownrightharpoondownvDashfscrIotalEexclfemaleLongrightarrow"
+	"DotDotrarrnisnsqsupeangelegsupsupsubrarrlarrsimContourIntegrallesapprox"
+	"npolintRightArrowlatesquarfDDotrahdUfrascrbcongandslopeepsisqcap"
+	"ClockwiseContourIntegralEogonlarrbfsRightUpTeeVectorccedilbsimebigvee"
+	"rhovnbumpCedillaiscrYcygopfnLtLlsscrIntegralxlarrorvvarnothingfrac12"
+	"rightsquigarrowspadesbcyRightArrowBarRshsqsubecheckmarklsquorsucccurlyeq"
+	"DscrxutricircdArrminusbapeNotSubsetEqualeplusMellintrfbigstarelsdot"
+	"ZcaronsupedotLshlesssimhyphenloangUpArrowDfrtopfprimeemptyvBarvOrYacute"
+	"IacuteegsdotLongleftrightarrowrealsfraslengCOPYEsimlneqMscrecircefDot"
+	"dotplusphoneuumlgljFopfhkswarowintegersltriepmxilltriprurelandvboxVeth"
+	"ecaronrarrchardcytwoheadleftarrowThickSpaceshcybnequivlstrokYumlcongdot"
+	"uuarrboxVLsimnelopfUtildeCenterDotRightTriangleEqualSquareUnionsubset"
+	"equivDDexpectationuopfalephnexistnwarrapacirsectuacuteStarrealinency"
+	"preccurlyeqlshbreveMuntrianglerightlacutevartrianglerightdzigrarrrharu"
+	"triangledownLeftTriangleEqualboxhupivdlcropCircleTimesrfloorqprime"
+	"approxeqforallrhoNotLessSlantEqualnexiststhereforeangmsdaanleqthorn"
+	"thetasymVerticalLinesmidBreveRhocrossfrownlongmapstoycyicufrLfr"
+	"DownLeftVectordiameumlColonertriltriTildeEqualSquareSubsetsimlequiv"
+	"frac35gggEumlqintplusacirnvHarrssmileosoleeprecapproxboxUr"
+	"NotNestedGreaterGreaterlthreealefsymstraightepsilonbfrleegtcedilbarwedge"
+	"dfrImaginaryIWedgeecyEquilibriumsupsetneqqjscrUnionimacrQscrxmapcolonngE"
+	"IntscnapkappavbecausRightTeeArrowcomplementNotPrecedesRightVectortilde"
+	"euroGfrbopfsmtiopftopforkeparslrightharpoonupsdotbsucceqdollarisincomp"
+	"UpArrowBarblacktrianglerightnotnivcodotangrtrmoustacheLowerRightArrow"
+	"copfDashvlvnEoslashangmsdafcaretnwneardarrCrossGscrlozFfrsmallsetminus"
+	"UpTeeArrownsmiddscrYcircNotPrecedesSlantEqualfallingdotseqangstRcy"
+	"subsetneqqscnsimSigmatrieijligrHarTabVerticalTildeRightDoubleBracket"
+	"rdquorbigotimesparsimxopfMcyleftharpoonupDiacriticalDoubleAcuteMaplfisht"
+	"risingdotseqtopcirlhardnparallelocythinspNcaronNotDoubleVerticalBardie"
+	"lozfDaggerLeftDoubleBracketnapErbrkeIdotlatailLessSlantEqualsubsupsqcups"
+	"laprdshhfrbetweenstraightphielscenterdotrscrDownArrowBarCfrmdashhslash"
+	"equalstargetSqrtplanckhincarenhArrgneqsupsetneqZdotdisinnwArrxscr"
+	"NotLeftTriangleJsercyScaronDotEquallsimhookrightarrowprsimlsaquomicro"
+	"CongruentnlArrrsquorvrtrishchcyrbarrproflinesqcuprarrlpUumluparrow"
+	"supseteqqbsolhsubbumpEsearrowLeftArrowRightArrowabreveinodot"
+	"Leftrightarrowrfractoeacueprprnaptstroklbrksldpropsuphsol"
+	"RightTriangleBarsupplusDownLeftTeeVectordigammaApplyFunctionyucysacute"
+	"brvbarcsubesungacircnjcyprodlesseqqgtrCconintcompfnisindotnumspyumlsime"
+	"EqualerarrbernoudivideontimesYopfsqsubseteqcirxharryopfSuppointint"
+	"RightTriangledotminusradicringpimarkeroperpboxVhlharuordLessLess"
+	"LeftVectorBarImtdotlarrhknparsltscymlcpnrarrcaumlkcedilzeetrfboxuLovbar"
+	"angmsdacnpartsetminusnsimelharulgtrlessdblacgeqslantLessEqualGreaternfr"
+	"blacklozengewopfgammavsubnENotSquareSupersetgtreqlessUnderBracepluscir"
+	"sopflessgtrrmoustdHaromacrcupcuprationalsgnsimnaturalboxplusmnpluslgE"
+	"EcaronboxHpoundlrhardHstrokolcirlaemptyvrharulvltridwanglebNot"
+	"bigtriangledownnleftarrownwarrowplusdoSubNotLessEqualbdquorbrksld"
+	"lvertneqqpscrclubsulcornUarrocirloarrnsccuebecauseCcedilominussubsetneq"
+	"iogoneqcircucircVerbarfrac58NewLineasympXfrOpenCurlyQuote"
+	"GreaterSlantEqualorderheartsuitscedilboxdlanglemidcirboxDlvangrt"
+	"succnapproxTRADEcurrennopfRightTeeVectornltPfrAogonntrianglerighteq"
+	"there4rfishtYIcyhybullncapNonBreakingSpacesqsubntglthetaDiacriticalTilde"
+	"nacutelesseqgtrsquareleqqseArrroangNscrDoubleLeftArrowProductsqsupe"
+	"ugraveuhblkboxVRboxvRcemptyvodsoldpermilcwintAMPnpreljcyNotTildeEqual"
+	"capandnwarhkNotCongruentkopfrangdLeftUpDownVectorNotTildeTildeboxHu"
+	"planckrthreescsimsparSubsetrarrhkRacutenotinErArraopfnesearVdashl"
+	"DoubleRightTeecolonesubeSucceedsTildePrecedesSlantEqualotimesascirE"
+	"subplusLtLcyiukcyLeftVectorscircnedotSquareVerticalSeparatoreacutepercnt"
+	"RightUpVectordsolboxvhItildeBcyangmsdahrightrightarrowsubreveagrave"
+	"LeftTeesubnemaltesehArrhksearowsqucopyEmptyVerySmallSquareHumpDownHump"
+	"LessTildevertZHcyplankvnsubsetdashgEFscrLessGreaterlesgnlessAtildexrArr"
+	"SucceedsplusmnsupdsubupuparrowspluseoeligbepsiboxurangzarrngeqqGammad"
+	"timesbnrarrwLeftTriangleKappaRightArrowLeftArrowasympeqnbspyicyAring"
+	"ncaronnvlArrnsceNotUdblaccurvearrowleftCopfastprecneqqSuchThatrange"
+	"doteqdotUpperLeftArrowcapdotnesimboxtimesEtaLcedilsubsimlpar"
+	"rightleftarrowsxfrsmtequestpopffrac13pfrxveeupdownarrowcupsLeftArrow"
+	"udarrboxminusnotnivaUbrcyETHgtquestUpperRightArrowKscr"
+	"OpenCurlyDoubleQuoteOverBarNotTildeFullEqualroplussupsimdtdotCacuteDel"
+	"mldrdjcyrotimeslsimgafdzcyUogondashvrshfrac16BarwedUpArrowDownArrow"
+	"diamondsubsublnapddaggerNfrCcircCloseCurlyQuoteNotSucceedsTildeGbreve"
+	"notnivbjmathGcedilIscrtopbotmcyograveelintersuHarminusdulmoustache"
+	"sqsupsetKHcygneqqandupsirsqbwedgeqeDotocircbulletsigmaDoubleUpArrow"
+	"lessapproxsubedotvopfsuccPscrvArrimaglinemacrvzigzagnrarrrealpart"
+	"lnapproxLeftDownVectorsetmnoparccapsgElNotLeftTriangleEqualbigwedge"
+	"LeftarrowQfrltcirrlmltquestleftarrowtailbnegnapamprcyImacrgtdotKJcyhalf"
+	"boxDrcrarracElrtriIntersectionnotinvaIfrPopflotimesLeftUpVectorPrime"
+	"CcaronLongRightArrowulcornerGcyfrac15curvearrowrightegsroarrRightFloor"
+	"zhcymhoFouriertrfplusbDownArrowquesteqNotGreaterplusOscrweierpdotsquare"
+	"ReverseEquilibriumDJcybackprimeratiohbartwoheadrightarrowrightthreetimes"
+	"TstrokgeqnLlherconRcaronbackepsilonnprecJcircddarrPcynRightarrowvnsub"
+	"subseteqlfrREGblanknpreceqepsilonZcyShortRightArrowleftharpoondown"
+	"DoubleDotgesdotolcoloneqnprudblaccentUpdownarrowExistsscnERuleDelayed"
+	"zscrleqslantdcaronJcyAcircyscramacrenspScircdotlneVertLeftUpVectorBar"
+	"LstrokDoubleContourIntegralWscrboxulrcedilOumlXicircleddash"
+	"TildeFullEqualgeqqboxvHfrac78lesdotoShortDownArrowBarvxoplusreallowbar"
+	"capbrcupcirmidnlEnscrvarkappaequestranglelongrightarrowLangetaprnE"
+	"scpolintbigcircMfrseswarcurlywedgeNotGreaterTildesimplusJfrjsercylnsim"
+	"pitchforkblacktriangleboxHUemacrssetmnSupersetOmicrongacutelangdnapos"
+	"AacuteRBarrgsimelarrlpsuccnsimlrharBackslashnlsimgessupellthetavGopf"
+	"shortmidcapsiffimathltccEpsilonbacksimeqsimlEHopfcireandandboxhigrave"
+	"uharrTScyrppolintSscrNotSubsetAEligpsiGreaterEqualLessvdash"
+	"HorizontalLinelowastDDropfgtrsimsupsetzopfrceilzwnjsimrarrltlarrPr"
+	"HilbertSpacetriplusVeefrac23Xopfnisdmidastutriraemptyvddotsequcymid"
+	"emsp13SupsetSopfvarsubsetneqqEcysfrowntelrecsupnenvinfinblk14perpGcirc"
+	"urcornutdotbarveeIumlrdldharrrarryacyxdtrinumeroangrtvbdxodotRarrRcedil"
+	"TopfuharllnEblk34vBarglafrac34simLeftRightArrowEcircbscrcularrubrcyAopf"
+	"iacuteNotLessGreaterLaplacetrfloparncongdotfpartintqscrNotLessTildeblock"
+	"nsupestarntriangleleftnaturalsnrArrgeslesyenhoarrboxdLgelgnapprox"
+	"DoubleVerticalBarogtSupersetEquallatesNotHumpDownHumpstrnsgsim"
+	"quaternionsintprodorderofthicksimncongIopfjcyDeltadividedfishtTildeouml"
+	"OtildeboxHdsearrprapOtimesupharpoonrighttauswArrDoubleUpDownArrowell"
+	"NoBreaknrightarrowgtrarrOgravenelesdotorescrvarsupsetneqqmumaplAarrboxvr"
+	"aposngtrbsolbOverBracketcuwedRightDownVectorBarboxvlnuultri"
+	"NotGreaterSlantEqualgraveLeftFloorENGUcirccuveenvltPlusMinuscsubBecause"
+	"UringmopfeqsimZscrnumDownBreveffrlcedilDoubleRightArrowsubmultbsim"
+	"luruharesdotDownTeeArrowtcyolcrossnGgwscrIgravevellipCHcyjopfsccuesigmaf"
+	"mscrneArrltordfngespreceqsigmavWfrbiguplusupsilonNotRightTriangleBar"
+	"doteqsupEllarrruluharSquareSupersetVcybetabsolnVDashNotRightTriangle"
+	"starflesccororlangleyacutefrac18qopfDownarrowbackcongsoftcyNotLessrobrk"
+	"frac14subseteqqoplusEopfcoprodKfrzetatriangleOcyvarsubsetneq"
+	"ReverseElementvcyIogonbigtriangleuprlharNotGreaterLessrbbrkTSHcy"
+	"NotSucceedsimagpartTcytriangleqtosagtcirtintglprecnapproxRoundImplies"
+	"NJcynvltrieleftrightsquigarrowCapScedilgbreveegravexcapSmallCirclecupor"
+	"CounterClockwiseContourIntegrallsimedharlRightAngleBracketnsupseteqsrarr"
+	"nrtrinvleYscrEqualTildeLeftDownTeeVectorlooparrowrightorslopeUgrave"
+	"bprimelceilrarrplsupnEldshllcornercirceqCupprofalarchiineqvparslodblac"
+	"ExponentialERightUpDownVectoromegaofcirLarrNotReverseElementrhardscWcirc"
+	"nvrtrieNestedLessLessrangJopfprimesrarrworigofodivVdashangmsdaeVDash"
+	"DifferentialDboxvOslashprcuerBarrHcircjfrHatmiddotIcircphmmatrarrbboxuR"
+	"rcubaogonDopfrarrtlAfrracegapTfrJukcyWopfspadesuitatildeddnsimeq"
+	"sqsupseteqveeRightarrowfrac38umlemsp14lAtailnsimlurdshar"
+	"SquareSupersetEqualsupsubitdiamsbotCapitalDifferentialDNotElementnapmalt"
+	"parallelLeftAngleBrackettscrslarrZopfgesdotoprEboxVlquatintQopf"
+	"UpEquilibriumdownharpoonrightsumleftthreetimesRangiprodxlArr"
+	"NotSquareSubsetrxDownRightVectoruogonRelagranIEcycurlyeqsuccllhard"
+	"DownRightVectorBarnLtvblacksquareAndnsupENotSucceedsSlantEqualudhar"
+	"swarrowNotSucceedsEqualgjcyuringalphaurcrop";
+
+static const uint16_t xm_html_ent_disp[XM_HTML_ENT_BUCKETS] = {
+	37,8,3,444,14,423,86,8,36,32,6,16,
+	14,53,16,214,85,150,31,19,65,16,6,1,
+	1,112,6,126,302,11,117,6,116,33,1,181,
+	81,214,1,89,11,12,1,26,69,150,0,42,
+	1,142,133,17,1,12,4,124,3,9,65,1,
+	54,22,64,106,2,97,163,27,10,12,81,1,
+	0,89,2,68,6,12,190,255,1,37,1,1,
+	3,16,3,33,30,1,94,3,28,6,17,193,
+	24,0,1,6,3,4,24,86,2,380,205,1,
+	26,4,11,1,7,12,4,55,24,15,48,11,
+	338,7,14,8,14,35,1,0,19,223,62,9,
+	1,392,182,148,34,16,583,1,165,3,535,20,
+	128,160,26,200,14,49,143,1,64,208,34,3,
+	1,239,8,322,191,120,3,111,163,150,22,1,
+	36,369,5,2,21,22,38,44,11,1,12,8,
+	15,424,7,142,60,2,8,136,1,306,1,44,
+	49,161,35,1,1,439,111,73,275,9,114,6,
+	4,21,9,38,67,218,9,878,141,9,1,177,
+	142,60,109,905,32,19,3,11,119,1,1018,148,
+	520,97,8,2,55,10,37,1,18,89,4,36,
+	71,20,52,481,2,3,128,6,52,21,2,252,
+	34,232,91,90,21,213,2,1,142,66,4,64,
+	41,470,23,45,2,78,185,153,122,2,329,20,
+	179,12,1,125,60,1,1,8,83,20,208,9,
+	28,143,409,58,3,273,72,46,2,1,144,180,
+	164,113,135,3,1360,0,105,242,7,366,14,5,
+	88,189,372,1,652,9,67,107,150,2,43,518,
+	52,512,91,213,491,83,174,803,559,14,7,754,
+	144,14,388,5,300,374,319,203,479,50,185,497,
+	213,4,7,1603,268,678,64,67,267,32,110,579,
+	398,35,91,20,12,4,228,116,565,38,4,437,
+	157,0,214,769,610,202,48,61,110,188,15,338,
+	14,535,252,1,9,876,59,207,1,33,1951,9,
+	268,6,1,133,1080,576,730,3,179,6,498,66,
+	345,1220,8,190,2,236,2,10,208,47,10,134,
+	87,1,3,21,171,173,15,99,2,8,235,20,
+	4,73,754,6,185,66,767,164,425,39,1,1886,
+	1981,519,441,242,56,9,1,224,11,1191,1036,1,
+	701,31,1288,7,2548,902,95,609,129,556,837,87,
+	2404,3,3,579,26,164,1,113,2825,5,73,76,
+	479,430,109,24,53,7,1,130,25,17,3,25,
+	6279,0,37,76,1166,200,942,956,426,20,38,2333,
+	669,1399,9,278,19,15,278,5,18,52,126,564,
+	421,3,186,101,1,23,0,46,3490,9,665,4,
+	51,119,14,354
+};
+
+static const xm_html_ent_t xm_html_ent_table[XM_HTML_ENT_COUNT] = {
+	{0,14,0,0x21ca,0x0} /*downdownarrows*/,
+	{14,4,0,0x210a,0x0} /*gscr*/,
+	{18,8,0,0x2a06,0x0} /*bigsqcup*/,
+	{26,5,0,0x21f5,0x0} /*duarr*/,
+	{31,2,0,0x24c8,0x0} /*oS*/,
+	{33,3,0,0x29c0,0x0} /*olt*/,
+	{36,5,1,0xab,0x0} /*laquo*/,
+	{41,6,0,0x3dd,0x0} /*gammad*/,
+	{47,6,0,0x179,0x0} /*Zacute*/,
+	{53,6,0,0x42c,0x0} /*SOFTcy*/,
+	{59,13,0,0x2266,0x0} /*LessFullEqual*/,
+	{72,3,0,0x430,0x0} /*acy*/,
+	{75,6,0,0x2200,0x0} /*ForAll*/,
+	{81,3,0,0x1d526,0x0} /*ifr*/,
+	{84,3,0,0x2a70,0x0} /*apE*/,
+	{87,6,0,0x29dc,0x0} /*iinfin*/,
+	{93,5,1,0xe6,0x0} /*aelig*/,
+	{98,2,0,0x2213,0x0} /*mp*/,
+	{100,4,1,0x22,0x0} /*quot*/,
+	{104,6,1,0xc9,0x0} /*Eacute*/,
+	{110,5,0,0x2209,0x0} /*notin*/,
+	{115,7,0,0x21d2,0x0} /*Implies*/,
+	{122,3,0,0x2282,0x0} /*sub*/,
+	{125,3,0,0x3a8,0x0} /*Psi*/,
+	{128,3,0,0x1d531,0x0} /*tfr*/,
+	{131,6,0,0x221d,0x0} /*propto*/,
+	{137,4,0,0x405,0x0} /*DScy*/,
+	{141,14,0,0x200b,0x0} /*ZeroWidthSpace*/,
+	{155,15,0,0x22b5,0x0} /*trianglerighteq*/,
+	{170,6,0,0x2925,0x0} /*searhk*/,
+	{176,6,0,0x2a33,0x0} /*smashp*/,
+	{182,12,0,0x23b5,0x0} /*UnderBracket*/,
+	{194,9,0,0x2299,0x0} /*CircleDot*/,
+	{203,7,0,0x2208,0x0} /*Element*/,
+	{210,3,0,0x41a,0x0} /*Kcy*/,
+	{213,10,0,0x3f5,0x0} /*varepsilon*/,
+	{223,6,0,0x2a30,0x0} /*timesd*/,
+	{229,12,0,0x21a4,0x0} /*LeftTeeArrow*/,
+	{241,8,0,0x2a01,0x0} /*bigoplus*/,
+	{249,13,0,0x27f8,0x0} /*Longleftarrow*/,
+	{262,3,0,0x1d52a,0x0} /*mfr*/,
+	{265,17,0,0x25fc,0x0} /*FilledSmallSquare*/,
+	{282,4,0,0x2ac5,0x0} /*subE*/,
+	{286,5,1,0xdf,0x0} /*szlig*/,
+	{291,4,0,0x211b,0x0} /*Rscr*/,
+	{295,4,0,0x2136,0x0} /*beth*/,
+	{299,6,0,0x127,0x0} /*hstrok*/,
+	{305,6,0,0x2995,0x0} /*gtlPar*/,
+	{311,13,0,0x2221,0x0} /*measuredangle*/,
+	{324,5,0,0x22df,0x0} /*cuesc*/,
+	{329,5,0,0x223a,0x0} /*mDDot*/,
+	{334,3,0,0x2283,0x0} /*sup*/,
+	{337,14,0,0x2aa2,0x0} /*GreaterGreater*/,
+	{351,4,0,0x25b9,0x0} /*rtri*/,
+	{355,5,0,0x2a66,0x0} /*sdote*/,
+	{360,4,0,0x229b,0x0} /*oast*/,
+	{364,3,0,0x2a92,0x0} /*glE*/,
+	{367,5,0,0x132,0x0} /*IJlig*/,
+	{372,4,0,0x222e,0x0} /*oint*/,
+	{376,5,0,0x2561,0x0} /*boxvL*/,
+	{381,5,1,0xee,0x0} /*icirc*/,
+	{386,6,0,0x2994,0x0} /*rpargt*/,
+	{392,6,0,0x230a,0x0} /*lfloor*/,
+	{398,4,0,0x210b,0x0} /*Hscr*/,
+	{402,3,0,0x223f,0x0} /*acd*/,
+	{405,17,0,0x25c2,0x0} /*blacktriangleleft*/,
+	{422,3,0,0x424,0x0} /*Fcy*/,
+	{425,8,0,0x2202,0x0} /*PartialD*/,
+	{433,6,0,0x13d,0x0} /*Lcaron*/,
+	{439,5,0,0xfb00,0x0} /*fflig*/,
+	{444,19,0,0x2267,0x338} /*NotGreaterFullEqual*/,
+	{463,5,0,0x100,0x0} /*Amacr*/,
+	{468,3,0,0x1d530,0x0} /*sfr*/,
+	{471,4,1,0xef,0x0} /*iuml*/,
+	{475,7,0,0x2a27,0x0} /*plustwo*/,
+	{482,4,0,0x224b,0x0} /*apid*/,
+	{486,6,0,0xfb04,0x0} /*ffllig*/,
+	{492,6,0,0x223b,0x0} /*homtht*/,
+	{498,5,0,0x221d,0x0} /*vprop*/,
+	{503,4,0,0x2269,0xfe00} /*gvnE*/,
+	{507,9,0,0x2a7e,0x338} /*ngeqslant*/,
+	{516,3,0,0x1d51e,0x0} /*afr*/,
+	{519,6,0,0x232d,0x0} /*cylcty*/,
+	{525,5,0,0x255a,0x0} /*boxUR*/,
+	{530,6,0,0x223c,0x0} /*thksim*/,
+	{536,16,0,0x21bb,0x0} /*circlearrowright*/,
+	{552,7,0,0x22e2,0x0} /*nsqsube*/,
+	{559,5,0,0x266f,0x0} /*sharp*/,
+	{564,14,0,0x2306,0x0} /*doublebarwedge*/,
+	{578,18,0,0x27f7,0x0} /*LongLeftRightArrow*/,
+	{596,4,0,0x2256,0x0} /*ecir*/,
+	{600,4,0,0x1d4cb,0x0} /*vscr*/,
+	{604,6,0,0x165,0x0} /*tcaron*/,
+	{610,5,0,0x2acb,0x0} /*subnE*/,
+	{615,4,0,0x2245,0x0} /*cong*/,
+	{619,9,0,0x226d,0x0} /*NotCupCap*/,
+	{628,5,0,0x224f,0x0} /*bumpe*/,
+	{633,4,0,0x2265,0x20d2} /*nvge*/,
+	{637,4,0,0x2284,0x0} /*nsub*/,
+	{641,3,1,0xad,0x0} /*shy*/,
+	{644,14,0,0x2d9,0x0} /*DiacriticalDot*/,
+	{658,14,0,0x2199,0x0} /*LowerLeftArrow*/,
+	{672,8,0,0x2ab6,0x0} /*succneqq*/,
+	{680,6,0,0x129,0x0} /*itilde*/,
+	{686,5,0,0x2266,0x338} /*nleqq*/,
+	{691,5,0,0x252c,0x0} /*boxhd*/,
+	{696,6,0,0x2a6e,0x0} /*easter*/,
+	{702,2,0,0x2276,0x0} /*lg*/,
+	{704,6,0,0x7d,0x0} /*rbrace*/,
+	{710,4,1,0xb2,0x0} /*sup2*/,
+	{714,4,0,0x40f,0x0} /*DZcy*/,
+	{718,18,0,0x295d,0x0} /*RightDownTeeVector*/,
+	{736,6,0,0x22ae,0x0} /*nVdash*/,
+	{742,8,0,0x23b6,0x0} /*bbrktbrk*/,
+	{750,8,0,0x2313,0x0} /*profsurf*/,
+	{758,4,0,0x2191,0x0} /*uarr*/,
+	{762,10,0,0x2295,0x0} /*CirclePlus*/,
+	{772,16,0,0x60,0x0} /*DiacriticalGrave*/,
+	{788,6,0,0x2993,0x0} /*lparlt*/,
+	{794,5,0,0x2ac5,0x338} /*nsubE*/,
+	{799,15,0,0x21ae,0x0} /*nleftrightarrow*/,
+	{814,6,1,0xbf,0x0} /*iquest*/,
+	{820,5,1,0xd7,0x0} /*times*/,
+	{825,4,0,0x2ab8,0x0} /*scap*/,
+	{829,5,0,0x201c,0x0} /*ldquo*/,
+	{834,3,0,0x1d52c,0x0} /*ofr*/,
+	{837,3,0,0x1d51c,0x0} /*Yfr*/,
+	{840,5,0,0x2018,0x0} /*lsquo*/,
+	{845,18,0,0x295f,0x0} /*DownRightTeeVector*/,
+	{863,6,0,0x2665,0x0} /*hearts*/,
+	{869,4,0,0x10b,0x0} /*cdot*/,
+	{873,11,0,0x2286,0x0} /*SubsetEqual*/,
+	{884,6,0,0x2008,0x0} /*puncsp*/,
+	{890,4,1,0xba,0x0} /*ordm*/,
+	{894,6,0,0x22a5,0x0} /*bottom*/,
+	{900,4,0,0x2112,0x0} /*Lscr*/,
+	{904,9,0,0x23de,0x0} /*OverBrace*/,
+	{913,10,0,0x212c,0x0} /*Bernoullis*/,
+	{923,8,0,0x3c2,0x0} /*varsigma*/,
+	{931,7,0,0x227f,0x0} /*succsim*/,
+	{938,12,0,0x221d,0x0} /*Proportional*/,
+	{950,5,0,0x2afd,0x0} /*parsl*/,
+	{955,5,0,0x3ba,0x0} /*kappa*/,
+	{960,6,0,0x22ca,0x0} /*rtimes*/,
+	{966,4,0,0x21a1,0x0} /*Darr*/,
+	{970,5,0,0x2592,0x0} /*blk12*/,
+	{975,4,0,0x3d2,0x0} /*Upsi*/,
+	{979,2,0,0x227a,0x0} /*pr*/,
+	{981,6,0,0x2a80,0x0} /*gesdot*/,
+	{987,14,0,0x2062,0x0} /*InvisibleTimes*/,
+	{1001,7,0,0x212d,0x0} /*Cayleys*/,
+	{1008,5,0,0x175,0x0} /*wcirc*/,
+	{1013,5,0,0x21c6,0x0} /*lrarr*/,
+	{1018,4,0,0x27e8,0x0} /*lang*/,
+	{1022,21,0,0x22ed,0x0} /*NotRightTriangleEqual*/,
+	{1043,7,0,0x25ca,0x0} /*lozenge*/,
+	{1050,5,0,0x25c2,0x0} /*ltrif*/,
+	{1055,7,0,0x2948,0x0} /*harrcir*/,
+	{1062,4,0,0x22b7,0x0} /*imof*/,
+	{1066,6,0,0x201e,0x0} /*ldquor*/,
+	{1072,6,0,0x2255,0x0} /*ecolon*/,
+	{1078,6,0,0x2abe,0x0} /*supdot*/,
+	{1084,5,0,0x2208,0x0} /*isinv*/,
+	{1089,4,0,0x1d542,0x0} /*Kopf*/,
+	{1093,12,0,0x2273,0x0} /*GreaterTilde*/,
+	{1105,4,0,0x1d555,0x0} /*dopf*/,
+	{1109,4,0,0x2936,0x0} /*ldca*/,
+	{1113,5,0,0x2a77,0x0} /*eDDot*/,
+	{1118,11,0,0x205f,0x0} /*MediumSpace*/,
+	{1129,4,0,0x3d5,0x0} /*phiv*/,
+	{1133,8,0,0x231d,0x0} /*urcorner*/,
+	{1141,6,0,0x2117,0x0} /*copysr*/,
+	{1147,6,0,0x139,0x0} /*Lacute*/,
+	{1153,5,0,0x255c,0x0} /*boxUl*/,
+	{1158,3,0,0x211c,0x0} /*Rfr*/,
+	{1161,9,0,0x2213,0x0} /*MinusPlus*/,
+	{1170,6,0,0x290d,0x0} /*bkarow*/,
+	{1176,8,0,0x29e4,0x0} /*smeparsl*/,
+	{1184,6,1,0xd3,0x0} /*Oacute*/,
+	{1190,6,0,0x2a46,0x0} /*cupcap*/,
+	{1196,5,0,0x2568,0x0} /*boxhU*/,
+	{1201,5,0,0x21db,0x0} /*rAarr*/,
+	{1206,5,0,0x255f,0x0} /*boxVr*/,
+	{1211,10,0,0x2248,0x0} /*TildeTilde*/,
+	{1221,7,0,0x21d1,0x0} /*Uparrow*/,
+	{1228,6,0,0x25ec,0x0} /*tridot*/,
+	{1234,15,0,0x22b2,0x0} /*vartriangleleft*/,
+	{1249,6,0,0x42a,0x0} /*HARDcy*/,
+	{1255,3,0,0x2ab4,0x0} /*scE*/,
+	{1258,6,0,0x291e,0x0} /*rarrfs*/,
+	{1264,6,0,0x2221,0x0} /*angmsd*/,
+	{1270,5,0,0x2713,0x0} /*check*/,
+	{1275,4,0,0x1d546,0x0} /*Oopf*/,
+	{1279,6,1,0xda,0x0} /*Uacute*/,
+	{1285,5,0,0x25ef,0x0} /*xcirc*/,
+	{1290,2,1,0x3e,0x0} /*gt*/,
+	{1292,5,0,0x219a,0x0} /*nlarr*/,
+	{1297,6,0,0x2026,0x0} /*hellip*/,
+	{1303,5,0,0x229d,0x0} /*odash*/,
+	{1308,5,0,0x296f,0x0} /*duhar*/,
+	{1313,4,0,0x25aa,0x0} /*squf*/,
+	{1317,6,0,0x2a47,0x0} /*capcup*/,
+	{1323,7,0,0x2990,0x0} /*rbrkslu*/,
+	{1330,14,0,0x22b4,0x0} /*trianglelefteq*/,
+	{1344,11,0,0x2296,0x0} /*CircleMinus*/,
+	{1355,9,0,0x2234,0x0} /*Therefore*/,
+	{1364,5,1,0xd4,0x0} /*Ocirc*/,
+	{1369,6,1,0xf5,0x0} /*otilde*/,
+	{1375,5,0,0x66,0x6a} /*fjlig*/,
+	{1380,15,0,0x2271,0x0} /*NotGreaterEqual*/,
+	{1395,7,0,0x29a7,0x0} /*uwangle*/,
+	{1402,7,0,0x2a3b,0x0} /*tritime*/,
+	{1409,9,0,0x224f,0x0} /*HumpEqual*/,
+	{1418,6,0,0x230c,0x0} /*drcrop*/,
+	{1424,4,1,0x22,0x0} /*QUOT*/,
+	{1428,5,0,0x2557,0x0} /*boxDL*/,
+	{1433,15,0,0x21c2,0x0} /*RightDownVector*/,
+	{1448,6,0,0x228b,0xfe00} /*vsupne*/,
+	{1454,13,0,0x210c,0x0} /*Poincareplane*/,
+	{1467,6,0,0x2a29,0x0} /*mcomma*/,
+	{1473,2,0,0x2240,0x0} /*wr*/,
+	{1475,6,1,0xc8,0x0} /*Egrave*/,
+	{1481,6,0,0x2a02,0x0} /*xotime*/,
+	{1487,12,0,0x2309,0x0} /*RightCeiling*/,
+	{1499,4,0,0x2224,0x0} /*nmid*/,
+	{1503,5,0,0x22d6,0x0} /*ltdot*/,
+	{1508,3,0,0x410,0x0} /*Acy*/,
+	{1511,6,0,0x2975,0x0} /*rarrap*/,
+	{1517,7,0,0x21dd,0x0} /*zigrarr*/,
+	{1524,4,0,0x25c3,0x0} /*ltri*/,
+	{1528,7,0,0x223d,0x0} /*backsim*/,
+	{1535,4,0,0x2a7d,0x338} /*nles*/,
+	{1539,3,0,0x1d537,0x0} /*zfr*/,
+	{1542,5,0,0x406,0x0} /*Iukcy*/,
+	{1547,5,0,0x2772,0x0} /*lbbrk*/,
+	{1552,7,0,0x22f7,0x0} /*notinvb*/,
+	{1559,3,0,0x222b,0x0} /*int*/,
+	{1562,5,0,0x2aa0,0x0} /*simgE*/,
+	{1567,5,0,0x21c4,0x0} /*rlarr*/,
+	{1572,15,0,0x294e,0x0} /*LeftRightVector*/,
+	{1587,6,0,0x2297,0x0} /*otimes*/,
+	{1593,6,0,0x29c9,0x0} /*boxbox*/,
+	{1599,4,0,0x396,0x0} /*Zeta*/,
+	{1603,6,0,0x146,0x0} /*ncedil*/,
+	{1609,6,0,0x13e,0x0} /*lcaron*/,
+	{1615,6,0,0x2924,0x0} /*nearhk*/,
+	{1621,5,0,0x22ef,0x0} /*ctdot*/,
+	{1626,6,0,0x2acc,0xfe00} /*vsupnE*/,
+	{1632,5,0,0x2199,0x0} /*swarr*/,
+	{1637,18,0,0x2293,0x0} /*SquareIntersection*/,
+	{1655,7,0,0x22be,0x0} /*angrtvb*/,
+	{1662,6,0,0x22c0,0x0} /*xwedge*/,
+	{1668,5,0,0x25b8,0x0} /*rtrif*/,
+	{1673,5,0,0x25b4,0x0} /*utrif*/,
+	{1678,3,0,0x1d516,0x0} /*Sfr*/,
+	{1681,3,1,0xac,0x0} /*not*/,
+	{1684,6,0,0x16c,0x0} /*Ubreve*/,
+	{1690,4,0,0x224d,0x20d2} /*nvap*/,
+	{1694,4,0,0x2271,0x0} /*ngeq*/,
+	{1698,20,0,0x226b,0x0} /*NestedGreaterGreater*/,
+	{1718,20,0,0x27f9,0x0} /*DoubleLongRightArrow*/,
+	{1738,3,0,0x226b,0x20d2} /*nGt*/,
+	{1741,3,0,0x2271,0x0} /*nge*/,
+	{1744,5,0,0xfb02,0x0} /*fllig*/,
+	{1749,6,0,0x22c7,0x0} /*divonx*/,
+	{1755,4,0,0x403,0x0} /*GJcy*/,
+	{1759,8,0,0x231f,0x0} /*lrcorner*/,
+	{1767,5,0,0x2019,0x0} /*rsquo*/,
+	{1772,10,0,0x2ac5,0x338} /*nsubseteqq*/,
+	{1782,6,0,0x2293,0xfe00} /*sqcaps*/,
+	{1788,13,0,0x2225,0x0} /*shortparallel*/,
+	{1801,14,0,0x2190,0x0} /*ShortLeftArrow*/,
+	{1815,6,0,0x161,0x0} /*scaron*/,
+	{1821,2,0,0x2abc,0x0} /*Sc*/,
+	{1823,5,0,0x256c,0x0} /*boxVH*/,
+	{1828,4,0,0x1d4ca,0x0} /*uscr*/,
+	{1832,6,0,0x10d,0x0} /*ccaron*/,
+	{1838,9,0,0x2204,0x0} /*NotExists*/,
+	{1847,3,0,0x1d533,0x0} /*vfr*/,
+	{1850,6,0,0x2240,0x0} /*wreath*/,
+	{1856,6,0,0x40,0x0} /*commat*/,
+	{1862,2,0,0x2148,0x0} /*ii*/,
+	{1864,12,0,0x21e4,0x0} /*LeftArrowBar*/,
+	{1876,3,0,0x3c6,0x0} /*phi*/,
+	{1879,4,0,0x1d543,0x0} /*Lopf*/,
+	{1883,3,0,0x1d508,0x0} /*Efr*/,
+	{1886,5,0,0x226c,0x0} /*twixt*/,
+	{1891,8,0,0x29a9,0x0} /*angmsdab*/,
+	{1899,10,0,0x21a7,0x0} /*mapstodown*/,
+	{1909,6,0,0x228a,0xfe00} /*vsubne*/,
+	{1915,3,0,0x41d,0x0} /*Ncy*/,
+	{1918,15,0,0x23dc,0x0} /*OverParenthesis*/,
+	{1933,4,0,0x211d,0x0} /*Ropf*/,
+	{1937,5,0,0x454,0x0} /*jukcy*/,
+	{1942,6,1,0xf1,0x0} /*ntilde*/,
+	{1948,5,0,0x3b4,0x0} /*delta*/,
+	{1953,4,0,0x42e,0x0} /*YUcy*/,
+	{1957,3,0,0xa8,0x0} /*Dot*/,
+	{1960,5,1,0xde,0x0} /*THORN*/,
+	{1965,8,0,0x2232,0x0} /*cwconint*/,
+	{1973,7,0,0x3bf,0x0} /*omicron*/,
+	{1980,3,1,0xae,0x0} /*reg*/,
+	{1983,3,0,0x414,0x0} /*Dcy*/,
+	{1986,5,0,0x2281,0x0} /*nsucc*/,
+	{1991,3,0,0x1d505,0x0} /*Bfr*/,
+	{1994,6,0,0x7c,0x0} /*verbar*/,
+	{2000,4,0,0x2130,0x0} /*Escr*/,
+	{2004,4,0,0x1d4bd,0x0} /*hscr*/,
+	{2008,6,0,0x2916,0x0} /*Rarrtl*/,
+	{2014,5,0,0x177,0x0} /*ycirc*/,
+	{2019,10,0,0x2ac6,0x338} /*nsupseteqq*/,
+	{2029,4,0,0x1d54c,0x0} /*Uopf*/,
+	{2033,6,0,0x2926,0x0} /*swarhk*/,
+	{2039,17,0,0x21cb,0x0} /*leftrightharpoons*/,
+	{2056,4,0,0x42f,0x0} /*YAcy*/,
+	{2060,6,0,0x15a,0x0} /*Sacute*/,
+	{2066,5,0,0x2268,0x0} /*lneqq*/,
+	{2071,11,0,0x229a,0x0} /*circledcirc*/,
+	{2082,11,0,0x2195,0x0} /*UpDownArrow*/,
+	{2093,6,0,0x107,0x0} /*cacute*/,
+	{2099,15,0,0x21c6,0x0} /*leftrightarrows*/,
+	{2114,3,0,0x22a4,0x0} /*top*/,
+	{2117,6,0,0x21a2,0x0} /*larrtl*/,
+	{2123,5,0,0x22f9,0x0} /*isinE*/,
+	{2128,5,0,0x222d,0x0} /*iiint*/,
+	{2133,3,0,0x2ab0,0x0} /*sce*/,
+	{2136,3,0,0x1d536,0x0} /*yfr*/,
+	{2139,6,0,0x3f1,0x0} /*varrho*/,
+	{2145,15,0,0x21ce,0x0} /*nLeftrightarrow*/,
+	{2160,8,0,0x2287,0x0} /*supseteq*/,
+	{2168,3,0,0x2211,0x0} /*Sum*/,
+	{2171,21,0,0x201d,0x0} /*CloseCurlyDoubleQuote*/,
+	{2192,3,0,0x437,0x0} /*zcy*/,
+	{2195,8,0,0x29ab,0x0} /*angmsdad*/,
+	{2203,11,0,0x21db,0x0} /*Rrightarrow*/,
+	{2214,4,0,0x1d4a5,0x0} /*Jscr*/,
+	{2218,9,0,0x2102,0x0} /*complexes*/,
+	{2227,6,0,0x22ec,0x0} /*nltrie*/,
+	{2233,5,0,0x125,0x0} /*hcirc*/,
+	{2238,3,0,0x21a6,0x0} /*map*/,
+	{2241,6,0,0x21a6,0x0} /*mapsto*/,
+	{2247,6,1,0xd1,0x0} /*Ntilde*/,
+	{2253,15,0,0x21c3,0x0} /*downharpoonleft*/,
+	{2268,5,0,0x11d,0x0} /*gcirc*/,
+	{2273,5,0,0x391,0x0} /*Alpha*/,
+	{2278,17,0,0x200b,0x0} /*NegativeThinSpace*/,
+	{2295,3,0,0x1d512,0x0} /*Ofr*/,
+	{2298,6,0,0x39b,0x0} /*Lambda*/,
+	{2304,6,0,0x222f,0x0} /*Conint*/,
+	{2310,5,0,0x393,0x0} /*Gamma*/,
+	{2315,3,0,0x2270,0x0} /*nle*/,
+	{2318,16,0,0x2954,0x0} /*RightUpVectorBar*/,
+	{2334,3,0,0x1d528,0x0} /*kfr*/,
+	{2337,4,0,0x451,0x0} /*iocy*/,
+	{2341,7,0,0x2920,0x0} /*rarrbfs*/,
+	{2348,4,0,0x29c4,0x0} /*solb*/,
+	{2352,2,0,0x226b,0x0} /*Gt*/,
+	{2354,5,0,0x25f9,0x0} /*urtri*/,
+	{2359,14,0,0x21a3,0x0} /*rightarrowtail*/,
+	{2373,14,0,0x2226,0x0} /*nshortparallel*/,
+	{2387,2,0,0x22d9,0x0} /*Gg*/,
+	{2389,6,0,0x200a,0x0} /*hairsp*/,
+	{2395,4,1,0xb6,0x0} /*para*/,
+	{2399,4,0,0x21d1,0x0} /*uArr*/,
+	{2403,3,0,0x3a4,0x0} /*Tau*/,
+	{2406,15,0,0x22ec,0x0} /*ntrianglelefteq*/,
+	{2421,20,0,0x296f,0x0} /*ReverseUpEquilibrium*/,
+	{2441,9,0,0x2190,0x0} /*leftarrow*/,
+	{2450,13,0,0x21ab,0x0} /*looparrowleft*/,
+	{2463,3,0,0x3a6,0x0} /*Phi*/,
+	{2466,3,0,0x2264,0x0} /*leq*/,
+	{2469,5,0,0x14c,0x0} /*Omacr*/,
+	{2474,4,0,0x1d544,0x0} /*Mopf*/,
+	{2478,8,0,0xae,0x0} /*circledR*/,
+	{2486,4,0,0x224e,0x0} /*bump*/,
+	{2490,6,0,0x228d,0x0} /*cupdot*/,
+	{2496,6,1,0xc0,0x0} /*Agrave*/,
+	{2502,18,0,0x29cf,0x338} /*NotLeftTriangleBar*/,
+	{2520,8,0,0x21a5,0x0} /*mapstoup*/,
+	{2528,6,0,0x2138,0x0} /*daleth*/,
+	{2534,13,0,0x2242,0x338} /*NotEqualTilde*/,
+	{2547,6,0,0x2a93,0x0} /*lesges*/,
+	{2553,5,0,0x228e,0x0} /*uplus*/,
+	{2558,2,1,0x3c,0x0} /*LT*/,
+	{2560,6,0,0x2020,0x0} /*dagger*/,
+	{2566,2,0,0x226b,0x0} /*gg*/,
+	{2568,5,0,0x255d,0x0} /*boxUL*/,
+	{2573,5,0,0x22f4,0x0} /*isins*/,
+	{2578,10,0,0x21a4,0x0} /*mapstoleft*/,
+	{2588,6,0,0x2156,0x0} /*frac25*/,
+	{2594,4,0,0x212c,0x0} /*Bscr*/,
+	{2598,13,0,0x295a,0x0} /*LeftTeeVector*/,
+	{2611,6,1,0xe1,0x0} /*aacute*/,
+	{2617,5,0,0x2323,0x0} /*smile*/,
+	{2622,6,0,0x22a7,0x0} /*models*/,
+	{2628,5,0,0x135,0x0} /*jcirc*/,
+	{2633,12,0,0x25c3,0x0} /*triangleleft*/,
+	{2645,6,0,0x291a,0x0} /*ratail*/,
+	{2651,7,0,0x2967,0x0} /*ldrdhar*/,
+	{2658,5,0,0x221e,0x0} /*infin*/,
+	{2663,7,0,0x227e,0x0} /*precsim*/,
+	{2670,13,0,0x2ae4,0x0} /*DoubleLeftTee*/,
+	{2683,22,0,0x22e3,0x0} /*NotSquareSupersetEqual*/,
+	{2705,14,0,0x21c7,0x0} /*leftleftarrows*/,
+	{2719,9,0,0x2a7d,0x338} /*nleqslant*/,
+	{2728,2,1,0x3e,0x0} /*GT*/,
+	{2730,6,0,0x233f,0x0} /*solbar*/,
+	{2736,4,0,0x192,0x0} /*fnof*/,
+	{2740,10,0,0x21da,0x0} /*Lleftarrow*/,
+	{2750,6,0,0x7b,0x0} /*lbrace*/,
+	{2756,13,0,0x21a9,0x0} /*hookleftarrow*/,
+	{2769,4,0,0x45c,0x0} /*kjcy*/,
+	{2773,5,0,0x22b5,0x0} /*rtrie*/,
+	{2778,7,0,0x22d6,0x0} /*lessdot*/,
+	{2785,4,0,0x2a42,0x0} /*ncup*/,
+	{2789,5,0,0x1b5,0x0} /*imped*/,
+	{2794,11,0,0x2277,0x0} /*GreaterLess*/,
+	{2805,3,0,0x2269,0x0} /*gnE*/,
+	{2808,5,0,0x21c2,0x0} /*dharr*/,
+	{2813,13,0,0x2ab0,0x0} /*SucceedsEqual*/,
+	{2826,5,0,0x27e6,0x0} /*lobrk*/,
+	{2831,8,0,0x2a31,0x0} /*timesbar*/,
+	{2839,5,0,0x2aac,0xfe00} /*smtes*/,
+	{2844,9,0,0x2193,0x0} /*downarrow*/,
+	{2853,6,0,0x2a4b,0x0} /*capcap*/,
+	{2859,3,0,0x200d,0x0} /*zwj*/,
+	{2862,6,0,0x164,0x0} /*Tcaron*/,
+	{2868,18,0,0x227d,0x0} /*SucceedsSlantEqual*/,
+	{2886,3,0,0x210c,0x0} /*Hfr*/,
+	{2889,3,0,0x43a,0x0} /*kcy*/,
+	{2892,6,0,0x2a04,0x0} /*xuplus*/,
+	{2898,3,0,0x444,0x0} /*fcy*/,
+	{2901,5,0,0x27fa,0x0} /*xhArr*/,
+	{2906,4,0,0x2115,0x0} /*Nopf*/,
+	{2910,6,0,0x21b7,0x0} /*curarr*/,
+	{2916,12,0,0x224f,0x338} /*NotHumpEqual*/,
+	{2928,5,0,0x2a90,0x0} /*gsiml*/,
+	{2933,4,0,0x2025,0x0} /*nldr*/,
+	{2937,6,0,0xfb03,0x0} /*ffilig*/,
+	{2943,4,0,0x1d560,0x0} /*oopf*/,
+	{2947,3,0,0x441,0x0} /*scy*/,
+	{2950,4,0,0x1d4c0,0x0} /*kscr*/,
+	{2954,4,0,0x2285,0x0} /*nsup*/,
+	{2958,7,0,0x22a4,0x0} /*DownTee*/,
+	{2965,4,0,0x22d4,0x0} /*fork*/,
+	{2969,6,0,0x2254,0x0} /*Assign*/,
+	{2975,14,0,0x2194,0x0} /*leftrightarrow*/,
+	{2989,8,0,0x2260,0x0} /*NotEqual*/,
+	{2997,8,0,0x228f,0x0} /*sqsubset*/,
+	{3005,4,0,0x2642,0x0} /*male*/,
+	{3009,20,0,0x22e2,0x0} /*NotSquareSubsetEqual*/,
+	{3029,6,0,0x2262,0x0} /*nequiv*/,
+	{3035,6,0,0x140,0x0} /*lmidot*/,
+	{3041,6,0,0x224e,0x0} /*Bumpeq*/,
+	{3047,4,0,0x428,0x0} /*SHcy*/,
+	{3051,5,0,0x27f6,0x0} /*xrarr*/,
+	{3056,4,0,0x445,0x0} /*khcy*/,
+	{3060,6,0,0x22d7,0x0} /*gtrdot*/,
+	{3066,4,0,0x435,0x0} /*iecy*/,
+	{3070,5,0,0x204f,0x0} /*bsemi*/,
+	{3075,5,0,0x2197,0x0} /*nearr*/,
+	{3080,6,0,0x231e,0x0} /*dlcorn*/,
+	{3086,3,0,0x2aab,0x0} /*lat*/,
+	{3089,4,0,0x22fb,0x0} /*xnis*/,
+	{3093,11,0,0x22de,0x0} /*curlyeqprec*/,
+	{3104,3,0,0x226f,0x0} /*ngt*/,
+	{3107,5,0,0x2554,0x0} /*boxDR*/,
+	{3112,6,0,0x231f,0x0} /*drcorn*/,
+	{3118,6,0,0x138,0x0} /*kgreen*/,
+	{3124,12,0,0x2265,0x0} /*GreaterEqual*/,
+	{3136,6,0,0x13f,0x0} /*Lmidot*/,
+	{3142,6,0,0x17e,0x0} /*zcaron*/,
+	{3148,9,0,0x20db,0x0} /*TripleDot*/,
+	{3157,8,0,0x2a17,0x0} /*intlarhk*/,
+	{3165,5,0,0x201a,0x0} /*sbquo*/,
+	{3170,3,0,0x2a8b,0x0} /*lEg*/,
+	{3173,9,0,0x2288,0x0} /*nsubseteq*/,
+	{3182,6,0,0x2305,0x0} /*barwed*/,
+	{3188,4,0,0x2242,0x0} /*esim*/,
+	{3192,5,0,0x2552,0x0} /*boxdR*/,
+	{3197,4,0,0x2134,0x0} /*oscr*/,
+	{3201,3,0,0x1d520,0x0} /*cfr*/,
+	{3204,6,0,0x2939,0x0} /*larrpl*/,
+	{3210,9,0,0x2224,0x0} /*nshortmid*/,
+	{3219,5,0,0x2207,0x0} /*nabla*/,
+	{3224,5,0,0x3d6,0x0} /*varpi*/,
+	{3229,7,0,0x29b1,0x0} /*demptyv*/,
+	{3236,5,0,0x16a,0x0} /*Umacr*/,
+	{3241,6,0,0x150,0x0} /*Odblac*/,
+	{3247,8,0,0x2a48,0x0} /*cupbrcap*/,
+	{3255,8,0,0x22ce,0x0} /*curlyvee*/,
+	{3263,6,0,0x22aa,0x0} /*Vvdash*/,
+	{3269,6,0,0x22c8,0x0} /*bowtie*/,
+	{3275,10,0,0x21cd,0x0} /*nLeftarrow*/,
+	{3285,2,0,0x39d,0x0} /*Nu*/,
+	{3287,5,0,0x16b,0x0} /*umacr*/,
+	{3292,6,0,0x291d,0x0} /*larrfs*/,
+	{3298,4,1,0xc4,0x0} /*Auml*/,
+	{3302,4,0,0x120,0x0} /*Gdot*/,
+	{3306,6,0,0x22c2,0x0} /*bigcap*/,
+	{3312,11,0,0x2283,0x20d2} /*NotSuperset*/,
+	{3323,7,0,0x2ad7,0x0} /*suphsub*/,
+	{3330,21,0,0x200b,0x0} /*NegativeVeryThinSpace*/,
+	{3351,4,0,0x1d4b1,0x0} /*Vscr*/,
+	{3355,5,0,0x2227,0x0} /*wedge*/,
+	{3360,16,0,0xb4,0x0} /*DiacriticalAcute*/,
+	{3376,10,0,0x2ab8,0x0} /*succapprox*/,
+	{3386,5,0,0x2203,0x0} /*exist*/,
+	{3391,5,1,0xb4,0x0} /*acute*/,
+	{3396,7,0,0x2938,0x0} /*cudarrl*/,
+	{3403,18,0,0x200b,0x0} /*NegativeThickSpace*/,
+	{3421,4,0,0x2003,0x0} /*emsp*/,
+	{3425,16,0,0x21f5,0x0} /*DownArrowUpArrow*/,
+	{3441,3,0,0x3a7,0x0} /*Chi*/,
+	{3444,4,0,0x29b6,0x0} /*omid*/,
+	{3448,5,0,0x225a,0x0} /*veeeq*/,
+	{3453,5,0,0x2a11,0x0} /*awint*/,
+	{3458,4,0,0x2190,0x0} /*larr*/,
+	{3462,4,0,0x2aa7,0x0} /*gtcc*/,
+	{3466,7,0,0x2a00,0x0} /*bigodot*/,
+	{3473,6,0,0x2a06,0x0} /*xsqcup*/,
+	{3479,8,0,0x2a10,0x0} /*cirfnint*/,
+	{3487,4,0,0x229a,0x0} /*ocir*/,
+	{3491,5,0,0x2290,0x0} /*sqsup*/,
+	{3496,3,0,0xf7,0x0} /*div*/,
+	{3499,6,0,0x22e8,0x0} /*prnsim*/,
+	{3505,8,0,0x23e2,0x0} /*trpezium*/,
+	{3513,5,0,0x220c,0x0} /*notni*/,
+	{3518,7,0,0x293c,0x0} /*curarrm*/,
+	{3525,4,0,0x1d49c,0x0} /*Ascr*/,
+	{3529,2,0,0x2a99,0x0} /*el*/,
+	{3531,4,0,0x455,0x0} /*dscy*/,
+	{3535,5,0,0x2226,0x0} /*nspar*/,
+	{3540,6,0,0x2a7f,0x0} /*lesdot*/,
+	{3546,3,0,0x200e,0x0} /*lrm*/,
+	{3549,4,0,0x2937,0x0} /*rdca*/,
+	{3553,6,1,0xf3,0x0} /*oacute*/,
+	{3559,3,0,0x2220,0x0} /*ang*/,
+	{3562,7,0,0x2283,0x20d2} /*nsupset*/,
+	{3569,10,0,0x229b,0x0} /*circledast*/,
+	{3579,6,0,0x2a6a,0x0} /*simdot*/,
+	{3585,6,0,0x22bb,0x0} /*veebar*/,
+	{3591,2,0,0x220b,0x0} /*ni*/,
+	{3593,3,0,0x418,0x0} /*Icy*/,
+	{3596,5,0,0x2986,0x0} /*ropar*/,
+	{3601,4,0,0x2220,0x20d2} /*nang*/,
+	{3605,6,0,0x203a,0x0} /*rsaquo*/,
+	{3611,3,0,0x43b,0x0} /*lcy*/,
+	{3614,5,0,0x2288,0x0} /*nsube*/,
+	{3619,8,0,0x29dd,0x0} /*infintie*/,
+	{3627,5,0,0x2566,0x0} /*boxHD*/,
+	{3632,5,0,0x21ba,0x0} /*olarr*/,
+	{3637,4,0,0x2202,0x0} /*part*/,
+	{3641,5,0,0x3f5,0x0} /*epsiv*/,
+	{3646,11,0,0x2308,0x0} /*LeftCeiling*/,
+	{3657,3,0,0x2a88,0x0} /*gne*/,
+	{3660,4,0,0x22c5,0x0} /*sdot*/,
+	{3664,5,0,0x290e,0x0} /*lBarr*/,
+	{3669,6,0,0x2e,0x0} /*period*/,
+	{3675,11,0,0x2223,0x0} /*VerticalBar*/,
+	{3686,4,0,0x392,0x0} /*Beta*/,
+	{3690,8,0,0x22b8,0x0} /*multimap*/,
+	{3698,19,0,0x27f8,0x0} /*DoubleLongLeftArrow*/,
+	{3717,3,0,0x421,0x0} /*Scy*/,
+	{3720,5,0,0x21ae,0x0} /*nharr*/,
+	{3725,4,0,0x2310,0x0} /*bnot*/,
+	{3729,9,0,0x2009,0x0} /*ThinSpace*/,
+	{3738,5,0,0x29cd,0x0} /*trisb*/,
+	{3743,5,0,0x2565,0x0} /*boxhD*/,
+	{3748,6,0,0x136,0x0} /*Kcedil*/,
+	{3754,4,0,0x29,0x0} /*rpar*/,
+	{3758,5,0,0x2c,0x0} /*comma*/,
+	{3763,4,0,0x23b4,0x0} /*tbrk*/,
+	{3767,5,0,0x2c7,0x0} /*caron*/,
+	{3772,5,0,0x2129,0x0} /*iiota*/,
+	{3777,18,0,0x27f7,0x0} /*longleftrightarrow*/,
+	{3795,17,0,0x2959,0x0} /*LeftDownVectorBar*/,
+	{3812,3,0,0x423,0x0} /*Ucy*/,
+	{3815,6,0,0x297e,0x0} /*ufisht*/,
+	{3821,5,0,0x2ad9,0x0} /*forkv*/,
+	{3826,4,0,0x2ad0,0x0} /*csup*/,
+	{3830,14,0,0x2953,0x0} /*RightVectorBar*/,
+	{3844,4,0,0x226b,0x338} /*nGtv*/,
+	{3848,6,0,0x2015,0x0} /*horbar*/,
+	{3854,6,0,0x22f3,0x0} /*isinsv*/,
+	{3860,5,0,0x2137,0x0} /*gimel*/,
+	{3865,4,0,0x1d4b8,0x0} /*cscr*/,
+	{3869,5,0,0x109,0x0} /*ccirc*/,
+	{3874,11,0,0x226a,0x338} /*NotLessLess*/,
+	{3885,15,0,0x29cf,0x0} /*LeftTriangleBar*/,
+	{3900,6,0,0x162,0x0} /*Tcedil*/,
+	{3906,4,0,0x2aeb,0x0} /*Vbar*/,
+	{3910,5,0,0x2111,0x0} /*image*/,
+	{3915,4,0,0x10a,0x0} /*Cdot*/,
+	{3919,3,0,0x1d519,0x0} /*Vfr*/,
+	{3922,5,0,0x2aa9,0x0} /*gescc*/,
+	{3927,9,0,0x221d,0x0} /*varpropto*/,
+	{3936,15,0,0x2960,0x0} /*LeftUpTeeVector*/,
+	{3951,4,0,0x3e,0x20d2} /*nvgt*/,
+	{3955,6,0,0x2205,0x0} /*emptyv*/,
+	{3961,8,0,0x22ba,0x0} /*intercal*/,
+	{3969,4,0,0x2a9e,0x0} /*simg*/,
+	{3973,7,0,0x2255,0x0} /*eqcolon*/,
+	{3980,4,0,0x121,0x0} /*gdot*/,
+	{3984,5,0,0x22ea,0x0} /*nltri*/,
+	{3989,5,0,0x224b,0x338} /*napid*/,
+	{3994,4,0,0x409,0x0} /*LJcy*/,
+	{3998,6,0,0x2903,0x0} /*nvrArr*/,
+	{4004,3,0,0x2281,0x0} /*nsc*/,
+	{4007,3,0,0x1d522,0x0} /*efr*/,
+	{4010,8,0,0x2205,0x0} /*emptyset*/,
+	{4018,8,0,0x5f,0x0} /*UnderBar*/,
+	{4026,5,0,0x250c,0x0} /*boxdr*/,
+	{4031,5,0,0x2248,0x0} /*thkap*/,
+	{4036,19,0,0x200b,0x0} /*NegativeMediumSpace*/,
+	{4055,5,0,0x119,0x0} /*eogon*/,
+	{4060,13,0,0x227e,0x0} /*PrecedesTilde*/,
+	{4073,7,0,0x2935,0x0} /*cudarrr*/,
+	{4080,6,0,0x2a2d,0x0} /*loplus*/,
+	{4086,6,0,0x22ac,0x0} /*nvdash*/,
+	{4092,7,0,0x293d,0x0} /*cularrp*/,
+	{4099,15,0,0x21d3,0x0} /*DoubleDownArrow*/,
+	{4114,4,0,0x2db,0x0} /*ogon*/,
+	{4118,6,0,0x210b,0x0} /*hamilt*/,
+	{4124,4,0,0x1d49e,0x0} /*Cscr*/,
+	{4128,4,0,0x1d539,0x0} /*Bopf*/,
+	{4132,6,0,0x22ed,0x0} /*nrtrie*/,
+	{4138,12,0,0x2191,0x0} /*ShortUpArrow*/,
+	{4150,3,1,0xb0,0x0} /*deg*/,
+	{4153,4,0,0x447,0x0} /*chcy*/,
+	{4157,5,0,0x2af2,0x0} /*nhpar*/,
+	{4162,8,0,0x22e8,0x0} /*precnsim*/,
+	{4170,6,0,0x111,0x0} /*dstrok*/,
+	{4176,7,0,0x290f,0x0} /*dbkarow*/,
+	{4183,5,1,0xbb,0x0} /*raquo*/,
+	{4188,5,0,0x29b5,0x0} /*ohbar*/,
+	{4193,3,0,0x433,0x0} /*gcy*/,
+	{4196,8,0,0x2663,0x0} /*clubsuit*/,
+	{4204,4,0,0x25ad,0x0} /*rect*/,
+	{4208,7,0,0x297b,0x0} /*suplarr*/,
+	{4215,6,0,0x155,0x0} /*racute*/,
+	{4221,5,0,0x2013,0x0} /*ndash*/,
+	{4226,11,0,0x2666,0x0} /*diamondsuit*/,
+	{4237,2,0,0x3a0,0x0} /*Pi*/,
+	{4239,5,0,0x22a5,0x0} /*UpTee*/,
+	{4244,5,0,0x2ad2,0x0} /*csupe*/,
+	{4249,11,0,0x2248,0x0} /*thickapprox*/,
+	{4260,5,0,0x25b1,0x0} /*fltns*/,
+	{4265,4,0,0x219f,0x0} /*Uarr*/,
+	{4269,8,0,0x3d1,0x0} /*vartheta*/,
+	{4277,6,0,0x222e,0x0} /*conint*/,
+	{4283,5,0,0x21ad,0x0} /*harrw*/,
+	{4288,8,0,0x22a2,0x0} /*RightTee*/,
+	{4296,10,0,0x2a96,0x0} /*eqslantgtr*/,
+	{4306,7,0,0x22c4,0x0} /*Diamond*/,
+	{4313,4,0,0x1d54d,0x0} /*Vopf*/,
+	{4317,6,0,0x10e,0x0} /*Dcaron*/,
+	{4323,11,0,0x2a95,0x0} /*eqslantless*/,
+	{4334,12,0,0x228b,0xfe00} /*varsupsetneq*/,
+	{4346,4,0,0x17c,0x0} /*zdot*/,
+	{4350,4,0,0x266d,0x0} /*flat*/,
+	{4354,5,0,0x3a9,0x0} /*Omega*/,
+	{4359,3,0,0x2229,0x0} /*cap*/,
+	{4362,4,0,0x1d4b0,0x0} /*Uscr*/,
+	{4366,4,0,0x1d4b3,0x0} /*Xscr*/,
+	{4370,6,0,0x2034,0x0} /*tprime*/,
+	{4376,19,0,0x2950,0x0} /*DownLeftRightVector*/,
+	{4395,3,0,0x2f,0x0} /*sol*/,
+	{4398,6,0,0x22c3,0x0} /*bigcup*/,
+	{4404,14,0,0x2063,0x0} /*InvisibleComma*/,
+	{4418,13,0,0x27f5,0x0} /*longleftarrow*/,
+	{4431,5,0,0x266e,0x0} /*natur*/,
+	{4436,7,0,0x2a26,0x0} /*plussim*/,
+	{4443,4,0,0x2a5c,0x0} /*andd*/,
+	{4447,13,0,0x2aaf,0x0} /*PrecedesEqual*/,
+	{4460,7,0,0x29c2,0x0} /*cirscir*/,
+	{4467,6,0,0x2a0c,0x0} /*iiiint*/,
+	{4473,3,0,0x1d534,0x0} /*wfr*/,
+	{4476,4,0,0x2736,0x0} /*sext*/,
+	{4480,4,0,0x22c3,0x0} /*xcup*/,
+	{4484,7,0,0x2974,0x0} /*rarrsim*/,
+	{4491,13,0,0x25b9,0x0} /*triangleright*/,
+	{4504,6,0,0x22c9,0x0} /*ltimes*/,
+	{4510,8,0,0x227a,0x0} /*Precedes*/,
+	{4518,5,1,0xb8,0x0} /*cedil*/,
+	{4523,21,0,0x25aa,0x0} /*FilledVerySmallSquare*/,
+	{4544,4,1,0xb9,0x0} /*sup1*/,
+	{4548,8,0,0x2241,0x0} /*NotTilde*/,
+	{4556,6,0,0x2222,0x0} /*angsph*/,
+	{4562,6,0,0x17a,0x0} /*zacute*/,
+	{4568,20,0,0x21d4,0x0} /*DoubleLeftRightArrow*/,
+	{4588,10,0,0x2192,0x0} /*rightarrow*/,
+	{4598,3,0,0x1d52e,0x0} /*qfr*/,
+	{4601,5,0,0x152,0x0} /*OElig*/,
+	{4606,6,0,0x102,0x0} /*Abreve*/,
+	{4612,7,0,0x2a50,0x0} /*ccupssm*/,
+	{4619,17,0,0x2aa1,0x338} /*NotNestedLessLess*/,
+	{4636,3,0,0x1d524,0x0} /*gfr*/,
+	{4639,6,0,0x224d,0x0} /*CupCap*/,
+	{4645,5,0,0x223c,0x20d2} /*nvsim*/,
+	{4650,9,0,0x2a86,0x0} /*gtrapprox*/,
+	{4659,8,0,0x22f5,0x338} /*notindot*/,
+	{4667,5,0,0x112,0x0} /*Emacr*/,
+	{4672,6,0,0x2238,0x0} /*minusd*/,
+	{4678,4,1,0xb3,0x0} /*sup3*/,
+	{4682,4,0,0x1d4af,0x0} /*Tscr*/,
+	{4686,4,0,0x22d5,0x0} /*epar*/,
+	{4690,5,0,0x2c7,0x0} /*Hacek*/,
+	{4695,7,0,0x22f6,0x0} /*notinvc*/,
+	{4702,9,0,0x2269,0xfe00} /*gvertneqq*/,
+	{4711,6,0,0x22ad,0x0} /*nvDash*/,
+	{4717,15,0,0x21ba,0x0} /*circlearrowleft*/,
+	{4732,6,0,0x169,0x0} /*utilde*/,
+	{4738,5,0,0x21bb,0x0} /*orarr*/,
+	{4743,13,0,0x27f5,0x0} /*LongLeftArrow*/,
+	{4756,6,0,0x22c6,0x0} /*sstarf*/,
+	{4762,5,0,0x398,0x0} /*Theta*/,
+	{4767,4,0,0x21d0,0x0} /*lArr*/,
+	{4771,4,0,0x227a,0x0} /*prec*/,
+	{4775,17,0,0x226b,0x338} /*NotGreaterGreater*/,
+	{4792,8,0,0x2a3a,0x0} /*triminus*/,
+	{4800,5,0,0x2a3f,0x0} /*amalg*/,
+	{4805,6,0,0x2a5f,0x0} /*wedbar*/,
+	{4811,5,1,0xa1,0x0} /*iexcl*/,
+	{4816,6,0,0x22e0,0x0} /*nprcue*/,
+	{4822,2,0,0x3bc,0x0} /*mu*/,
+	{4824,7,0,0x2ac2,0x0} /*supmult*/,
+	{4831,4,0,0x1d557,0x0} /*fopf*/,
+	{4835,5,0,0x2212,0x0} /*minus*/,
+	{4840,16,0,0x2289,0x0} /*NotSupersetEqual*/,
+	{4856,6,0,0x23b0,0x0} /*lmoust*/,
+	{4862,3,0,0x43f,0x0} /*pcy*/,
+	{4865,4,0,0x5b,0x0} /*lsqb*/,
+	{4869,5,0,0x2253,0x0} /*erDot*/,
+	{4874,5,0,0x2a4c,0x0} /*ccups*/,
+	{4879,6,0,0x224f,0x0} /*bumpeq*/,
+	{4885,16,0,0x2267,0x0} /*GreaterFullEqual*/,
+	{4901,5,0,0x45b,0x0} /*tshcy*/,
+	{4906,5,0,0x203e,0x0} /*oline*/,
+	{4911,4,0,0x1d559,0x0} /*hopf*/,
+	{4915,5,0,0x3d2,0x0} /*upsih*/,
+	{4920,6,0,0x230f,0x0} /*ulcrop*/,
+	{4926,12,0,0x2147,0x0} /*exponentiale*/,
+	{4938,3,0,0x434,0x0} /*dcy*/,
+	{4941,3,0,0x222a,0x0} /*cup*/,
+	{4944,14,0,0x2224,0x0} /*NotVerticalBar*/,
+	{4958,5,0,0xfb01,0x0} /*filig*/,
+	{4963,8,0,0x24c8,0x0} /*circledS*/,
+	{4971,16,0,0x23dd,0x0} /*UnderParenthesis*/,
+	{4987,4,0,0x3b,0x0} /*semi*/,
+	{4991,17,0,0x2956,0x0} /*DownLeftVectorBar*/,
+	{5008,5,0,0x2237,0x0} /*Colon*/,
+	{5013,5,0,0x298b,0x0} /*lbrke*/,
+	{5018,5,0,0x2275,0x0} /*ngsim*/,
+	{5023,6,0,0x292a,0x0} /*swnwar*/,
+	{5029,4,0,0x2022,0x0} /*bull*/,
+	{5033,6,0,0x224f,0x338} /*nbumpe*/,
+	{5039,6,0,0x215a,0x0} /*frac56*/,
+	{5045,6,0,0x110,0x0} /*Dstrok*/,
+	{5051,16,0,0x2aaf,0x338} /*NotPrecedesEqual*/,
+	{5067,6,0,0x2abd,0x0} /*subdot*/,
+	{5073,5,0,0x2122,0x0} /*trade*/,
+	{5078,8,0,0x2910,0x0} /*drbkarow*/,
+	{5086,4,0,0x401,0x0} /*IOcy*/,
+	{5090,4,0,0x117,0x0} /*edot*/,
+	{5094,6,0,0x2158,0x0} /*frac45*/,
+	{5100,10,0,0x2a8c,0x0} /*gtreqqless*/,
+	{5110,6,0,0x145,0x0} /*Ncedil*/,
+	{5116,6,0,0x5d,0x0} /*rbrack*/,
+	{5122,5,0,0x2aee,0x0} /*rnmid*/,
+	{5127,7,0,0x298d,0x0} /*lbrkslu*/,
+	{5134,4,0,0x25bf,0x0} /*dtri*/,
+	{5138,24,0,0x27fa,0x0} /*DoubleLongLeftRightArrow*/,
+	{5162,2,0,0x2265,0x0} /*ge*/,
+	{5164,3,0,0x2225,0x0} /*par*/,
+	{5167,9,0,0x228e,0x0} /*UnionPlus*/,
+	{5176,4,0,0x3b9,0x0} /*iota*/,
+	{5180,6,0,0x22ba,0x0} /*intcal*/,
+	{5186,6,0,0x2a25,0x0} /*plusdu*/,
+	{5192,4,0,0x7b,0x0} /*lcub*/,
+	{5196,6,0,0x223e,0x0} /*mstpos*/,
+	{5202,4,0,0x2278,0x0} /*ntlg*/,
+	{5206,3,0,0x2128,0x0} /*Zfr*/,
+	{5209,16,0,0x25fb,0x0} /*EmptySmallSquare*/,
+	{5225,2,0,0x2118,0x0} /*wp*/,
+	{5227,13,0,0x21bf,0x0} /*upharpoonleft*/,
+	{5240,3,0,0x3a9,0x0} /*ohm*/,
+	{5243,4,0,0x2195,0x0} /*varr*/,
+	{5247,5,0,0x25be,0x0} /*dtrif*/,
+	{5252,5,0,0x290c,0x0} /*lbarr*/,
+	{5257,4,0,0x1d4c1,0x0} /*lscr*/,
+	{5261,9,0,0x2210,0x0} /*Coproduct*/,
+	{5270,7,0,0x29b0,0x0} /*bemptyv*/,
+	{5277,7,0,0x2197,0x0} /*nearrow*/,
+	{5284,6,0,0x291c,0x0} /*rAtail*/,
+	{5290,13,0,0x200a,0x0} /*VeryThinSpace*/,
+	{5303,2,0,0x2248,0x0} /*ap*/,
+	{5305,6,0,0x2996,0x0} /*ltrPar*/,
+	{5311,17,0,0x2291,0x0} /*SquareSubsetEqual*/,
+	{5328,4,0,0x2194,0x0} /*harr*/,
+	{5332,5,0,0x2584,0x0} /*lhblk*/,
+	{5337,5,0,0x21e4,0x0} /*larrb*/,
+	{5342,4,0,0x2226,0x0} /*npar*/,
+	{5346,2,0,0x2228,0x0} /*or*/,
+	{5348,7,0,0x2249,0x0} /*napprox*/,
+	{5355,5,1,0xe5,0x0} /*aring*/,
+	{5360,4,0,0x2962,0x0} /*lHar*/,
+	{5364,4,0,0x1d556,0x0} /*eopf*/,
+	{5368,4,0,0x22db,0xfe00} /*gesl*/,
+	{5372,6,0,0x3bb,0x0} /*lambda*/,
+	{5378,8,0,0x2233,0x0} /*awconint*/,
+	{5386,7,0,0x3a5,0x0} /*Upsilon*/,
+	{5393,6,0,0x159,0x0} /*rcaron*/,
+	{5399,6,0,0x3d5,0x0} /*varphi*/,
+	{5405,5,0,0x201d,0x0} /*rdquo*/,
+	{5410,10,0,0x2237,0x0} /*Proportion*/,
+	{5420,4,0,0x23b5,0x0} /*bbrk*/,
+	{5424,4,0,0x116,0x0} /*Edot*/,
+	{5428,3,0,0x438,0x0} /*icy*/,
+	{5431,3,0,0x2aaf,0x0} /*pre*/,
+	{5434,8,0,0x29ae,0x0} /*angmsdag*/,
+	{5442,17,0,0x21cc,0x0} /*rightleftharpoons*/,
+	{5459,8,0,0x294b,0x0} /*ldrushar*/,
+	{5467,3,0,0x220b,0x0} /*niv*/,
+	{5470,7,0,0x2ab0,0x338} /*nsucceq*/,
+	{5477,6,0,0x5b,0x0} /*lbrack*/,
+	{5483,7,0,0x2031,0x0} /*pertenk*/,
+	{5490,6,0,0x429,0x0} /*SHCHcy*/,
+	{5496,5,0,0x2243,0x0} /*simeq*/,
+	{5501,6,0,0x143,0x0} /*Nacute*/,
+	{5507,5,0,0x2283,0x20d2} /*vnsup*/,
+	{5512,17,0,0x25be,0x0} /*blacktriangledown*/,
+	{5529,16,0,0x21c1,0x0} /*rightharpoondown*/,
+	{5545,5,0,0x22a8,0x0} /*vDash*/,
+	{5550,4,0,0x1d4bb,0x0} /*fscr*/,
+	{5554,4,0,0x399,0x0} /*Iota*/,
+	{5558,2,0,0x2266,0x0} /*lE*/,
+	{5560,4,0,0x21,0x0} /*excl*/,
+	{5564,6,0,0x2640,0x0} /*female*/,
+	{5570,14,0,0x27f9,0x0} /*Longrightarrow*/,
+	{5584,6,0,0x20dc,0x0} /*DotDot*/,
+	{5590,4,0,0x2192,0x0} /*rarr*/,
+	{5594,3,0,0x22fc,0x0} /*nis*/,
+	{5597,7,0,0x22e3,0x0} /*nsqsupe*/,
+	{5604,4,0,0x29a4,0x0} /*ange*/,
+	{5608,3,0,0x22da,0x0} /*leg*/,
+	{5611,6,0,0x2ad6,0x0} /*supsup*/,
+	{5617,7,0,0x2979,0x0} /*subrarr*/,
+	{5624,7,0,0x2973,0x0} /*larrsim*/,
+	{5631,15,0,0x222e,0x0} /*ContourIntegral*/,
+	{5646,3,0,0x2a7d,0x0} /*les*/,
+	{5649,6,0,0x2248,0x0} /*approx*/,
+	{5655,7,0,0x2a14,0x0} /*npolint*/,
+	{5662,10,0,0x2192,0x0} /*RightArrow*/,
+	{5672,4,0,0x2aad,0x0} /*late*/,
+	{5676,6,0,0x25aa,0x0} /*squarf*/,
+	{5682,8,0,0x2911,0x0} /*DDotrahd*/,
+	{5690,3,0,0x1d518,0x0} /*Ufr*/,
+	{5693,4,0,0x1d4b6,0x0} /*ascr*/,
+	{5697,5,0,0x224c,0x0} /*bcong*/,
+	{5702,8,0,0x2a58,0x0} /*andslope*/,
+	{5710,4,0,0x3b5,0x0} /*epsi*/,
+	{5714,5,0,0x2293,0x0} /*sqcap*/,
+	{5719,24,0,0x2232,0x0} /*ClockwiseContourIntegral*/,
+	{5743,5,0,0x118,0x0} /*Eogon*/,
+	{5748,7,0,0x291f,0x0} /*larrbfs*/,
+	{5755,16,0,0x295c,0x0} /*RightUpTeeVector*/,
+	{5771,6,1,0xe7,0x0} /*ccedil*/,
+	{5777,5,0,0x22cd,0x0} /*bsime*/,
+	{5782,6,0,0x22c1,0x0} /*bigvee*/,
+	{5788,4,0,0x3f1,0x0} /*rhov*/,
+	{5792,5,0,0x224e,0x338} /*nbump*/,
+	{5797,7,0,0xb8,0x0} /*Cedilla*/,
+	{5804,4,0,0x1d4be,0x0} /*iscr*/,
+	{5808,3,0,0x42b,0x0} /*Ycy*/,
+	{5811,4,0,0x1d558,0x0} /*gopf*/,
+	{5815,3,0,0x226a,0x20d2} /*nLt*/,
+	{5818,2,0,0x22d8,0x0} /*Ll*/,
+	{5820,4,0,0x1d4c8,0x0} /*sscr*/,
+	{5824,8,0,0x222b,0x0} /*Integral*/,
+	{5832,5,0,0x27f5,0x0} /*xlarr*/,
+	{5837,3,0,0x2a5b,0x0} /*orv*/,
+	{5840,10,0,0x2205,0x0} /*varnothing*/,
+	{5850,6,1,0xbd,0x0} /*frac12*/,
+	{5856,15,0,0x219d,0x0} /*rightsquigarrow*/,
+	{5871,6,0,0x2660,0x0} /*spades*/,
+	{5877,3,0,0x431,0x0} /*bcy*/,
+	{5880,13,0,0x21e5,0x0} /*RightArrowBar*/,
+	{5893,3,0,0x21b1,0x0} /*Rsh*/,
+	{5896,6,0,0x2291,0x0} /*sqsube*/,
+	{5902,9,0,0x2713,0x0} /*checkmark*/,
+	{5911,6,0,0x201a,0x0} /*lsquor*/,
+	{5917,11,0,0x227d,0x0} /*succcurlyeq*/,
+	{5928,4,0,0x1d49f,0x0} /*Dscr*/,
+	{5932,5,0,0x25b3,0x0} /*xutri*/,
+	{5937,4,0,0x2c6,0x0} /*circ*/,
+	{5941,4,0,0x21d3,0x0} /*dArr*/,
+	{5945,6,0,0x229f,0x0} /*minusb*/,
+	{5951,3,0,0x224a,0x0} /*ape*/,
+	{5954,14,0,0x2288,0x0} /*NotSubsetEqual*/,
+	{5968,5,0,0x2a71,0x0} /*eplus*/,
+	{5973,9,0,0x2133,0x0} /*Mellintrf*/,
+	{5982,7,0,0x2605,0x0} /*bigstar*/,
+	{5989,6,0,0x2a97,0x0} /*elsdot*/,
+	{5995,6,0,0x17d,0x0} /*Zcaron*/,
+	{6001,7,0,0x2ac4,0x0} /*supedot*/,
+	{6008,3,0,0x21b0,0x0} /*Lsh*/,
+	{6011,7,0,0x2272,0x0} /*lesssim*/,
+	{6018,6,0,0x2010,0x0} /*hyphen*/,
+	{6024,5,0,0x27ec,0x0} /*loang*/,
+	{6029,7,0,0x2191,0x0} /*UpArrow*/,
+	{6036,3,0,0x1d507,0x0} /*Dfr*/,
+	{6039,4,0,0x1d565,0x0} /*topf*/,
+	{6043,5,0,0x2032,0x0} /*prime*/,
+	{6048,5,0,0x2205,0x0} /*empty*/,
+	{6053,5,0,0x2ae9,0x0} /*vBarv*/,
+	{6058,2,0,0x2a54,0x0} /*Or*/,
+	{6060,6,1,0xdd,0x0} /*Yacute*/,
+	{6066,6,1,0xcd,0x0} /*Iacute*/,
+	{6072,6,0,0x2a98,0x0} /*egsdot*/,
+	{6078,18,0,0x27fa,0x0} /*Longleftrightarrow*/,
+	{6096,5,0,0x211d,0x0} /*reals*/,
+	{6101,5,0,0x2044,0x0} /*frasl*/,
+	{6106,3,0,0x14b,0x0} /*eng*/,
+	{6109,4,1,0xa9,0x0} /*COPY*/,
+	{6113,4,0,0x2a73,0x0} /*Esim*/,
+	{6117,4,0,0x2a87,0x0} /*lneq*/,
+	{6121,4,0,0x2133,0x0} /*Mscr*/,
+	{6125,5,1,0xea,0x0} /*ecirc*/,
+	{6130,5,0,0x2252,0x0} /*efDot*/,
+	{6135,7,0,0x2214,0x0} /*dotplus*/,
+	{6142,5,0,0x260e,0x0} /*phone*/,
+	{6147,4,1,0xfc,0x0} /*uuml*/,
+	{6151,3,0,0x2aa4,0x0} /*glj*/,
+	{6154,4,0,0x1d53d,0x0} /*Fopf*/,
+	{6158,8,0,0x2926,0x0} /*hkswarow*/,
+	{6166,8,0,0x2124,0x0} /*integers*/,
+	{6174,5,0,0x22b4,0x0} /*ltrie*/,
+	{6179,2,0,0xb1,0x0} /*pm*/,
+	{6181,2,0,0x3be,0x0} /*xi*/,
+	{6183,5,0,0x25fa,0x0} /*lltri*/,
+	{6188,6,0,0x22b0,0x0} /*prurel*/,
+	{6194,4,0,0x2a5a,0x0} /*andv*/,
+	{6198,4,0,0x2551,0x0} /*boxV*/,
+	{6202,3,1,0xf0,0x0} /*eth*/,
+	{6205,6,0,0x11b,0x0} /*ecaron*/,
+	{6211,5,0,0x2933,0x0} /*rarrc*/,
+	{6216,6,0,0x44a,0x0} /*hardcy*/,
+	{6222,16,0,0x219e,0x0} /*twoheadleftarrow*/,
+	{6238,10,0,0x205f,0x200a} /*ThickSpace*/,
+	{6248,4,0,0x448,0x0} /*shcy*/,
+	{6252,7,0,0x2261,0x20e5} /*bnequiv*/,
+	{6259,6,0,0x142,0x0} /*lstrok*/,
+	{6265,4,0,0x178,0x0} /*Yuml*/,
+	{6269,7,0,0x2a6d,0x0} /*congdot*/,
+	{6276,5,0,0x21c8,0x0} /*uuarr*/,
+	{6281,5,0,0x2563,0x0} /*boxVL*/,
+	{6286,5,0,0x2246,0x0} /*simne*/,
+	{6291,4,0,0x1d55d,0x0} /*lopf*/,
+	{6295,6,0,0x168,0x0} /*Utilde*/,
+	{6301,9,0,0xb7,0x0} /*CenterDot*/,
+	{6310,18,0,0x22b5,0x0} /*RightTriangleEqual*/,
+	{6328,11,0,0x2294,0x0} /*SquareUnion*/,
+	{6339,6,0,0x2282,0x0} /*subset*/,
+	{6345,7,0,0x2a78,0x0} /*equivDD*/,
+	{6352,11,0,0x2130,0x0} /*expectation*/,
+	{6363,4,0,0x1d566,0x0} /*uopf*/,
+	{6367,5,0,0x2135,0x0} /*aleph*/,
+	{6372,6,0,0x2204,0x0} /*nexist*/,
+	{6378,5,0,0x2196,0x0} /*nwarr*/,
+	{6383,6,0,0x2a6f,0x0} /*apacir*/,
+	{6389,4,1,0xa7,0x0} /*sect*/,
+	{6393,6,1,0xfa,0x0} /*uacute*/,
+	{6399,4,0,0x22c6,0x0} /*Star*/,
+	{6403,7,0,0x211b,0x0} /*realine*/,
+	{6410,3,0,0x43d,0x0} /*ncy*/,
+	{6413,11,0,0x227c,0x0} /*preccurlyeq*/,
+	{6424,3,0,0x21b0,0x0} /*lsh*/,
+	{6427,5,0,0x2d8,0x0} /*breve*/,
+	{6432,2,0,0x39c,0x0} /*Mu*/,
+	{6434,14,0,0x22eb,0x0} /*ntriangleright*/,
+	{6448,6,0,0x13a,0x0} /*lacute*/,
+	{6454,16,0,0x22b3,0x0} /*vartriangleright*/,
+	{6470,8,0,0x27ff,0x0} /*dzigrarr*/,
+	{6478,5,0,0x21c0,0x0} /*rharu*/,
+	{6483,12,0,0x25bf,0x0} /*triangledown*/,
+	{6495,17,0,0x22b4,0x0} /*LeftTriangleEqual*/,
+	{6512,5,0,0x2534,0x0} /*boxhu*/,
+	{6517,3,0,0x3d6,0x0} /*piv*/,
+	{6520,6,0,0x230d,0x0} /*dlcrop*/,
+	{6526,11,0,0x2297,0x0} /*CircleTimes*/,
+	{6537,6,0,0x230b,0x0} /*rfloor*/,
+	{6543,6,0,0x2057,0x0} /*qprime*/,
+	{6549,8,0,0x224a,0x0} /*approxeq*/,
+	{6557,6,0,0x2200,0x0} /*forall*/,
+	{6563,3,0,0x3c1,0x0} /*rho*/,
+	{6566,17,0,0x2a7d,0x338} /*NotLessSlantEqual*/,
+	{6583,7,0,0x2204,0x0} /*nexists*/,
+	{6590,9,0,0x2234,0x0} /*therefore*/,
+	{6599,8,0,0x29a8,0x0} /*angmsdaa*/,
+	{6607,4,0,0x2270,0x0} /*nleq*/,
+	{6611,5,1,0xfe,0x0} /*thorn*/,
+	{6616,8,0,0x3d1,0x0} /*thetasym*/,
+	{6624,12,0,0x7c,0x0} /*VerticalLine*/,
+	{6636,4,0,0x2223,0x0} /*smid*/,
+	{6640,5,0,0x2d8,0x0} /*Breve*/,
+	{6645,3,0,0x3a1,0x0} /*Rho*/,
+	{6648,5,0,0x2717,0x0} /*cross*/,
+	{6653,5,0,0x2322,0x0} /*frown*/,
+	{6658,10,0,0x27fc,0x0} /*longmapsto*/,
+	{6668,3,0,0x44b,0x0} /*ycy*/,
+	{6671,2,0,0x2063,0x0} /*ic*/,
+	{6673,3,0,0x1d532,0x0} /*ufr*/,
+	{6676,3,0,0x1d50f,0x0} /*Lfr*/,
+	{6679,14,0,0x21bd,0x0} /*DownLeftVector*/,
+	{6693,4,0,0x22c4,0x0} /*diam*/,
+	{6697,4,1,0xeb,0x0} /*euml*/,
+	{6701,6,0,0x2a74,0x0} /*Colone*/,
+	{6707,8,0,0x29ce,0x0} /*rtriltri*/,
+	{6715,10,0,0x2243,0x0} /*TildeEqual*/,
+	{6725,12,0,0x228f,0x0} /*SquareSubset*/,
+	{6737,4,0,0x2a9d,0x0} /*siml*/,
+	{6741,5,0,0x2261,0x0} /*equiv*/,
+	{6746,6,0,0x2157,0x0} /*frac35*/,
+	{6752,3,0,0x22d9,0x0} /*ggg*/,
+	{6755,4,1,0xcb,0x0} /*Euml*/,
+	{6759,4,0,0x2a0c,0x0} /*qint*/,
+	{6763,8,0,0x2a23,0x0} /*plusacir*/,
+	{6771,6,0,0x2904,0x0} /*nvHarr*/,
+	{6777,6,0,0x2323,0x0} /*ssmile*/,
+	{6783,4,0,0x2298,0x0} /*osol*/,
+	{6787,2,0,0x2147,0x0} /*ee*/,
+	{6789,10,0,0x2ab7,0x0} /*precapprox*/,
+	{6799,5,0,0x2559,0x0} /*boxUr*/,
+	{6804,23,0,0x2aa2,0x338} /*NotNestedGreaterGreater*/,
+	{6827,6,0,0x22cb,0x0} /*lthree*/,
+	{6833,7,0,0x2135,0x0} /*alefsym*/,
+	{6840,15,0,0x3f5,0x0} /*straightepsilon*/,
+	{6855,3,0,0x1d51f,0x0} /*bfr*/,
+	{6858,2,0,0x2264,0x0} /*le*/,
+	{6860,2,0,0x2a9a,0x0} /*eg*/,
+	{6862,6,0,0x163,0x0} /*tcedil*/,
+	{6868,8,0,0x2305,0x0} /*barwedge*/,
+	{6876,3,0,0x1d521,0x0} /*dfr*/,
+	{6879,10,0,0x2148,0x0} /*ImaginaryI*/,
+	{6889,5,0,0x22c0,0x0} /*Wedge*/,
+	{6894,3,0,0x44d,0x0} /*ecy*/,
+	{6897,11,0,0x21cc,0x0} /*Equilibrium*/,
+	{6908,10,0,0x2acc,0x0} /*supsetneqq*/,
+	{6918,4,0,0x1d4bf,0x0} /*jscr*/,
+	{6922,5,0,0x22c3,0x0} /*Union*/,
+	{6927,5,0,0x12b,0x0} /*imacr*/,
+	{6932,4,0,0x1d4ac,0x0} /*Qscr*/,
+	{6936,4,0,0x27fc,0x0} /*xmap*/,
+	{6940,5,0,0x3a,0x0} /*colon*/,
+	{6945,3,0,0x2267,0x338} /*ngE*/,
+	{6948,3,0,0x222c,0x0} /*Int*/,
+	{6951,5,0,0x2aba,0x0} /*scnap*/,
+	{6956,6,0,0x3f0,0x0} /*kappav*/,
+	{6962,6,0,0x2235,0x0} /*becaus*/,
+	{6968,13,0,0x21a6,0x0} /*RightTeeArrow*/,
+	{6981,10,0,0x2201,0x0} /*complement*/,
+	{6991,11,0,0x2280,0x0} /*NotPrecedes*/,
+	{7002,11,0,0x21c0,0x0} /*RightVector*/,
+	{7013,5,0,0x2dc,0x0} /*tilde*/,
+	{7018,4,0,0x20ac,0x0} /*euro*/,
+	{7022,3,0,0x1d50a,0x0} /*Gfr*/,
+	{7025,4,0,0x1d553,0x0} /*bopf*/,
+	{7029,3,0,0x2aaa,0x0} /*smt*/,
+	{7032,4,0,0x1d55a,0x0} /*iopf*/,
+	{7036,7,0,0x2ada,0x0} /*topfork*/,
+	{7043,6,0,0x29e3,0x0} /*eparsl*/,
+	{7049,14,0,0x21c0,0x0} /*rightharpoonup*/,
+	{7063,5,0,0x22a1,0x0} /*sdotb*/,
+	{7068,6,0,0x2ab0,0x0} /*succeq*/,
+	{7074,6,0,0x24,0x0} /*dollar*/,
+	{7080,4,0,0x2208,0x0} /*isin*/,
+	{7084,4,0,0x2201,0x0} /*comp*/,
+	{7088,10,0,0x2912,0x0} /*UpArrowBar*/,
+	{7098,18,0,0x25b8,0x0} /*blacktriangleright*/,
+	{7116,7,0,0x22fd,0x0} /*notnivc*/,
+	{7123,4,0,0x2299,0x0} /*odot*/,
+	{7127,5,0,0x221f,0x0} /*angrt*/,
+	{7132,10,0,0x23b1,0x0} /*rmoustache*/,
+	{7142,15,0,0x2198,0x0} /*LowerRightArrow*/,
+	{7157,4,0,0x1d554,0x0} /*copf*/,
+	{7161,5,0,0x2ae4,0x0} /*Dashv*/,
+	{7166,4,0,0x2268,0xfe00} /*lvnE*/,
+	{7170,6,1,0xf8,0x0} /*oslash*/,
+	{7176,8,0,0x29ad,0x0} /*angmsdaf*/,
+	{7184,5,0,0x2041,0x0} /*caret*/,
+	{7189,6,0,0x2927,0x0} /*nwnear*/,
+	{7195,4,0,0x2193,0x0} /*darr*/,
+	{7199,5,0,0x2a2f,0x0} /*Cross*/,
+	{7204,4,0,0x1d4a2,0x0} /*Gscr*/,
+	{7208,3,0,0x25ca,0x0} /*loz*/,
+	{7211,3,0,0x1d509,0x0} /*Ffr*/,
+	{7214,13,0,0x2216,0x0} /*smallsetminus*/,
+	{7227,10,0,0x21a5,0x0} /*UpTeeArrow*/,
+	{7237,5,0,0x2224,0x0} /*nsmid*/,
+	{7242,4,0,0x1d4b9,0x0} /*dscr*/,
+	{7246,5,0,0x176,0x0} /*Ycirc*/,
+	{7251,21,0,0x22e0,0x0} /*NotPrecedesSlantEqual*/,
+	{7272,13,0,0x2252,0x0} /*fallingdotseq*/,
+	{7285,5,0,0xc5,0x0} /*angst*/,
+	{7290,3,0,0x420,0x0} /*Rcy*/,
+	{7293,10,0,0x2acb,0x0} /*subsetneqq*/,
+	{7303,6,0,0x22e9,0x0} /*scnsim*/,
+	{7309,5,0,0x3a3,0x0} /*Sigma*/,
+	{7314,4,0,0x225c,0x0} /*trie*/,
+	{7318,5,0,0x133,0x0} /*ijlig*/,
+	{7323,4,0,0x2964,0x0} /*rHar*/,
+	{7327,3,0,0x9,0x0} /*Tab*/,
+	{7330,13,0,0x2240,0x0} /*VerticalTilde*/,
+	{7343,18,0,0x27e7,0x0} /*RightDoubleBracket*/,
+	{7361,6,0,0x201d,0x0} /*rdquor*/,
+	{7367,9,0,0x2a02,0x0} /*bigotimes*/,
+	{7376,6,0,0x2af3,0x0} /*parsim*/,
+	{7382,4,0,0x1d569,0x0} /*xopf*/,
+	{7386,3,0,0x41c,0x0} /*Mcy*/,
+	{7389,13,0,0x21bc,0x0} /*leftharpoonup*/,
+	{7402,22,0,0x2dd,0x0} /*DiacriticalDoubleAcute*/,
+	{7424,3,0,0x2905,0x0} /*Map*/,
+	{7427,6,0,0x297c,0x0} /*lfisht*/,
+	{7433,12,0,0x2253,0x0} /*risingdotseq*/,
+	{7445,6,0,0x2af1,0x0} /*topcir*/,
+	{7451,5,0,0x21bd,0x0} /*lhard*/,
+	{7456,9,0,0x2226,0x0} /*nparallel*/,
+	{7465,3,0,0x43e,0x0} /*ocy*/,
+	{7468,6,0,0x2009,0x0} /*thinsp*/,
+	{7474,6,0,0x147,0x0} /*Ncaron*/,
+	{7480,20,0,0x2226,0x0} /*NotDoubleVerticalBar*/,
+	{7500,3,0,0xa8,0x0} /*die*/,
+	{7503,4,0,0x29eb,0x0} /*lozf*/,
+	{7507,6,0,0x2021,0x0} /*Dagger*/,
+	{7513,17,0,0x27e6,0x0} /*LeftDoubleBracket*/,
+	{7530,4,0,0x2a70,0x338} /*napE*/,
+	{7534,5,0,0x298c,0x0} /*rbrke*/,
+	{7539,4,0,0x130,0x0} /*Idot*/,
+	{7543,6,0,0x2919,0x0} /*latail*/,
+	{7549,14,0,0x2a7d,0x0} /*LessSlantEqual*/,
+	{7563,6,0,0x2ad3,0x0} /*subsup*/,
+	{7569,6,0,0x2294,0xfe00} /*sqcups*/,
+	{7575,3,0,0x2a85,0x0} /*lap*/,
+	{7578,4,0,0x21b3,0x0} /*rdsh*/,
+	{7582,3,0,0x1d525,0x0} /*hfr*/,
+	{7585,7,0,0x226c,0x0} /*between*/,
+	{7592,11,0,0x3d5,0x0} /*straightphi*/,
+	{7603,3,0,0x2a95,0x0} /*els*/,
+	{7606,9,0,0xb7,0x0} /*centerdot*/,
+	{7615,4,0,0x1d4c7,0x0} /*rscr*/,
+	{7619,12,0,0x2913,0x0} /*DownArrowBar*/,
+	{7631,3,0,0x212d,0x0} /*Cfr*/,
+	{7634,5,0,0x2014,0x0} /*mdash*/,
+	{7639,6,0,0x210f,0x0} /*hslash*/,
+	{7645,6,0,0x3d,0x0} /*equals*/,
+	{7651,6,0,0x2316,0x0} /*target*/,
+	{7657,4,0,0x221a,0x0} /*Sqrt*/,
+	{7661,7,0,0x210e,0x0} /*planckh*/,
+	{7668,6,0,0x2105,0x0} /*incare*/,
+	{7674,5,0,0x21ce,0x0} /*nhArr*/,
+	{7679,4,0,0x2a88,0x0} /*gneq*/,
+	{7683,9,0,0x228b,0x0} /*supsetneq*/,
+	{7692,4,0,0x17b,0x0} /*Zdot*/,
+	{7696,5,0,0x22f2,0x0} /*disin*/,
+	{7701,5,0,0x21d6,0x0} /*nwArr*/,
+	{7706,4,0,0x1d4cd,0x0} /*xscr*/,
+	{7710,15,0,0x22ea,0x0} /*NotLeftTriangle*/,
+	{7725,6,0,0x408,0x0} /*Jsercy*/,
+	{7731,6,0,0x160,0x0} /*Scaron*/,
+	{7737,8,0,0x2250,0x0} /*DotEqual*/,
+	{7745,4,0,0x2272,0x0} /*lsim*/,
+	{7749,14,0,0x21aa,0x0} /*hookrightarrow*/,
+	{7763,5,0,0x227e,0x0} /*prsim*/,
+	{7768,6,0,0x2039,0x0} /*lsaquo*/,
+	{7774,5,1,0xb5,0x0} /*micro*/,
+	{7779,9,0,0x2261,0x0} /*Congruent*/,
+	{7788,5,0,0x21cd,0x0} /*nlArr*/,
+	{7793,6,0,0x2019,0x0} /*rsquor*/,
+	{7799,5,0,0x22b3,0x0} /*vrtri*/,
+	{7804,6,0,0x449,0x0} /*shchcy*/,
+	{7810,5,0,0x290d,0x0} /*rbarr*/,
+	{7815,8,0,0x2312,0x0} /*profline*/,
+	{7823,5,0,0x2294,0x0} /*sqcup*/,
+	{7828,6,0,0x21ac,0x0} /*rarrlp*/,
+	{7834,4,1,0xdc,0x0} /*Uuml*/,
+	{7838,7,0,0x2191,0x0} /*uparrow*/,
+	{7845,9,0,0x2ac6,0x0} /*supseteqq*/,
+	{7854,8,0,0x27c8,0x0} /*bsolhsub*/,
+	{7862,5,0,0x2aae,0x0} /*bumpE*/,
+	{7867,7,0,0x2198,0x0} /*searrow*/,
+	{7874,19,0,0x21c6,0x0} /*LeftArrowRightArrow*/,
+	{7893,6,0,0x103,0x0} /*abreve*/,
+	{7899,6,0,0x131,0x0} /*inodot*/,
+	{7905,14,0,0x21d4,0x0} /*Leftrightarrow*/,
+	{7919,3,0,0x1d52f,0x0} /*rfr*/,
+	{7922,2,0,0x223e,0x0} /*ac*/,
+	{7924,4,0,0x2928,0x0} /*toea*/,
+	{7928,5,0,0x22de,0x0} /*cuepr*/,
+	{7933,5,0,0x2ab9,0x0} /*prnap*/,
+	{7938,6,0,0x167,0x0} /*tstrok*/,
+	{7944,7,0,0x298f,0x0} /*lbrksld*/,
+	{7951,4,0,0x221d,0x0} /*prop*/,
+	{7955,7,0,0x27c9,0x0} /*suphsol*/,
+	{7962,16,0,0x29d0,0x0} /*RightTriangleBar*/,
+	{7978,7,0,0x2ac0,0x0} /*supplus*/,
+	{7985,17,0,0x295e,0x0} /*DownLeftTeeVector*/,
+	{8002,7,0,0x3dd,0x0} /*digamma*/,
+	{8009,13,0,0x2061,0x0} /*ApplyFunction*/,
+	{8022,4,0,0x44e,0x0} /*yucy*/,
+	{8026,6,0,0x15b,0x0} /*sacute*/,
+	{8032,6,1,0xa6,0x0} /*brvbar*/,
+	{8038,5,0,0x2ad1,0x0} /*csube*/,
+	{8043,4,0,0x266a,0x0} /*sung*/,
+	{8047,5,1,0xe2,0x0} /*acirc*/,
+	{8052,4,0,0x45a,0x0} /*njcy*/,
+	{8056,4,0,0x220f,0x0} /*prod*/,
+	{8060,10,0,0x2a8b,0x0} /*lesseqqgtr*/,
+	{8070,7,0,0x2230,0x0} /*Cconint*/,
+	{8077,6,0,0x2218,0x0} /*compfn*/,
+	{8083,7,0,0x22f5,0x0} /*isindot*/,
+	{8090,5,0,0x2007,0x0} /*numsp*/,
+	{8095,4,1,0xff,0x0} /*yuml*/,
+	{8099,4,0,0x2243,0x0} /*sime*/,
+	{8103,5,0,0x2a75,0x0} /*Equal*/,
+	{8108,5,0,0x2971,0x0} /*erarr*/,
+	{8113,6,0,0x212c,0x0} /*bernou*/,
+	{8119,13,0,0x22c7,0x0} /*divideontimes*/,
+	{8132,4,0,0x1d550,0x0} /*Yopf*/,
+	{8136,10,0,0x2291,0x0} /*sqsubseteq*/,
+	{8146,3,0,0x25cb,0x0} /*cir*/,
+	{8149,5,0,0x27f7,0x0} /*xharr*/,
+	{8154,4,0,0x1d56a,0x0} /*yopf*/,
+	{8158,3,0,0x22d1,0x0} /*Sup*/,
+	{8161,8,0,0x2a15,0x0} /*pointint*/,
+	{8169,13,0,0x22b3,0x0} /*RightTriangle*/,
+	{8182,8,0,0x2238,0x0} /*dotminus*/,
+	{8190,5,0,0x221a,0x0} /*radic*/,
+	{8195,4,0,0x2da,0x0} /*ring*/,
+	{8199,2,0,0x3c0,0x0} /*pi*/,
+	{8201,6,0,0x25ae,0x0} /*marker*/,
+	{8207,5,0,0x29b9,0x0} /*operp*/,
+	{8212,5,0,0x256b,0x0} /*boxVh*/,
+	{8217,5,0,0x21bc,0x0} /*lharu*/,
+	{8222,3,0,0x2a5d,0x0} /*ord*/,
+	{8225,8,0,0x2aa1,0x0} /*LessLess*/,
+	{8233,13,0,0x2952,0x0} /*LeftVectorBar*/,
+	{8246,2,0,0x2111,0x0} /*Im*/,
+	{8248,4,0,0x20db,0x0} /*tdot*/,
+	{8252,6,0,0x21a9,0x0} /*larrhk*/,
+	{8258,6,0,0x2afd,0x20e5} /*nparsl*/,
+	{8264,4,0,0x446,0x0} /*tscy*/,
+	{8268,4,0,0x2adb,0x0} /*mlcp*/,
+	{8272,6,0,0x2933,0x338} /*nrarrc*/,
+	{8278,4,1,0xe4,0x0} /*auml*/,
+	{8282,6,0,0x137,0x0} /*kcedil*/,
+	{8288,6,0,0x2128,0x0} /*zeetrf*/,
+	{8294,5,0,0x255b,0x0} /*boxuL*/,
+	{8299,5,0,0x233d,0x0} /*ovbar*/,
+	{8304,8,0,0x29aa,0x0} /*angmsdac*/,
+	{8312,5,0,0x2202,0x338} /*npart*/,
+	{8317,8,0,0x2216,0x0} /*setminus*/,
+	{8325,5,0,0x2244,0x0} /*nsime*/,
+	{8330,6,0,0x296a,0x0} /*lharul*/,
+	{8336,7,0,0x2277,0x0} /*gtrless*/,
+	{8343,5,0,0x2dd,0x0} /*dblac*/,
+	{8348,8,0,0x2a7e,0x0} /*geqslant*/,
+	{8356,16,0,0x22da,0x0} /*LessEqualGreater*/,
+	{8372,3,0,0x1d52b,0x0} /*nfr*/,
+	{8375,12,0,0x29eb,0x0} /*blacklozenge*/,
+	{8387,4,0,0x1d568,0x0} /*wopf*/,
+	{8391,5,0,0x3b3,0x0} /*gamma*/,
+	{8396,6,0,0x2acb,0xfe00} /*vsubnE*/,
+	{8402,17,0,0x2290,0x338} /*NotSquareSuperset*/,
+	{8419,9,0,0x22db,0x0} /*gtreqless*/,
+	{8428,10,0,0x23df,0x0} /*UnderBrace*/,
+	{8438,7,0,0x2a22,0x0} /*pluscir*/,
+	{8445,4,0,0x1d564,0x0} /*sopf*/,
+	{8449,7,0,0x2276,0x0} /*lessgtr*/,
+	{8456,6,0,0x23b1,0x0} /*rmoust*/,
+	{8462,4,0,0x2965,0x0} /*dHar*/,
+	{8466,5,0,0x14d,0x0} /*omacr*/,
+	{8471,6,0,0x2a4a,0x0} /*cupcup*/,
+	{8477,9,0,0x211a,0x0} /*rationals*/,
+	{8486,5,0,0x22e7,0x0} /*gnsim*/,
+	{8491,7,0,0x266e,0x0} /*natural*/,
+	{8498,7,0,0x229e,0x0} /*boxplus*/,
+	{8505,6,0,0x2213,0x0} /*mnplus*/,
+	{8511,3,0,0x2a91,0x0} /*lgE*/,
+	{8514,6,0,0x11a,0x0} /*Ecaron*/,
+	{8520,4,0,0x2550,0x0} /*boxH*/,
+	{8524,5,1,0xa3,0x0} /*pound*/,
+	{8529,6,0,0x296d,0x0} /*lrhard*/,
+	{8535,6,0,0x126,0x0} /*Hstrok*/,
+	{8541,5,0,0x29be,0x0} /*olcir*/,
+	{8546,8,0,0x29b4,0x0} /*laemptyv*/,
+	{8554,6,0,0x296c,0x0} /*rharul*/,
+	{8560,5,0,0x22b2,0x0} /*vltri*/,
+	{8565,7,0,0x29a6,0x0} /*dwangle*/,
+	{8572,4,0,0x2aed,0x0} /*bNot*/,
+	{8576,15,0,0x25bd,0x0} /*bigtriangledown*/,
+	{8591,10,0,0x219a,0x0} /*nleftarrow*/,
+	{8601,7,0,0x2196,0x0} /*nwarrow*/,
+	{8608,6,0,0x2214,0x0} /*plusdo*/,
+	{8614,3,0,0x22d0,0x0} /*Sub*/,
+	{8617,12,0,0x2270,0x0} /*NotLessEqual*/,
+	{8629,5,0,0x201e,0x0} /*bdquo*/,
+	{8634,7,0,0x298e,0x0} /*rbrksld*/,
+	{8641,9,0,0x2268,0xfe00} /*lvertneqq*/,
+	{8650,4,0,0x1d4c5,0x0} /*pscr*/,
+	{8654,5,0,0x2663,0x0} /*clubs*/,
+	{8659,6,0,0x231c,0x0} /*ulcorn*/,
+	{8665,8,0,0x2949,0x0} /*Uarrocir*/,
+	{8673,5,0,0x21fd,0x0} /*loarr*/,
+	{8678,6,0,0x22e1,0x0} /*nsccue*/,
+	{8684,7,0,0x2235,0x0} /*because*/,
+	{8691,6,1,0xc7,0x0} /*Ccedil*/,
+	{8697,6,0,0x2296,0x0} /*ominus*/,
+	{8703,9,0,0x228a,0x0} /*subsetneq*/,
+	{8712,5,0,0x12f,0x0} /*iogon*/,
+	{8717,6,0,0x2256,0x0} /*eqcirc*/,
+	{8723,5,1,0xfb,0x0} /*ucirc*/,
+	{8728,6,0,0x2016,0x0} /*Verbar*/,
+	{8734,6,0,0x215d,0x0} /*frac58*/,
+	{8740,7,0,0xa,0x0} /*NewLine*/,
+	{8747,5,0,0x2248,0x0} /*asymp*/,
+	{8752,3,0,0x1d51b,0x0} /*Xfr*/,
+	{8755,14,0,0x2018,0x0} /*OpenCurlyQuote*/,
+	{8769,17,0,0x2a7e,0x0} /*GreaterSlantEqual*/,
+	{8786,5,0,0x2134,0x0} /*order*/,
+	{8791,9,0,0x2665,0x0} /*heartsuit*/,
+	{8800,6,0,0x15f,0x0} /*scedil*/,
+	{8806,5,0,0x2510,0x0} /*boxdl*/,
+	{8811,5,0,0x2220,0x0} /*angle*/,
+	{8816,6,0,0x2af0,0x0} /*midcir*/,
+	{8822,5,0,0x2556,0x0} /*boxDl*/,
+	{8827,6,0,0x299c,0x0} /*vangrt*/,
+	{8833,11,0,0x2aba,0x0} /*succnapprox*/,
+	{8844,5,0,0x2122,0x0} /*TRADE*/,
+	{8849,6,1,0xa4,0x0} /*curren*/,
+	{8855,4,0,0x1d55f,0x0} /*nopf*/,
+	{8859,14,0,0x295b,0x0} /*RightTeeVector*/,
+	{8873,3,0,0x226e,0x0} /*nlt*/,
+	{8876,3,0,0x1d513,0x0} /*Pfr*/,
+	{8879,5,0,0x104,0x0} /*Aogon*/,
+	{8884,16,0,0x22ed,0x0} /*ntrianglerighteq*/,
+	{8900,6,0,0x2234,0x0} /*there4*/,
+	{8906,6,0,0x297d,0x0} /*rfisht*/,
+	{8912,4,0,0x407,0x0} /*YIcy*/,
+	{8916,6,0,0x2043,0x0} /*hybull*/,
+	{8922,4,0,0x2a43,0x0} /*ncap*/,
+	{8926,16,0,0xa0,0x0} /*NonBreakingSpace*/,
+	{8942,5,0,0x228f,0x0} /*sqsub*/,
+	{8947,4,0,0x2279,0x0} /*ntgl*/,
+	{8951,5,0,0x3b8,0x0} /*theta*/,
+	{8956,16,0,0x2dc,0x0} /*DiacriticalTilde*/,
+	{8972,6,0,0x144,0x0} /*nacute*/,
+	{8978,9,0,0x22da,0x0} /*lesseqgtr*/,
+	{8987,6,0,0x25a1,0x0} /*square*/,
+	{8993,4,0,0x2266,0x0} /*leqq*/,
+	{8997,5,0,0x21d8,0x0} /*seArr*/,
+	{9002,5,0,0x27ed,0x0} /*roang*/,
+	{9007,4,0,0x1d4a9,0x0} /*Nscr*/,
+	{9011,15,0,0x21d0,0x0} /*DoubleLeftArrow*/,
+	{9026,7,0,0x220f,0x0} /*Product*/,
+	{9033,6,0,0x2292,0x0} /*sqsupe*/,
+	{9039,6,1,0xf9,0x0} /*ugrave*/,
+	{9045,5,0,0x2580,0x0} /*uhblk*/,
+	{9050,5,0,0x2560,0x0} /*boxVR*/,
+	{9055,5,0,0x255e,0x0} /*boxvR*/,
+	{9060,7,0,0x29b2,0x0} /*cemptyv*/,
+	{9067,6,0,0x29bc,0x0} /*odsold*/,
+	{9073,6,0,0x2030,0x0} /*permil*/,
+	{9079,5,0,0x2231,0x0} /*cwint*/,
+	{9084,3,1,0x26,0x0} /*AMP*/,
+	{9087,4,0,0x2aaf,0x338} /*npre*/,
+	{9091,4,0,0x459,0x0} /*ljcy*/,
+	{9095,13,0,0x2244,0x0} /*NotTildeEqual*/,
+	{9108,6,0,0x2a44,0x0} /*capand*/,
+	{9114,6,0,0x2923,0x0} /*nwarhk*/,
+	{9120,12,0,0x2262,0x0} /*NotCongruent*/,
+	{9132,4,0,0x1d55c,0x0} /*kopf*/,
+	{9136,5,0,0x2992,0x0} /*rangd*/,
+	{9141,16,0,0x2951,0x0} /*LeftUpDownVector*/,
+	{9157,13,0,0x2249,0x0} /*NotTildeTilde*/,
+	{9170,5,0,0x2567,0x0} /*boxHu*/,
+	{9175,6,0,0x210f,0x0} /*planck*/,
+	{9181,6,0,0x22cc,0x0} /*rthree*/,
+	{9187,5,0,0x227f,0x0} /*scsim*/,
+	{9192,4,0,0x2225,0x0} /*spar*/,
+	{9196,6,0,0x22d0,0x0} /*Subset*/,
+	{9202,6,0,0x21aa,0x0} /*rarrhk*/,
+	{9208,6,0,0x154,0x0} /*Racute*/,
+	{9214,6,0,0x22f9,0x338} /*notinE*/,
+	{9220,4,0,0x21d2,0x0} /*rArr*/,
+	{9224,4,0,0x1d552,0x0} /*aopf*/,
+	{9228,6,0,0x2928,0x0} /*nesear*/,
+	{9234,6,0,0x2ae6,0x0} /*Vdashl*/,
+	{9240,14,0,0x22a8,0x0} /*DoubleRightTee*/,
+	{9254,6,0,0x2254,0x0} /*colone*/,
+	{9260,4,0,0x2286,0x0} /*sube*/,
+	{9264,13,0,0x227f,0x0} /*SucceedsTilde*/,
+	{9277,18,0,0x227c,0x0} /*PrecedesSlantEqual*/,
+	{9295,8,0,0x2a36,0x0} /*otimesas*/,
+	{9303,4,0,0x29c3,0x0} /*cirE*/,
+	{9307,7,0,0x2abf,0x0} /*subplus*/,
+	{9314,2,0,0x226a,0x0} /*Lt*/,
+	{9316,3,0,0x41b,0x0} /*Lcy*/,
+	{9319,5,0,0x456,0x0} /*iukcy*/,
+	{9324,10,0,0x21bc,0x0} /*LeftVector*/,
+	{9334,5,0,0x15d,0x0} /*scirc*/,
+	{9339,5,0,0x2250,0x338} /*nedot*/,
+	{9344,6,0,0x25a1,0x0} /*Square*/,
+	{9350,17,0,0x2758,0x0} /*VerticalSeparator*/,
+	{9367,6,1,0xe9,0x0} /*eacute*/,
+	{9373,6,0,0x25,0x0} /*percnt*/,
+	{9379,13,0,0x21be,0x0} /*RightUpVector*/,
+	{9392,4,0,0x29f6,0x0} /*dsol*/,
+	{9396,5,0,0x253c,0x0} /*boxvh*/,
+	{9401,6,0,0x128,0x0} /*Itilde*/,
+	{9407,3,0,0x411,0x0} /*Bcy*/,
+	{9410,8,0,0x29af,0x0} /*angmsdah*/,
+	{9418,16,0,0x21c9,0x0} /*rightrightarrows*/,
+	{9434,6,0,0x16d,0x0} /*ubreve*/,
+	{9440,6,1,0xe0,0x0} /*agrave*/,
+	{9446,7,0,0x22a3,0x0} /*LeftTee*/,
+	{9453,5,0,0x228a,0x0} /*subne*/,
+	{9458,7,0,0x2720,0x0} /*maltese*/,
+	{9465,4,0,0x21d4,0x0} /*hArr*/,
+	{9469,8,0,0x2925,0x0} /*hksearow*/,
+	{9477,3,0,0x25a1,0x0} /*squ*/,
+	{9480,4,1,0xa9,0x0} /*copy*/,
+	{9484,20,0,0x25ab,0x0} /*EmptyVerySmallSquare*/,
+	{9504,12,0,0x224e,0x0} /*HumpDownHump*/,
+	{9516,9,0,0x2272,0x0} /*LessTilde*/,
+	{9525,4,0,0x7c,0x0} /*vert*/,
+	{9529,4,0,0x416,0x0} /*ZHcy*/,
+	{9533,6,0,0x210f,0x0} /*plankv*/,
+	{9539,7,0,0x2282,0x20d2} /*nsubset*/,
+	{9546,4,0,0x2010,0x0} /*dash*/,
+	{9550,2,0,0x2267,0x0} /*gE*/,
+	{9552,4,0,0x2131,0x0} /*Fscr*/,
+	{9556,11,0,0x2276,0x0} /*LessGreater*/,
+	{9567,4,0,0x22da,0xfe00} /*lesg*/,
+	{9571,5,0,0x226e,0x0} /*nless*/,
+	{9576,6,1,0xc3,0x0} /*Atilde*/,
+	{9582,5,0,0x27f9,0x0} /*xrArr*/,
+	{9587,8,0,0x227b,0x0} /*Succeeds*/,
+	{9595,6,1,0xb1,0x0} /*plusmn*/,
+	{9601,7,0,0x2ad8,0x0} /*supdsub*/,
+	{9608,10,0,0x21c8,0x0} /*upuparrows*/,
+	{9618,5,0,0x2a72,0x0} /*pluse*/,
+	{9623,5,0,0x153,0x0} /*oelig*/,
+	{9628,5,0,0x3f6,0x0} /*bepsi*/,
+	{9633,5,0,0x2514,0x0} /*boxur*/,
+	{9638,7,0,0x237c,0x0} /*angzarr*/,
+	{9645,5,0,0x2267,0x338} /*ngeqq*/,
+	{9650,6,0,0x3dc,0x0} /*Gammad*/,
+	{9656,6,0,0x22a0,0x0} /*timesb*/,
+	{9662,6,0,0x219d,0x338} /*nrarrw*/,
+	{9668,12,0,0x22b2,0x0} /*LeftTriangle*/,
+	{9680,5,0,0x39a,0x0} /*Kappa*/,
+	{9685,19,0,0x21c4,0x0} /*RightArrowLeftArrow*/,
+	{9704,7,0,0x224d,0x0} /*asympeq*/,
+	{9711,4,1,0xa0,0x0} /*nbsp*/,
+	{9715,4,0,0x457,0x0} /*yicy*/,
+	{9719,5,1,0xc5,0x0} /*Aring*/,
+	{9724,6,0,0x148,0x0} /*ncaron*/,
+	{9730,6,0,0x2902,0x0} /*nvlArr*/,
+	{9736,4,0,0x2ab0,0x338} /*nsce*/,
+	{9740,3,0,0x2aec,0x0} /*Not*/,
+	{9743,6,0,0x170,0x0} /*Udblac*/,
+	{9749,14,0,0x21b6,0x0} /*curvearrowleft*/,
+	{9763,4,0,0x2102,0x0} /*Copf*/,
+	{9767,3,0,0x2a,0x0} /*ast*/,
+	{9770,8,0,0x2ab5,0x0} /*precneqq*/,
+	{9778,8,0,0x220b,0x0} /*SuchThat*/,
+	{9786,5,0,0x29a5,0x0} /*range*/,
+	{9791,8,0,0x2251,0x0} /*doteqdot*/,
+	{9799,14,0,0x2196,0x0} /*UpperLeftArrow*/,
+	{9813,6,0,0x2a40,0x0} /*capdot*/,
+	{9819,5,0,0x2242,0x338} /*nesim*/,
+	{9824,8,0,0x22a0,0x0} /*boxtimes*/,
+	{9832,3,0,0x397,0x0} /*Eta*/,
+	{9835,6,0,0x13b,0x0} /*Lcedil*/,
+	{9841,6,0,0x2ac7,0x0} /*subsim*/,
+	{9847,4,0,0x28,0x0} /*lpar*/,
+	{9851,15,0,0x21c4,0x0} /*rightleftarrows*/,
+	{9866,3,0,0x1d535,0x0} /*xfr*/,
+	{9869,4,0,0x2aac,0x0} /*smte*/,
+	{9873,5,0,0x3f,0x0} /*quest*/,
+	{9878,4,0,0x1d561,0x0} /*popf*/,
+	{9882,6,0,0x2153,0x0} /*frac13*/,
+	{9888,3,0,0x1d52d,0x0} /*pfr*/,
+	{9891,4,0,0x22c1,0x0} /*xvee*/,
+	{9895,11,0,0x2195,0x0} /*updownarrow*/,
+	{9906,4,0,0x222a,0xfe00} /*cups*/,
+	{9910,9,0,0x2190,0x0} /*LeftArrow*/,
+	{9919,5,0,0x21c5,0x0} /*udarr*/,
+	{9924,8,0,0x229f,0x0} /*boxminus*/,
+	{9932,7,0,0x220c,0x0} /*notniva*/,
+	{9939,5,0,0x40e,0x0} /*Ubrcy*/,
+	{9944,3,1,0xd0,0x0} /*ETH*/,
+	{9947,7,0,0x2a7c,0x0} /*gtquest*/,
+	{9954,15,0,0x2197,0x0} /*UpperRightArrow*/,
+	{9969,4,0,0x1d4a6,0x0} /*Kscr*/,
+	{9973,20,0,0x201c,0x0} /*OpenCurlyDoubleQuote*/,
+	{9993,7,0,0x203e,0x0} /*OverBar*/,
+	{10000,17,0,0x2247,0x0} /*NotTildeFullEqual*/,
+	{10017,6,0,0x2a2e,0x0} /*roplus*/,
+	{10023,6,0,0x2ac8,0x0} /*supsim*/,
+	{10029,5,0,0x22f1,0x0} /*dtdot*/,
+	{10034,6,0,0x106,0x0} /*Cacute*/,
+	{10040,3,0,0x2207,0x0} /*Del*/,
+	{10043,4,0,0x2026,0x0} /*mldr*/,
+	{10047,4,0,0x452,0x0} /*djcy*/,
+	{10051,7,0,0x2a35,0x0} /*rotimes*/,
+	{10058,5,0,0x2a8f,0x0} /*lsimg*/,
+	{10063,2,0,0x2061,0x0} /*af*/,
+	{10065,4,0,0x45f,0x0} /*dzcy*/,
+	{10069,5,0,0x172,0x0} /*Uogon*/,
+	{10074,5,0,0x22a3,0x0} /*dashv*/,
+	{10079,3,0,0x21b1,0x0} /*rsh*/,
+	{10082,6,0,0x2159,0x0} /*frac16*/,
+	{10088,6,0,0x2306,0x0} /*Barwed*/,
+	{10094,16,0,0x21c5,0x0} /*UpArrowDownArrow*/,
+	{10110,7,0,0x22c4,0x0} /*diamond*/,
+	{10117,6,0,0x2ad5,0x0} /*subsub*/,
+	{10123,4,0,0x2a89,0x0} /*lnap*/,
+	{10127,7,0,0x2021,0x0} /*ddagger*/,
+	{10134,3,0,0x1d511,0x0} /*Nfr*/,
+	{10137,5,0,0x108,0x0} /*Ccirc*/,
+	{10142,15,0,0x2019,0x0} /*CloseCurlyQuote*/,
+	{10157,16,0,0x227f,0x338} /*NotSucceedsTilde*/,
+	{10173,6,0,0x11e,0x0} /*Gbreve*/,
+	{10179,7,0,0x22fe,0x0} /*notnivb*/,
+	{10186,5,0,0x237,0x0} /*jmath*/,
+	{10191,6,0,0x122,0x0} /*Gcedil*/,
+	{10197,4,0,0x2110,0x0} /*Iscr*/,
+	{10201,6,0,0x2336,0x0} /*topbot*/,
+	{10207,3,0,0x43c,0x0} /*mcy*/,
+	{10210,6,1,0xf2,0x0} /*ograve*/,
+	{10216,8,0,0x23e7,0x0} /*elinters*/,
+	{10224,4,0,0x2963,0x0} /*uHar*/,
+	{10228,7,0,0x2a2a,0x0} /*minusdu*/,
+	{10235,10,0,0x23b0,0x0} /*lmoustache*/,
+	{10245,8,0,0x2290,0x0} /*sqsupset*/,
+	{10253,4,0,0x425,0x0} /*KHcy*/,
+	{10257,5,0,0x2269,0x0} /*gneqq*/,
+	{10262,3,0,0x2227,0x0} /*and*/,
+	{10265,4,0,0x3c5,0x0} /*upsi*/,
+	{10269,4,0,0x5d,0x0} /*rsqb*/,
+	{10273,6,0,0x2259,0x0} /*wedgeq*/,
+	{10279,4,0,0x2251,0x0} /*eDot*/,
+	{10283,5,1,0xf4,0x0} /*ocirc*/,
+	{10288,6,0,0x2022,0x0} /*bullet*/,
+	{10294,5,0,0x3c3,0x0} /*sigma*/,
+	{10299,13,0,0x21d1,0x0} /*DoubleUpArrow*/,
+	{10312,10,0,0x2a85,0x0} /*lessapprox*/,
+	{10322,7,0,0x2ac3,0x0} /*subedot*/,
+	{10329,4,0,0x1d567,0x0} /*vopf*/,
+	{10333,4,0,0x227b,0x0} /*succ*/,
+	{10337,4,0,0x1d4ab,0x0} /*Pscr*/,
+	{10341,4,0,0x21d5,0x0} /*vArr*/,
+	{10345,8,0,0x2110,0x0} /*imagline*/,
+	{10353,4,1,0xaf,0x0} /*macr*/,
+	{10357,7,0,0x299a,0x0} /*vzigzag*/,
+	{10364,5,0,0x219b,0x0} /*nrarr*/,
+	{10369,8,0,0x211c,0x0} /*realpart*/,
+	{10377,8,0,0x2a89,0x0} /*lnapprox*/,
+	{10385,14,0,0x21c3,0x0} /*LeftDownVector*/,
+	{10399,5,0,0x2216,0x0} /*setmn*/,
+	{10404,4,0,0x29b7,0x0} /*opar*/,
+	{10408,5,0,0x2a4d,0x0} /*ccaps*/,
+	{10413,3,0,0x2a8c,0x0} /*gEl*/,
+	{10416,20,0,0x22ec,0x0} /*NotLeftTriangleEqual*/,
+	{10436,8,0,0x22c0,0x0} /*bigwedge*/,
+	{10444,9,0,0x21d0,0x0} /*Leftarrow*/,
+	{10453,3,0,0x1d514,0x0} /*Qfr*/,
+	{10456,5,0,0x2a79,0x0} /*ltcir*/,
+	{10461,3,0,0x200f,0x0} /*rlm*/,
+	{10464,7,0,0x2a7b,0x0} /*ltquest*/,
+	{10471,13,0,0x21a2,0x0} /*leftarrowtail*/,
+	{10484,3,0,0x3d,0x20e5} /*bne*/,
+	{10487,4,0,0x2a8a,0x0} /*gnap*/,
+	{10491,3,1,0x26,0x0} /*amp*/,
+	{10494,3,0,0x440,0x0} /*rcy*/,
+	{10497,5,0,0x12a,0x0} /*Imacr*/,
+	{10502,5,0,0x22d7,0x0} /*gtdot*/,
+	{10507,4,0,0x40c,0x0} /*KJcy*/,
+	{10511,4,0,0xbd,0x0} /*half*/,
+	{10515,5,0,0x2553,0x0} /*boxDr*/,
+	{10520,5,0,0x21b5,0x0} /*crarr*/,
+	{10525,3,0,0x223e,0x333} /*acE*/,
+	{10528,5,0,0x22bf,0x0} /*lrtri*/,
+	{10533,12,0,0x22c2,0x0} /*Intersection*/,
+	{10545,7,0,0x2209,0x0} /*notinva*/,
+	{10552,3,0,0x2111,0x0} /*Ifr*/,
+	{10555,4,0,0x2119,0x0} /*Popf*/,
+	{10559,7,0,0x2a34,0x0} /*lotimes*/,
+	{10566,12,0,0x21bf,0x0} /*LeftUpVector*/,
+	{10578,5,0,0x2033,0x0} /*Prime*/,
+	{10583,6,0,0x10c,0x0} /*Ccaron*/,
+	{10589,14,0,0x27f6,0x0} /*LongRightArrow*/,
+	{10603,8,0,0x231c,0x0} /*ulcorner*/,
+	{10611,3,0,0x413,0x0} /*Gcy*/,
+	{10614,6,0,0x2155,0x0} /*frac15*/,
+	{10620,15,0,0x21b7,0x0} /*curvearrowright*/,
+	{10635,3,0,0x2a96,0x0} /*egs*/,
+	{10638,5,0,0x21fe,0x0} /*roarr*/,
+	{10643,10,0,0x230b,0x0} /*RightFloor*/,
+	{10653,4,0,0x436,0x0} /*zhcy*/,
+	{10657,3,0,0x2127,0x0} /*mho*/,
+	{10660,10,0,0x2131,0x0} /*Fouriertrf*/,
+	{10670,5,0,0x229e,0x0} /*plusb*/,
+	{10675,9,0,0x2193,0x0} /*DownArrow*/,
+	{10684,7,0,0x225f,0x0} /*questeq*/,
+	{10691,10,0,0x226f,0x0} /*NotGreater*/,
+	{10701,4,0,0x2b,0x0} /*plus*/,
+	{10705,4,0,0x1d4aa,0x0} /*Oscr*/,
+	{10709,6,0,0x2118,0x0} /*weierp*/,
+	{10715,9,0,0x22a1,0x0} /*dotsquare*/,
+	{10724,18,0,0x21cb,0x0} /*ReverseEquilibrium*/,
+	{10742,4,0,0x402,0x0} /*DJcy*/,
+	{10746,9,0,0x2035,0x0} /*backprime*/,
+	{10755,5,0,0x2236,0x0} /*ratio*/,
+	{10760,4,0,0x210f,0x0} /*hbar*/,
+	{10764,17,0,0x21a0,0x0} /*twoheadrightarrow*/,
+	{10781,15,0,0x22cc,0x0} /*rightthreetimes*/,
+	{10796,6,0,0x166,0x0} /*Tstrok*/,
+	{10802,3,0,0x2265,0x0} /*geq*/,
+	{10805,3,0,0x22d8,0x338} /*nLl*/,
+	{10808,6,0,0x22b9,0x0} /*hercon*/,
+	{10814,6,0,0x158,0x0} /*Rcaron*/,
+	{10820,11,0,0x3f6,0x0} /*backepsilon*/,
+	{10831,5,0,0x2280,0x0} /*nprec*/,
+	{10836,5,0,0x134,0x0} /*Jcirc*/,
+	{10841,5,0,0x21ca,0x0} /*ddarr*/,
+	{10846,3,0,0x41f,0x0} /*Pcy*/,
+	{10849,11,0,0x21cf,0x0} /*nRightarrow*/,
+	{10860,5,0,0x2282,0x20d2} /*vnsub*/,
+	{10865,8,0,0x2286,0x0} /*subseteq*/,
+	{10873,3,0,0x1d529,0x0} /*lfr*/,
+	{10876,3,1,0xae,0x0} /*REG*/,
+	{10879,5,0,0x2423,0x0} /*blank*/,
+	{10884,7,0,0x2aaf,0x338} /*npreceq*/,
+	{10891,7,0,0x3b5,0x0} /*epsilon*/,
+	{10898,3,0,0x417,0x0} /*Zcy*/,
+	{10901,15,0,0x2192,0x0} /*ShortRightArrow*/,
+	{10916,15,0,0x21bd,0x0} /*leftharpoondown*/,
+	{10931,9,0,0xa8,0x0} /*DoubleDot*/,
+	{10940,8,0,0x2a84,0x0} /*gesdotol*/,
+	{10948,7,0,0x2254,0x0} /*coloneq*/,
+	{10955,3,0,0x2280,0x0} /*npr*/,
+	{10958,6,0,0x171,0x0} /*udblac*/,
+	{10964,4,1,0xa2,0x0} /*cent*/,
+	{10968,11,0,0x21d5,0x0} /*Updownarrow*/,
+	{10979,6,0,0x2203,0x0} /*Exists*/,
+	{10985,4,0,0x2ab6,0x0} /*scnE*/,
+	{10989,11,0,0x29f4,0x0} /*RuleDelayed*/,
+	{11000,4,0,0x1d4cf,0x0} /*zscr*/,
+	{11004,8,0,0x2a7d,0x0} /*leqslant*/,
+	{11012,6,0,0x10f,0x0} /*dcaron*/,
+	{11018,3,0,0x419,0x0} /*Jcy*/,
+	{11021,5,1,0xc2,0x0} /*Acirc*/,
+	{11026,4,0,0x1d4ce,0x0} /*yscr*/,
+	{11030,5,0,0x101,0x0} /*amacr*/,
+	{11035,4,0,0x2002,0x0} /*ensp*/,
+	{11039,5,0,0x15c,0x0} /*Scirc*/,
+	{11044,3,0,0x2d9,0x0} /*dot*/,
+	{11047,3,0,0x2a87,0x0} /*lne*/,
+	{11050,4,0,0x2016,0x0} /*Vert*/,
+	{11054,15,0,0x2958,0x0} /*LeftUpVectorBar*/,
+	{11069,6,0,0x141,0x0} /*Lstrok*/,
+	{11075,21,0,0x222f,0x0} /*DoubleContourIntegral*/,
+	{11096,4,0,0x1d4b2,0x0} /*Wscr*/,
+	{11100,5,0,0x2518,0x0} /*boxul*/,
+	{11105,6,0,0x157,0x0} /*rcedil*/,
+	{11111,4,1,0xd6,0x0} /*Ouml*/,
+	{11115,2,0,0x39e,0x0} /*Xi*/,
+	{11117,11,0,0x229d,0x0} /*circleddash*/,
+	{11128,14,0,0x2245,0x0} /*TildeFullEqual*/,
+	{11142,4,0,0x2267,0x0} /*geqq*/,
+	{11146,5,0,0x256a,0x0} /*boxvH*/,
+	{11151,6,0,0x215e,0x0} /*frac78*/,
+	{11157,7,0,0x2a81,0x0} /*lesdoto*/,
+	{11164,14,0,0x2193,0x0} /*ShortDownArrow*/,
+	{11178,4,0,0x2ae7,0x0} /*Barv*/,
+	{11182,6,0,0x2a01,0x0} /*xoplus*/,
+	{11188,4,0,0x211c,0x0} /*real*/,
+	{11192,6,0,0x5f,0x0} /*lowbar*/,
+	{11198,8,0,0x2a49,0x0} /*capbrcup*/,
+	{11206,6,0,0x2aef,0x0} /*cirmid*/,
+	{11212,3,0,0x2266,0x338} /*nlE*/,
+	{11215,4,0,0x1d4c3,0x0} /*nscr*/,
+	{11219,8,0,0x3f0,0x0} /*varkappa*/,
+	{11227,6,0,0x225f,0x0} /*equest*/,
+	{11233,6,0,0x27e9,0x0} /*rangle*/,
+	{11239,14,0,0x27f6,0x0} /*longrightarrow*/,
+	{11253,4,0,0x27ea,0x0} /*Lang*/,
+	{11257,3,0,0x3b7,0x0} /*eta*/,
+	{11260,4,0,0x2ab5,0x0} /*prnE*/,
+	{11264,8,0,0x2a13,0x0} /*scpolint*/,
+	{11272,7,0,0x25ef,0x0} /*bigcirc*/,
+	{11279,3,0,0x1d510,0x0} /*Mfr*/,
+	{11282,6,0,0x2929,0x0} /*seswar*/,
+	{11288,10,0,0x22cf,0x0} /*curlywedge*/,
+	{11298,15,0,0x2275,0x0} /*NotGreaterTilde*/,
+	{11313,7,0,0x2a24,0x0} /*simplus*/,
+	{11320,3,0,0x1d50d,0x0} /*Jfr*/,
+	{11323,6,0,0x458,0x0} /*jsercy*/,
+	{11329,5,0,0x22e6,0x0} /*lnsim*/,
+	{11334,9,0,0x22d4,0x0} /*pitchfork*/,
+	{11343,13,0,0x25b4,0x0} /*blacktriangle*/,
+	{11356,5,0,0x2569,0x0} /*boxHU*/,
+	{11361,5,0,0x113,0x0} /*emacr*/,
+	{11366,6,0,0x2216,0x0} /*ssetmn*/,
+	{11372,8,0,0x2283,0x0} /*Superset*/,
+	{11380,7,0,0x39f,0x0} /*Omicron*/,
+	{11387,6,0,0x1f5,0x0} /*gacute*/,
+	{11393,5,0,0x2991,0x0} /*langd*/,
+	{11398,5,0,0x149,0x0} /*napos*/,
+	{11403,6,1,0xc1,0x0} /*Aacute*/,
+	{11409,5,0,0x2910,0x0} /*RBarr*/,
+	{11414,5,0,0x2a8e,0x0} /*gsime*/,
+	{11419,6,0,0x21ab,0x0} /*larrlp*/,
+	{11425,8,0,0x22e9,0x0} /*succnsim*/,
+	{11433,5,0,0x21cb,0x0} /*lrhar*/,
+	{11438,9,0,0x2216,0x0} /*Backslash*/,
+	{11447,5,0,0x2274,0x0} /*nlsim*/,
+	{11452,3,0,0x2a7e,0x0} /*ges*/,
+	{11455,4,0,0x2287,0x0} /*supe*/,
+	{11459,2,0,0x226a,0x0} /*ll*/,
+	{11461,6,0,0x3d1,0x0} /*thetav*/,
+	{11467,4,0,0x1d53e,0x0} /*Gopf*/,
+	{11471,8,0,0x2223,0x0} /*shortmid*/,
+	{11479,4,0,0x2229,0xfe00} /*caps*/,
+	{11483,3,0,0x21d4,0x0} /*iff*/,
+	{11486,5,0,0x131,0x0} /*imath*/,
+	{11491,4,0,0x2aa6,0x0} /*ltcc*/,
+	{11495,7,0,0x395,0x0} /*Epsilon*/,
+	{11502,9,0,0x22cd,0x0} /*backsimeq*/,
+	{11511,5,0,0x2a9f,0x0} /*simlE*/,
+	{11516,4,0,0x210d,0x0} /*Hopf*/,
+	{11520,4,0,0x2257,0x0} /*cire*/,
+	{11524,6,0,0x2a55,0x0} /*andand*/,
+	{11530,4,0,0x2500,0x0} /*boxh*/,
+	{11534,6,1,0xec,0x0} /*igrave*/,
+	{11540,5,0,0x21be,0x0} /*uharr*/,
+	{11545,4,0,0x426,0x0} /*TScy*/,
+	{11549,8,0,0x2a12,0x0} /*rppolint*/,
+	{11557,4,0,0x1d4ae,0x0} /*Sscr*/,
+	{11561,9,0,0x2282,0x20d2} /*NotSubset*/,
+	{11570,5,1,0xc6,0x0} /*AElig*/,
+	{11575,3,0,0x3c8,0x0} /*psi*/,
+	{11578,16,0,0x22db,0x0} /*GreaterEqualLess*/,
+	{11594,5,0,0x22a2,0x0} /*vdash*/,
+	{11599,14,0,0x2500,0x0} /*HorizontalLine*/,
+	{11613,6,0,0x2217,0x0} /*lowast*/,
+	{11619,2,0,0x2145,0x0} /*DD*/,
+	{11621,4,0,0x1d563,0x0} /*ropf*/,
+	{11625,6,0,0x2273,0x0} /*gtrsim*/,
+	{11631,6,0,0x2283,0x0} /*supset*/,
+	{11637,4,0,0x1d56b,0x0} /*zopf*/,
+	{11641,5,0,0x2309,0x0} /*rceil*/,
+	{11646,4,0,0x200c,0x0} /*zwnj*/,
+	{11650,7,0,0x2972,0x0} /*simrarr*/,
+	{11657,6,0,0x2976,0x0} /*ltlarr*/,
+	{11663,2,0,0x2abb,0x0} /*Pr*/,
+	{11665,12,0,0x210b,0x0} /*HilbertSpace*/,
+	{11677,7,0,0x2a39,0x0} /*triplus*/,
+	{11684,3,0,0x22c1,0x0} /*Vee*/,
+	{11687,6,0,0x2154,0x0} /*frac23*/,
+	{11693,4,0,0x1d54f,0x0} /*Xopf*/,
+	{11697,4,0,0x22fa,0x0} /*nisd*/,
+	{11701,6,0,0x2a,0x0} /*midast*/,
+	{11707,4,0,0x25b5,0x0} /*utri*/,
+	{11711,8,0,0x29b3,0x0} /*raemptyv*/,
+	{11719,7,0,0x2a77,0x0} /*ddotseq*/,
+	{11726,3,0,0x443,0x0} /*ucy*/,
+	{11729,3,0,0x2223,0x0} /*mid*/,
+	{11732,6,0,0x2004,0x0} /*emsp13*/,
+	{11738,6,0,0x22d1,0x0} /*Supset*/,
+	{11744,4,0,0x1d54a,0x0} /*Sopf*/,
+	{11748,13,0,0x2acb,0xfe00} /*varsubsetneqq*/,
+	{11761,3,0,0x42d,0x0} /*Ecy*/,
+	{11764,6,0,0x2322,0x0} /*sfrown*/,
+	{11770,6,0,0x2315,0x0} /*telrec*/,
+	{11776,5,0,0x228b,0x0} /*supne*/,
+	{11781,7,0,0x29de,0x0} /*nvinfin*/,
+	{11788,5,0,0x2591,0x0} /*blk14*/,
+	{11793,4,0,0x22a5,0x0} /*perp*/,
+	{11797,5,0,0x11c,0x0} /*Gcirc*/,
+	{11802,6,0,0x231d,0x0} /*urcorn*/,
+	{11808,5,0,0x22f0,0x0} /*utdot*/,
+	{11813,6,0,0x22bd,0x0} /*barvee*/,
+	{11819,4,1,0xcf,0x0} /*Iuml*/,
+	{11823,7,0,0x2969,0x0} /*rdldhar*/,
+	{11830,5,0,0x21c9,0x0} /*rrarr*/,
+	{11835,4,0,0x44f,0x0} /*yacy*/,
+	{11839,5,0,0x25bd,0x0} /*xdtri*/,
+	{11844,6,0,0x2116,0x0} /*numero*/,
+	{11850,8,0,0x299d,0x0} /*angrtvbd*/,
+	{11858,5,0,0x2a00,0x0} /*xodot*/,
+	{11863,4,0,0x21a0,0x0} /*Rarr*/,
+	{11867,6,0,0x156,0x0} /*Rcedil*/,
+	{11873,4,0,0x1d54b,0x0} /*Topf*/,
+	{11877,5,0,0x21bf,0x0} /*uharl*/,
+	{11882,3,0,0x2268,0x0} /*lnE*/,
+	{11885,5,0,0x2593,0x0} /*blk34*/,
+	{11890,4,0,0x2ae8,0x0} /*vBar*/,
+	{11894,3,0,0x2aa5,0x0} /*gla*/,
+	{11897,6,1,0xbe,0x0} /*frac34*/,
+	{11903,3,0,0x223c,0x0} /*sim*/,
+	{11906,14,0,0x2194,0x0} /*LeftRightArrow*/,
+	{11920,5,1,0xca,0x0} /*Ecirc*/,
+	{11925,4,0,0x1d4b7,0x0} /*bscr*/,
+	{11929,6,0,0x21b6,0x0} /*cularr*/,
+	{11935,5,0,0x45e,0x0} /*ubrcy*/,
+	{11940,4,0,0x1d538,0x0} /*Aopf*/,
+	{11944,6,1,0xed,0x0} /*iacute*/,
+	{11950,14,0,0x2278,0x0} /*NotLessGreater*/,
+	{11964,10,0,0x2112,0x0} /*Laplacetrf*/,
+	{11974,5,0,0x2985,0x0} /*lopar*/,
+	{11979,8,0,0x2a6d,0x338} /*ncongdot*/,
+	{11987,8,0,0x2a0d,0x0} /*fpartint*/,
+	{11995,4,0,0x1d4c6,0x0} /*qscr*/,
+	{11999,12,0,0x2274,0x0} /*NotLessTilde*/,
+	{12011,5,0,0x2588,0x0} /*block*/,
+	{12016,5,0,0x2289,0x0} /*nsupe*/,
+	{12021,4,0,0x2606,0x0} /*star*/,
+	{12025,13,0,0x22ea,0x0} /*ntriangleleft*/,
+	{12038,8,0,0x2115,0x0} /*naturals*/,
+	{12046,5,0,0x21cf,0x0} /*nrArr*/,
+	{12051,6,0,0x2a94,0x0} /*gesles*/,
+	{12057,3,1,0xa5,0x0} /*yen*/,
+	{12060,5,0,0x21ff,0x0} /*hoarr*/,
+	{12065,5,0,0x2555,0x0} /*boxdL*/,
+	{12070,3,0,0x22db,0x0} /*gel*/,
+	{12073,8,0,0x2a8a,0x0} /*gnapprox*/,
+	{12081,17,0,0x2225,0x0} /*DoubleVerticalBar*/,
+	{12098,3,0,0x29c1,0x0} /*ogt*/,
+	{12101,13,0,0x2287,0x0} /*SupersetEqual*/,
+	{12114,5,0,0x2aad,0xfe00} /*lates*/,
+	{12119,15,0,0x224e,0x338} /*NotHumpDownHump*/,
+	{12134,5,0,0xaf,0x0} /*strns*/,
+	{12139,4,0,0x2273,0x0} /*gsim*/,
+	{12143,11,0,0x210d,0x0} /*quaternions*/,
+	{12154,7,0,0x2a3c,0x0} /*intprod*/,
+	{12161,7,0,0x2134,0x0} /*orderof*/,
+	{12168,8,0,0x223c,0x0} /*thicksim*/,
+	{12176,5,0,0x2247,0x0} /*ncong*/,
+	{12181,4,0,0x1d540,0x0} /*Iopf*/,
+	{12185,3,0,0x439,0x0} /*jcy*/,
+	{12188,5,0,0x394,0x0} /*Delta*/,
+	{12193,6,1,0xf7,0x0} /*divide*/,
+	{12199,6,0,0x297f,0x0} /*dfisht*/,
+	{12205,5,0,0x223c,0x0} /*Tilde*/,
+	{12210,4,1,0xf6,0x0} /*ouml*/,
+	{12214,6,1,0xd5,0x0} /*Otilde*/,
+	{12220,5,0,0x2564,0x0} /*boxHd*/,
+	{12225,5,0,0x2198,0x0} /*searr*/,
+	{12230,4,0,0x2ab7,0x0} /*prap*/,
+	{12234,6,0,0x2a37,0x0} /*Otimes*/,
+	{12240,14,0,0x21be,0x0} /*upharpoonright*/,
+	{12254,3,0,0x3c4,0x0} /*tau*/,
+	{12257,5,0,0x21d9,0x0} /*swArr*/,
+	{12262,17,0,0x21d5,0x0} /*DoubleUpDownArrow*/,
+	{12279,3,0,0x2113,0x0} /*ell*/,
+	{12282,7,0,0x2060,0x0} /*NoBreak*/,
+	{12289,11,0,0x219b,0x0} /*nrightarrow*/,
+	{12300,6,0,0x2978,0x0} /*gtrarr*/,
+	{12306,6,1,0xd2,0x0} /*Ograve*/,
+	{12312,2,0,0x2260,0x0} /*ne*/,
+	{12314,8,0,0x2a83,0x0} /*lesdotor*/,
+	{12322,4,0,0x212f,0x0} /*escr*/,
+	{12326,13,0,0x2acc,0xfe00} /*varsupsetneqq*/,
+	{12339,5,0,0x22b8,0x0} /*mumap*/,
+	{12344,5,0,0x21da,0x0} /*lAarr*/,
+	{12349,5,0,0x251c,0x0} /*boxvr*/,
+	{12354,4,0,0x27,0x0} /*apos*/,
+	{12358,4,0,0x226f,0x0} /*ngtr*/,
+	{12362,5,0,0x29c5,0x0} /*bsolb*/,
+	{12367,11,0,0x23b4,0x0} /*OverBracket*/,
+	{12378,5,0,0x22cf,0x0} /*cuwed*/,
+	{12383,18,0,0x2955,0x0} /*RightDownVectorBar*/,
+	{12401,5,0,0x2524,0x0} /*boxvl*/,
+	{12406,2,0,0x3bd,0x0} /*nu*/,
+	{12408,5,0,0x25f8,0x0} /*ultri*/,
+	{12413,20,0,0x2a7e,0x338} /*NotGreaterSlantEqual*/,
+	{12433,5,0,0x60,0x0} /*grave*/,
+	{12438,9,0,0x230a,0x0} /*LeftFloor*/,
+	{12447,3,0,0x14a,0x0} /*ENG*/,
+	{12450,5,1,0xdb,0x0} /*Ucirc*/,
+	{12455,5,0,0x22ce,0x0} /*cuvee*/,
+	{12460,4,0,0x3c,0x20d2} /*nvlt*/,
+	{12464,9,0,0xb1,0x0} /*PlusMinus*/,
+	{12473,4,0,0x2acf,0x0} /*csub*/,
+	{12477,7,0,0x2235,0x0} /*Because*/,
+	{12484,5,0,0x16e,0x0} /*Uring*/,
+	{12489,4,0,0x1d55e,0x0} /*mopf*/,
+	{12493,5,0,0x2242,0x0} /*eqsim*/,
+	{12498,4,0,0x1d4b5,0x0} /*Zscr*/,
+	{12502,3,0,0x23,0x0} /*num*/,
+	{12505,9,0,0x311,0x0} /*DownBreve*/,
+	{12514,3,0,0x1d523,0x0} /*ffr*/,
+	{12517,6,0,0x13c,0x0} /*lcedil*/,
+	{12523,16,0,0x21d2,0x0} /*DoubleRightArrow*/,
+	{12539,7,0,0x2ac1,0x0} /*submult*/,
+	{12546,4,0,0x223d,0x0} /*bsim*/,
+	{12550,7,0,0x2966,0x0} /*luruhar*/,
+	{12557,5,0,0x2250,0x0} /*esdot*/,
+	{12562,12,0,0x21a7,0x0} /*DownTeeArrow*/,
+	{12574,3,0,0x442,0x0} /*tcy*/,
+	{12577,7,0,0x29bb,0x0} /*olcross*/,
+	{12584,3,0,0x22d9,0x338} /*nGg*/,
+	{12587,4,0,0x1d4cc,0x0} /*wscr*/,
+	{12591,6,1,0xcc,0x0} /*Igrave*/,
+	{12597,6,0,0x22ee,0x0} /*vellip*/,
+	{12603,4,0,0x427,0x0} /*CHcy*/,
+	{12607,4,0,0x1d55b,0x0} /*jopf*/,
+	{12611,5,0,0x227d,0x0} /*sccue*/,
+	{12616,6,0,0x3c2,0x0} /*sigmaf*/,
+	{12622,4,0,0x1d4c2,0x0} /*mscr*/,
+	{12626,5,0,0x21d7,0x0} /*neArr*/,
+	{12631,2,1,0x3c,0x0} /*lt*/,
+	{12633,4,1,0xaa,0x0} /*ordf*/,
+	{12637,4,0,0x2a7e,0x338} /*nges*/,
+	{12641,6,0,0x2aaf,0x0} /*preceq*/,
+	{12647,6,0,0x3c2,0x0} /*sigmav*/,
+	{12653,3,0,0x1d51a,0x0} /*Wfr*/,
+	{12656,8,0,0x2a04,0x0} /*biguplus*/,
+	{12664,7,0,0x3c5,0x0} /*upsilon*/,
+	{12671,19,0,0x29d0,0x338} /*NotRightTriangleBar*/,
+	{12690,5,0,0x2250,0x0} /*doteq*/,
+	{12695,4,0,0x2ac6,0x0} /*supE*/,
+	{12699,5,0,0x21c7,0x0} /*llarr*/,
+	{12704,7,0,0x2968,0x0} /*ruluhar*/,
+	{12711,14,0,0x2290,0x0} /*SquareSuperset*/,
+	{12725,3,0,0x412,0x0} /*Vcy*/,
+	{12728,4,0,0x3b2,0x0} /*beta*/,
+	{12732,4,0,0x5c,0x0} /*bsol*/,
+	{12736,6,0,0x22af,0x0} /*nVDash*/,
+	{12742,16,0,0x22eb,0x0} /*NotRightTriangle*/,
+	{12758,5,0,0x2605,0x0} /*starf*/,
+	{12763,5,0,0x2aa8,0x0} /*lescc*/,
+	{12768,4,0,0x2a56,0x0} /*oror*/,
+	{12772,6,0,0x27e8,0x0} /*langle*/,
+	{12778,6,1,0xfd,0x0} /*yacute*/,
+	{12784,6,0,0x215b,0x0} /*frac18*/,
+	{12790,4,0,0x1d562,0x0} /*qopf*/,
+	{12794,9,0,0x21d3,0x0} /*Downarrow*/,
+	{12803,8,0,0x224c,0x0} /*backcong*/,
+	{12811,6,0,0x44c,0x0} /*softcy*/,
+	{12817,7,0,0x226e,0x0} /*NotLess*/,
+	{12824,5,0,0x27e7,0x0} /*robrk*/,
+	{12829,6,1,0xbc,0x0} /*frac14*/,
+	{12835,9,0,0x2ac5,0x0} /*subseteqq*/,
+	{12844,5,0,0x2295,0x0} /*oplus*/,
+	{12849,4,0,0x1d53c,0x0} /*Eopf*/,
+	{12853,6,0,0x2210,0x0} /*coprod*/,
+	{12859,3,0,0x1d50e,0x0} /*Kfr*/,
+	{12862,4,0,0x3b6,0x0} /*zeta*/,
+	{12866,8,0,0x25b5,0x0} /*triangle*/,
+	{12874,3,0,0x41e,0x0} /*Ocy*/,
+	{12877,12,0,0x228a,0xfe00} /*varsubsetneq*/,
+	{12889,14,0,0x220b,0x0} /*ReverseElement*/,
+	{12903,3,0,0x432,0x0} /*vcy*/,
+	{12906,5,0,0x12e,0x0} /*Iogon*/,
+	{12911,13,0,0x25b3,0x0} /*bigtriangleup*/,
+	{12924,5,0,0x21cc,0x0} /*rlhar*/,
+	{12929,14,0,0x2279,0x0} /*NotGreaterLess*/,
+	{12943,5,0,0x2773,0x0} /*rbbrk*/,
+	{12948,5,0,0x40b,0x0} /*TSHcy*/,
+	{12953,11,0,0x2281,0x0} /*NotSucceeds*/,
+	{12964,8,0,0x2111,0x0} /*imagpart*/,
+	{12972,3,0,0x422,0x0} /*Tcy*/,
+	{12975,9,0,0x225c,0x0} /*triangleq*/,
+	{12984,4,0,0x2929,0x0} /*tosa*/,
+	{12988,5,0,0x2a7a,0x0} /*gtcir*/,
+	{12993,4,0,0x222d,0x0} /*tint*/,
+	{12997,2,0,0x2277,0x0} /*gl*/,
+	{12999,11,0,0x2ab9,0x0} /*precnapprox*/,
+	{13010,12,0,0x2970,0x0} /*RoundImplies*/,
+	{13022,4,0,0x40a,0x0} /*NJcy*/,
+	{13026,7,0,0x22b4,0x20d2} /*nvltrie*/,
+	{13033,19,0,0x21ad,0x0} /*leftrightsquigarrow*/,
+	{13052,3,0,0x22d2,0x0} /*Cap*/,
+	{13055,6,0,0x15e,0x0} /*Scedil*/,
+	{13061,6,0,0x11f,0x0} /*gbreve*/,
+	{13067,6,1,0xe8,0x0} /*egrave*/,
+	{13073,4,0,0x22c2,0x0} /*xcap*/,
+	{13077,11,0,0x2218,0x0} /*SmallCircle*/,
+	{13088,5,0,0x2a45,0x0} /*cupor*/,
+	{13093,31,0,0x2233,0x0} /*CounterClockwiseContourIntegral*/,
+	{13124,5,0,0x2a8d,0x0} /*lsime*/,
+	{13129,5,0,0x21c3,0x0} /*dharl*/,
+	{13134,17,0,0x27e9,0x0} /*RightAngleBracket*/,
+	{13151,9,0,0x2289,0x0} /*nsupseteq*/,
+	{13160,5,0,0x2192,0x0} /*srarr*/,
+	{13165,5,0,0x22eb,0x0} /*nrtri*/,
+	{13170,4,0,0x2264,0x20d2} /*nvle*/,
+	{13174,4,0,0x1d4b4,0x0} /*Yscr*/,
+	{13178,10,0,0x2242,0x0} /*EqualTilde*/,
+	{13188,17,0,0x2961,0x0} /*LeftDownTeeVector*/,
+	{13205,14,0,0x21ac,0x0} /*looparrowright*/,
+	{13219,7,0,0x2a57,0x0} /*orslope*/,
+	{13226,6,1,0xd9,0x0} /*Ugrave*/,
+	{13232,6,0,0x2035,0x0} /*bprime*/,
+	{13238,5,0,0x2308,0x0} /*lceil*/,
+	{13243,6,0,0x2945,0x0} /*rarrpl*/,
+	{13249,5,0,0x2acc,0x0} /*supnE*/,
+	{13254,4,0,0x21b2,0x0} /*ldsh*/,
+	{13258,8,0,0x231e,0x0} /*llcorner*/,
+	{13266,6,0,0x2257,0x0} /*circeq*/,
+	{13272,3,0,0x22d3,0x0} /*Cup*/,
+	{13275,8,0,0x232e,0x0} /*profalar*/,
+	{13283,3,0,0x3c7,0x0} /*chi*/,
+	{13286,2,0,0x2208,0x0} /*in*/,
+	{13288,8,0,0x29e5,0x0} /*eqvparsl*/,
+	{13296,6,0,0x151,0x0} /*odblac*/,
+	{13302,12,0,0x2147,0x0} /*ExponentialE*/,
+	{13314,17,0,0x294f,0x0} /*RightUpDownVector*/,
+	{13331,5,0,0x3c9,0x0} /*omega*/,
+	{13336,5,0,0x29bf,0x0} /*ofcir*/,
+	{13341,4,0,0x219e,0x0} /*Larr*/,
+	{13345,17,0,0x220c,0x0} /*NotReverseElement*/,
+	{13362,5,0,0x21c1,0x0} /*rhard*/,
+	{13367,2,0,0x227b,0x0} /*sc*/,
+	{13369,5,0,0x174,0x0} /*Wcirc*/,
+	{13374,7,0,0x22b5,0x20d2} /*nvrtrie*/,
+	{13381,14,0,0x226a,0x0} /*NestedLessLess*/,
+	{13395,4,0,0x27e9,0x0} /*rang*/,
+	{13399,4,0,0x1d541,0x0} /*Jopf*/,
+	{13403,6,0,0x2119,0x0} /*primes*/,
+	{13409,5,0,0x219d,0x0} /*rarrw*/,
+	{13414,6,0,0x22b6,0x0} /*origof*/,
+	{13420,4,0,0x2a38,0x0} /*odiv*/,
+	{13424,5,0,0x22a9,0x0} /*Vdash*/,
+	{13429,8,0,0x29ac,0x0} /*angmsdae*/,
+	{13437,5,0,0x22ab,0x0} /*VDash*/,
+	{13442,13,0,0x2146,0x0} /*DifferentialD*/,
+	{13455,4,0,0x2502,0x0} /*boxv*/,
+	{13459,6,1,0xd8,0x0} /*Oslash*/,
+	{13465,5,0,0x227c,0x0} /*prcue*/,
+	{13470,5,0,0x290f,0x0} /*rBarr*/,
+	{13475,5,0,0x124,0x0} /*Hcirc*/,
+	{13480,3,0,0x1d527,0x0} /*jfr*/,
+	{13483,3,0,0x5e,0x0} /*Hat*/,
+	{13486,6,1,0xb7,0x0} /*middot*/,
+	{13492,5,1,0xce,0x0} /*Icirc*/,
+	{13497,6,0,0x2133,0x0} /*phmmat*/,
+	{13503,5,0,0x21e5,0x0} /*rarrb*/,
+	{13508,5,0,0x2558,0x0} /*boxuR*/,
+	{13513,4,0,0x7d,0x0} /*rcub*/,
+	{13517,5,0,0x105,0x0} /*aogon*/,
+	{13522,4,0,0x1d53b,0x0} /*Dopf*/,
+	{13526,6,0,0x21a3,0x0} /*rarrtl*/,
+	{13532,3,0,0x1d504,0x0} /*Afr*/,
+	{13535,4,0,0x223d,0x331} /*race*/,
+	{13539,3,0,0x2a86,0x0} /*gap*/,
+	{13542,3,0,0x1d517,0x0} /*Tfr*/,
+	{13545,5,0,0x404,0x0} /*Jukcy*/,
+	{13550,4,0,0x1d54e,0x0} /*Wopf*/,
+	{13554,9,0,0x2660,0x0} /*spadesuit*/,
+	{13563,6,1,0xe3,0x0} /*atilde*/,
+	{13569,2,0,0x2146,0x0} /*dd*/,
+	{13571,6,0,0x2244,0x0} /*nsimeq*/,
+	{13577,10,0,0x2292,0x0} /*sqsupseteq*/,
+	{13587,3,0,0x2228,0x0} /*vee*/,
+	{13590,10,0,0x21d2,0x0} /*Rightarrow*/,
+	{13600,6,0,0x215c,0x0} /*frac38*/,
+	{13606,3,1,0xa8,0x0} /*uml*/,
+	{13609,6,0,0x2005,0x0} /*emsp14*/,
+	{13615,6,0,0x291b,0x0} /*lAtail*/,
+	{13621,4,0,0x2241,0x0} /*nsim*/,
+	{13625,8,0,0x294a,0x0} /*lurdshar*/,
+	{13633,19,0,0x2292,0x0} /*SquareSupersetEqual*/,
+	{13652,6,0,0x2ad4,0x0} /*supsub*/,
+	{13658,2,0,0x2062,0x0} /*it*/,
+	{13660,5,0,0x2666,0x0} /*diams*/,
+	{13665,3,0,0x22a5,0x0} /*bot*/,
+	{13668,20,0,0x2145,0x0} /*CapitalDifferentialD*/,
+	{13688,10,0,0x2209,0x0} /*NotElement*/,
+	{13698,3,0,0x2249,0x0} /*nap*/,
+	{13701,4,0,0x2720,0x0} /*malt*/,
+	{13705,8,0,0x2225,0x0} /*parallel*/,
+	{13713,16,0,0x27e8,0x0} /*LeftAngleBracket*/,
+	{13729,4,0,0x1d4c9,0x0} /*tscr*/,
+	{13733,5,0,0x2190,0x0} /*slarr*/,
+	{13738,4,0,0x2124,0x0} /*Zopf*/,
+	{13742,7,0,0x2a82,0x0} /*gesdoto*/,
+	{13749,3,0,0x2ab3,0x0} /*prE*/,
+	{13752,5,0,0x2562,0x0} /*boxVl*/,
+	{13757,7,0,0x2a16,0x0} /*quatint*/,
+	{13764,4,0,0x211a,0x0} /*Qopf*/,
+	{13768,13,0,0x296e,0x0} /*UpEquilibrium*/,
+	{13781,16,0,0x21c2,0x0} /*downharpoonright*/,
+	{13797,3,0,0x2211,0x0} /*sum*/,
+	{13800,14,0,0x22cb,0x0} /*leftthreetimes*/,
+	{13814,4,0,0x27eb,0x0} /*Rang*/,
+	{13818,5,0,0x2a3c,0x0} /*iprod*/,
+	{13823,5,0,0x27f8,0x0} /*xlArr*/,
+	{13828,15,0,0x228f,0x338} /*NotSquareSubset*/,
+	{13843,2,0,0x211e,0x0} /*rx*/,
+	{13845,15,0,0x21c1,0x0} /*DownRightVector*/,
+	{13860,5,0,0x173,0x0} /*uogon*/,
+	{13865,2,0,0x211c,0x0} /*Re*/,
+	{13867,6,0,0x2112,0x0} /*lagran*/,
+	{13873,4,0,0x415,0x0} /*IEcy*/,
+	{13877,11,0,0x22df,0x0} /*curlyeqsucc*/,
+	{13888,6,0,0x296b,0x0} /*llhard*/,
+	{13894,18,0,0x2957,0x0} /*DownRightVectorBar*/,
+	{13912,4,0,0x226a,0x338} /*nLtv*/,
+	{13916,11,0,0x25aa,0x0} /*blacksquare*/,
+	{13927,3,0,0x2a53,0x0} /*And*/,
+	{13930,5,0,0x2ac6,0x338} /*nsupE*/,
+	{13935,21,0,0x22e1,0x0} /*NotSucceedsSlantEqual*/,
+	{13956,5,0,0x296e,0x0} /*udhar*/,
+	{13961,7,0,0x2199,0x0} /*swarrow*/,
+	{13968,16,0,0x2ab0,0x338} /*NotSucceedsEqual*/,
+	{13984,4,0,0x453,0x0} /*gjcy*/,
+	{13988,5,0,0x16f,0x0} /*uring*/,
+	{13993,5,0,0x3b1,0x0} /*alpha*/,
+	{13998,6,0,0x230e,0x0} /*urcrop*/
+};
+
+#endif /*XM_HTML_ENTITIES_H*/
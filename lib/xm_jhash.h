@@ -84,19 +84,19 @@ static inline uint32_t xm_jhash(const unsigned char *key, uint32_t length, uint3
 	/* Last block: affect all 32 bits of (c) */
 	/* All the case statements fall through */
 	switch (length) {
-	case 12: c += (uint32_t)k[11]<<24;
-	case 11: c += (uint32_t)k[10]<<16;
-	case 10: c += (uint32_t)k[9]<<8;
-	case 9:  c += k[8];
-	case 8:  b += (uint32_t)k[7]<<24;
-	case 7:  b += (uint32_t)k[6]<<16;
-	case 6:  b += (uint32_t)k[5]<<8;
-	case 5:  b += k[4];
-	case 4:  a += (uint32_t)k[3]<<24;
-	case 3:  a += (uint32_t)k[2]<<16;
-	case 2:  a += (uint32_t)k[1]<<8;
+	case 12: c += (uint32_t)k[11]<<24; /* fall through */
+	case 11: c += (uint32_t)k[10]<<16; /* fall through */
+	case 10: c += (uint32_t)k[9]<<8; /* fall through */
+	case 9:  c += k[8]; /* fall through */
+	case 8:  b += (uint32_t)k[7]<<24; /* fall through */
+	case 7:  b += (uint32_t)k[6]<<16; /* fall through */
+	case 6:  b += (uint32_t)k[5]<<8; /* fall through */
+	case 5:  b += k[4]; /* fall through */
+	case 4:  a += (uint32_t)k[3]<<24; /* fall through */
+	case 3:  a += (uint32_t)k[2]<<16; /* fall through */
+	case 2:  a += (uint32_t)k[1]<<8; /* fall through */
 	case 1:  a += k[0];
-		 __jhash_final(a, b, c);
+		 __jhash_final(a, b, c); /* fall through */
 	case 0: /* Nothing left to add */
 		break;
 	}
@@ -130,10 +130,10 @@ static inline uint32_t xm_jhash2(const uint32_t *k, uint32_t length, uint32_t in
 
 	/* Handle the last 3 uint32_t's: all the case statements fall through */
 	switch (length) {
-	case 3: c += k[2];
-	case 2: b += k[1];
+	case 3: c += k[2]; /* fall through */
+	case 2: b += k[1]; /* fall through */
 	case 1: a += k[0];
-		__jhash_final(a, b, c);
+		__jhash_final(a, b, c); /* fall through */
 	case 0:	/* Nothing left to add */
 		break;
 	}
@@ -10,6 +10,10 @@
 
 #include "xm_log.h"
 #include "xm_util.h"
+#include "xm_fmt.h"
+#include "xm_trace.h"
+
+XM_TRACE_SITE(trace_log,"log","log_error_core");
 
 static xm_log_t log_s,*log_ptr=&log_s;
 
@@ -25,6 +29,8 @@ static const char* err_levels[] = {
     "debug"
 };
 
+XM_FMT_DEFINE(log_prefix_fmt,"[%s][%d][%s][%s] %s\n");
+
 
 void
 xm_log_error_core(int level,int err,
@@ -43,12 +49,14 @@ xm_log_error_core(int level,int err,
         return;
     }
 
+    XM_TRACE_BEGIN(trace_log);
+
     va_start(args, fmt);
     xm_vsnprintf(errstr1,sizeof(errstr1), fmt, args);
     va_end(args);
 
 
-    xm_snprintf(errstr2,sizeof(errstr2),"[%s][%d][%s][%s] %s\n",
+    xm_fmt_snprintf(&log_prefix_fmt,errstr2,sizeof(errstr2),
             xm_current_logtime_with_buf(tstr,100),
             getpid(),
             err_levels[level],
@@ -58,6 +66,8 @@ xm_log_error_core(int level,int err,
 
     nbytes = strlen(errstr2);
     xm_file_write_full(log_ptr->file,errstr2,nbytes,&nbytes_written);
+
+    XM_TRACE_END(trace_log);
 }
 
 void
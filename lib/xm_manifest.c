@@ -0,0 +1,488 @@
+/*
+ *
+ *      Filename: xm_manifest.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 13:30:16
+ * Last Modified: 2026-10-18 13:30:16
+ */
+
+#include "xm_manifest.h"
+#include "xm_file.h"
+#include "xm_string.h"
+#include "xm_util.h"
+#include "xm_log.h"
+
+#define FNV64_OFFSET 0xcbf29ce484222325ULL
+#define FNV64_PRIME  0x100000001b3ULL
+
+#define HASH_BUF_SIZE (64*1024)
+
+static const char *phase_names[] = {"start","end"};
+
+xm_manifest_t *xm_manifest_create(xm_pool_t *mp){
+
+	xm_manifest_t *m = (xm_manifest_t*)xm_pcalloc(mp,sizeof(*m));
+
+	if(m == NULL)
+		return NULL;
+
+	m->mp = mp;
+	m->version = XM_MANIFEST_VERSION;
+	m->phase = XM_MANIFEST_PHASE_START;
+	m->shard_num = 1;
+	m->threads = 1;
+
+	m->probe_params = xm_table_make(mp,8);
+	m->counters = xm_table_make(mp,8);
+
+	if(m->probe_params == NULL||m->counters == NULL)
+		return NULL;
+
+	return m;
+}
+
+void xm_manifest_param_set(xm_manifest_t *m,const char *key,const char *value){
+
+	xm_table_set(m->probe_params,key,value?value:"");
+}
+
+void xm_manifest_counter_set(xm_manifest_t *m,const char *name,uint64_t value){
+
+	char buf[32];
+
+	xm_snprintf(buf,sizeof(buf),"%" XM_UINT64_T_FMT,value);
+	xm_table_set(m->counters,name,buf);
+}
+
+int xm_manifest_blocklist_hash(xm_manifest_t *m,const char *fname){
+
+	xm_file_t *fp;
+	unsigned char *buf;
+	size_t i,n;
+	uint64_t h = FNV64_OFFSET;
+	int rc;
+
+	rc = xm_file_open(&fp,fname,XM_READ|XM_BINARY,XM_OS_DEFAULT,m->mp);
+	if(rc != 0)
+		return rc;
+
+	buf = (unsigned char*)malloc(HASH_BUF_SIZE);
+	if(buf == NULL){
+
+		xm_file_close(fp);
+		return XM_ENOMEM;
+	}
+
+	for(;;){
+
+		n = HASH_BUF_SIZE;
+		rc = xm_file_read(fp,buf,&n);
+
+		for(i = 0;i<n;i++){
+
+			h ^= buf[i];
+			h *= FNV64_PRIME;
+		}
+
+		if(rc != 0)
+			break;
+	}
+
+	free(buf);
+	xm_file_close(fp);
+
+	if(rc != XM_EOF)
+		return rc;
+
+	m->blocklist = xm_pstrdup(m->mp,fname);
+	m->blocklist_hash = h;
+
+	return 0;
+}
+
+/*quote a value for xm_getword_conf*/
+static const char *_quote(xm_pool_t *p,const char *s){
+
+	size_t len = strlen(s);
+	char *res = (char*)xm_palloc(p,len*2+3);
+	char *d = res;
+
+	*d++ = '"';
+
+	for(;*s;s++){
+
+		if(*s == '"'||*s == '\\')
+			*d++ = '\\';
+
+		/*line breaks would end the directive*/
+		*d++ = (*s == '\n'||*s == '\r')?' ':*s;
+	}
+
+	*d++ = '"';
+	*d = '\0';
+
+	return res;
+}
+
+typedef struct {
+
+	xm_file_t *fp;
+	xm_pool_t *mp;
+	const char *directive;
+	int rc;
+
+}table_write_ctx_t;
+
+static int _table_write(void *rec,const char *key,const char *value){
+
+	table_write_ctx_t *ctx = (table_write_ctx_t*)rec;
+
+	if(xm_file_printf(ctx->fp,"%s %s %s\n",ctx->directive,_quote(ctx->mp,key),_quote(ctx->mp,value))<0){
+
+		ctx->rc = -1;
+		return 0;
+	}
+
+	return 1;
+}
+
+int xm_manifest_write(xm_manifest_t *m,const char *fname,int phase){
+
+	xm_pool_t *tmp;
+	xm_file_t *fp;
+	const char *tmpname;
+	table_write_ctx_t ctx;
+	int rc;
+
+	if(phase != XM_MANIFEST_PHASE_START&&phase != XM_MANIFEST_PHASE_END)
+		return -1;
+
+	tmp = xm_pool_create(4096);
+	if(tmp == NULL)
+		return -1;
+
+	m->phase = phase;
+
+	if(phase == XM_MANIFEST_PHASE_START)
+		m->start_time = time(NULL);
+	else
+		m->end_time = time(NULL);
+
+	tmpname = xm_pstrcat(tmp,fname,".tmp",NULL);
+
+	rc = xm_file_open(&fp,tmpname,XM_WRITE|XM_CREATE|XM_TRUNCATE|XM_BUFFERED|XM_BINARY,
+		CREATEMODE,tmp);
+
+	if(rc != 0){
+
+		xm_log(XM_LOG_ERR,"Cannot open manifest file:%s",tmpname);
+		xm_pool_destroy(tmp);
+		return -1;
+	}
+
+	xm_file_printf(fp,"# xmap scan manifest\n");
+	xm_file_printf(fp,"Version %d\n",m->version);
+	xm_file_printf(fp,"Phase %s\n",phase_names[phase]);
+	xm_file_printf(fp,"Seed 0x%" XM_UINT64_T_HEX_FMT "\n",m->seed);
+	xm_file_printf(fp,"Generator %" XM_UINT64_T_FMT "\n",m->generator);
+	xm_file_printf(fp,"Prime %" XM_UINT64_T_FMT "\n",m->prime);
+	xm_file_printf(fp,"MaxIndex %" XM_UINT64_T_FMT "\n",m->max_index);
+	xm_file_printf(fp,"Shard %u %u\n",m->shard_id,m->shard_num);
+	xm_file_printf(fp,"Threads %u\n",m->threads);
+	xm_file_printf(fp,"Rate %" XM_UINT64_T_FMT "\n",m->rate);
+
+	if(m->blocklist)
+		xm_file_printf(fp,"Blocklist %s 0x%016" XM_UINT64_T_HEX_FMT "\n",_quote(tmp,m->blocklist),m->blocklist_hash);
+
+	if(m->probe_module)
+		xm_file_printf(fp,"ProbeModule %s\n",_quote(tmp,m->probe_module));
+
+	ctx.fp = fp;
+	ctx.mp = tmp;
+	ctx.rc = 0;
+
+	ctx.directive = "ProbeParam";
+	xm_table_do(_table_write,&ctx,m->probe_params,NULL);
+
+	xm_file_printf(fp,"StartTime %ld\n",(long)m->start_time);
+
+	if(phase == XM_MANIFEST_PHASE_END){
+
+		xm_file_printf(fp,"EndTime %ld\n",(long)m->end_time);
+
+		ctx.directive = "Counter";
+		xm_table_do(_table_write,&ctx,m->counters,NULL);
+	}
+
+	/*xm_file_close does not flush the write buffer*/
+	rc = xm_file_flush(fp);
+
+	if(xm_file_close(fp))
+		rc = -1;
+
+	if(rc == 0&&ctx.rc == 0)
+		rc = xm_file_rename(tmpname,fname,tmp);
+	else
+		rc = -1;
+
+	if(rc != 0)
+		xm_log(XM_LOG_ERR,"Write manifest file:%s failed",fname);
+
+	xm_pool_destroy(tmp);
+
+	return rc == 0?0:-1;
+}
+
+static const char *_u64_parse(cmd_parms *cmd,const char *w,uint64_t *v){
+
+	char *end;
+
+	errno = 0;
+	*v = strtoull(w,&end,0);
+
+	if(*w == '\0'||*end != '\0'||errno)
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad number '",w,"'",NULL);
+
+	return NULL;
+}
+
+/*cmd_data is the offset of a uint64_t field*/
+static const char *set_u64(cmd_parms *cmd,void *mconfig,const char *w){
+
+	return _u64_parse(cmd,w,(uint64_t*)((char*)mconfig+(uintptr_t)cmd->info));
+}
+
+/*cmd_data is the offset of a uint32_t field*/
+static const char *set_u32(cmd_parms *cmd,void *mconfig,const char *w){
+
+	uint64_t v;
+	const char *err = _u64_parse(cmd,w,&v);
+
+	if(err)
+		return err;
+
+	if(v>UINT32_MAX)
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": number too large",NULL);
+
+	*(uint32_t*)((char*)mconfig+(uintptr_t)cmd->info) = (uint32_t)v;
+
+	return NULL;
+}
+
+static const char *set_version(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_manifest_t *m = (xm_manifest_t*)mconfig;
+
+	m->version = atoi(w);
+
+	if(m->version<1||m->version>XM_MANIFEST_VERSION)
+		return xm_pstrcat(cmd->pool,"Unsupported manifest version ",w,NULL);
+
+	return NULL;
+}
+
+static const char *set_phase(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_manifest_t *m = (xm_manifest_t*)mconfig;
+
+	if(strcasecmp(w,"start") == 0)
+		m->phase = XM_MANIFEST_PHASE_START;
+	else if(strcasecmp(w,"end") == 0)
+		m->phase = XM_MANIFEST_PHASE_END;
+	else
+		return xm_pstrcat(cmd->pool,"Unknown manifest phase ",w,NULL);
+
+	return NULL;
+}
+
+static const char *set_shard(cmd_parms *cmd,void *mconfig,const char *w,const char *w2){
+
+	xm_manifest_t *m = (xm_manifest_t*)mconfig;
+	uint64_t id,num;
+	const char *err;
+
+	if((err = _u64_parse(cmd,w,&id)) != NULL||(err = _u64_parse(cmd,w2,&num)) != NULL)
+		return err;
+
+	if(num == 0||num>UINT32_MAX||id>=num)
+		return "Shard id must be less than the shard number";
+
+	m->shard_id = (uint32_t)id;
+	m->shard_num = (uint32_t)num;
+
+	return NULL;
+}
+
+static const char *set_time(cmd_parms *cmd,void *mconfig,const char *w){
+
+	uint64_t v;
+	const char *err = _u64_parse(cmd,w,&v);
+
+	if(err)
+		return err;
+
+	*(time_t*)((char*)mconfig+(uintptr_t)cmd->info) = (time_t)v;
+
+	return NULL;
+}
+
+static const char *set_blocklist(cmd_parms *cmd,void *mconfig,const char *w,const char *w2){
+
+	xm_manifest_t *m = (xm_manifest_t*)mconfig;
+
+	m->blocklist = xm_pstrdup(m->mp,w);
+
+	return _u64_parse(cmd,w2,&m->blocklist_hash);
+}
+
+static const char *set_probe_module(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_manifest_t *m = (xm_manifest_t*)mconfig;
+
+	XM_SET_USED(cmd);
+	m->probe_module = xm_pstrdup(m->mp,w);
+
+	return NULL;
+}
+
+static const char *set_probe_param(cmd_parms *cmd,void *mconfig,const char *w,const char *w2){
+
+	xm_manifest_t *m = (xm_manifest_t*)mconfig;
+
+	XM_SET_USED(cmd);
+	xm_manifest_param_set(m,w,w2);
+
+	return NULL;
+}
+
+static const char *set_counter(cmd_parms *cmd,void *mconfig,const char *w,const char *w2){
+
+	xm_manifest_t *m = (xm_manifest_t*)mconfig;
+	uint64_t v;
+	const char *err = _u64_parse(cmd,w2,&v);
+
+	if(err)
+		return err;
+
+	xm_manifest_counter_set(m,w,v);
+
+	return NULL;
+}
+
+#define MF_OFF(f) ((void*)offsetof(xm_manifest_t,f))
+
+const command_rec xm_manifest_cmds[] = {
+
+	XM_INIT_TAKE1("Version",set_version,NULL,0,"manifest format version"),
+	XM_INIT_TAKE1("Phase",set_phase,NULL,0,"start or end"),
+	XM_INIT_TAKE1("Seed",set_u64,MF_OFF(seed),0,"generator seed"),
+	XM_INIT_TAKE1("Generator",set_u64,MF_OFF(generator),0,"cyclic group generator"),
+	XM_INIT_TAKE1("Prime",set_u64,MF_OFF(prime),0,"cyclic group prime"),
+	XM_INIT_TAKE1("MaxIndex",set_u64,MF_OFF(max_index),0,"number of targets"),
+	XM_INIT_TAKE2("Shard",set_shard,NULL,0,"shard id and shard number"),
+	XM_INIT_TAKE1("Threads",set_u32,MF_OFF(threads),0,"sender threads per shard"),
+	XM_INIT_TAKE1("Rate",set_u64,MF_OFF(rate),0,"send rate in packets per second"),
+	XM_INIT_TAKE2("Blocklist",set_blocklist,NULL,0,"blocklist file and content hash"),
+	XM_INIT_TAKE1("ProbeModule",set_probe_module,NULL,0,"probe module name"),
+	XM_INIT_TAKE12("ProbeParam",set_probe_param,NULL,0,"probe module parameter and value"),
+	XM_INIT_TAKE1("StartTime",set_time,MF_OFF(start_time),0,"scan start time"),
+	XM_INIT_TAKE1("EndTime",set_time,MF_OFF(end_time),0,"scan end time"),
+	XM_INIT_TAKE2("Counter",set_counter,NULL,0,"final counter name and value"),
+	{NULL}
+};
+
+const char *xm_manifest_read(xm_manifest_t *m,xm_pool_t *ptemp,const char *fname){
+
+	return xm_process_command_config(xm_manifest_cmds,m,m->mp,ptemp,fname);
+}
+
+static uint64_t _powmod(uint64_t b,uint64_t e,uint64_t p){
+
+	unsigned __int128 r = 1,x = b%p;
+
+	while(e){
+
+		if(e&1)
+			r = (r*x)%p;
+
+		x = (x*x)%p;
+		e >>= 1;
+	}
+
+	return (uint64_t)r;
+}
+
+int xm_cyclic_init(xm_cyclic_t *it,uint64_t prime,uint64_t generator,uint64_t seed,
+	uint32_t sub_id,uint32_t sub_num,uint64_t max){
+
+	uint64_t order,first;
+
+	if(prime<3||generator<2||generator>=prime||sub_num == 0||sub_id>=sub_num)
+		return -1;
+
+	order = prime-1;
+
+	first = _powmod(generator,1+seed%order,prime);
+
+	it->prime = prime;
+	it->step = _powmod(generator,sub_num,prime);
+	it->cur = (uint64_t)(((unsigned __int128)first*_powmod(generator,sub_id,prime))%prime);
+	it->max = max?max:order;
+	it->left = sub_id<order?(order-sub_id+sub_num-1)/sub_num:0;
+
+	return 0;
+}
+
+int64_t xm_manifest_replay(xm_manifest_t *m,xm_manifest_sink_pt sink,void *ctx){
+
+	xm_cyclic_t it;
+	uint32_t t,threads = m->threads?m->threads:1;
+	uint64_t sub_num = (uint64_t)m->shard_num*threads;
+	uint64_t idx;
+	int64_t n = 0;
+
+	if(sub_num>UINT32_MAX)
+		return -1;
+
+	for(t = 0;t<threads;t++){
+
+		/*sub-shards are laid out shard major: shard_id*threads+thread*/
+		if(xm_cyclic_init(&it,m->prime,m->generator,m->seed,
+			m->shard_id*threads+t,(uint32_t)sub_num,m->max_index))
+			return -1;
+
+		while((idx = xm_cyclic_next(&it)) != 0){
+
+			n++;
+
+			if(sink(ctx,t,idx))
+				return n;
+		}
+	}
+
+	return n;
+}
+
+static int _table_dump(void *rec,const char *key,const char *value){
+
+	fprintf((FILE*)rec,"    %s = %s\n",key,value);
+
+	return 1;
+}
+
+void xm_manifest_dump(xm_manifest_t *m,FILE *fp){
+
+	fprintf(fp,"Dump scan manifest-------------------------------------------\n");
+	fprintf(fp,"version:%d,phase:%s\n",m->version,phase_names[m->phase]);
+	fprintf(fp,"seed:0x%lx,generator:%lu,prime:%lu,max index:%lu\n",(unsigned long)m->seed,
+		(unsigned long)m->generator,(unsigned long)m->prime,(unsigned long)m->max_index);
+	fprintf(fp,"shard:%u/%u,threads:%u,rate:%lu\n",m->shard_id,m->shard_num,m->threads,(unsigned long)m->rate);
+	fprintf(fp,"blocklist:%s,hash:0x%016lx\n",m->blocklist?m->blocklist:"--",(unsigned long)m->blocklist_hash);
+	fprintf(fp,"probe module:%s\n",m->probe_module?m->probe_module:"--");
+	xm_table_do(_table_dump,fp,m->probe_params,NULL);
+	fprintf(fp,"start:%ld,end:%ld\n",(long)m->start_time,(long)m->end_time);
+	fprintf(fp,"counters:\n");
+	xm_table_do(_table_dump,fp,m->counters,NULL);
+}
@@ -0,0 +1,147 @@
+/*
+ *
+ *      Filename: xm_manifest.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: scan manifest and deterministic probe sequence replay
+ *        Create: 2026-10-18 13:02:51
+ * Last Modified: 2026-10-18 13:02:51
+ */
+
+#ifndef XM_MANIFEST_H
+#define XM_MANIFEST_H
+
+typedef struct xm_manifest_t xm_manifest_t;
+typedef struct xm_cyclic_t xm_cyclic_t;
+
+#include "xm_mpool.h"
+#include "xm_tables.h"
+#include "xm_config.h"
+
+#define XM_MANIFEST_VERSION 1
+
+#define XM_MANIFEST_PHASE_START 0
+#define XM_MANIFEST_PHASE_END   1
+
+/**
+ * Everything needed to audit a scan and to regenerate its probe order.
+ * The manifest is written once at start and rewritten at the end with
+ * the final counters, so nothing here is touched on the send path.
+ */
+struct xm_manifest_t {
+
+	xm_pool_t *mp;
+
+	int version;
+	int phase;
+
+	/*address generator: the multiplicative group mod prime*/
+	uint64_t seed;
+	uint64_t generator;
+	uint64_t prime;
+
+	/*shard layout*/
+	uint32_t shard_id;
+	uint32_t shard_num;
+	uint32_t threads;
+
+	uint64_t rate;
+
+	/*targets are the group elements 1..max_index*/
+	uint64_t max_index;
+
+	const char *blocklist;
+	uint64_t blocklist_hash;
+
+	const char *probe_module;
+	xm_table_t *probe_params;
+
+	xm_table_t *counters;
+
+	time_t start_time;
+	time_t end_time;
+};
+
+/**
+ * Iterator over one sub-shard of the cyclic group, see xm_cyclic_init.
+ */
+struct xm_cyclic_t {
+
+	uint64_t prime;
+	uint64_t step;
+	uint64_t cur;
+	uint64_t max;
+	uint64_t left;
+};
+
+/*config directives used to read a manifest back, mconfig must be the xm_manifest_t*/
+extern const command_rec xm_manifest_cmds[];
+
+extern xm_manifest_t *xm_manifest_create(xm_pool_t *mp);
+
+extern void xm_manifest_param_set(xm_manifest_t *m,const char *key,const char *value);
+
+extern void xm_manifest_counter_set(xm_manifest_t *m,const char *name,uint64_t value);
+
+/**
+ * Hash the blocklist file content (FNV-1a 64) into m->blocklist_hash.
+ * @return 0 on success, otherwise the error status of the file layer
+ */
+extern int xm_manifest_blocklist_hash(xm_manifest_t *m,const char *fname);
+
+/**
+ * Write the manifest to fname for the given phase. The file is written
+ * to fname.tmp and renamed, so readers never see a partial manifest.
+ * @return 0 on success, -1 on failure
+ */
+extern int xm_manifest_write(xm_manifest_t *m,const char *fname,int phase);
+
+/**
+ * Read a manifest previously written by xm_manifest_write.
+ * @return NULL on success, otherwise the error message
+ */
+extern const char *xm_manifest_read(xm_manifest_t *m,xm_pool_t *ptemp,const char *fname);
+
+/**
+ * Setup an iterator over sub-shard sub_id of sub_num.
+ * The walk starts at generator^(1 + seed mod (prime-1)), moves by
+ * generator^sub_num and skips elements above max, so with a primitive
+ * root the sub-shards together visit every index in 1..max exactly once.
+ * @return 0 on success, -1 on bad parameters
+ */
+extern int xm_cyclic_init(xm_cyclic_t *it,uint64_t prime,uint64_t generator,uint64_t seed,
+	uint32_t sub_id,uint32_t sub_num,uint64_t max);
+
+/**
+ * Get the next index.
+ * @return The next index in 1..max, or 0 when the sub-shard is done
+ */
+static inline uint64_t xm_cyclic_next(xm_cyclic_t *it){
+
+	uint64_t v;
+
+	while(it->left){
+
+		v = it->cur;
+		it->cur = (uint64_t)(((unsigned __int128)v*it->step)%it->prime);
+		it->left--;
+
+		if(v<=it->max)
+			return v;
+	}
+
+	return 0;
+}
+
+typedef int (*xm_manifest_sink_pt)(void *ctx,uint32_t thread,uint64_t index);
+
+/**
+ * Regenerate the probe sequence of the manifest's shard, thread by thread,
+ * into sink. A non zero return from sink stops the replay.
+ * @return The number of indexes emitted, or -1 on bad manifest parameters
+ */
+extern int64_t xm_manifest_replay(xm_manifest_t *m,xm_manifest_sink_pt sink,void *ctx);
+
+extern void xm_manifest_dump(xm_manifest_t *m,FILE *fp);
+
+#endif /*XM_MANIFEST_H*/
@@ -9,15 +9,38 @@
  */
 
 #include "xm_mpool.h"
+#include "xm_trace.h"
+
+/*the bump path is not traced, only what reaches malloc/free*/
+XM_TRACE_SITE(trace_pool_create,"pool","pool_create");
+XM_TRACE_SITE(trace_pool_destroy,"pool","pool_destroy");
+XM_TRACE_SITE(trace_pool_reset,"pool","pool_reset");
+XM_TRACE_SITE(trace_pool_block,"pool","palloc_block");
+XM_TRACE_SITE(trace_pool_large,"pool","palloc_large");
+
+/* where the allocations of a block start, as xm_palloc_block() lays it out */
+static void *
+xm_pool_block_start(xm_pool_t *pool, xm_pool_t *p)
+{
+    if (p == pool) {
+        return (void *) p + sizeof(xm_pool_t);
+    }
+
+    return xm_align_ptr((void *) p + sizeof(xm_pool_data_t), XM_ALIGNMENT);
+}
+
 
 xm_pool_t *
 xm_pool_create(size_t size)
 {
     xm_pool_t  *p;
 
+    XM_TRACE_BEGIN(trace_pool_create);
+
     p = (xm_pool_t*)memalign(XM_POOL_ALIGNMENT, size);
 
     if (p == NULL) {
+        XM_TRACE_END(trace_pool_create);
         return NULL;
     }
 
@@ -32,6 +55,9 @@ xm_pool_create(size_t size)
     p->current = p;
     p->large = NULL;
     p->cleanup = NULL;
+    p->large_floor = NULL;
+
+    XM_TRACE_END(trace_pool_create);
 
     return p;
 }
@@ -43,6 +69,8 @@ xm_pool_destroy(xm_pool_t *pool)
     xm_pool_large_t    *l;
     xm_pool_cleanup_t  *c;
 
+    XM_TRACE_BEGIN(trace_pool_destroy);
+
     for (c = pool->cleanup; c; c = c->next) {
         if (c->handler) {
             c->handler(c->data);
@@ -62,6 +90,8 @@ xm_pool_destroy(xm_pool_t *pool)
             break;
         }
     }
+
+    XM_TRACE_END(trace_pool_destroy);
 }
 
 
@@ -71,6 +101,8 @@ xm_pool_reset(xm_pool_t *pool)
     xm_pool_t        *p;
     xm_pool_large_t  *l;
 
+    XM_TRACE_BEGIN(trace_pool_reset);
+
     for (l = pool->large; l; l = l->next) {
         if (l->alloc) {
             free(l->alloc);
@@ -78,12 +110,15 @@ xm_pool_reset(xm_pool_t *pool)
     }
 
     for (p = pool; p; p = p->d.next) {
-        p->d.last = (void *) p + sizeof(xm_pool_t);
+        p->d.last = xm_pool_block_start(pool, p);
         p->d.failed = 0;
     }
 
     pool->current = pool;
     pool->large = NULL;
+    pool->large_floor = NULL;
+
+    XM_TRACE_END(trace_pool_reset);
 }
 
 static void *
@@ -93,11 +128,14 @@ xm_palloc_block(xm_pool_t *pool, size_t size)
     size_t       psize;
     xm_pool_t  *p, *new;
 
+    XM_TRACE_BEGIN(trace_pool_block);
+
     psize = (size_t) (pool->d.end - (void *) pool);
 
     m = memalign(XM_POOL_ALIGNMENT, psize);
 
     if (m == NULL) {
+        XM_TRACE_END(trace_pool_block);
         return NULL;
     }
 
@@ -119,6 +157,8 @@ xm_palloc_block(xm_pool_t *pool, size_t size)
 
     p->d.next = new;
 
+    XM_TRACE_END(trace_pool_block);
+
     return m;
 }
 
@@ -160,16 +200,23 @@ xm_palloc_large(xm_pool_t *pool, size_t size)
     unsigned int         n;
     xm_pool_large_t  *large;
 
+    XM_TRACE_BEGIN(trace_pool_large);
+
     p = malloc(size);
     if (p == NULL) {
+        XM_TRACE_END(trace_pool_large);
         return NULL;
     }
 
     n = 0;
 
-    for (large = pool->large; large; large = large->next) {
+    /* a slot freed before a mark must not take what the release frees */
+    for (large = pool->large; large && large != pool->large_floor;
+         large = large->next)
+    {
         if (large->alloc == NULL) {
             large->alloc = p;
+            XM_TRACE_END(trace_pool_large);
             return p;
         }
 
@@ -181,6 +228,7 @@ xm_palloc_large(xm_pool_t *pool, size_t size)
     large = xm_palloc_small(pool, sizeof(xm_pool_large_t), 1);
     if (large == NULL) {
         free(p);
+        XM_TRACE_END(trace_pool_large);
         return NULL;
     }
 
@@ -188,6 +236,8 @@ xm_palloc_large(xm_pool_t *pool, size_t size)
     large->next = pool->large;
     pool->large = large;
 
+    XM_TRACE_END(trace_pool_large);
+
     return p;
 }
 
@@ -237,6 +287,34 @@ xm_pmemalign(xm_pool_t *pool, size_t size, size_t alignment)
 }
 
 
+xm_pool_t *
+xm_pool_tail_block(xm_pool_t *pool, size_t size)
+{
+    xm_pool_t  *p;
+
+    if (size > pool->max) {
+        return NULL;
+    }
+
+    for (p = pool->current; p; p = p->d.next) {
+        if ((size_t) (p->d.end - p->d.last) >= size) {
+            return p;
+        }
+    }
+
+    if (xm_palloc_block(pool, 0) == NULL) {
+        return NULL;
+    }
+
+    /* xm_palloc_block links the new block at the end of the chain */
+    for (p = pool->current; p->d.next; p = p->d.next) {
+        /* void */
+    }
+
+    return p;
+}
+
+
 int
 xm_pfree(xm_pool_t *pool, void *p)
 {
@@ -297,3 +375,67 @@ xm_pool_cleanup_add(xm_pool_t *p, size_t size)
     return c;
 }
 
+
+void
+xm_pool_mark(xm_pool_t *pool, xm_pool_mark_t *mark)
+{
+    xm_pool_t  *p;
+
+    /*
+     * the last block holding data: an empty block takes any small
+     * allocation, so first fit never leaves data behind an empty one
+     */
+    for (p = pool->current;
+         p->d.next && p->d.next->d.last != xm_pool_block_start(pool, p->d.next);
+         p = p->d.next)
+    {
+        /* void */
+    }
+
+    mark->current = pool->current;
+    mark->block = p;
+    mark->last = p->d.last;
+    mark->large = pool->large;
+    mark->large_floor = pool->large_floor;
+    mark->cleanup = pool->cleanup;
+
+    /* what is allocated from here on lies past (block, last) */
+    pool->current = p;
+    pool->large_floor = pool->large;
+}
+
+
+void
+xm_pool_release_to(xm_pool_t *pool, const xm_pool_mark_t *mark)
+{
+    xm_pool_t          *p;
+    xm_pool_large_t    *l;
+    xm_pool_cleanup_t  *c;
+
+    /* the lists live in the memory about to be taken back, walk them first */
+    for (c = pool->cleanup; c != mark->cleanup; c = c->next) {
+        if (c->handler) {
+            c->handler(c->data);
+        }
+    }
+
+    pool->cleanup = mark->cleanup;
+
+    for (l = pool->large; l != mark->large; l = l->next) {
+        if (l->alloc) {
+            free(l->alloc);
+        }
+    }
+
+    pool->large = mark->large;
+    pool->large_floor = mark->large_floor;
+
+    mark->block->d.last = mark->last;
+
+    for (p = mark->block->d.next; p; p = p->d.next) {
+        p->d.last = xm_pool_block_start(pool, p);
+        p->d.failed = 0;
+    }
+
+    pool->current = mark->current;
+}
@@ -16,6 +16,7 @@ typedef struct xm_pool_cleanup_t  xm_pool_cleanup_t;
 typedef struct xm_pool_large_t xm_pool_large_t;
 typedef struct xm_pool_t xm_pool_t;
 typedef struct xm_pool_data_t xm_pool_data_t;
+typedef struct xm_pool_mark_t xm_pool_mark_t;
 
 #include "xm_constants.h"
 #include "xm_list.h"
@@ -60,6 +61,22 @@ struct xm_pool_t {
     xm_pool_t           *current;
     xm_pool_large_t     *large;
     xm_pool_cleanup_t   *cleanup;
+
+    /* large entries at and below this one belong to an open mark */
+    xm_pool_large_t     *large_floor;
+};
+
+
+/*
+ * A position in the pool to roll back to, see xm_pool_mark().
+ */
+struct xm_pool_mark_t {
+    xm_pool_t           *current;
+    xm_pool_t           *block;
+    void                *last;
+    xm_pool_large_t     *large;
+    xm_pool_large_t     *large_floor;
+    xm_pool_cleanup_t   *cleanup;
 };
 
 extern xm_pool_t *
@@ -86,8 +103,35 @@ xm_pmemalign(xm_pool_t *pool, size_t size, size_t alignment);
 extern int 
 xm_pfree(xm_pool_t *pool, void *p);
 
+/*
+ * Find a block with at least size free bytes at its tail, adding a new
+ * block if needed. Nothing is allocated: the caller writes at d.last and
+ * then moves d.last past what it keeps. size must not exceed pool->max.
+ */
+extern xm_pool_t *
+xm_pool_tail_block(xm_pool_t *pool, size_t size);
+
 
 extern xm_pool_cleanup_t *
 xm_pool_cleanup_add(xm_pool_t *p, size_t size);
 
+/*
+ * Save the position of the pool for xm_pool_release_to(), for scratch
+ * allocations inside a long lived pool. Until the release the small
+ * allocations only come from the last block in use on, so the free
+ * tails of the blocks before it wait. Marks nest; release them in
+ * reverse order.
+ */
+extern void
+xm_pool_mark(xm_pool_t *pool, xm_pool_mark_t *mark);
+
+/*
+ * Roll the pool back to mark: run the cleanups added since, free the
+ * large allocations made since and take back the small ones. Blocks
+ * added since stay with the pool, empty. Nothing allocated after the
+ * mark may be used afterwards.
+ */
+extern void
+xm_pool_release_to(xm_pool_t *pool, const xm_pool_mark_t *mark);
+
 #endif /* XM_MPOOL_H */
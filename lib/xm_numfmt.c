@@ -0,0 +1,314 @@
+/*
+ *
+ *      Filename: xm_numfmt.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 17:06:44
+ * Last Modified: 2026-10-18 17:06:44
+ */
+
+#include "xm_numfmt.h"
+#include "xm_ryu_table.h"
+
+#define DOUBLE_MANTISSA_BITS 52
+#define DOUBLE_EXPONENT_BITS 11
+#define DOUBLE_BIAS 1023
+
+const char xm_digit_pairs[200] = {
+	'0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+	'1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+	'2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+	'3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+	'4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+	'5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+	'6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+	'7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+	'8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+	'9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+/*ceil(log2(5^e)), exact for 0<=e<=3528*/
+static inline int32_t _pow5bits(int32_t e){
+
+	return (int32_t)((((uint32_t)e*1217359)>>19)+1);
+}
+
+/*floor(log10(2^e))*/
+static inline uint32_t _log10_pow2(int32_t e){
+
+	return ((uint32_t)e*78913)>>18;
+}
+
+/*floor(log10(5^e))*/
+static inline uint32_t _log10_pow5(int32_t e){
+
+	return ((uint32_t)e*732923)>>20;
+}
+
+static inline uint32_t _pow5_factor(uint64_t v){
+
+	uint32_t n = 0;
+
+	while(v%5 == 0){
+
+		v /= 5;
+		n++;
+	}
+
+	return n;
+}
+
+static inline int _multiple_of_pow5(uint64_t v,uint32_t p){
+
+	return _pow5_factor(v)>=p;
+}
+
+static inline int _multiple_of_pow2(uint64_t v,uint32_t p){
+
+	return (v&((1ULL<<p)-1)) == 0;
+}
+
+static inline uint64_t _mul_shift64(uint64_t m,const uint64_t *mul,int32_t j){
+
+	unsigned __int128 b0 = (unsigned __int128)m*mul[0];
+	unsigned __int128 b2 = (unsigned __int128)m*mul[1];
+
+	return (uint64_t)(((b0>>64)+b2)>>(j-64));
+}
+
+/*
+ * Shortest decimal m*10^e inside the rounding interval of the double
+ * ieee_m*2^ieee_e, closest to it when several are equally short.
+ */
+static void _d2d(uint64_t ieee_m,uint32_t ieee_e,uint64_t *out_m,int32_t *out_e){
+
+	int32_t e2,e10,removed = 0;
+	uint64_t m2,mv,vr,vp,vm,output;
+	uint32_t mm_shift,q;
+	int32_t k,i,j;
+	int even,vm_tz = 0,vr_tz = 0,round_up = 0;
+	uint8_t last_removed = 0;
+
+	if(ieee_e == 0){
+
+		e2 = 1-DOUBLE_BIAS-DOUBLE_MANTISSA_BITS-2;
+		m2 = ieee_m;
+	}
+	else{
+
+		e2 = (int32_t)ieee_e-DOUBLE_BIAS-DOUBLE_MANTISSA_BITS-2;
+		m2 = (1ULL<<DOUBLE_MANTISSA_BITS)|ieee_m;
+	}
+
+	even = (m2&1) == 0;
+
+	/*interval of valid representations in units of 2^e2: [mv-1-mm_shift,mv+2]*/
+	mv = 4*m2;
+	mm_shift = ieee_m != 0||ieee_e<=1;
+
+	if(e2>=0){
+
+		q = _log10_pow2(e2)-(e2>3);
+		e10 = (int32_t)q;
+		k = XM_DOUBLE_POW5_INV_BITCOUNT+_pow5bits((int32_t)q)-1;
+		i = -e2+(int32_t)q+k;
+
+		vr = _mul_shift64(4*m2,XM_DOUBLE_POW5_INV_SPLIT[q],i);
+		vp = _mul_shift64(4*m2+2,XM_DOUBLE_POW5_INV_SPLIT[q],i);
+		vm = _mul_shift64(4*m2-1-mm_shift,XM_DOUBLE_POW5_INV_SPLIT[q],i);
+
+		if(q<=21){
+
+			if(mv%5 == 0)
+				vr_tz = _multiple_of_pow5(mv,q);
+			else if(even)
+				vm_tz = _multiple_of_pow5(mv-1-mm_shift,q);
+			else
+				vp -= _multiple_of_pow5(mv+2,q);
+		}
+	}
+	else{
+
+		q = _log10_pow5(-e2)-(-e2>1);
+		e10 = (int32_t)q+e2;
+		i = -e2-(int32_t)q;
+		k = _pow5bits(i)-XM_DOUBLE_POW5_BITCOUNT;
+		j = (int32_t)q-k;
+
+		vr = _mul_shift64(4*m2,XM_DOUBLE_POW5_SPLIT[i],j);
+		vp = _mul_shift64(4*m2+2,XM_DOUBLE_POW5_SPLIT[i],j);
+		vm = _mul_shift64(4*m2-1-mm_shift,XM_DOUBLE_POW5_SPLIT[i],j);
+
+		if(q<=1){
+
+			vr_tz = 1;
+
+			if(even)
+				vm_tz = mm_shift == 1;
+			else
+				--vp;
+		}
+		else if(q<63){
+
+			vr_tz = _multiple_of_pow2(mv,q);
+		}
+	}
+
+	if(vm_tz||vr_tz){
+
+		/*rare general case, tracks exact trailing zeros*/
+		while(vp/10>vm/10){
+
+			vm_tz &= vm%10 == 0;
+			vr_tz &= last_removed == 0;
+			last_removed = (uint8_t)(vr%10);
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			removed++;
+		}
+
+		if(vm_tz){
+
+			while(vm%10 == 0){
+
+				vr_tz &= last_removed == 0;
+				last_removed = (uint8_t)(vr%10);
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				removed++;
+			}
+		}
+
+		/*round half to even when the exact value is ...50..0*/
+		if(vr_tz&&last_removed == 5&&vr%2 == 0)
+			last_removed = 4;
+
+		output = vr+((vr == vm&&(!even||!vm_tz))||last_removed>=5);
+	}
+	else{
+
+		/*common case, two digits at a time first*/
+		if(vp/100>vm/100){
+
+			round_up = vr%100>=50;
+			vr /= 100;
+			vp /= 100;
+			vm /= 100;
+			removed += 2;
+		}
+
+		while(vp/10>vm/10){
+
+			round_up = vr%10>=5;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			removed++;
+		}
+
+		output = vr+(vr == vm||round_up);
+	}
+
+	*out_m = output;
+	*out_e = e10+removed;
+}
+
+size_t xm_dtoa(double v,char *buf){
+
+	uint64_t bits,ieee_m,m;
+	uint32_t ieee_e,olen,n;
+	int32_t e,dp;
+	char digits[20];
+	char *p = buf;
+
+	memcpy(&bits,&v,sizeof(bits));
+
+	ieee_m = bits&((1ULL<<DOUBLE_MANTISSA_BITS)-1);
+	ieee_e = (uint32_t)((bits>>DOUBLE_MANTISSA_BITS)&((1U<<DOUBLE_EXPONENT_BITS)-1));
+
+	if(ieee_e == (1U<<DOUBLE_EXPONENT_BITS)-1&&ieee_m){
+
+		memcpy(buf,"nan",4);
+		return 3;
+	}
+
+	if(bits>>63)
+		*p++ = '-';
+
+	if(ieee_e == (1U<<DOUBLE_EXPONENT_BITS)-1){
+
+		memcpy(p,"inf",4);
+		return p-buf+3;
+	}
+
+	if(ieee_e == 0&&ieee_m == 0){
+
+		*p++ = '0';
+		*p = '\0';
+		return p-buf;
+	}
+
+	_d2d(ieee_m,ieee_e,&m,&e);
+
+	olen = xm_dec_len_u64(m);
+	xm_u64_to_dec_end(digits+olen,m);
+
+	/*value is 0.d1..dn * 10^dp*/
+	dp = (int32_t)olen+e;
+
+	if(dp>=(int32_t)olen&&dp<=21){
+
+		memcpy(p,digits,olen);
+		p += olen;
+		for(n = olen;(int32_t)n<dp;n++)
+			*p++ = '0';
+	}
+	else if(dp>0&&dp<=21){
+
+		memcpy(p,digits,dp);
+		p += dp;
+		*p++ = '.';
+		memcpy(p,digits+dp,olen-dp);
+		p += olen-dp;
+	}
+	else if(dp>-6&&dp<=0){
+
+		*p++ = '0';
+		*p++ = '.';
+		for(;dp<0;dp++)
+			*p++ = '0';
+		memcpy(p,digits,olen);
+		p += olen;
+	}
+	else{
+
+		*p++ = digits[0];
+		if(olen>1){
+
+			*p++ = '.';
+			memcpy(p,digits+1,olen-1);
+			p += olen-1;
+		}
+
+		*p++ = 'e';
+		dp--;
+		if(dp<0){
+
+			*p++ = '-';
+			dp = -dp;
+		}
+		else{
+
+			*p++ = '+';
+		}
+
+		p = p+xm_u64_to_dec(p,(uint64_t)dp);
+	}
+
+	*p = '\0';
+
+	return p-buf;
+}
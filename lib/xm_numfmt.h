@@ -0,0 +1,143 @@
+/*
+ *
+ *      Filename: xm_numfmt.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: integer and double to text kernels
+ *        Create: 2026-10-18 16:49:25
+ * Last Modified: 2026-10-18 16:49:25
+ */
+
+#ifndef XM_NUMFMT_H
+#define XM_NUMFMT_H
+
+#include <string.h>
+#include "xm_constants.h"
+
+/*longest xm_dtoa output plus the NUL*/
+#define XM_DTOA_BUF_SIZE 32
+
+/*longest 64 bit decimal: sign and 20 digits*/
+#define XM_I64_DEC_MAX 21
+
+/*"00" "01" ... "99"*/
+extern const char xm_digit_pairs[200];
+
+static inline uint32_t xm_dec_len_u32(uint32_t v){
+
+	if(v<10) return 1;
+	if(v<100) return 2;
+	if(v<1000) return 3;
+	if(v<10000) return 4;
+	if(v<100000) return 5;
+	if(v<1000000) return 6;
+	if(v<10000000) return 7;
+	if(v<100000000) return 8;
+	if(v<1000000000) return 9;
+	return 10;
+}
+
+static inline uint32_t xm_dec_len_u64(uint64_t v){
+
+	if(v<=UINT32_MAX)
+		return xm_dec_len_u32((uint32_t)v);
+
+	if(v<10000000000ULL) return 10;
+	if(v<100000000000ULL) return 11;
+	if(v<1000000000000ULL) return 12;
+	if(v<10000000000000ULL) return 13;
+	if(v<100000000000000ULL) return 14;
+	if(v<1000000000000000ULL) return 15;
+	if(v<10000000000000000ULL) return 16;
+	if(v<100000000000000000ULL) return 17;
+	if(v<1000000000000000000ULL) return 18;
+	if(v<10000000000000000000ULL) return 19;
+	return 20;
+}
+
+/**
+ * Write v backwards, two digits per step, ending just before end.
+ * @return The first digit written
+ */
+static inline char *xm_u32_to_dec_end(char *end,uint32_t v){
+
+	uint32_t r;
+
+	while(v>=100){
+
+		r = v%100;
+		v /= 100;
+		end -= 2;
+		memcpy(end,&xm_digit_pairs[r*2],2);
+	}
+
+	if(v>=10){
+
+		end -= 2;
+		memcpy(end,&xm_digit_pairs[v*2],2);
+	}
+	else{
+
+		*--end = (char)('0'+v);
+	}
+
+	return end;
+}
+
+static inline char *xm_u64_to_dec_end(char *end,uint64_t v){
+
+	uint64_t q;
+	uint32_t r,i;
+
+	/*peel 8 digits at a time so the rest runs on 32 bit divisions*/
+	while(v>UINT32_MAX){
+
+		q = v/100000000;
+		r = (uint32_t)(v-q*100000000);
+		v = q;
+
+		for(i = 0;i<4;i++){
+
+			end -= 2;
+			memcpy(end,&xm_digit_pairs[(r%100)*2],2);
+			r /= 100;
+		}
+	}
+
+	return xm_u32_to_dec_end(end,(uint32_t)v);
+}
+
+/**
+ * Write v at buf, sized up front so the digits land in place.
+ * No NUL is written.
+ * @return The number of chars written
+ */
+static inline size_t xm_u64_to_dec(char *buf,uint64_t v){
+
+	uint32_t n = xm_dec_len_u64(v);
+
+	xm_u64_to_dec_end(buf+n,v);
+
+	return n;
+}
+
+static inline size_t xm_i64_to_dec(char *buf,int64_t v){
+
+	if(v<0){
+
+		*buf = '-';
+		return 1+xm_u64_to_dec(buf+1,(uint64_t)0-(uint64_t)v);
+	}
+
+	return xm_u64_to_dec(buf,(uint64_t)v);
+}
+
+/**
+ * Shortest text that reads back as exactly v (Ryu). Plain notation is
+ * used for decimal exponents -6 < n <= 21, e.g. "0.1", "1e+21", "5e-7",
+ * "-0", "inf", "nan". buf must hold XM_DTOA_BUF_SIZE chars.
+ * @return The length, buf is NUL terminated
+ */
+extern size_t xm_dtoa(double v,char *buf);
+
+#endif /*XM_NUMFMT_H*/
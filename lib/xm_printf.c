@@ -10,6 +10,7 @@
 
 #include <arpa/inet.h>
 #include "xm_string.h"
+#include "xm_numfmt.h"
 
 typedef enum {
     NO = 0, YES = 1
@@ -324,16 +325,8 @@ static char *conv_10(register int32_t num, register int is_unsigned,
         }
     }
 
-    /*
-     * We use a do-while loop so that we write at least 1 digit 
-     */
-    do {
-        register uint32_t new_magnitude = magnitude / 10;
-
-        *--p = (char) (magnitude - new_magnitude * 10 + '0');
-        magnitude = new_magnitude;
-    }
-    while (magnitude);
+    /* two digits per division, at least 1 digit is written */
+    p = xm_u32_to_dec_end(p, magnitude);
 
     *len = buf_end - p;
     return (p);
@@ -376,16 +369,8 @@ static char *conv_10_quad(int64_t num, register int is_unsigned,
         }
     }
 
-    /*
-     * We use a do-while loop so that we write at least 1 digit 
-     */
-    do {
-        uint64_t new_magnitude = magnitude / 10;
-
-        *--p = (char) (magnitude - new_magnitude * 10 + '0');
-        magnitude = new_magnitude;
-    }
-    while (magnitude);
+    /* two digits per division, at least 1 digit is written */
+    p = xm_u64_to_dec_end(p, magnitude);
 
     *len = buf_end - p;
     return (p);
@@ -1029,6 +1014,25 @@ int xm_vformatter(int (*flush_func)(xm_vformatter_buff_t *),
                 }
                 break;
 
+                /* print a double, passed by pointer, in its shortest
+                 * form that reads back exactly
+                 */
+                case 'D':
+                {
+                    double *arg = va_arg(ap, double *);
+
+                    if (arg != NULL) {
+                        s = &num_buf[1];
+                        s_len = xm_dtoa(*arg, s);
+                    }
+                    else {
+                        s = S_NULL;
+                        s_len = S_NULL_LEN;
+                    }
+                    pad_char = ' ';
+                }
+                break;
+
                 case 'B':
                 case 'F':
                 case 'S':
@@ -1201,24 +1205,69 @@ int xm_vsnprintf(char *buf, size_t len, const char *format,
  * "Print" functions (debug)
  */
 
+/* first tail block asked for, any block with this much room will do */
+#define PSPRINTF_MIN_SIZE 64
+
 struct psprintf_data {
     xm_vformatter_buff_t vbuff;
+    xm_pool_t *pool;
+    /* block whose free tail holds the string, NULL once it went large */
+    xm_pool_t *blk;
     char      *mem;
     size_t size;
 };
 
+/*
+ * The string is built in the free tail of a pool block, claimed for the
+ * time of the formatting so no allocation can land on it. When the tail
+ * is full, it moves to a block with twice the room, and past pool->max
+ * to a large allocation owned by the pool.
+ */
+static void psprintf_claim(struct psprintf_data *ps, xm_pool_t *blk)
+{
+    ps->blk = blk;
+    ps->mem = (char *)blk->d.last;
+    ps->size = (char *)blk->d.end - ps->mem;
+
+    blk->d.last = blk->d.end;
+}
+
 static int psprintf_flush(xm_vformatter_buff_t *vbuff)
 {
     struct psprintf_data *ps = (struct psprintf_data *)vbuff;
-    size_t size;
+    xm_pool_t *blk = NULL;
+    size_t used;
+    char *mem;
 
-    size = ps->vbuff.curpos - ps->mem;
+    used = ps->vbuff.curpos - ps->mem;
 
     ps->size <<= 1;
-    if ((ps->mem = realloc(ps->mem, ps->size)) == NULL)
+
+    if (ps->blk)
+        blk = xm_pool_tail_block(ps->pool, ps->size);
+
+    if (blk)
+        mem = (char *)blk->d.last;
+    else if ((mem = xm_pnalloc(ps->pool, ps->size)) == NULL)
         return -1;
 
-    ps->vbuff.curpos = ps->mem + size;
+    memcpy(mem, ps->mem, used);
+
+    /* give back the claimed tail, or the outgrown large buffer */
+    if (ps->blk)
+        ps->blk->d.last = ps->mem;
+    else
+        xm_pfree(ps->pool, ps->mem);
+
+    if (blk) {
+        psprintf_claim(ps, blk);
+    }
+    else {
+        ps->blk = NULL;
+        ps->mem = mem;
+    }
+
+    ps->vbuff.curpos = ps->mem + used;
     ps->vbuff.endpos = ps->mem + ps->size - 1;
 
     return 0;
@@ -1226,13 +1275,17 @@ static int psprintf_flush(xm_vformatter_buff_t *vbuff)
 
 char * xm_pvsprintf(xm_pool_t *pool, const char *fmt, va_list ap)
 {
-	pool = pool;
-
     struct psprintf_data ps;
+    xm_pool_t *blk;
 
+    ps.pool = pool;
+
+    blk = xm_pool_tail_block(pool, PSPRINTF_MIN_SIZE);
+    if (blk == NULL)
+        return NULL;
+
+    psprintf_claim(&ps, blk);
 
-    ps.size = 64;
-    ps.mem = malloc(ps.size);
     ps.vbuff.curpos  = ps.mem;
 
     /* Save a byte for the NUL terminator */
@@ -1240,11 +1293,18 @@ char * xm_pvsprintf(xm_pool_t *pool, const char *fmt, va_list ap)
 
     if (xm_vformatter(psprintf_flush, &ps.vbuff, fmt, ap) == -1) {
 
+        if (ps.blk)
+            ps.blk->d.last = ps.mem;
+
         return NULL;
     }
 
     *ps.vbuff.curpos++ = '\0';
 
+    /* keep what was written, the rest of the tail is free again */
+    if (ps.blk)
+        ps.blk->d.last = ps.vbuff.curpos;
+
     return ps.mem;
 }
 
@@ -0,0 +1,598 @@
+/*
+ *
+ *      Filename: xm_prof.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 13:40:22
+ * Last Modified: 2026-10-18 13:40:22
+ */
+
+#include <dlfcn.h>
+#include <semaphore.h>
+#include <ucontext.h>
+#include <sys/syscall.h>
+#include "xm_prof.h"
+#include "xm_atomic.h"
+#include "xm_mpool.h"
+#include "xm_string.h"
+
+static xm_prof_slot_t prof_slots[XM_PROF_THREADS_MAX];
+static xm_prof_slot_t prof_other;
+static xm_spinlock_t prof_lock = RTE_SPINLOCK_INITIALIZER;
+
+static volatile int prof_on;
+static struct sigaction prof_old_sa;
+
+static sem_t prof_sem;
+static char *prof_path;
+static int prof_sig_flags;
+
+static int prof_slot_alloc(xm_prof_slot_t *slot){
+
+	if(slot->buf)
+		return 0;
+
+	slot->buf = (uint64_t*)malloc(XM_PROF_BUF_WORDS*sizeof(uint64_t));
+	if(slot->buf == NULL)
+		return ENOMEM;
+
+	slot->cap = XM_PROF_BUF_WORDS;
+
+	return 0;
+}
+
+int xm_prof_thread_register(const char *name){
+
+	xm_prof_slot_t *slot = NULL;
+	pthread_attr_t attr;
+	void *addr;
+	size_t size;
+	int i,tid = (int)syscall(SYS_gettid),rv;
+
+	xm_spinlock_lock(&prof_lock);
+
+	/*a slot never used first, so the samples of gone threads stay apart*/
+	for(i = 0;i<XM_PROF_THREADS_MAX;i++){
+
+		if(prof_slots[i].tid == tid){
+
+			xm_spinlock_unlock(&prof_lock);
+			return 0;
+		}
+
+		if(prof_slots[i].tid == 0&&(slot == NULL||(slot->buf&&prof_slots[i].buf == NULL)))
+			slot = &prof_slots[i];
+	}
+
+	if(slot == NULL){
+
+		xm_spinlock_unlock(&prof_lock);
+		return ENOSPC;
+	}
+
+	/*held by tid -1 until set up, the handler skips it*/
+	slot->tid = -1;
+
+	xm_spinlock_unlock(&prof_lock);
+
+	rv = prof_slot_alloc(slot);
+	if(rv == 0)
+		rv = pthread_getattr_np(pthread_self(),&attr);
+
+	if(rv){
+
+		slot->tid = 0;
+		return rv;
+	}
+
+	pthread_attr_getstack(&attr,&addr,&size);
+	pthread_attr_destroy(&attr);
+
+	slot->stack_lo = (uintptr_t)addr;
+	slot->stack_hi = (uintptr_t)addr+size;
+	xm_cpystrn(slot->name,name?name:"",sizeof(slot->name));
+
+	xm_smp_wmb();
+	slot->tid = tid;
+
+	return 0;
+}
+
+void xm_prof_thread_unregister(void){
+
+	int i,tid = (int)syscall(SYS_gettid);
+
+	for(i = 0;i<XM_PROF_THREADS_MAX;i++){
+
+		if(prof_slots[i].tid == tid)
+			prof_slots[i].tid = 0;
+	}
+}
+
+static xm_prof_slot_t *prof_slot_find(int tid){
+
+	int i;
+
+	for(i = 0;i<XM_PROF_THREADS_MAX;i++){
+
+		if(prof_slots[i].tid == tid)
+			return &prof_slots[i];
+	}
+
+	return NULL;
+}
+
+/*
+ * Walk the rbp chain of the interrupted code. A frame is only read
+ * inside the thread's own mapped stack and each one must be above the
+ * last, so code built without frame pointers ends the walk early
+ * instead of faulting.
+ */
+static int prof_unwind(const ucontext_t *uc,const xm_prof_slot_t *slot,uint64_t *pcs){
+
+	uintptr_t fp,next,sp,ret;
+	int n = 0;
+
+	pcs[n++] = (uint64_t)uc->uc_mcontext.gregs[REG_RIP];
+
+	if(slot->stack_hi == 0)
+		return n;
+
+	fp = (uintptr_t)uc->uc_mcontext.gregs[REG_RBP];
+	sp = (uintptr_t)uc->uc_mcontext.gregs[REG_RSP];
+
+	while(n<XM_PROF_DEPTH){
+
+		if(fp<sp||fp<slot->stack_lo||fp+2*sizeof(uintptr_t)>slot->stack_hi||(fp&7))
+			break;
+
+		next = ((const uintptr_t*)fp)[0];
+		ret = ((const uintptr_t*)fp)[1];
+
+		if(ret == 0)
+			break;
+
+		pcs[n++] = ret;
+
+		if(next<=fp)
+			break;
+
+		fp = next;
+	}
+
+	return n;
+}
+
+static void prof_record(xm_prof_slot_t *slot,const uint64_t *pcs,int n){
+
+	size_t pos = slot->pos;
+
+	slot->samples++;
+
+	if(slot->buf == NULL||pos+1+n>slot->cap){
+
+		slot->dropped++;
+		return;
+	}
+
+	slot->buf[pos] = (uint64_t)n;
+	memcpy(slot->buf+pos+1,pcs,n*sizeof(uint64_t));
+
+	xm_smp_wmb();
+	slot->pos = pos+1+n;
+}
+
+static void prof_handler(int signo,siginfo_t *si,void *ctx){
+
+	uint64_t pcs[XM_PROF_DEPTH];
+	xm_prof_slot_t *slot;
+	int saved_errno = errno,n;
+
+	signo = signo;
+	si = si;
+
+	if(!prof_on)
+		return;
+
+	slot = prof_slot_find((int)syscall(SYS_gettid));
+
+	if(slot){
+
+		n = prof_unwind((const ucontext_t*)ctx,slot,pcs);
+		prof_record(slot,pcs,n);
+	}
+	else if(xm_spinlock_trylock(&prof_other.lock)){
+
+		/*no stack bounds, the pc alone*/
+		n = prof_unwind((const ucontext_t*)ctx,&prof_other,pcs);
+		prof_record(&prof_other,pcs,n);
+		xm_spinlock_unlock(&prof_other.lock);
+	}
+
+	errno = saved_errno;
+}
+
+int xm_prof_start(int hz){
+
+	struct itimerval it;
+	struct sigaction sa;
+	int i,rv;
+
+	if(prof_on)
+		return EBUSY;
+
+	if(hz<=0||hz>10000)
+		hz = XM_PROF_HZ_DEFAULT;
+
+	rv = prof_slot_alloc(&prof_other);
+	if(rv == 0)
+		rv = xm_prof_thread_register(NULL);
+	if(rv)
+		return rv;
+
+	/*a late signal of the last run checks prof_on, off until now*/
+	for(i = 0;i<XM_PROF_THREADS_MAX;i++){
+
+		prof_slots[i].pos = 0;
+		prof_slots[i].samples = 0;
+		prof_slots[i].dropped = 0;
+	}
+
+	prof_other.pos = 0;
+	prof_other.samples = 0;
+	prof_other.dropped = 0;
+
+	memset(&sa,0,sizeof(sa));
+	sa.sa_sigaction = prof_handler;
+	sa.sa_flags = SA_RESTART|SA_SIGINFO;
+	sigemptyset(&sa.sa_mask);
+
+	if(sigaction(SIGPROF,&sa,&prof_old_sa))
+		return errno;
+
+	prof_on = 1;
+
+	it.it_interval.tv_sec = 0;
+	it.it_interval.tv_usec = 1000000/hz;
+	it.it_value = it.it_interval;
+
+	if(setitimer(ITIMER_PROF,&it,NULL)){
+
+		rv = errno;
+		prof_on = 0;
+		sigaction(SIGPROF,&prof_old_sa,NULL);
+		return rv;
+	}
+
+	return 0;
+}
+
+void xm_prof_stop(void){
+
+	struct itimerval it;
+
+	if(!prof_on)
+		return;
+
+	memset(&it,0,sizeof(it));
+	setitimer(ITIMER_PROF,&it,NULL);
+
+	prof_on = 0;
+
+	/*a signal still pending finds prof_on clear, leave the handler in place*/
+}
+
+int xm_prof_running(void){
+
+	return prof_on;
+}
+
+typedef struct {
+
+	char *line;
+	uint64_t count;
+} prof_stack_t;
+
+#define PROF_CACHE_SIZE 4096
+
+typedef struct {
+
+	uint64_t pc;
+	const char *name;
+} prof_sym_t;
+
+static const char *prof_symbol(xm_pool_t *mp,prof_sym_t *cache,uint64_t pc){
+
+	prof_sym_t *e = NULL;
+	const char *name,*base;
+	Dl_info info;
+	size_t i,h,probes;
+
+	if(pc == 0)
+		return "[unknown]";
+
+	h = (size_t)((pc>>4)*0x9e3779b97f4a7c15ULL>>52)&(PROF_CACHE_SIZE-1);
+
+	/*open addressing; a full table only costs the lookups, not a name*/
+	for(probes = 0;probes<PROF_CACHE_SIZE;probes++){
+
+		i = (h+probes)&(PROF_CACHE_SIZE-1);
+
+		if(cache[i].pc == pc)
+			return cache[i].name;
+
+		if(cache[i].pc == 0){
+
+			e = &cache[i];
+			break;
+		}
+	}
+
+	memset(&info,0,sizeof(info));
+
+	if(dladdr((void*)(uintptr_t)pc,&info)&&info.dli_sname){
+
+		name = xm_pstrdup(mp,info.dli_sname);
+	}
+	else if(info.dli_fname){
+
+		base = strrchr(info.dli_fname,'/');
+		name = xm_psprintf(mp,"[%s]",base?base+1:info.dli_fname);
+	}
+	else{
+
+		name = "[unknown]";
+	}
+
+	if(name == NULL)
+		name = "[unknown]";
+
+	if(e){
+
+		e->pc = pc;
+		e->name = name;
+	}
+
+	return name;
+}
+
+static int prof_stack_cmp(const void *a,const void *b){
+
+	return strcmp(((const prof_stack_t*)a)->line,((const prof_stack_t*)b)->line);
+}
+
+/*fold the records of one slot, root first*/
+static size_t prof_fold(xm_pool_t *mp,prof_sym_t *cache,const xm_prof_slot_t *slot,
+	const char *root,prof_stack_t *out,size_t nout){
+
+	const uint64_t *rec,*end;
+	char *line,*p;
+	const char *frames[XM_PROF_DEPTH];
+	size_t len,l;
+	uint64_t n;
+	int i;
+
+	rec = slot->buf;
+	end = slot->buf+slot->pos;
+
+	while(rec<end){
+
+		n = rec[0];
+
+		/*past the leaf the pcs are return addresses, look up the call*/
+		for(i = 0;i<(int)n;i++)
+			frames[i] = prof_symbol(mp,cache,i?rec[1+i]-1:rec[1+i]);
+
+		len = root?strlen(root)+1:0;
+		for(i = 0;i<(int)n;i++)
+			len += strlen(frames[i])+1;
+
+		line = p = (char*)xm_pnalloc(mp,len+1);
+		if(line == NULL)
+			break;
+
+		if(root){
+
+			l = strlen(root);
+			memcpy(p,root,l);
+			p += l;
+			*p++ = ';';
+		}
+
+		for(i = (int)n-1;i>=0;i--){
+
+			l = strlen(frames[i]);
+			memcpy(p,frames[i],l);
+			p += l;
+			*p++ = ';';
+		}
+
+		p[-1] = '\0';
+
+		out[nout].line = line;
+		out[nout].count = 1;
+		nout++;
+
+		rec += 1+n;
+	}
+
+	return nout;
+}
+
+static size_t prof_slot_records(const xm_prof_slot_t *slot){
+
+	const uint64_t *rec = slot->buf,*end = slot->buf+slot->pos;
+	size_t n = 0;
+
+	for(;rec<end;rec += 1+rec[0])
+		n++;
+
+	return n;
+}
+
+int xm_prof_dump_fp(FILE *fp,int flags){
+
+	xm_prof_slot_t snap[XM_PROF_THREADS_MAX+1];
+	prof_stack_t *stacks;
+	prof_sym_t *cache;
+	xm_pool_t *mp;
+	const char *root;
+	size_t nstacks = 0,total = 0,i,j;
+	uint64_t samples = 0,dropped = 0;
+	int k;
+
+	/*a copy of each slot's pos, records before it are complete*/
+	for(k = 0;k<XM_PROF_THREADS_MAX;k++)
+		snap[k] = prof_slots[k];
+	snap[k] = prof_other;
+
+	xm_smp_rmb();
+
+	for(k = 0;k<=XM_PROF_THREADS_MAX;k++){
+
+		if(snap[k].buf)
+			total += prof_slot_records(&snap[k]);
+		samples += snap[k].samples;
+		dropped += snap[k].dropped;
+	}
+
+	mp = xm_pool_create(65536);
+	if(mp == NULL)
+		return ENOMEM;
+
+	stacks = (prof_stack_t*)xm_pcalloc(mp,(total+1)*sizeof(prof_stack_t));
+	cache = (prof_sym_t*)xm_pcalloc(mp,PROF_CACHE_SIZE*sizeof(prof_sym_t));
+
+	if(stacks == NULL||cache == NULL){
+
+		xm_pool_destroy(mp);
+		return ENOMEM;
+	}
+
+	for(k = 0;k<=XM_PROF_THREADS_MAX;k++){
+
+		if(snap[k].buf == NULL||snap[k].pos == 0)
+			continue;
+
+		root = NULL;
+		if(flags&XM_PROF_F_THREADS){
+
+			if(k == XM_PROF_THREADS_MAX)
+				root = "[unregistered]";
+			else if(snap[k].name[0])
+				root = snap[k].name;
+			else
+				root = xm_psprintf(mp,"tid-%d",snap[k].tid);
+		}
+
+		nstacks = prof_fold(mp,cache,&snap[k],root,stacks,nstacks);
+	}
+
+	/*pcs of the same functions fold to the same line, sum them*/
+	qsort(stacks,nstacks,sizeof(prof_stack_t),prof_stack_cmp);
+
+	for(i = 0;i<nstacks;i = j){
+
+		for(j = i+1;j<nstacks&&strcmp(stacks[i].line,stacks[j].line) == 0;j++)
+			stacks[i].count += stacks[j].count;
+
+		fprintf(fp,"%s %llu\n",stacks[i].line,(unsigned long long)stacks[i].count);
+	}
+
+	if(dropped)
+		fprintf(stderr,"xm_prof: %llu of %llu samples dropped, buffers full\n",
+			(unsigned long long)dropped,(unsigned long long)samples);
+
+	xm_pool_destroy(mp);
+
+	return ferror(fp)?EIO:0;
+}
+
+int xm_prof_dump(const char *path,int flags){
+
+	FILE *fp;
+	int rv;
+
+	fp = fopen(path,"w");
+	if(fp == NULL)
+		return errno;
+
+	rv = xm_prof_dump_fp(fp,flags);
+
+	if(fclose(fp)&&rv == 0)
+		rv = errno;
+
+	return rv;
+}
+
+static void prof_sig_handler(int signo){
+
+	signo = signo;
+
+	sem_post(&prof_sem);
+}
+
+static void *prof_toggler(void *arg){
+
+	arg = arg;
+
+	for(;;){
+
+		if(sem_wait(&prof_sem))
+			continue;
+
+		if(prof_on){
+
+			xm_prof_stop();
+			xm_prof_dump(prof_path,prof_sig_flags);
+		}
+		else if(xm_prof_start(XM_PROF_HZ_DEFAULT) == 0){
+
+			/*this thread only sleeps, leave the slot to one that works*/
+			xm_prof_thread_unregister();
+		}
+	}
+
+	return NULL;
+}
+
+int xm_prof_signal(int signo,const char *path,int flags){
+
+	struct sigaction sa;
+	pthread_attr_t attr;
+	pthread_t th;
+	int rv;
+
+	if(prof_path)
+		return EBUSY;
+
+	prof_path = strdup(path);
+	if(prof_path == NULL)
+		return ENOMEM;
+
+	prof_sig_flags = flags;
+	sem_init(&prof_sem,0,0);
+
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr,PTHREAD_CREATE_DETACHED);
+	rv = pthread_create(&th,&attr,prof_toggler,NULL);
+	pthread_attr_destroy(&attr);
+
+	if(rv){
+
+		free(prof_path);
+		prof_path = NULL;
+		return rv;
+	}
+
+	memset(&sa,0,sizeof(sa));
+	sa.sa_handler = prof_sig_handler;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+
+	if(sigaction(signo,&sa,NULL))
+		return errno;
+
+	return 0;
+}
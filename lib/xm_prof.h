@@ -0,0 +1,96 @@
+/*
+ *
+ *      Filename: xm_prof.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: SIGPROF sampling profiler writing folded stacks
+ *        Create: 2026-10-18 13:40:22
+ * Last Modified: 2026-10-18 13:40:22
+ */
+
+#ifndef XM_PROF_H
+#define XM_PROF_H
+
+typedef struct xm_prof_slot_t xm_prof_slot_t;
+
+#include "xm_constants.h"
+#include "xm_spinlock.h"
+
+#define XM_PROF_HZ_DEFAULT 99          /*off the beat of 100Hz timers*/
+#define XM_PROF_THREADS_MAX 64
+#define XM_PROF_DEPTH 64
+#define XM_PROF_BUF_WORDS (1<<16)     /*per thread, one sample is 1+depth words*/
+
+/*put the thread name as the root frame of each stack*/
+#define XM_PROF_F_THREADS 0x1
+
+/**
+ * The samples of one thread: records of a frame count then the pcs,
+ * leaf first. Only the owner's signal handler appends, pos is
+ * published after the record; a full buffer drops samples.
+ */
+struct xm_prof_slot_t {
+
+	volatile int tid;           /*0 for a free slot*/
+	char name[16];
+
+	/*the walk never leaves [lo,hi), the part of the stack that is mapped*/
+	uintptr_t stack_lo;
+	uintptr_t stack_hi;
+
+	uint64_t *buf;
+	size_t cap;
+	volatile size_t pos;
+
+	uint64_t samples;
+	uint64_t dropped;
+
+	/*shared by the threads that did not register*/
+	xm_spinlock_t lock;
+};
+
+/**
+ * Give the calling thread a slot so its samples carry whole stacks.
+ * Samples of a thread that did not register only have the pc it was
+ * at. Call it from the thread itself, before or while profiling.
+ * @return 0, ENOSPC with all XM_PROF_THREADS_MAX slots taken, or ENOMEM
+ */
+extern int xm_prof_thread_register(const char *name);
+
+/*give the slot back; its samples stay and a later thread may add to them*/
+extern void xm_prof_thread_unregister(void);
+
+/**
+ * Start sampling the cpu time of the process hz times a second,
+ * dropping the samples of any earlier run. Registers the calling
+ * thread. The ITIMER_PROF timer and SIGPROF belong to the profiler
+ * while it runs.
+ * @return 0 or an errno
+ */
+extern int xm_prof_start(int hz);
+
+extern void xm_prof_stop(void);
+
+extern int xm_prof_running(void);
+
+/**
+ * Write the samples as folded stacks, "root;caller;leaf count" per
+ * line, what flamegraph.pl and speedscope read. Frames are named with
+ * dladdr, so the program must be linked with -rdynamic and built with
+ * frame pointers; a static function shows as its module in brackets.
+ * A leaf that sets up no frame hides its caller. Safe while sampling.
+ */
+extern int xm_prof_dump_fp(FILE *fp,int flags);
+
+/*@return 0 or the errno of the failed open/write*/
+extern int xm_prof_dump(const char *path,int flags);
+
+/**
+ * Toggle the profiler whenever signo arrives: the first signal starts
+ * it at XM_PROF_HZ_DEFAULT, the next stops it and writes path.
+ * The handler only wakes a thread that does the work; the threads
+ * worth a whole stack register themselves up front.
+ */
+extern int xm_prof_signal(int signo,const char *path,int flags);
+
+#endif /*XM_PROF_H*/
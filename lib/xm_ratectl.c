@@ -0,0 +1,384 @@
+/*
+ *
+ *      Filename: xm_ratectl.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 15:12:09
+ * Last Modified: 2026-10-18 15:12:09
+ */
+
+#include "xm_ratectl.h"
+#include "xm_filesystem.h"
+#include "xm_string.h"
+#include "xm_log.h"
+
+/*weight of a new response ratio in the running average*/
+#define RESPONSE_AVG_WEIGHT 0.125
+
+/*bounds on the relative change the pid may ask for in one step*/
+#define PID_OUT_MIN -0.5
+#define PID_OUT_MAX  0.5
+
+static const char *policy_names[] = {"off","aimd","pid"};
+
+/*local counters that mean we, not the remote end, lost packets*/
+static const char *if_drop_counters[] = {
+	"tx_dropped",
+	"tx_errors",
+	"rx_dropped",
+	"rx_missed_errors",
+	NULL
+};
+
+void xm_tbucket_init(xm_tbucket_t *tb,uint64_t rate,uint64_t burst,uint64_t now){
+
+	tb->rate = rate;
+	tb->burst = burst?burst:(rate/1000?rate/1000:1);
+	tb->tokens = 0;
+	tb->last = now;
+}
+
+void xm_tbucket_rate_set(xm_tbucket_t *tb,uint64_t rate){
+
+	tb->rate = rate;
+	xm_smp_wmb();
+}
+
+int xm_ratectl_policy_parse(const char *name){
+
+	int i;
+
+	for(i = 0;i<(int)(sizeof(policy_names)/sizeof(policy_names[0]));i++){
+
+		if(strcasecmp(name,policy_names[i]) == 0)
+			return i;
+	}
+
+	return -1;
+}
+
+xm_ratectl_t *xm_ratectl_create(xm_pool_t *mp,xm_tbucket_t *tb){
+
+	xm_ratectl_t *ctl = (xm_ratectl_t*)xm_pcalloc(mp,sizeof(*ctl));
+
+	if(ctl == NULL)
+		return NULL;
+
+	ctl->mp = mp;
+	ctl->tb = tb;
+	ctl->policy = XM_RATECTL_OFF;
+
+	ctl->min_rate = tb->rate;
+	ctl->max_rate = tb->rate;
+	ctl->interval = XM_RATECTL_INTERVAL_DEFAULT;
+	ctl->target_loss = XM_RATECTL_TARGET_LOSS_DEFAULT;
+	ctl->decrease = XM_RATECTL_DECREASE_DEFAULT;
+	ctl->response_drop = XM_RATECTL_RESPONSE_DROP_DEFAULT;
+
+	ctl->kp = XM_RATECTL_KP_DEFAULT;
+	ctl->ki = XM_RATECTL_KI_DEFAULT;
+	ctl->kd = XM_RATECTL_KD_DEFAULT;
+
+	ctl->rate = (double)tb->rate;
+
+	return ctl;
+}
+
+static void _if_counter_path(xm_ratectl_t *ctl,int i,char *path,size_t size){
+
+	xm_snprintf(path,size,"/sys/class/net/%s/statistics/%s",ctl->ifname,if_drop_counters[i]);
+}
+
+/*the counters the driver has, probed once so a missing one is not an error every interval*/
+static void _if_counters_probe(xm_ratectl_t *ctl){
+
+	char path[256];
+	int i;
+
+	ctl->if_counters = 0;
+
+	for(i = 0;if_drop_counters[i];i++){
+
+		_if_counter_path(ctl,i,path,sizeof(path));
+
+		if(access(path,R_OK) == 0)
+			ctl->if_counters |= 1U<<i;
+	}
+}
+
+static uint64_t _if_drops_read(xm_ratectl_t *ctl){
+
+	char path[256];
+	unsigned long v;
+	uint64_t sum = 0;
+	int i;
+
+	for(i = 0;if_drop_counters[i];i++){
+
+		if(!(ctl->if_counters&(1U<<i)))
+			continue;
+
+		_if_counter_path(ctl,i,path,sizeof(path));
+
+		/*a counter that went away is logged once and then left out*/
+		if(xm_parse_sysfs_value(path,&v) == 0)
+			sum += v;
+		else
+			ctl->if_counters &= ~(1U<<i);
+	}
+
+	return sum;
+}
+
+static double _aimd(xm_ratectl_t *ctl){
+
+	uint64_t inc = ctl->increase;
+
+	if(inc == 0)
+		inc = ctl->max_rate/100?ctl->max_rate/100:1;
+
+	if(ctl->congested)
+		return ctl->rate*ctl->decrease;
+
+	return ctl->rate+(double)inc;
+}
+
+static double _pid(xm_ratectl_t *ctl){
+
+	double dt = (double)ctl->interval/1000.0;
+	double err = ctl->target_loss-ctl->loss;
+	double out;
+
+	/*a collapsing response rate is treated as loss even if no drop was counted*/
+	if(ctl->congested&&err>-ctl->target_loss)
+		err = -ctl->target_loss;
+
+	out = ctl->kp*err+ctl->ki*(ctl->integral+err*dt)+ctl->kd*(err-ctl->prev_err)/dt;
+
+	/*integrate only while the output and the rate are not pinned, no windup*/
+	if(out>PID_OUT_MIN&&out<PID_OUT_MAX&&
+		!(err>0&&ctl->rate>=(double)ctl->max_rate)&&
+		!(err<0&&ctl->rate<=(double)ctl->min_rate))
+		ctl->integral += err*dt;
+
+	ctl->prev_err = err;
+
+	if(out<PID_OUT_MIN)
+		out = PID_OUT_MIN;
+	else if(out>PID_OUT_MAX)
+		out = PID_OUT_MAX;
+
+	return ctl->rate*(1.0+out);
+}
+
+uint64_t xm_ratectl_step(xm_ratectl_t *ctl,const xm_ratectl_sample_t *sample){
+
+	uint64_t if_drops = 0,dsent,dresp,ddrops;
+	double rate;
+
+	if(ctl->if_counters)
+		if_drops = _if_drops_read(ctl);
+
+	if(!ctl->primed||ctl->policy == XM_RATECTL_OFF){
+
+		ctl->primed = 1;
+		ctl->last = *sample;
+		ctl->if_drops = if_drops;
+		return ctl->tb->rate;
+	}
+
+	dsent = sample->sent-ctl->last.sent;
+	dresp = sample->responses-ctl->last.responses;
+	ddrops = sample->drops-ctl->last.drops;
+
+	/*counters of a re-created interface may go backwards*/
+	if(if_drops>=ctl->if_drops)
+		ddrops += if_drops-ctl->if_drops;
+
+	ctl->last = *sample;
+	ctl->if_drops = if_drops;
+
+	/*nothing sent, nothing learned*/
+	if(dsent == 0)
+		return ctl->tb->rate;
+
+	ctl->loss = (double)ddrops/(double)dsent;
+	if(ctl->loss>1.0)
+		ctl->loss = 1.0;
+
+	ctl->response_ratio = (double)dresp/(double)dsent;
+
+	ctl->congested = ctl->loss>ctl->target_loss||
+		(ctl->response_avg>0&&ctl->response_ratio<ctl->response_avg*(1.0-ctl->response_drop));
+
+	if(ctl->response_avg<=0)
+		ctl->response_avg = ctl->response_ratio;
+	else
+		ctl->response_avg += RESPONSE_AVG_WEIGHT*(ctl->response_ratio-ctl->response_avg);
+
+	rate = ctl->policy == XM_RATECTL_AIMD?_aimd(ctl):_pid(ctl);
+
+	if(rate<(double)ctl->min_rate)
+		rate = (double)ctl->min_rate;
+	else if(rate>(double)ctl->max_rate)
+		rate = (double)ctl->max_rate;
+
+	ctl->rate = rate;
+
+	xm_tbucket_rate_set(ctl->tb,(uint64_t)rate);
+
+	return ctl->tb->rate;
+}
+
+static const char *_number_parse(cmd_parms *cmd,const char *w,double *v){
+
+	char *end;
+
+	*v = strtod(w,&end);
+
+	if(*w == '\0'||*end != '\0'||*v<0)
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad number '",w,"'",NULL);
+
+	return NULL;
+}
+
+static const char *set_policy(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_ratectl_t *ctl = (xm_ratectl_t*)mconfig;
+	int policy = xm_ratectl_policy_parse(w);
+
+	if(policy<0)
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": unknown policy '",w,"', expect off, aimd or pid",NULL);
+
+	ctl->policy = policy;
+
+	return NULL;
+}
+
+/*cmd_data is the offset of a uint64_t field*/
+static const char *set_u64(cmd_parms *cmd,void *mconfig,const char *w){
+
+	double v;
+	const char *err = _number_parse(cmd,w,&v);
+
+	if(err)
+		return err;
+
+	*(uint64_t*)((char*)mconfig+(uintptr_t)cmd->info) = (uint64_t)v;
+
+	return NULL;
+}
+
+static const char *set_fraction(cmd_parms *cmd,void *mconfig,const char *w){
+
+	double v;
+	const char *err = _number_parse(cmd,w,&v);
+
+	if(err)
+		return err;
+
+	if(v>=1.0)
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": expect a fraction below 1",NULL);
+
+	*(double*)((char*)mconfig+(uintptr_t)cmd->info) = v;
+
+	return NULL;
+}
+
+static const char *set_pid(cmd_parms *cmd,void *mconfig,const char *w,const char *w2,const char *w3){
+
+	xm_ratectl_t *ctl = (xm_ratectl_t*)mconfig;
+	const char *err;
+
+	if((err = _number_parse(cmd,w,&ctl->kp)) != NULL||
+		(err = _number_parse(cmd,w2,&ctl->ki)) != NULL||
+		(err = _number_parse(cmd,w3,&ctl->kd)) != NULL)
+		return err;
+
+	return NULL;
+}
+
+static const char *set_interface(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_ratectl_t *ctl = (xm_ratectl_t*)mconfig;
+
+	if(strchr(w,'/')||strlen(w)>=32)
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad interface name '",w,"'",NULL);
+
+	ctl->ifname = xm_pstrdup(ctl->mp,w);
+
+	return NULL;
+}
+
+#define RC_OFF(f) ((void*)offsetof(xm_ratectl_t,f))
+
+const command_rec xm_ratectl_cmds[] = {
+
+	XM_INIT_TAKE1("RateControl",set_policy,NULL,0,"off, aimd or pid"),
+	XM_INIT_TAKE1("RateMin",set_u64,RC_OFF(min_rate),0,"lowest rate in packets per second"),
+	XM_INIT_TAKE1("RateMax",set_u64,RC_OFF(max_rate),0,"highest rate in packets per second"),
+	XM_INIT_TAKE1("RateInterval",set_u64,RC_OFF(interval),0,"controller period in ms"),
+	XM_INIT_TAKE1("RateTargetLoss",set_fraction,RC_OFF(target_loss),0,"tolerated loss fraction"),
+	XM_INIT_TAKE1("RateIncrease",set_u64,RC_OFF(increase),0,"aimd additive step in packets per second"),
+	XM_INIT_TAKE1("RateDecrease",set_fraction,RC_OFF(decrease),0,"aimd multiplicative factor"),
+	XM_INIT_TAKE1("RateResponseDrop",set_fraction,RC_OFF(response_drop),0,
+		"relative fall of the response ratio treated as congestion"),
+	XM_INIT_TAKE3("RatePid",set_pid,NULL,0,"pid gains kp ki kd"),
+	XM_INIT_TAKE1("RateInterface",set_interface,NULL,0,"interface whose drop counters are watched"),
+	{NULL}
+};
+
+const char *xm_ratectl_check(xm_ratectl_t *ctl){
+
+	/*the directives come in any order, so the bounds are only checked here*/
+	if(ctl->min_rate>ctl->max_rate)
+		return "RateMin must not be above RateMax";
+
+	if(ctl->interval == 0)
+		return "RateInterval must be at least 1 ms";
+
+	if(ctl->policy != XM_RATECTL_OFF&&ctl->max_rate == 0)
+		return "RateMax must be set for an adaptive RateControl";
+
+	if(ctl->ifname){
+
+		_if_counters_probe(ctl);
+
+		if(ctl->if_counters == 0)
+			return xm_pstrcat(ctl->mp,"RateInterface: ",ctl->ifname," has no drop counters in sysfs",NULL);
+	}
+
+	if(ctl->rate<(double)ctl->min_rate)
+		ctl->rate = (double)ctl->min_rate;
+	else if(ctl->rate>(double)ctl->max_rate)
+		ctl->rate = (double)ctl->max_rate;
+
+	if(ctl->policy != XM_RATECTL_OFF)
+		xm_tbucket_rate_set(ctl->tb,(uint64_t)ctl->rate);
+
+	return NULL;
+}
+
+const char *xm_ratectl_load(xm_ratectl_t *ctl,xm_pool_t *ptemp,const char *fname){
+
+	const char *err;
+
+	err = xm_process_command_config(xm_ratectl_cmds,ctl,ctl->mp,ptemp,fname);
+	if(err)
+		return err;
+
+	return xm_ratectl_check(ctl);
+}
+
+void xm_ratectl_dump(xm_ratectl_t *ctl,FILE *fp){
+
+	fprintf(fp,"Dump rate controller-------------------------------------------\n");
+	fprintf(fp,"policy:%s,rate:%lu,bounds:%lu-%lu,interval:%lums\n",policy_names[ctl->policy],
+		(unsigned long)ctl->tb->rate,(unsigned long)ctl->min_rate,(unsigned long)ctl->max_rate,
+		(unsigned long)ctl->interval);
+	fprintf(fp,"target loss:%.4f,increase:%lu,decrease:%.2f,pid:%.3f/%.3f/%.3f\n",ctl->target_loss,
+		(unsigned long)ctl->increase,ctl->decrease,ctl->kp,ctl->ki,ctl->kd);
+	fprintf(fp,"interface:%s,last loss:%.4f,response ratio:%.4f(avg %.4f),congested:%d\n",
+		ctl->ifname?ctl->ifname:"--",ctl->loss,ctl->response_ratio,ctl->response_avg,ctl->congested);
+}
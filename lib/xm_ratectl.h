@@ -0,0 +1,204 @@
+/*
+ *
+ *      Filename: xm_ratectl.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: token bucket and adaptive send rate controller
+ *        Create: 2026-10-18 14:55:40
+ * Last Modified: 2026-10-18 14:55:40
+ */
+
+#ifndef XM_RATECTL_H
+#define XM_RATECTL_H
+
+typedef struct xm_tbucket_t xm_tbucket_t;
+typedef struct xm_ratectl_t xm_ratectl_t;
+typedef struct xm_ratectl_sample_t xm_ratectl_sample_t;
+
+#include <time.h>
+#include "xm_constants.h"
+#include "xm_atomic.h"
+#include "xm_mpool.h"
+#include "xm_config.h"
+
+#define XM_NSEC_PER_SEC 1000000000ULL
+
+#define XM_RATECTL_OFF  0
+#define XM_RATECTL_AIMD 1
+#define XM_RATECTL_PID  2
+
+#define XM_RATECTL_INTERVAL_DEFAULT 500   /*ms*/
+#define XM_RATECTL_TARGET_LOSS_DEFAULT 0.01
+#define XM_RATECTL_DECREASE_DEFAULT 0.7
+#define XM_RATECTL_RESPONSE_DROP_DEFAULT 0.3
+#define XM_RATECTL_KP_DEFAULT 5.0
+#define XM_RATECTL_KI_DEFAULT 1.0
+#define XM_RATECTL_KD_DEFAULT 0.0
+
+/**
+ * Token bucket for the send path. Tokens are kept scaled by
+ * XM_NSEC_PER_SEC so a refill is one multiply. rate is written by the
+ * controller thread and only read here, a plain aligned store is enough.
+ */
+struct xm_tbucket_t {
+
+	volatile uint64_t rate;      /*packets per second*/
+	uint64_t burst;              /*packets*/
+
+	uint64_t tokens;             /*packets*XM_NSEC_PER_SEC*/
+	uint64_t last;               /*ns*/
+};
+
+/**
+ * Cumulative counters handed to the controller, the controller works on
+ * the deltas between two samples.
+ */
+struct xm_ratectl_sample_t {
+
+	uint64_t sent;
+	uint64_t responses;
+
+	/*kernel and ring drops seen by the caller, e.g. from xm_xsk_stats_get*/
+	uint64_t drops;
+};
+
+struct xm_ratectl_t {
+
+	xm_pool_t *mp;
+
+	xm_tbucket_t *tb;
+
+	int policy;
+
+	uint64_t min_rate;
+	uint64_t max_rate;
+	uint64_t interval;          /*ms*/
+
+	/*loss fraction the controller steers towards, and above which aimd backs off*/
+	double target_loss;
+
+	/*aimd*/
+	uint64_t increase;          /*pps added per quiet interval*/
+	double decrease;            /*factor applied on congestion*/
+
+	/*pid on loss error, output is a relative rate change*/
+	double kp;
+	double ki;
+	double kd;
+	double integral;
+	double prev_err;
+
+	/*a fall of the response ratio below (1-response_drop) of its average counts as congestion*/
+	double response_drop;
+	double response_avg;
+
+	/*local interface counters under /sys/class/net*/
+	const char *ifname;
+	uint32_t if_counters;       /*bit i: if_drop_counters[i] exists, set by xm_ratectl_check*/
+	uint64_t if_drops;
+
+	double rate;                /*unrounded controller output*/
+
+	int primed;
+	xm_ratectl_sample_t last;
+
+	/*last step, for logging*/
+	double loss;
+	double response_ratio;
+	int congested;
+};
+
+/*config directives, mconfig must be the xm_ratectl_t*/
+extern const command_rec xm_ratectl_cmds[];
+
+/**
+ * Init a token bucket.
+ * @param burst the largest number of packets granted at once, 0 for rate/1000
+ */
+extern void xm_tbucket_init(xm_tbucket_t *tb,uint64_t rate,uint64_t burst,uint64_t now);
+
+extern void xm_tbucket_rate_set(xm_tbucket_t *tb,uint64_t rate);
+
+/**
+ * Take up to n tokens.
+ * @return The number of packets that may be sent now
+ */
+static inline uint32_t xm_tbucket_take(xm_tbucket_t *tb,uint64_t now,uint32_t n){
+
+	uint64_t rate = tb->rate;
+	uint64_t elapsed = now-tb->last;
+	uint64_t cap = tb->burst*XM_NSEC_PER_SEC;
+	uint64_t avail;
+
+	/*cap the refill so elapsed*rate cannot overflow*/
+	if(elapsed>XM_NSEC_PER_SEC)
+		elapsed = XM_NSEC_PER_SEC;
+
+	tb->tokens += elapsed*rate;
+	if(tb->tokens>cap)
+		tb->tokens = cap;
+
+	tb->last = now;
+
+	avail = tb->tokens/XM_NSEC_PER_SEC;
+	if(avail<n)
+		n = (uint32_t)avail;
+
+	tb->tokens -= (uint64_t)n*XM_NSEC_PER_SEC;
+
+	return n;
+}
+
+/*ns until at least one token is available*/
+static inline uint64_t xm_tbucket_wait(xm_tbucket_t *tb){
+
+	uint64_t rate = tb->rate;
+
+	if(tb->tokens>=XM_NSEC_PER_SEC||rate == 0)
+		return 0;
+
+	return (XM_NSEC_PER_SEC-tb->tokens+rate-1)/rate;
+}
+
+static inline uint64_t xm_now_ns(void){
+
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+
+	return (uint64_t)ts.tv_sec*XM_NSEC_PER_SEC+(uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Create a controller driving tb. The policy is off until set by
+ * xm_ratectl_cmds or by hand, bounds default to the current rate.
+ */
+extern xm_ratectl_t *xm_ratectl_create(xm_pool_t *mp,xm_tbucket_t *tb);
+
+extern int xm_ratectl_policy_parse(const char *name);
+
+/**
+ * Check the settings once they are all in, e.g. after the directives,
+ * and pull the current rate into the bounds. With an interface set it
+ * also probes which drop counters the driver has; only those are read.
+ * @return NULL on success, otherwise the error message
+ */
+extern const char *xm_ratectl_check(xm_ratectl_t *ctl);
+
+/**
+ * Load the settings from a config file and check them.
+ * @return NULL on success, otherwise the error message
+ */
+extern const char *xm_ratectl_load(xm_ratectl_t *ctl,xm_pool_t *ptemp,const char *fname);
+
+/**
+ * Feed one sample and adjust the bucket rate. Call it every
+ * ctl->interval ms from a thread other than the senders; it reads
+ * sysfs when ifname is set and must stay off the send path.
+ * @return The new rate in packets per second
+ */
+extern uint64_t xm_ratectl_step(xm_ratectl_t *ctl,const xm_ratectl_sample_t *sample);
+
+extern void xm_ratectl_dump(xm_ratectl_t *ctl,FILE *fp);
+
+#endif /*XM_RATECTL_H*/
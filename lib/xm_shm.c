@@ -0,0 +1,542 @@
+/*
+ *
+ *      Filename: xm_shm.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 15:02:37
+ * Last Modified: 2026-10-18 15:02:37
+ */
+
+#include <sys/mman.h>
+#include "xm_shm.h"
+#include "xm_atomic.h"
+#include "xm_errno.h"
+#include "xm_string.h"
+
+/*
+ * The blocks lie back to back from hdr_size to top, each one a
+ * header and its data, so the heap can be walked by size alone.
+ * A free block links to the next free one by offset; a block in use
+ * holds SHM_USED there instead.
+ */
+typedef struct {
+
+	uint64_t size;              /*with the header, a multiple of SHM_ALIGN*/
+	xm_shm_off_t next;
+} shm_blk_t;
+
+#define SHM_ALIGN 16
+#define SHM_BLK_MIN (2*sizeof(shm_blk_t))
+#define SHM_USED (~(xm_shm_off_t)0)
+
+#define SHM_HDR_SIZE ((sizeof(xm_shm_hdr_t)+63)&~(size_t)63)
+#define SHM_BLK(hdr,off) ((shm_blk_t*)((unsigned char*)(hdr)+(off)))
+
+static void shm_cleanup(void *data){
+
+	xm_shm_detach((xm_shm_t*)data);
+}
+
+static int shm_map(xm_shm_t **shm,xm_pool_t *mp,const char *name,int fd,size_t size,int flags){
+
+	xm_pool_cleanup_t *cln;
+	xm_shm_t *s;
+	void *base;
+
+	base = mmap(NULL,size,flags&XM_SHM_F_RDONLY?PROT_READ:PROT_READ|PROT_WRITE,MAP_SHARED,fd,0);
+	if(base == MAP_FAILED)
+		return errno == ENOMEM?XM_ENOSHMAVAIL:errno;
+
+	s = (xm_shm_t*)xm_pcalloc(mp,sizeof(*s));
+	cln = xm_pool_cleanup_add(mp,0);
+
+	if(s == NULL||cln == NULL){
+
+		munmap(base,size);
+		return ENOMEM;
+	}
+
+	s->name = name?xm_pstrdup(mp,name):NULL;
+	s->fd = fd;
+	s->flags = flags;
+	s->base = (unsigned char*)base;
+	s->size = size;
+	s->hdr = (xm_shm_hdr_t*)base;
+
+	cln->handler = shm_cleanup;
+	cln->data = s;
+
+	*shm = s;
+
+	return 0;
+}
+
+static int shm_hdr_init(xm_shm_hdr_t *hdr,size_t size){
+
+	pthread_mutexattr_t attr;
+	int rv;
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_setpshared(&attr,PTHREAD_PROCESS_SHARED);
+	pthread_mutexattr_setrobust(&attr,PTHREAD_MUTEX_ROBUST);
+
+	rv = pthread_mutex_init(&hdr->lock,&attr);
+	pthread_mutexattr_destroy(&attr);
+
+	if(rv)
+		return rv;
+
+	hdr->size = size;
+	hdr->hdr_size = SHM_HDR_SIZE;
+	hdr->top = SHM_HDR_SIZE;
+	hdr->version = XM_SHM_VERSION;
+
+	/*the magic last, an attach that sees it sees the rest*/
+	__sync_synchronize();
+	hdr->magic = XM_SHM_MAGIC;
+
+	return 0;
+}
+
+int xm_shm_create(xm_shm_t **shm,xm_pool_t *mp,const char *name,size_t size){
+
+	int fd,rv;
+
+	size = (size+4095)&~(size_t)4095;
+	if(size<SHM_HDR_SIZE+4096)
+		size = SHM_HDR_SIZE+4096;
+
+	if(name)
+		fd = shm_open(name,O_RDWR|O_CREAT|O_EXCL,0600);
+	else
+		fd = memfd_create("xm_shm",0);
+
+	if(fd<0)
+		return errno == ENOSYS?XM_ENOSHMAVAIL:errno;
+
+	if(ftruncate(fd,(off_t)size)){
+
+		rv = errno == ENOSPC||errno == EFBIG?XM_ENOSHMAVAIL:errno;
+		goto fail;
+	}
+
+	rv = shm_map(shm,mp,name,fd,size,0);
+	if(rv)
+		goto fail;
+
+	rv = shm_hdr_init((*shm)->hdr,size);
+	if(rv){
+
+		xm_shm_detach(*shm);
+		if(name)
+			shm_unlink(name);
+		return rv;
+	}
+
+	return 0;
+
+fail:
+	close(fd);
+	if(name)
+		shm_unlink(name);
+
+	return rv;
+}
+
+int xm_shm_attach_fd(xm_shm_t **shm,xm_pool_t *mp,int fd,int flags){
+
+	const xm_shm_hdr_t *hdr;
+	struct stat st;
+	int rv;
+
+	if(fstat(fd,&st))
+		return errno;
+
+	if((size_t)st.st_size<SHM_HDR_SIZE)
+		return EINVAL;
+
+	fd = fcntl(fd,F_DUPFD_CLOEXEC,0);
+	if(fd<0)
+		return errno;
+
+	rv = shm_map(shm,mp,NULL,fd,(size_t)st.st_size,flags);
+	if(rv){
+
+		close(fd);
+		return rv;
+	}
+
+	hdr = (*shm)->hdr;
+
+	if(hdr->magic != XM_SHM_MAGIC||hdr->version != XM_SHM_VERSION||hdr->size != (uint64_t)st.st_size){
+
+		xm_shm_detach(*shm);
+		return EINVAL;
+	}
+
+	return 0;
+}
+
+int xm_shm_attach(xm_shm_t **shm,xm_pool_t *mp,const char *name,int flags){
+
+	int fd,rv;
+
+	fd = shm_open(name,flags&XM_SHM_F_RDONLY?O_RDONLY:O_RDWR,0);
+	if(fd<0)
+		return errno;
+
+	rv = xm_shm_attach_fd(shm,mp,fd,flags);
+	close(fd);
+
+	if(rv == 0)
+		(*shm)->name = xm_pstrdup(mp,name);
+
+	return rv;
+}
+
+void xm_shm_detach(xm_shm_t *shm){
+
+	if(shm->base == NULL)
+		return;
+
+	munmap(shm->base,shm->size);
+	close(shm->fd);
+
+	shm->base = NULL;
+	shm->hdr = NULL;
+	shm->fd = -1;
+}
+
+int xm_shm_remove(const char *name){
+
+	return shm_unlink(name)?errno:0;
+}
+
+int xm_shm_fd(const xm_shm_t *shm){
+
+	return shm->fd;
+}
+
+/*
+ * The lock holder died. A block header is written before the size
+ * that takes it into the walk, so the blocks are sound up to the
+ * first bad one; cut top there and build the free list again.
+ */
+static void shm_recover(xm_shm_hdr_t *hdr){
+
+	shm_blk_t *b,*last_free = NULL;
+	xm_shm_off_t off,last_off = XM_SHM_NULL,*link = &hdr->free_head,*last_link = NULL;
+	uint64_t used = 0,nallocs = 0,size;
+
+	for(off = hdr->hdr_size;off<hdr->top;off += size){
+
+		b = SHM_BLK(hdr,off);
+		size = b->size;
+
+		if(size<SHM_BLK_MIN||(size&(SHM_ALIGN-1))||size>hdr->top-off)
+			break;
+
+		if(b->next == SHM_USED){
+
+			used += size;
+			nallocs++;
+			last_free = NULL;
+			continue;
+		}
+
+		/*run into the free block just before*/
+		if(last_free&&last_off+last_free->size == off){
+
+			last_free->size += size;
+			continue;
+		}
+
+		last_link = link;
+		*link = off;
+		link = &b->next;
+		last_free = b;
+		last_off = off;
+	}
+
+	*link = XM_SHM_NULL;
+
+	/*a free block at the end is space above top*/
+	if(last_free&&last_off+last_free->size == off){
+
+		*last_link = XM_SHM_NULL;
+		off = last_off;
+	}
+
+	hdr->top = off;
+	hdr->used = used;
+	hdr->nallocs = nallocs;
+	hdr->recoveries++;
+}
+
+/*
+ * Only the compiler can reorder what a killed process leaves behind,
+ * so a barrier keeps every heap store on its side of the dirty flag.
+ */
+static inline void shm_dirty_set(xm_shm_hdr_t *hdr,uint32_t dirty){
+
+	xm_compiler_barrier();
+	hdr->dirty = dirty;
+	xm_compiler_barrier();
+}
+
+static int shm_lock(xm_shm_hdr_t *hdr){
+
+	int rv = pthread_mutex_lock(&hdr->lock);
+
+	if(rv == EOWNERDEAD){
+
+		if(hdr->dirty)
+			shm_recover(hdr);
+
+		hdr->dirty = 0;
+		pthread_mutex_consistent(&hdr->lock);
+		rv = 0;
+	}
+
+	return rv;
+}
+
+void *xm_shm_alloc(xm_shm_t *shm,size_t size){
+
+	xm_shm_hdr_t *hdr = shm->hdr;
+	xm_shm_off_t off,*link;
+	shm_blk_t *b,*rest;
+	uint64_t need;
+
+	if((shm->flags&XM_SHM_F_RDONLY)||size>hdr->size)
+		return NULL;
+
+	need = (size+sizeof(shm_blk_t)+SHM_ALIGN-1)&~(uint64_t)(SHM_ALIGN-1);
+	if(need<SHM_BLK_MIN)
+		need = SHM_BLK_MIN;
+
+	if(shm_lock(hdr))
+		return NULL;
+
+	shm_dirty_set(hdr,1);
+
+	/*first fit keeps the low end busy and lets top come back down*/
+	for(link = &hdr->free_head,off = *link;off;link = &b->next,off = *link){
+
+		b = SHM_BLK(hdr,off);
+		if(b->size<need)
+			continue;
+
+		if(b->size-need>=SHM_BLK_MIN){
+
+			rest = SHM_BLK(hdr,off+need);
+			rest->size = b->size-need;
+			rest->next = b->next;
+			*link = off+need;
+
+			/*the rest is whole before the walk can reach it*/
+			xm_compiler_barrier();
+			b->size = need;
+		}
+		else{
+
+			*link = b->next;
+		}
+
+		goto found;
+	}
+
+	if(hdr->size-hdr->top<need){
+
+		shm_dirty_set(hdr,0);
+		pthread_mutex_unlock(&hdr->lock);
+		return NULL;
+	}
+
+	off = hdr->top;
+	b = SHM_BLK(hdr,off);
+	b->size = need;
+	b->next = SHM_USED;
+
+	/*the header is written before top takes the block into the walk*/
+	xm_compiler_barrier();
+	hdr->top += need;
+
+found:
+	b->next = SHM_USED;
+	hdr->used += b->size;
+	hdr->nallocs++;
+
+	shm_dirty_set(hdr,0);
+	pthread_mutex_unlock(&hdr->lock);
+
+	return b+1;
+}
+
+void *xm_shm_calloc(xm_shm_t *shm,size_t size){
+
+	void *p = xm_shm_alloc(shm,size);
+
+	if(p)
+		memset(p,0,size);
+
+	return p;
+}
+
+char *xm_shm_strdup(xm_shm_t *shm,const char *s){
+
+	size_t len = strlen(s)+1;
+	char *p = (char*)xm_shm_alloc(shm,len);
+
+	if(p)
+		memcpy(p,s,len);
+
+	return p;
+}
+
+int xm_shm_free(xm_shm_t *shm,void *p){
+
+	xm_shm_hdr_t *hdr = shm->hdr;
+	xm_shm_off_t off,cur,prev = XM_SHM_NULL,*link,*prev_link = NULL;
+	shm_blk_t *b,*c;
+
+	if(p == NULL)
+		return 0;
+
+	off = xm_shm_off(shm,p)-sizeof(shm_blk_t);
+
+	if((shm->flags&XM_SHM_F_RDONLY)||(unsigned char*)p<shm->base+hdr->hdr_size+sizeof(shm_blk_t)||
+		off>=hdr->size||(off&(SHM_ALIGN-1)))
+		return EINVAL;
+
+	if(shm_lock(hdr))
+		return EINVAL;
+
+	b = SHM_BLK(hdr,off);
+
+	if(off>=hdr->top||b->next != SHM_USED){
+
+		pthread_mutex_unlock(&hdr->lock);
+		return EINVAL;
+	}
+
+	shm_dirty_set(hdr,1);
+	hdr->used -= b->size;
+	hdr->nallocs--;
+
+	for(link = &hdr->free_head;(cur = *link)&&cur<off;link = &SHM_BLK(hdr,cur)->next){
+
+		prev_link = link;
+		prev = cur;
+	}
+
+	/*take in the free block after, then let the one before take this*/
+	if(cur&&off+b->size == cur){
+
+		c = SHM_BLK(hdr,cur);
+		b->size += c->size;
+		b->next = c->next;
+	}
+	else{
+
+		b->next = cur;
+	}
+
+	*link = off;
+
+	if(prev&&prev+SHM_BLK(hdr,prev)->size == off){
+
+		c = SHM_BLK(hdr,prev);
+		c->size += b->size;
+		c->next = b->next;
+
+		b = c;
+		off = prev;
+		link = prev_link;
+	}
+
+	/*the last block goes back above top*/
+	if(b->next == XM_SHM_NULL&&off+b->size == hdr->top){
+
+		*link = XM_SHM_NULL;
+		hdr->top = off;
+	}
+
+	shm_dirty_set(hdr,0);
+	pthread_mutex_unlock(&hdr->lock);
+
+	return 0;
+}
+
+void xm_shm_root_set(xm_shm_t *shm,void *p){
+
+	__sync_synchronize();
+	shm->hdr->root = xm_shm_off(shm,p);
+}
+
+void *xm_shm_root(const xm_shm_t *shm){
+
+	return xm_shm_ptr(shm,shm->hdr->root);
+}
+
+int xm_shm_check(xm_shm_t *shm){
+
+	xm_shm_hdr_t *hdr = shm->hdr;
+	xm_shm_off_t off,next_free;
+	shm_blk_t *b;
+	uint64_t used = 0,nallocs = 0;
+	int rv = 0,prev_free = 0,locked = !(shm->flags&XM_SHM_F_RDONLY);
+
+	/*a read only mapping cannot take the lock, it may see a change half done*/
+	if(locked&&shm_lock(hdr))
+		return EINVAL;
+
+	next_free = hdr->free_head;
+
+	for(off = hdr->hdr_size;off<hdr->top;off += b->size){
+
+		b = SHM_BLK(hdr,off);
+
+		if(b->size<SHM_BLK_MIN||(b->size&(SHM_ALIGN-1))||b->size>hdr->top-off){
+
+			rv = EINVAL;
+			break;
+		}
+
+		if(b->next == SHM_USED){
+
+			used += b->size;
+			nallocs++;
+			prev_free = 0;
+			continue;
+		}
+
+		/*free blocks are in the list in order and never side by side*/
+		if(off != next_free||prev_free){
+
+			rv = EINVAL;
+			break;
+		}
+
+		next_free = b->next;
+		prev_free = 1;
+	}
+
+	if(rv == 0&&(off != hdr->top||next_free||prev_free||used != hdr->used||nallocs != hdr->nallocs))
+		rv = EINVAL;
+
+	if(locked)
+		pthread_mutex_unlock(&hdr->lock);
+
+	return rv;
+}
+
+void xm_shm_dump(xm_shm_t *shm,FILE *fp){
+
+	const xm_shm_hdr_t *hdr = shm->hdr;
+
+	fprintf(fp,"shm %s: size %lu, top %lu, used %lu in %lu allocations, %lu recoveries\n",
+		shm->name?shm->name:"(memfd)",(unsigned long)hdr->size,(unsigned long)hdr->top,
+		(unsigned long)hdr->used,(unsigned long)hdr->nallocs,(unsigned long)hdr->recoveries);
+}
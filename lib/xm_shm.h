@@ -0,0 +1,155 @@
+/*
+ *
+ *      Filename: xm_shm.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: shared memory arena with an offset based allocator
+ *        Create: 2026-10-18 15:02:37
+ * Last Modified: 2026-10-18 15:02:37
+ */
+
+#ifndef XM_SHM_H
+#define XM_SHM_H
+
+typedef struct xm_shm_t xm_shm_t;
+typedef struct xm_shm_hdr_t xm_shm_hdr_t;
+
+#include "xm_constants.h"
+#include "xm_mpool.h"
+
+#define XM_SHM_MAGIC 0x4d485358    /*"XSHM"*/
+#define XM_SHM_VERSION 1
+
+/*map the segment read only; nothing can be allocated through it*/
+#define XM_SHM_F_RDONLY 0x1
+
+/**
+ * A position in the segment. Every process maps the segment at its
+ * own address, so what lives in it links to other parts of it by
+ * offset, never by pointer. 0 is the header, never an allocation.
+ */
+typedef uint64_t xm_shm_off_t;
+
+#define XM_SHM_NULL ((xm_shm_off_t)0)
+
+/**
+ * A self relative pointer: the distance from the field to the target.
+ * It needs no xm_shm_t to follow, handy for lists and trees built
+ * inside the segment. 0 is NULL.
+ */
+typedef int64_t xm_shm_rel_t;
+
+/*
+ * The start of the segment, shared by all the processes. The lock is
+ * a robust process shared mutex: the allocator repairs itself when a
+ * process dies holding it. What a dead process had allocated stays
+ * allocated.
+ */
+struct xm_shm_hdr_t {
+
+	uint32_t magic;
+	uint32_t version;
+	uint64_t size;              /*of the whole segment*/
+	uint64_t hdr_size;          /*the first block starts here*/
+
+	pthread_mutex_t lock;
+	volatile uint32_t dirty;    /*the blocks are being changed*/
+
+	uint64_t top;               /*the end of the last block*/
+	xm_shm_off_t free_head;     /*free blocks below top, by offset*/
+	uint64_t used;
+	uint64_t nallocs;
+	uint64_t recoveries;
+
+	xm_shm_off_t root;          /*where the creator left its structure*/
+};
+
+/*the process local handle*/
+struct xm_shm_t {
+
+	char *name;                 /*NULL for an anonymous memfd*/
+	int fd;
+	int flags;
+
+	unsigned char *base;
+	size_t size;
+
+	xm_shm_hdr_t *hdr;
+};
+
+/**
+ * Create a segment of size bytes and map it. With a name it is a
+ * POSIX shm object other processes attach to by name, and the name
+ * must not exist yet. Without one it is a memfd that forked children
+ * share and others get by xm_shm_fd. The mapping goes with mp.
+ * @return 0, EEXIST, XM_ENOSHMAVAIL when the system has no room for
+ * it, or another errno
+ */
+extern int xm_shm_create(xm_shm_t **shm,xm_pool_t *mp,const char *name,size_t size);
+
+extern int xm_shm_attach(xm_shm_t **shm,xm_pool_t *mp,const char *name,int flags);
+
+/**
+ * Attach to the segment behind fd, a memfd passed over a unix socket
+ * or across exec. fd is dup()ed, the caller keeps its own.
+ * @return 0, EINVAL when fd holds no segment of this version, or an errno
+ */
+extern int xm_shm_attach_fd(xm_shm_t **shm,xm_pool_t *mp,int fd,int flags);
+
+/*unmap now rather than with the pool; the segment lives on*/
+extern void xm_shm_detach(xm_shm_t *shm);
+
+/*remove the name; the memory goes with the last mapping*/
+extern int xm_shm_remove(const char *name);
+
+extern int xm_shm_fd(const xm_shm_t *shm);
+
+/**
+ * Allocate from the segment, 16 byte aligned.
+ * @return NULL when the segment is full or mapped read only
+ */
+extern void *xm_shm_alloc(xm_shm_t *shm,size_t size);
+
+extern void *xm_shm_calloc(xm_shm_t *shm,size_t size);
+
+extern char *xm_shm_strdup(xm_shm_t *shm,const char *s);
+
+/*@return 0 or EINVAL for what is no allocation of this segment*/
+extern int xm_shm_free(xm_shm_t *shm,void *p);
+
+/*publish the structure the other processes start from*/
+extern void xm_shm_root_set(xm_shm_t *shm,void *p);
+
+extern void *xm_shm_root(const xm_shm_t *shm);
+
+/**
+ * Walk the blocks and the free list under the lock.
+ * @return 0 or EINVAL when they do not agree
+ */
+extern int xm_shm_check(xm_shm_t *shm);
+
+extern void xm_shm_dump(xm_shm_t *shm,FILE *fp);
+
+static inline void *xm_shm_ptr(const xm_shm_t *shm,xm_shm_off_t off){
+
+	return off?(void*)(shm->base+off):NULL;
+}
+
+static inline xm_shm_off_t xm_shm_off(const xm_shm_t *shm,const void *p){
+
+	return p?(xm_shm_off_t)((const unsigned char*)p-shm->base):XM_SHM_NULL;
+}
+
+#define XM_SHM_PTR(shm,off,type) ((type*)xm_shm_ptr(shm,off))
+
+static inline void xm_shm_rel_set(xm_shm_rel_t *rel,const void *p){
+
+	*rel = p?(xm_shm_rel_t)((const char*)p-(const char*)rel):0;
+}
+
+static inline void *xm_shm_rel_get(const xm_shm_rel_t *rel){
+
+	return *rel?(void*)((const char*)rel+*rel):NULL;
+}
+
+#endif /*XM_SHM_H*/
@@ -0,0 +1,481 @@
+/*
+ *
+ *      Filename: xm_slice.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 18:58:12
+ * Last Modified: 2026-10-18 18:58:12
+ */
+
+#include "xm_slice.h"
+#include "xm_cpu.h"
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
+#define BS_BIT(c) (1ULL<<((c)&63))
+
+const xm_byteset_t xm_byteset_space = {
+
+	{BS_BIT(' ')|BS_BIT('\t')|BS_BIT('\r')|BS_BIT('\n')|BS_BIT('\v')|BS_BIT('\f'),0,0,0},
+	0,
+	{0}
+};
+
+void xm_byteset_init(xm_byteset_t *set,const char *chars){
+
+	const unsigned char *p;
+	unsigned char c;
+
+	memset(set,0,sizeof(*set));
+
+	for(p = (const unsigned char*)chars;*p;p++){
+
+		c = *p;
+		if(xm_byteset_has(set,c))
+			continue;
+
+		set->bits[c>>6] |= BS_BIT(c);
+
+		/*one past the max marks the set as too big for the simd scan*/
+		if(set->nchars<=XM_BYTESET_SIMD_MAX){
+
+			if(set->nchars<XM_BYTESET_SIMD_MAX)
+				set->chars[set->nchars] = c;
+			set->nchars++;
+		}
+	}
+}
+
+static inline uint8_t _lower(uint8_t c){
+
+	return (uint8_t)(c-'A')<26?c|0x20:c;
+}
+
+typedef size_t (*find_any_fn)(const unsigned char *p,size_t len,const xm_byteset_t *set);
+
+/*
+ * The simd scans stop at a hit or at the tail and xm_str_find_any
+ * settles both with the bitmap; the scalar one is that bitmap scan.
+ */
+static size_t _find_any_scalar(const unsigned char *p,size_t len,const xm_byteset_t *set){
+
+	size_t i;
+
+	for(i = 0;i<len;i++){
+
+		if(xm_byteset_has(set,p[i]))
+			break;
+	}
+
+	return i;
+}
+
+#ifdef __SSE2__
+/*16 bytes per step, compare against each delimiter and or the masks*/
+static size_t _find_any_sse2(const unsigned char *p,size_t len,const xm_byteset_t *set){
+
+	__m128i v[XM_BYTESET_SIMD_MAX],x,m;
+	size_t i;
+	int j,mask;
+
+	for(j = 0;j<set->nchars;j++)
+		v[j] = _mm_set1_epi8((char)set->chars[j]);
+
+	for(i = 0;i+16<=len;i += 16){
+
+		x = _mm_loadu_si128((const __m128i*)(p+i));
+		m = _mm_cmpeq_epi8(x,v[0]);
+
+		for(j = 1;j<set->nchars;j++)
+			m = _mm_or_si128(m,_mm_cmpeq_epi8(x,v[j]));
+
+		mask = _mm_movemask_epi8(m);
+		if(mask)
+			return i+__builtin_ctz((unsigned)mask);
+	}
+
+	return i;
+}
+
+/*one pcmpestri per 16 bytes whatever the number of delimiters*/
+__attribute__((target("sse4.2")))
+static size_t _find_any_sse42(const unsigned char *p,size_t len,const xm_byteset_t *set){
+
+	__m128i chars;
+	uint32_t w;
+	size_t i;
+	int k;
+
+	/*XM_BYTESET_SIMD_MAX is 4, the delimiters fit one dword*/
+	memcpy(&w,set->chars,sizeof(w));
+	chars = _mm_cvtsi32_si128((int)w);
+
+	for(i = 0;i+16<=len;i += 16){
+
+		k = _mm_cmpestri(chars,set->nchars,_mm_loadu_si128((const __m128i*)(p+i)),16,
+			_SIDD_UBYTE_OPS|_SIDD_CMP_EQUAL_ANY|_SIDD_LEAST_SIGNIFICANT);
+		if(k<16)
+			return i+k;
+	}
+
+	return i;
+}
+
+__attribute__((target("avx2")))
+static size_t _find_any_avx2(const unsigned char *p,size_t len,const xm_byteset_t *set){
+
+	__m256i v[XM_BYTESET_SIMD_MAX],x,m;
+	size_t i;
+	int j,mask;
+
+	for(j = 0;j<set->nchars;j++)
+		v[j] = _mm256_set1_epi8((char)set->chars[j]);
+
+	for(i = 0;i+32<=len;i += 32){
+
+		x = _mm256_loadu_si256((const __m256i*)(p+i));
+		m = _mm256_cmpeq_epi8(x,v[0]);
+
+		for(j = 1;j<set->nchars;j++)
+			m = _mm256_or_si256(m,_mm256_cmpeq_epi8(x,v[j]));
+
+		mask = _mm256_movemask_epi8(m);
+		if(mask)
+			return i+__builtin_ctz((unsigned)mask);
+	}
+
+	return i+_find_any_sse2(p+i,len-i,set);
+}
+#endif
+
+#ifdef __SSE2__
+/*
+ * xm_byteset_space has six bytes, too many for the scans above. They are
+ * ' ' and the range '\t' to '\r', which is one compare and one unsigned
+ * range check (SSE2 has no unsigned less-than, min does it).
+ */
+static inline unsigned _space_mask_sse2(const unsigned char *p){
+
+	__m128i x = _mm_loadu_si128((const __m128i*)p);
+	__m128i r = _mm_sub_epi8(x,_mm_set1_epi8('\t'));
+	__m128i m = _mm_cmpeq_epi8(_mm_min_epu8(r,_mm_set1_epi8('\r'-'\t')),r);
+
+	m = _mm_or_si128(m,_mm_cmpeq_epi8(x,_mm_set1_epi8(' ')));
+
+	return (unsigned)_mm_movemask_epi8(m);
+}
+
+/*to the first whitespace byte, or with flip 0xffff the first other one*/
+static size_t _find_space_sse2(const unsigned char *p,size_t len,unsigned flip){
+
+	size_t i;
+	unsigned mask;
+
+	for(i = 0;i+16<=len;i += 16){
+
+		mask = _space_mask_sse2(p+i)^flip;
+		if(mask)
+			return i+__builtin_ctz(mask);
+	}
+
+	return i;
+}
+
+/*the length without trailing whitespace, down to a tail under 16 bytes*/
+static size_t _rtrim_space_sse2(const unsigned char *p,size_t len){
+
+	unsigned mask;
+
+	while(len>=16){
+
+		mask = _space_mask_sse2(p+len-16)^0xffff;
+		if(mask)
+			return len-16+32-__builtin_clz(mask);
+
+		len -= 16;
+	}
+
+	return len;
+}
+#endif
+
+static size_t _find_any_resolve(const unsigned char *p,size_t len,const xm_byteset_t *set);
+
+static xm_cpu_fn_t find_any_slot = (xm_cpu_fn_t)_find_any_resolve;
+
+static const xm_cpu_impl_t find_any_impls[] = {
+
+	{XM_CPU_SCALAR,(xm_cpu_fn_t)_find_any_scalar},
+#ifdef __SSE2__
+	{XM_CPU_SSE2,(xm_cpu_fn_t)_find_any_sse2},
+	{XM_CPU_SSE42,(xm_cpu_fn_t)_find_any_sse42},
+	{XM_CPU_AVX2,(xm_cpu_fn_t)_find_any_avx2},
+#endif
+};
+
+static volatile size_t find_any_sink;
+
+/*a query string, split on "&="*/
+static void _find_any_bench(xm_cpu_fn_t fn,unsigned n){
+
+	static const char q[] = "id=12345&name=some+user+with+a+long+name&lang=en&theme=dark"
+		"&page=7&sort=desc&q=%22a+quoted+search+phrase%22&ref=home&utm_source=newsletter";
+	xm_byteset_t set;
+	size_t i,r;
+
+	xm_byteset_init(&set,"&=");
+
+	while(n--){
+
+		for(i = 0;i<sizeof(q)-1;i += r+1){
+
+			r = ((find_any_fn)fn)((const unsigned char*)q+i,sizeof(q)-1-i,&set);
+
+			/*the tail too, or the simd scans would be timed on less work*/
+			while(i+r<sizeof(q)-1&&!xm_byteset_has(&set,q[i+r]))
+				r++;
+		}
+
+		find_any_sink = i;
+	}
+}
+
+static xm_cpu_kernel_t find_any_kernel = {
+	"str_find_any",&find_any_slot,(xm_cpu_fn_t)_find_any_resolve,
+	find_any_impls,XM_CPU_NIMPLS(find_any_impls),_find_any_bench,NULL,0,0
+};
+
+static size_t _find_any_resolve(const unsigned char *p,size_t len,const xm_byteset_t *set){
+
+	return ((find_any_fn)xm_cpu_resolve(&find_any_kernel))(p,len,set);
+}
+
+ssize_t xm_str_find_any(const xm_str_t *s,const xm_byteset_t *set){
+
+	const unsigned char *p = s->data;
+	size_t i = 0;
+
+	if(set->nchars == 1)
+		return xm_str_find_byte(s,set->chars[0]);
+
+#ifdef __SSE2__
+	if(s->len>=16&&set == &xm_byteset_space)
+		i = _find_space_sse2(p,s->len,0);
+	else
+#endif
+	if(s->len>=16&&set->nchars>0&&set->nchars<=XM_BYTESET_SIMD_MAX){
+
+		/*stops at a hit or at the tail, the loop below settles both*/
+		i = ((find_any_fn)find_any_slot)(p,s->len,set);
+	}
+
+	for(;i<s->len;i++){
+
+		if(xm_byteset_has(set,p[i]))
+			return (ssize_t)i;
+	}
+
+	return -1;
+}
+
+ssize_t xm_str_find_not(const xm_str_t *s,const xm_byteset_t *set){
+
+	size_t i = 0;
+
+#ifdef __SSE2__
+	if(s->len>=16&&set == &xm_byteset_space)
+		i = _find_space_sse2(s->data,s->len,0xffff);
+#endif
+
+	for(;i<s->len;i++){
+
+		if(!xm_byteset_has(set,s->data[i]))
+			return (ssize_t)i;
+	}
+
+	return -1;
+}
+
+ssize_t xm_str_find(const xm_str_t *s,const xm_str_t *needle){
+
+	const unsigned char *p = s->data,*last,*hit;
+
+	if(needle->len == 0)
+		return 0;
+
+	if(needle->len>s->len)
+		return -1;
+
+	/*only positions where the whole needle still fits*/
+	last = s->data+s->len-needle->len+1;
+
+	while(p<last){
+
+		hit = (const unsigned char*)memchr(p,needle->data[0],last-p);
+		if(hit == NULL)
+			break;
+
+		if(memcmp(hit+1,needle->data+1,needle->len-1) == 0)
+			return hit-s->data;
+
+		p = hit+1;
+	}
+
+	return -1;
+}
+
+void xm_str_ltrim(xm_str_t *s){
+
+	ssize_t off = xm_str_find_not(s,&xm_byteset_space);
+
+	xm_str_advance(s,off<0?s->len:(size_t)off);
+}
+
+void xm_str_rtrim(xm_str_t *s){
+
+#ifdef __SSE2__
+	s->len = _rtrim_space_sse2(s->data,s->len);
+#endif
+
+	while(s->len&&xm_byteset_has(&xm_byteset_space,s->data[s->len-1]))
+		s->len--;
+}
+
+int xm_str_next_token(xm_str_t *rest,const xm_byteset_t *set,xm_str_t *tok){
+
+	ssize_t off = xm_str_find_not(rest,set);
+
+	if(off<0){
+
+		xm_str_advance(rest,rest->len);
+		return 0;
+	}
+
+	xm_str_advance(rest,off);
+
+	off = xm_str_find_any(rest,set);
+	if(off<0)
+		off = rest->len;
+
+	xm_str_set(tok,rest->data,off);
+
+	/*step over the delimiter that ended the token*/
+	xm_str_advance(rest,off+1);
+
+	return 1;
+}
+
+int xm_str_split(const xm_str_t *s,char delim,xm_str_t *toks,int max){
+
+	xm_str_t rest = *s;
+	ssize_t off;
+	int n = 0;
+
+	if(max<=0)
+		return 0;
+
+	while(n<max-1){
+
+		off = xm_str_find_byte(&rest,(unsigned char)delim);
+		if(off<0)
+			break;
+
+		xm_str_set(&toks[n++],rest.data,off);
+		xm_str_advance(&rest,off+1);
+	}
+
+	toks[n++] = rest;
+
+	return n;
+}
+
+int xm_str_casecmp(const xm_str_t *a,const xm_str_t *b){
+
+	size_t i,n = a->len<b->len?a->len:b->len;
+	int d;
+
+	for(i = 0;i<n;i++){
+
+		d = (int)_lower(a->data[i])-(int)_lower(b->data[i]);
+		if(d)
+			return d;
+	}
+
+	return a->len<b->len?-1:(a->len>b->len);
+}
+
+int xm_str_caseeq_cstr(const xm_str_t *s,const char *cs){
+
+	const unsigned char *p = (const unsigned char*)cs;
+	size_t i;
+
+	for(i = 0;i<s->len;i++){
+
+		if(p[i] == '\0'||_lower(s->data[i]) != _lower(p[i]))
+			return 0;
+	}
+
+	return p[i] == '\0';
+}
+
+int xm_str_to_u64(const xm_str_t *s,uint64_t *v){
+
+	uint64_t r = 0;
+	unsigned d;
+	size_t i;
+
+	if(s->len == 0)
+		return -1;
+
+	for(i = 0;i<s->len;i++){
+
+		d = (unsigned)s->data[i]-'0';
+		if(d>9)
+			return -1;
+
+		if(r>(UINT64_MAX-d)/10)
+			return -1;
+
+		r = r*10+d;
+	}
+
+	*v = r;
+
+	return 0;
+}
+
+int xm_str_to_i64(const xm_str_t *s,int64_t *v){
+
+	xm_str_t digits = *s;
+	uint64_t r;
+	int neg = 0;
+
+	if(digits.len&&(digits.data[0] == '-'||digits.data[0] == '+')){
+
+		neg = digits.data[0] == '-';
+		xm_str_advance(&digits,1);
+	}
+
+	if(xm_str_to_u64(&digits,&r))
+		return -1;
+
+	if(neg){
+
+		if(r>(uint64_t)INT64_MAX+1)
+			return -1;
+
+		*v = (int64_t)(0-r);
+	}
+	else{
+
+		if(r>(uint64_t)INT64_MAX)
+			return -1;
+
+		*v = (int64_t)r;
+	}
+
+	return 0;
+}
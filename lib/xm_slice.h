@@ -0,0 +1,140 @@
+/*
+ *
+ *      Filename: xm_slice.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: xm_str_t slices, parsing without copies or NULs
+ *        Create: 2026-10-18 18:41:20
+ * Last Modified: 2026-10-18 18:41:20
+ */
+
+#ifndef XM_SLICE_H
+#define XM_SLICE_H
+
+typedef struct xm_byteset_t xm_byteset_t;
+
+#include "xm_constants.h"
+#include "xm_string.h"
+
+/*sets up to this size are searched 16 bytes at a time*/
+#define XM_BYTESET_SIMD_MAX 4
+
+/**
+ * A set of delimiter bytes: a bitmap for the byte at a time scan and,
+ * for small sets, the bytes themselves for the SIMD scans.
+ */
+struct xm_byteset_t {
+
+	uint64_t bits[4];
+	uint8_t nchars;
+	uint8_t chars[XM_BYTESET_SIMD_MAX];
+};
+
+/*" \t\r\n\v\f", what isspace() accepts in the C locale, with an SSE2 scan of its own*/
+extern const xm_byteset_t xm_byteset_space;
+
+extern void xm_byteset_init(xm_byteset_t *set,const char *chars);
+
+static inline int xm_byteset_has(const xm_byteset_t *set,unsigned char c){
+
+	return (set->bits[c>>6]>>(c&63))&1;
+}
+
+static inline void xm_str_set(xm_str_t *s,const void *data,size_t len){
+
+	s->data = (unsigned char*)data;
+	s->len = len;
+}
+
+static inline void xm_str_from_cstr(xm_str_t *s,const char *cs){
+
+	xm_str_set(s,cs,strlen(cs));
+}
+
+/*the bytes after off*/
+static inline void xm_str_advance(xm_str_t *s,size_t off){
+
+	if(off>s->len)
+		off = s->len;
+
+	s->data += off;
+	s->len -= off;
+}
+
+/**
+ * Offset of the first byte of s in set, SSE2 over long inputs for sets
+ * of up to XM_BYTESET_SIMD_MAX bytes and for xm_byteset_space.
+ * @return The offset, or -1 if there is none
+ */
+extern ssize_t xm_str_find_any(const xm_str_t *s,const xm_byteset_t *set);
+
+/**
+ * Offset of the first byte of s not in set.
+ * @return The offset, or -1 if all bytes are in set
+ */
+extern ssize_t xm_str_find_not(const xm_str_t *s,const xm_byteset_t *set);
+
+static inline ssize_t xm_str_find_byte(const xm_str_t *s,int c){
+
+	const unsigned char *p = (const unsigned char*)memchr(s->data,c,s->len);
+
+	return p?p-s->data:-1;
+}
+
+/**
+ * Offset of the first occurrence of needle in s.
+ * @return The offset, or -1 if there is none
+ */
+extern ssize_t xm_str_find(const xm_str_t *s,const xm_str_t *needle);
+
+/*strip leading, trailing or both runs of whitespace*/
+extern void xm_str_ltrim(xm_str_t *s);
+extern void xm_str_rtrim(xm_str_t *s);
+
+static inline void xm_str_trim(xm_str_t *s){
+
+	xm_str_ltrim(s);
+	xm_str_rtrim(s);
+}
+
+/**
+ * Like xm_strtok: skip delimiters in rest, cut the token up to the next
+ * one, and leave rest just after it. Nothing is written to the input.
+ * @return 1 if a token was found, 0 at the end
+ */
+extern int xm_str_next_token(xm_str_t *rest,const xm_byteset_t *set,xm_str_t *tok);
+
+/**
+ * Split s at every delim, keeping empty fields. When there are more
+ * fields than max the last token holds the rest of s, delimiters and all.
+ * @return The number of tokens
+ */
+extern int xm_str_split(const xm_str_t *s,char delim,xm_str_t *toks,int max);
+
+/**
+ * Compare ASCII case-insensitively, like strcasecmp.
+ */
+extern int xm_str_casecmp(const xm_str_t *a,const xm_str_t *b);
+
+extern int xm_str_caseeq_cstr(const xm_str_t *s,const char *cs);
+
+static inline int xm_str_eq(const xm_str_t *a,const xm_str_t *b){
+
+	return a->len == b->len&&memcmp(a->data,b->data,a->len) == 0;
+}
+
+/**
+ * Parse the whole of s as a decimal number, an optional sign for the
+ * signed variant, no spaces.
+ * @return 0, or -1 if s is empty, holds other chars or overflows
+ */
+extern int xm_str_to_u64(const xm_str_t *s,uint64_t *v);
+extern int xm_str_to_i64(const xm_str_t *s,int64_t *v);
+
+/*a NUL terminated pool copy, for the few callers that keep a token*/
+static inline char *xm_str_pdup(xm_pool_t *mp,const xm_str_t *s){
+
+	return xm_pstrmemdup(mp,(const char*)s->data,s->len);
+}
+
+#endif /*XM_SLICE_H*/
@@ -0,0 +1,389 @@
+/*
+ *
+ *      Filename: xm_srcpool.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 14:21:50
+ * Last Modified: 2026-10-18 14:21:50
+ */
+
+#include "xm_srcpool.h"
+#include "xm_string.h"
+#include "xm_log.h"
+
+xm_srcpool_t *xm_srcpool_create(xm_pool_t *mp){
+
+	xm_srcpool_t *pool = (xm_srcpool_t*)xm_pcalloc(mp,sizeof(*pool));
+
+	if(pool == NULL)
+		return NULL;
+
+	pool->mp = mp;
+
+	pool->addrs = xm_array_make(mp,16,sizeof(xm_srcaddr_t));
+	pool->port_ranges = xm_array_make(mp,4,sizeof(xm_srcport_range_t));
+
+	if(pool->addrs == NULL||pool->port_ranges == NULL)
+		return NULL;
+
+	return pool;
+}
+
+int xm_srcpool_addr_add(xm_srcpool_t *pool,int family,const void *addr){
+
+	xm_srcaddr_t *sa;
+
+	if(family != AF_INET&&family != AF_INET6)
+		return -1;
+
+	if(pool->addrs->nelts>=XM_SRCPOOL_ADDR_MAX)
+		return -1;
+
+	sa = (xm_srcaddr_t*)xm_array_push(pool->addrs);
+	if(sa == NULL)
+		return -1;
+
+	xm_srcaddr_set(sa,family,addr);
+
+	return 0;
+}
+
+/*add count addresses starting at base, counting in the low 32 bits*/
+static int _addr_range_add(xm_srcpool_t *pool,int family,const uint8_t *base,uint64_t count){
+
+	uint8_t a[16];
+	size_t alen = family == AF_INET?4:16;
+	uint32_t low;
+	uint64_t i;
+
+	if(count == 0||count>XM_SRCPOOL_ADDR_MAX-(uint64_t)pool->addrs->nelts)
+		return -1;
+
+	memcpy(a,base,alen);
+	memcpy(&low,a+alen-4,4);
+	low = ntohl(low);
+
+	for(i = 0;i<count;i++){
+
+		uint32_t v = htonl(low+(uint32_t)i);
+
+		memcpy(a+alen-4,&v,4);
+
+		if(xm_srcpool_addr_add(pool,family,a))
+			return -1;
+	}
+
+	return 0;
+}
+
+int xm_srcpool_addr_parse(xm_srcpool_t *pool,const char *s){
+
+	char buf[INET6_ADDRSTRLEN+8];
+	char *sep,*end;
+	uint8_t a[16],b[16];
+	int family;
+	unsigned long plen;
+	uint32_t x,y,hbits;
+
+	if(strlen(s)>=sizeof(buf))
+		return -1;
+
+	strcpy(buf,s);
+
+	family = strchr(buf,':')?AF_INET6:AF_INET;
+
+	if((sep = strchr(buf,'/')) != NULL){
+
+		*sep++ = '\0';
+
+		plen = strtoul(sep,&end,10);
+		if(*sep == '\0'||*end != '\0'||plen>(family == AF_INET?32UL:128UL))
+			return -1;
+
+		if(inet_pton(family,buf,a) != 1)
+			return -1;
+
+		hbits = (family == AF_INET?32:128)-(uint32_t)plen;
+		if(hbits>16)
+			return -1;
+
+		/*clear the host bits, they all live in the last 4 bytes*/
+		memcpy(&x,a+(family == AF_INET?0:12),4);
+		x = ntohl(x);
+		x &= ~((1U<<hbits)-1);
+		x = htonl(x);
+		memcpy(a+(family == AF_INET?0:12),&x,4);
+
+		return _addr_range_add(pool,family,a,(uint64_t)1<<hbits);
+	}
+
+	if(family == AF_INET&&(sep = strchr(buf,'-')) != NULL){
+
+		*sep++ = '\0';
+
+		if(inet_pton(AF_INET,buf,a) != 1||inet_pton(AF_INET,sep,b) != 1)
+			return -1;
+
+		memcpy(&x,a,4);
+		memcpy(&y,b,4);
+		x = ntohl(x);
+		y = ntohl(y);
+
+		if(y<x)
+			return -1;
+
+		return _addr_range_add(pool,AF_INET,a,(uint64_t)y-x+1);
+	}
+
+	if(inet_pton(family,buf,a) != 1)
+		return -1;
+
+	return xm_srcpool_addr_add(pool,family,a);
+}
+
+int xm_srcpool_port_add(xm_srcpool_t *pool,uint16_t first,uint16_t last){
+
+	xm_srcport_range_t *r;
+
+	if(first == 0||last<first)
+		return -1;
+
+	r = (xm_srcport_range_t*)xm_array_push(pool->port_ranges);
+	if(r == NULL)
+		return -1;
+
+	r->first = first;
+	r->last = last;
+
+	return 0;
+}
+
+static int _ports_compile(xm_srcpool_t *pool){
+
+	const xm_srcport_range_t *r;
+	uint32_t p,n = 0;
+	int i;
+
+	if(pool->port_ranges->nelts == 0&&
+		xm_srcpool_port_add(pool,XM_SRCPOOL_PORT_FIRST,XM_SRCPOOL_PORT_LAST))
+		return -1;
+
+	memset(pool->port_bitmap,0,sizeof(pool->port_bitmap));
+
+	r = (const xm_srcport_range_t*)pool->port_ranges->elts;
+	for(i = 0;i<pool->port_ranges->nelts;i++){
+
+		for(p = r[i].first;p<=r[i].last;p++){
+
+			if(!(pool->port_bitmap[BIT_WORD(p)]&BIT_MASK(p))){
+
+				pool->port_bitmap[BIT_WORD(p)] |= BIT_MASK(p);
+				n++;
+			}
+		}
+	}
+
+	pool->ports = (uint16_t*)xm_palloc(pool->mp,n*sizeof(uint16_t));
+	if(pool->ports == NULL)
+		return -1;
+
+	/*keep the configured order, the bitmap only drops repeats*/
+	pool->port_num = 0;
+	for(i = 0;i<pool->port_ranges->nelts;i++){
+
+		for(p = r[i].first;p<=r[i].last;p++){
+
+			if(pool->port_bitmap[BIT_WORD(p)]&BIT_MASK(p)){
+
+				pool->ports[pool->port_num++] = (uint16_t)p;
+				pool->port_bitmap[BIT_WORD(p)] &= ~BIT_MASK(p);
+			}
+		}
+	}
+
+	for(p = 0;p<pool->port_num;p++)
+		pool->port_bitmap[BIT_WORD(pool->ports[p])] |= BIT_MASK(pool->ports[p]);
+
+	return 0;
+}
+
+static int _addrs_compile(xm_srcpool_t *pool){
+
+	xm_srcaddr_t *addrs = (xm_srcaddr_t*)pool->addrs->elts;
+	uint32_t size = 16,i,n = 0,slot,idx;
+
+	if(pool->addrs->nelts == 0)
+		return -1;
+
+	while(size<(uint32_t)pool->addrs->nelts*2)
+		size <<= 1;
+
+	pool->slots = (uint32_t*)xm_pcalloc(pool->mp,size*sizeof(uint32_t));
+	if(pool->slots == NULL)
+		return -1;
+
+	pool->slot_mask = size-1;
+
+	/*insert and compact in place, dropping duplicates*/
+	for(i = 0;i<(uint32_t)pool->addrs->nelts;i++){
+
+		for(slot = xm_jhash2(addrs[i].u.addr32,4,JHASH_INITVAL)&pool->slot_mask;;
+			slot = (slot+1)&pool->slot_mask){
+
+			idx = pool->slots[slot];
+
+			if(idx == 0){
+
+				addrs[n] = addrs[i];
+				pool->slots[slot] = ++n;
+				break;
+			}
+
+			if(memcmp(addrs[idx-1].u.addr8,addrs[i].u.addr8,16) == 0)
+				break;
+		}
+	}
+
+	pool->addrs->nelts = (int)n;
+
+	return 0;
+}
+
+int xm_srcpool_compile(xm_srcpool_t *pool){
+
+	if(_addrs_compile(pool)||_ports_compile(pool))
+		return -1;
+
+	return 0;
+}
+
+int xm_srcpool_thread_init(xm_srcpool_t *pool,xm_srcpool_thread_t *th,
+	uint32_t thread_id,uint32_t threads){
+
+	xm_srcaddr_t *addrs = (xm_srcaddr_t*)pool->addrs->elts;
+	uint32_t naddr = (uint32_t)pool->addrs->nelts;
+	uint32_t i,first,last;
+
+	if(threads == 0||thread_id>=threads||naddr == 0)
+		return -1;
+
+	memset(th,0,sizeof(*th));
+
+	if(naddr>=threads){
+
+		/*addresses are striped over the threads, every thread sees all ports*/
+		th->addr_num = (naddr-thread_id+threads-1)/threads;
+		th->ports = pool->ports;
+		th->port_num = pool->port_num;
+	}
+	else{
+
+		/*too few addresses: share them and split the ports instead*/
+		if(pool->port_num<threads)
+			return -1;
+
+		first = (uint32_t)((uint64_t)pool->port_num*thread_id/threads);
+		last = (uint32_t)((uint64_t)pool->port_num*(thread_id+1)/threads);
+
+		th->addr_num = naddr;
+		th->ports = pool->ports+first;
+		th->port_num = last-first;
+	}
+
+	th->addrs = (xm_srcaddr_t**)xm_palloc(pool->mp,th->addr_num*sizeof(xm_srcaddr_t*));
+	if(th->addrs == NULL)
+		return -1;
+
+	if(naddr>=threads){
+
+		for(i = 0;i<th->addr_num;i++)
+			th->addrs[i] = &addrs[thread_id+i*threads];
+	}
+	else{
+
+		for(i = 0;i<naddr;i++)
+			th->addrs[i] = &addrs[i];
+	}
+
+	return 0;
+}
+
+static const char *set_address(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_srcpool_t *pool = (xm_srcpool_t*)mconfig;
+
+	if(xm_srcpool_addr_parse(pool,w))
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad address '",w,
+			"' or more than 65536 addresses in the pool",NULL);
+
+	return NULL;
+}
+
+static const char *set_ports(cmd_parms *cmd,void *mconfig,const char *w){
+
+	xm_srcpool_t *pool = (xm_srcpool_t*)mconfig;
+	unsigned long first,last;
+	char *end;
+
+	first = strtoul(w,&end,10);
+	last = first;
+
+	if(*end == '-')
+		last = strtoul(end+1,&end,10);
+
+	if(*w == '\0'||*end != '\0'||first>65535||last>65535||
+		xm_srcpool_port_add(pool,(uint16_t)first,(uint16_t)last))
+		return xm_pstrcat(cmd->pool,cmd->cmd->name,": bad port range '",w,"'",NULL);
+
+	return NULL;
+}
+
+const command_rec xm_srcpool_cmds[] = {
+
+	XM_INIT_ITERATE("SourceAddress",set_address,NULL,0,
+		"source addresses: a.b.c.d, a.b.c.d-e.f.g.h, a.b.c.d/len, ipv6 or ipv6/len"),
+
+	XM_INIT_ITERATE("SourcePorts",set_ports,NULL,0,
+		"source ports: port or first-last"),
+
+	{NULL}
+};
+
+const char *xm_srcpool_load(xm_srcpool_t *pool,xm_pool_t *ptemp,const char *fname){
+
+	const char *err;
+
+	err = xm_process_command_config(xm_srcpool_cmds,pool,pool->mp,ptemp,fname);
+	if(err)
+		return err;
+
+	if(xm_srcpool_compile(pool))
+		return "No source address configured or no memory to compile source pool";
+
+	return NULL;
+}
+
+void xm_srcpool_dump(xm_srcpool_t *pool,FILE *fp){
+
+	const xm_srcaddr_t *addrs = (const xm_srcaddr_t*)pool->addrs->elts;
+	const xm_srcport_range_t *r = (const xm_srcport_range_t*)pool->port_ranges->elts;
+	char buf[INET6_ADDRSTRLEN];
+	int i;
+
+	fprintf(fp,"Dump source pool-------------------------------------------\n");
+	fprintf(fp,"addresses:%d,ports:%u\n",pool->addrs->nelts,pool->port_num);
+
+	for(i = 0;i<pool->addrs->nelts;i++){
+
+		if(addrs[i].family == AF_INET)
+			inet_ntop(AF_INET,&addrs[i].u.addr32[3],buf,sizeof(buf));
+		else
+			inet_ntop(AF_INET6,addrs[i].u.addr8,buf,sizeof(buf));
+
+		fprintf(fp,"    %s\n",buf);
+	}
+
+	for(i = 0;i<pool->port_ranges->nelts;i++)
+		fprintf(fp,"port range:%u-%u\n",r[i].first,r[i].last);
+}
@@ -0,0 +1,209 @@
+/*
+ *
+ *      Filename: xm_srcpool.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: source address and port rotation pools
+ *        Create: 2026-10-18 14:02:37
+ * Last Modified: 2026-10-18 14:02:37
+ */
+
+#ifndef XM_SRCPOOL_H
+#define XM_SRCPOOL_H
+
+typedef struct xm_srcpool_t xm_srcpool_t;
+typedef struct xm_srcaddr_t xm_srcaddr_t;
+typedef struct xm_srcport_range_t xm_srcport_range_t;
+typedef struct xm_srcpool_thread_t xm_srcpool_thread_t;
+
+#include <string.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "xm_mpool.h"
+#include "xm_tables.h"
+#include "xm_config.h"
+#include "xm_bitops.h"
+#include "xm_jhash.h"
+
+/*upper bound of addresses one pool may hold*/
+#define XM_SRCPOOL_ADDR_MAX 65536
+
+/*used when no SourcePorts directive is given*/
+#define XM_SRCPOOL_PORT_FIRST 32768
+#define XM_SRCPOOL_PORT_LAST  61000
+
+/**
+ * A source address, ipv4 is kept as an ipv4-mapped ipv6 address
+ * so both families share one key layout.
+ */
+struct xm_srcaddr_t {
+
+	union {
+		uint8_t  addr8[16];
+		uint32_t addr32[4];
+	}u;
+
+	int family;
+};
+
+struct xm_srcport_range_t {
+
+	uint16_t first;
+	uint16_t last;
+};
+
+struct xm_srcpool_t {
+
+	xm_pool_t *mp;
+
+	xm_array_header_t *addrs;
+	xm_array_header_t *port_ranges;
+
+	/*built by xm_srcpool_compile*/
+	uint16_t *ports;
+	uint32_t port_num;
+
+	/*open addressing set of addrs, slot holds index+1, 0 is empty*/
+	uint32_t *slots;
+	uint32_t slot_mask;
+
+	unsigned long port_bitmap[BITS_TO_LONGS(65536)];
+};
+
+/**
+ * Per sender thread view of the pool. A thread owns either a disjoint
+ * subset of the addresses (when there are at least as many addresses
+ * as threads) or a disjoint slice of the port list, so no two threads
+ * ever send from the same address and port.
+ */
+struct xm_srcpool_thread_t {
+
+	xm_srcaddr_t **addrs;
+	uint32_t addr_num;
+	uint32_t addr_cur;
+
+	const uint16_t *ports;
+	uint32_t port_num;
+	uint32_t port_cur;
+};
+
+/*config directives, mconfig must be the xm_srcpool_t*/
+extern const command_rec xm_srcpool_cmds[];
+
+extern xm_srcpool_t *xm_srcpool_create(xm_pool_t *mp);
+
+/**
+ * Add one address in network byte order, duplicates are dropped by
+ * xm_srcpool_compile.
+ * @return 0 on success, -1 on bad family or when the pool is full
+ */
+extern int xm_srcpool_addr_add(xm_srcpool_t *pool,int family,const void *addr);
+
+/**
+ * Add addresses from text: "192.0.2.1", "192.0.2.1-192.0.2.9",
+ * "192.0.2.0/28", "2001:db8::1" or "2001:db8::/120".
+ * @return 0 on success, -1 on syntax error or when the pool is full
+ */
+extern int xm_srcpool_addr_parse(xm_srcpool_t *pool,const char *s);
+
+/*add the ports first..last in host byte order*/
+extern int xm_srcpool_port_add(xm_srcpool_t *pool,uint16_t first,uint16_t last);
+
+/**
+ * Build the flat port list and the address set used for validation.
+ * Must be called after the last add and before xm_srcpool_thread_init.
+ * @return 0 on success, -1 when the pool is empty or out of memory
+ */
+extern int xm_srcpool_compile(xm_srcpool_t *pool);
+
+/**
+ * Load directives from a config file and compile the pool.
+ * @return NULL on success, otherwise the error message
+ */
+extern const char *xm_srcpool_load(xm_srcpool_t *pool,xm_pool_t *ptemp,const char *fname);
+
+/**
+ * Setup the view of thread thread_id out of threads.
+ * @return 0 on success, -1 when the pool cannot be split that many ways
+ */
+extern int xm_srcpool_thread_init(xm_srcpool_t *pool,xm_srcpool_thread_t *th,
+	uint32_t thread_id,uint32_t threads);
+
+extern void xm_srcpool_dump(xm_srcpool_t *pool,FILE *fp);
+
+/**
+ * Get the source for the next probe. Addresses rotate on every call,
+ * the port moves on once every address of the thread has been used.
+ * @param port receives the port in host byte order
+ */
+static inline const xm_srcaddr_t *xm_srcpool_next(xm_srcpool_thread_t *th,uint16_t *port){
+
+	const xm_srcaddr_t *a = th->addrs[th->addr_cur];
+
+	*port = th->ports[th->port_cur];
+
+	if(++th->addr_cur == th->addr_num){
+
+		th->addr_cur = 0;
+
+		if(++th->port_cur == th->port_num)
+			th->port_cur = 0;
+	}
+
+	return a;
+}
+
+static inline void xm_srcaddr_set(xm_srcaddr_t *sa,int family,const void *addr){
+
+	if(family == AF_INET){
+
+		sa->u.addr32[0] = 0;
+		sa->u.addr32[1] = 0;
+		sa->u.addr32[2] = htonl(0xffff);
+		memcpy(&sa->u.addr32[3],addr,4);
+	}
+	else{
+
+		memcpy(sa->u.addr8,addr,16);
+	}
+
+	sa->family = family;
+}
+
+static inline int xm_srcpool_port_match(const xm_srcpool_t *pool,uint16_t port){
+
+	return (pool->port_bitmap[BIT_WORD(port)]&BIT_MASK(port)) != 0;
+}
+
+/**
+ * Validate the destination of a response against the pool.
+ * @param addr the address in network byte order
+ * @param port the port in host byte order
+ * @return 1 if addr and port belong to the pool, otherwise 0
+ */
+static inline int xm_srcpool_match(const xm_srcpool_t *pool,int family,const void *addr,uint16_t port){
+
+	xm_srcaddr_t key;
+	const xm_srcaddr_t *addrs;
+	uint32_t i,idx;
+
+	if(!xm_srcpool_port_match(pool,port))
+		return 0;
+
+	xm_srcaddr_set(&key,family,addr);
+
+	addrs = (const xm_srcaddr_t*)pool->addrs->elts;
+
+	for(i = xm_jhash2(key.u.addr32,4,JHASH_INITVAL)&pool->slot_mask;;i = (i+1)&pool->slot_mask){
+
+		idx = pool->slots[i];
+		if(idx == 0)
+			return 0;
+
+		if(memcmp(addrs[idx-1].u.addr8,key.u.addr8,16) == 0)
+			return 1;
+	}
+}
+
+#endif /*XM_SRCPOOL_H*/
@@ -0,0 +1,255 @@
+/*
+ *
+ *      Filename: xm_stats.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 16:20:41
+ * Last Modified: 2026-10-18 16:20:41
+ */
+
+#include "xm_stats.h"
+#include "xm_atomic.h"
+#include "xm_string.h"
+#include "xm_errno.h"
+
+#define STATS_READ_TRIES 1000
+
+static uint64_t stats_clock_ns(clockid_t clk){
+
+	struct timespec ts;
+
+	clock_gettime(clk,&ts);
+
+	return (uint64_t)ts.tv_sec*1000000000ULL+(uint64_t)ts.tv_nsec;
+}
+
+xm_stats_t *xm_stats_create(xm_pool_t *mp,const char *app,uint32_t max){
+
+	xm_stats_t *st;
+
+	st = (xm_stats_t*)xm_pcalloc(mp,sizeof(*st));
+	if(st == NULL)
+		return NULL;
+
+	st->mp = mp;
+	st->app = app?xm_pstrdup(mp,app):"";
+	st->max = max;
+
+	st->descs = (xm_stats_desc_t*)xm_pcalloc(mp,max*sizeof(xm_stats_desc_t));
+	st->values = (uint64_t*)xm_pcalloc(mp,max*sizeof(uint64_t));
+
+	if(st->descs == NULL||st->values == NULL)
+		return NULL;
+
+	return st;
+}
+
+uint64_t *xm_stats_add(xm_stats_t *st,const char *name,const char *unit,uint32_t type){
+
+	xm_stats_desc_t *d;
+	uint32_t i;
+
+	for(i = 0;i<st->n;i++){
+
+		if(strncmp(st->descs[i].name,name,XM_STATS_NAME_MAX-1) == 0)
+			return &st->values[i];
+	}
+
+	if(st->n == st->max)
+		return NULL;
+
+	d = &st->descs[st->n];
+	xm_cpystrn(d->name,name,sizeof(d->name));
+	xm_cpystrn(d->unit,unit?unit:"",sizeof(d->unit));
+	d->type = type;
+
+	return &st->values[st->n++];
+}
+
+int xm_stats_shm_open(xm_stats_t *st,const char *name){
+
+	xm_stats_hdr_t *hdr;
+	size_t size;
+	int rv;
+
+	size = sizeof(xm_stats_hdr_t)+st->max*(sizeof(xm_stats_desc_t)+sizeof(uint64_t))+4096;
+
+	/*the name is this process's, a crashed run may have left it behind*/
+	xm_shm_remove(name);
+
+	rv = xm_shm_create(&st->shm,st->mp,name,size);
+	if(rv)
+		return rv;
+
+	hdr = (xm_stats_hdr_t*)xm_shm_calloc(st->shm,sizeof(*hdr));
+	if(hdr == NULL){
+
+		xm_stats_shm_close(st);
+		return XM_ENOSHMAVAIL;
+	}
+
+	hdr->descs = xm_shm_off(st->shm,xm_shm_calloc(st->shm,st->max*sizeof(xm_stats_desc_t)));
+	hdr->values = xm_shm_off(st->shm,xm_shm_calloc(st->shm,st->max*sizeof(uint64_t)));
+
+	if(hdr->descs == XM_SHM_NULL||hdr->values == XM_SHM_NULL){
+
+		xm_stats_shm_close(st);
+		return XM_ENOSHMAVAIL;
+	}
+
+	hdr->version = XM_STATS_VERSION;
+	hdr->hdr_size = sizeof(*hdr);
+	hdr->desc_size = sizeof(xm_stats_desc_t);
+	hdr->max = st->max;
+	hdr->pid = (int32_t)getpid();
+	hdr->start_ns = stats_clock_ns(CLOCK_REALTIME);
+	xm_cpystrn(hdr->app,st->app,sizeof(hdr->app));
+
+	xm_smp_wmb();
+	hdr->magic = XM_STATS_MAGIC;
+
+	st->hdr = hdr;
+	xm_shm_root_set(st->shm,hdr);
+
+	xm_stats_publish(st);
+
+	return 0;
+}
+
+void xm_stats_shm_close(xm_stats_t *st){
+
+	if(st->shm == NULL)
+		return;
+
+	xm_shm_remove(st->shm->name);
+	xm_shm_detach(st->shm);
+
+	st->shm = NULL;
+	st->hdr = NULL;
+}
+
+void xm_stats_publish(xm_stats_t *st){
+
+	xm_stats_hdr_t *hdr = st->hdr;
+	uint32_t n;
+
+	if(hdr == NULL)
+		return;
+
+	n = st->n;
+
+	hdr->seq++;
+	xm_smp_wmb();
+
+	/*descriptors are only ever added at the end*/
+	if(hdr->n != n)
+		memcpy(XM_SHM_PTR(st->shm,hdr->descs,xm_stats_desc_t)+hdr->n,st->descs+hdr->n,
+			(n-hdr->n)*sizeof(xm_stats_desc_t));
+
+	memcpy(XM_SHM_PTR(st->shm,hdr->values,uint64_t),st->values,n*sizeof(uint64_t));
+
+	hdr->n = n;
+	hdr->publish_ns = stats_clock_ns(CLOCK_MONOTONIC);
+	hdr->publishes++;
+
+	xm_smp_wmb();
+	hdr->seq++;
+}
+
+void xm_stats_dump(const xm_stats_t *st,FILE *fp){
+
+	uint32_t i;
+
+	for(i = 0;i<st->n;i++){
+
+		fprintf(fp,"%-40s %20llu %s\n",st->descs[i].name,
+			(unsigned long long)st->values[i],st->descs[i].unit);
+	}
+}
+
+int xm_stats_view_open(xm_stats_view_t **view,xm_pool_t *mp,const char *name){
+
+	const xm_stats_hdr_t *hdr;
+	xm_stats_view_t *v;
+	xm_shm_t *shm;
+	int rv;
+
+	rv = xm_shm_attach(&shm,mp,name,XM_SHM_F_RDONLY);
+	if(rv)
+		return rv;
+
+	hdr = (const xm_stats_hdr_t*)xm_shm_root(shm);
+
+	/*a newer writer may only have grown the structs*/
+	if(hdr == NULL||hdr->magic != XM_STATS_MAGIC||hdr->version != XM_STATS_VERSION||
+		hdr->hdr_size<sizeof(xm_stats_hdr_t)||hdr->desc_size<sizeof(xm_stats_desc_t)){
+
+		xm_shm_detach(shm);
+		return EINVAL;
+	}
+
+	v = (xm_stats_view_t*)xm_pcalloc(mp,sizeof(*v));
+	if(v == NULL){
+
+		xm_shm_detach(shm);
+		return ENOMEM;
+	}
+
+	v->values = (uint64_t*)xm_pcalloc(mp,hdr->max*sizeof(uint64_t));
+	if(v->values == NULL){
+
+		xm_shm_detach(shm);
+		return ENOMEM;
+	}
+
+	v->shm = shm;
+	v->hdr = hdr;
+	v->descs = XM_SHM_PTR(shm,hdr->descs,const xm_stats_desc_t);
+
+	*view = v;
+
+	/*a writer stuck in a publish still lets the view open, empty*/
+	xm_stats_view_read(v);
+
+	return 0;
+}
+
+int xm_stats_view_read(xm_stats_view_t *view){
+
+	const xm_stats_hdr_t *hdr = view->hdr;
+	const uint64_t *values = XM_SHM_PTR(view->shm,hdr->values,const uint64_t);
+	uint32_t seq,n;
+	uint64_t publish_ns;
+	int tries;
+
+	for(tries = 0;tries<STATS_READ_TRIES;tries++){
+
+		seq = hdr->seq;
+		if(seq&1){
+
+			sched_yield();
+			continue;
+		}
+
+		xm_smp_rmb();
+
+		n = hdr->n;
+		if(n>hdr->max)
+			n = hdr->max;
+
+		publish_ns = hdr->publish_ns;
+		memcpy(view->values,values,n*sizeof(uint64_t));
+
+		xm_smp_rmb();
+
+		if(hdr->seq == seq){
+
+			view->n = n;
+			view->publish_ns = publish_ns;
+			return 0;
+		}
+	}
+
+	return EAGAIN;
+}
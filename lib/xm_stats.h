@@ -0,0 +1,165 @@
+/*
+ *
+ *      Filename: xm_stats.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: counters and gauges, optionally published in shared memory
+ *        Create: 2026-10-18 16:20:41
+ * Last Modified: 2026-10-18 16:20:41
+ */
+
+#ifndef XM_STATS_H
+#define XM_STATS_H
+
+typedef struct xm_stats_t xm_stats_t;
+typedef struct xm_stats_hdr_t xm_stats_hdr_t;
+typedef struct xm_stats_desc_t xm_stats_desc_t;
+typedef struct xm_stats_view_t xm_stats_view_t;
+
+#include "xm_constants.h"
+#include "xm_mpool.h"
+#include "xm_shm.h"
+
+#define XM_STATS_MAGIC 0x53545358    /*"XSTS"*/
+#define XM_STATS_VERSION 1
+
+#define XM_STATS_COUNTER 0           /*only goes up, readers show a rate*/
+#define XM_STATS_GAUGE   1
+
+#define XM_STATS_NAME_MAX 48
+
+/**
+ * The layout in the segment, the root of an xm_shm segment. A reader
+ * finds its way by the sizes and offsets here, so a later version may
+ * grow the header and the descriptors at their ends.
+ *
+ * seq is a seqlock: odd while xm_stats_publish copies the values in,
+ * a snapshot is good when it saw the same even seq before and after.
+ */
+struct xm_stats_hdr_t {
+
+	uint32_t magic;
+	uint32_t version;
+	uint32_t hdr_size;
+	uint32_t desc_size;
+
+	volatile uint32_t seq;
+	uint32_t max;
+	volatile uint32_t n;        /*the descriptors in use, changes under seq*/
+	int32_t pid;
+
+	char app[32];
+
+	uint64_t start_ns;          /*CLOCK_REALTIME*/
+	volatile uint64_t publish_ns; /*CLOCK_MONOTONIC, for rates and staleness*/
+	uint64_t publishes;
+
+	xm_shm_off_t descs;
+	xm_shm_off_t values;
+};
+
+struct xm_stats_desc_t {
+
+	char name[XM_STATS_NAME_MAX];
+	char unit[8];               /*"pkts", "bytes", ... or empty*/
+	uint32_t type;
+	uint32_t flags;
+};
+
+/**
+ * The writer's side. The values live in process memory, the hot path
+ * updates them there and never touches the segment; xm_stats_publish
+ * copies them out. One thread publishes.
+ */
+struct xm_stats_t {
+
+	xm_pool_t *mp;
+
+	const char *app;
+	uint32_t max;
+	uint32_t n;
+
+	xm_stats_desc_t *descs;
+	uint64_t *values;
+
+	/*NULL until xm_stats_shm_open*/
+	xm_shm_t *shm;
+	xm_stats_hdr_t *hdr;
+};
+
+/*the reader's side of a segment*/
+struct xm_stats_view_t {
+
+	xm_shm_t *shm;
+	const xm_stats_hdr_t *hdr;
+	const xm_stats_desc_t *descs;
+
+	/*the last good snapshot*/
+	uint32_t n;
+	uint64_t publish_ns;
+	uint64_t *values;
+};
+
+/**
+ * Make room for max counters and gauges. app names the process for
+ * the readers, e.g. "scan" or "proxy".
+ * @return NULL when out of memory
+ */
+extern xm_stats_t *xm_stats_create(xm_pool_t *mp,const char *app,uint32_t max);
+
+/**
+ * Add a counter or gauge and return its value slot. Update it however
+ * suits the callers: a plain add from one thread, an atomic add from
+ * several. A name already added returns the same slot.
+ * @return NULL when all max are taken
+ */
+extern uint64_t *xm_stats_add(xm_stats_t *st,const char *name,const char *unit,uint32_t type);
+
+static inline uint64_t *xm_stats_counter(xm_stats_t *st,const char *name,const char *unit){
+
+	return xm_stats_add(st,name,unit,XM_STATS_COUNTER);
+}
+
+static inline uint64_t *xm_stats_gauge(xm_stats_t *st,const char *name,const char *unit){
+
+	return xm_stats_add(st,name,unit,XM_STATS_GAUGE);
+}
+
+/**
+ * Publish the stats in the POSIX shm segment name from now on. A
+ * segment left by an earlier run under that name is removed first.
+ * @return 0 or the error of xm_shm_create
+ */
+extern int xm_stats_shm_open(xm_stats_t *st,const char *name);
+
+/*remove the name; readers attached keep their mapping*/
+extern void xm_stats_shm_close(xm_stats_t *st);
+
+/**
+ * Copy the values into the segment under the seqlock, from a timer or
+ * the main loop. Without a segment it does nothing.
+ */
+extern void xm_stats_publish(xm_stats_t *st);
+
+extern void xm_stats_dump(const xm_stats_t *st,FILE *fp);
+
+/**
+ * Map the segment name read only: a reader never writes to it and the
+ * process it watches cannot tell it is there.
+ * @return 0, EINVAL for a segment of another layout, or an errno
+ */
+extern int xm_stats_view_open(xm_stats_view_t **view,xm_pool_t *mp,const char *name);
+
+/**
+ * Take a consistent copy of the values into view->values.
+ * @return 0, or EAGAIN when the writer stayed in a publish, e.g. it
+ * died there, and view keeps the last snapshot
+ */
+extern int xm_stats_view_read(xm_stats_view_t *view);
+
+static inline const xm_stats_desc_t *xm_stats_view_desc(const xm_stats_view_t *view,uint32_t i){
+
+	return (const xm_stats_desc_t*)((const char*)view->descs+(size_t)i*view->hdr->desc_size);
+}
+
+#endif /*XM_STATS_H*/
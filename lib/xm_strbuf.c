@@ -0,0 +1,168 @@
+/*
+ *
+ *      Filename: xm_strbuf.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 18:10:05
+ * Last Modified: 2026-10-18 18:10:05
+ */
+
+#include "xm_strbuf.h"
+
+/*claim the whole free tail of blk for the text*/
+static inline void _tail_claim(xm_strbuf_t *sb,xm_pool_t *blk){
+
+	sb->blk = blk;
+	sb->start = (char*)blk->d.last;
+	sb->pos = sb->start;
+	sb->end = (char*)blk->d.end-1;
+
+	blk->d.last = blk->d.end;
+}
+
+int xm_strbuf_init(xm_strbuf_t *sb,xm_pool_t *pool,size_t hint){
+
+	xm_pool_t *blk;
+
+	sb->pool = pool;
+	sb->failed = 0;
+
+	if(hint<XM_STRBUF_MIN_SIZE)
+		hint = XM_STRBUF_MIN_SIZE;
+
+	blk = xm_pool_tail_block(pool,hint+1);
+
+	if(blk){
+
+		_tail_claim(sb,blk);
+		return 0;
+	}
+
+	sb->blk = NULL;
+	sb->start = (char*)xm_pnalloc(pool,hint+1);
+
+	if(sb->start == NULL){
+
+		sb->pos = sb->end = NULL;
+		sb->failed = 1;
+		return -1;
+	}
+
+	sb->pos = sb->start;
+	sb->end = sb->start+hint;
+
+	return 0;
+}
+
+int xm_strbuf_grow(xm_strbuf_t *sb,size_t n){
+
+	size_t used,size;
+	xm_pool_t *blk = NULL;
+	char *mem;
+
+	if(sb->failed)
+		return -1;
+
+	used = sb->pos-sb->start;
+	size = 2*(sb->end-sb->start+1);
+
+	if(size<used+n+1)
+		size = used+n+1;
+
+	/*a new block has room for twice the text, the claimed one does not*/
+	if(size<=sb->pool->max)
+		blk = xm_pool_tail_block(sb->pool,size);
+
+	if(blk){
+
+		mem = (char*)blk->d.last;
+		memcpy(mem,sb->start,used);
+
+		if(sb->blk)
+			sb->blk->d.last = sb->start;
+
+		_tail_claim(sb,blk);
+		sb->pos = mem+used;
+
+		return 0;
+	}
+
+	mem = (char*)xm_pnalloc(sb->pool,size);
+	if(mem == NULL){
+
+		sb->failed = 1;
+		return -1;
+	}
+
+	memcpy(mem,sb->start,used);
+
+	/*give back the claimed tail, or the outgrown large buffer*/
+	if(sb->blk)
+		sb->blk->d.last = sb->start;
+	else
+		xm_pfree(sb->pool,sb->start);
+
+	sb->blk = NULL;
+	sb->start = mem;
+	sb->pos = mem+used;
+	sb->end = mem+size-1;
+
+	return 0;
+}
+
+char *xm_strbuf_finish(xm_strbuf_t *sb,size_t *len){
+
+	if(sb->failed){
+
+		/*nothing is kept, but the tail claim must not outlive the builder*/
+		if(sb->blk)
+			sb->blk->d.last = sb->start;
+
+		return NULL;
+	}
+
+	*sb->pos = '\0';
+
+	if(sb->blk)
+		sb->blk->d.last = sb->pos+1;
+
+	if(len)
+		*len = sb->pos-sb->start;
+
+	sb->blk = NULL;
+
+	return sb->start;
+}
+
+int xm_strbuf_append_escaped(xm_strbuf_t *sb,const char *s,size_t len){
+
+	const unsigned char *p = (const unsigned char*)s,*last = p+len;
+	const unsigned char *run;
+	unsigned char c;
+
+	while(p<last){
+
+		/*copy runs of plain chars in one go*/
+		run = p;
+		while(p<last&&*p != '"'&&*p != '\\'&&*p>0x1f&&*p<0x7f)
+			p++;
+
+		if(p>run&&xm_strbuf_append(sb,(const char*)run,p-run))
+			return -1;
+
+		if(p == last)
+			break;
+
+		if(xm_strbuf_reserve(sb,4))
+			return -1;
+
+		c = *p++;
+		sb->pos[0] = '\\';
+		sb->pos[1] = 'x';
+		xm_c2x(c,(unsigned char*)sb->pos+2);
+		sb->pos += 4;
+	}
+
+	return 0;
+}
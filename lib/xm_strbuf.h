@@ -0,0 +1,146 @@
+/*
+ *
+ *      Filename: xm_strbuf.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: string builder growing at a pool block tail
+ *        Create: 2026-10-18 18:02:37
+ * Last Modified: 2026-10-18 18:02:37
+ */
+
+#ifndef XM_STRBUF_H
+#define XM_STRBUF_H
+
+typedef struct xm_strbuf_t xm_strbuf_t;
+
+#include "xm_constants.h"
+#include "xm_mpool.h"
+#include "xm_string.h"
+#include "xm_numfmt.h"
+
+#define XM_STRBUF_MIN_SIZE 128
+
+/**
+ * A string built in place at the tail of a pool block. The builder
+ * claims the whole free tail while it is open, so the pool can still be
+ * used for other allocations meanwhile; xm_strbuf_finish gives back what
+ * was not written. When the tail is too small the text moves to a block
+ * or large allocation with twice the room, so n appends cost O(n).
+ */
+struct xm_strbuf_t {
+
+	xm_pool_t *pool;
+
+	/*block whose tail holds the text, NULL once it moved to a large allocation*/
+	xm_pool_t *blk;
+
+	char *start;
+	char *pos;
+
+	/*last usable byte, one is always kept for the NUL*/
+	char *end;
+
+	int failed;
+};
+
+/**
+ * Open a builder with room for at least hint chars.
+ * @return 0, or -1 if no memory
+ */
+extern int xm_strbuf_init(xm_strbuf_t *sb,xm_pool_t *pool,size_t hint);
+
+/**
+ * Make room for n more chars. Used by the appenders, which only
+ * call it when the room left is too small.
+ * @return 0, or -1 if no memory, the builder is then marked failed
+ */
+extern int xm_strbuf_grow(xm_strbuf_t *sb,size_t n);
+
+/**
+ * Close the builder, the text stays where it was written.
+ * @param len The text length if not NULL
+ * @return The NUL terminated text, or NULL if an append failed
+ */
+extern char *xm_strbuf_finish(xm_strbuf_t *sb,size_t *len);
+
+/**
+ * Append s with '"', '\\', control and non ASCII chars written as
+ * \xHH, like xm_log_escape_hex.
+ */
+extern int xm_strbuf_append_escaped(xm_strbuf_t *sb,const char *s,size_t len);
+
+static inline size_t xm_strbuf_len(const xm_strbuf_t *sb){
+
+	return sb->pos-sb->start;
+}
+
+static inline int xm_strbuf_reserve(xm_strbuf_t *sb,size_t n){
+
+	if((size_t)(sb->end-sb->pos)>=n)
+		return 0;
+
+	return xm_strbuf_grow(sb,n);
+}
+
+static inline int xm_strbuf_append(xm_strbuf_t *sb,const char *s,size_t len){
+
+	if(xm_strbuf_reserve(sb,len))
+		return -1;
+
+	memcpy(sb->pos,s,len);
+	sb->pos += len;
+
+	return 0;
+}
+
+static inline int xm_strbuf_append_str(xm_strbuf_t *sb,const char *s){
+
+	return xm_strbuf_append(sb,s,strlen(s));
+}
+
+static inline int xm_strbuf_append_slice(xm_strbuf_t *sb,const xm_str_t *s){
+
+	return xm_strbuf_append(sb,(const char*)s->data,s->len);
+}
+
+static inline int xm_strbuf_append_char(xm_strbuf_t *sb,char c){
+
+	if(xm_strbuf_reserve(sb,1))
+		return -1;
+
+	*sb->pos++ = c;
+
+	return 0;
+}
+
+static inline int xm_strbuf_append_u64(xm_strbuf_t *sb,uint64_t v){
+
+	if(xm_strbuf_reserve(sb,XM_I64_DEC_MAX))
+		return -1;
+
+	sb->pos += xm_u64_to_dec(sb->pos,v);
+
+	return 0;
+}
+
+static inline int xm_strbuf_append_i64(xm_strbuf_t *sb,int64_t v){
+
+	if(xm_strbuf_reserve(sb,XM_I64_DEC_MAX))
+		return -1;
+
+	sb->pos += xm_i64_to_dec(sb->pos,v);
+
+	return 0;
+}
+
+static inline int xm_strbuf_append_double(xm_strbuf_t *sb,double v){
+
+	if(xm_strbuf_reserve(sb,XM_DTOA_BUF_SIZE))
+		return -1;
+
+	sb->pos += xm_dtoa(v,sb->pos);
+
+	return 0;
+}
+
+#endif /*XM_STRBUF_H*/
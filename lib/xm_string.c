@@ -9,6 +9,7 @@
  */
 
 #include "xm_string.h"
+#include "xm_numfmt.h"
 
 /** this is used to cache lengths in xm_pstrcat */
 #define MAX_SAVED_LENGTHS  6
@@ -178,76 +179,34 @@ int64_t xm_atoi64(const char *buf)
     return xm_strtoi64(buf, NULL, 10);
 }
 
-char * xm_itoa(xm_pool_t *p, int n)
+/* the digits are counted first so the result is allocated to size */
+static char *_i64toa(xm_pool_t *p, int64_t n)
 {
-    const int BUFFER_SIZE = sizeof(int) * 3 + 2;
-    char *buf = xm_palloc(p, BUFFER_SIZE);
-    char *start = buf + BUFFER_SIZE - 1;
-    int negative;
-    if (n < 0) {
-	negative = 1;
-	n = -n;
-    }
-    else {
-	negative = 0;
-    }
-    *start = 0;
-    do {
-	*--start = '0' + (n % 10);
-	n /= 10;
-    } while (n);
-    if (negative) {
-	*--start = '-';
+    uint64_t mag = n < 0 ? (uint64_t)0 - (uint64_t)n : (uint64_t)n;
+    size_t len = (n < 0) + xm_dec_len_u64(mag);
+    char *buf = xm_pnalloc(p, len + 1);
+
+    if (buf == NULL) {
+        return NULL;
     }
-    return start;
+    xm_i64_to_dec(buf, n);
+    buf[len] = '\0';
+    return buf;
+}
+
+char * xm_itoa(xm_pool_t *p, int n)
+{
+    return _i64toa(p, n);
 }
 
 char * xm_ltoa(xm_pool_t *p, long n)
 {
-    const int BUFFER_SIZE = sizeof(long) * 3 + 2;
-    char *buf = xm_palloc(p, BUFFER_SIZE);
-    char *start = buf + BUFFER_SIZE - 1;
-    int negative;
-    if (n < 0) {
-	negative = 1;
-	n = -n;
-    }
-    else {
-	negative = 0;
-    }
-    *start = 0;
-    do {
-	*--start = (char)('0' + (n % 10));
-	n /= 10;
-    } while (n);
-    if (negative) {
-	*--start = '-';
-    }
-    return start;
+    return _i64toa(p, n);
 }
 
 char * off_t_toa(xm_pool_t *p, off_t n)
 {
-    const int BUFFER_SIZE = sizeof(off_t) * 3 + 2;
-    char *buf = xm_palloc(p, BUFFER_SIZE);
-    char *start = buf + BUFFER_SIZE - 1;
-    int negative;
-    if (n < 0) {
-	negative = 1;
-	n = -n;
-    }
-    else {
-	negative = 0;
-    }
-    *start = 0;
-    do {
-	*--start = '0' + (char)(n % 10);
-	n /= 10;
-    } while (n);
-    if (negative) {
-	*--start = '-';
-    }
-    return start;
+    return _i64toa(p, n);
 }
 
 char * xm_strfsize(off_t size, char *buf)
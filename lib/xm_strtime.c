@@ -9,6 +9,7 @@
  */
 
 #include "xm_time.h"
+#include "xm_errno.h"
 
 /* End System Headers */
 
@@ -70,6 +71,148 @@ int xm_rfc822_date(char *date_str, xm_time_t t)
     return 0;
 }
 
+static const char day_lnames[7][10] =
+{
+    "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday",
+    "Saturday"
+};
+
+static const int month_days[12] =
+{
+    31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+};
+
+/* "42" -> 42, anything but two digits -> -1 */
+static inline int date_2digit(const char *p)
+{
+    unsigned int h = (unsigned char)p[0] - '0';
+    unsigned int l = (unsigned char)p[1] - '0';
+
+    if (h > 9 || l > 9)
+        return -1;
+    return (int)(h * 10 + l);
+}
+
+static inline int date_month(const char *p)
+{
+    /* the three letters as one word, no loop over the names */
+    switch (((uint32_t)(unsigned char)p[0] << 16)
+            | ((uint32_t)(unsigned char)p[1] << 8)
+            | (unsigned char)p[2]) {
+    case 0x4a616e: return 0;        /* Jan */
+    case 0x466562: return 1;        /* Feb */
+    case 0x4d6172: return 2;        /* Mar */
+    case 0x417072: return 3;        /* Apr */
+    case 0x4d6179: return 4;        /* May */
+    case 0x4a756e: return 5;        /* Jun */
+    case 0x4a756c: return 6;        /* Jul */
+    case 0x417567: return 7;        /* Aug */
+    case 0x536570: return 8;        /* Sep */
+    case 0x4f6374: return 9;        /* Oct */
+    case 0x4e6f76: return 10;       /* Nov */
+    case 0x446563: return 11;       /* Dec */
+    }
+    return -1;
+}
+
+static int date_wday(const char *p, size_t len)
+{
+    int i;
+
+    for (i = 0; i < 7; i++) {
+        if (len == 3) {
+            if (memcmp(p, xm_day_snames[i], 3) == 0)
+                return i;
+        }
+        else if (len == strlen(day_lnames[i])
+                 && memcmp(p, day_lnames[i], len) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* "hh:mm:ss" into seconds of the day, -1 if malformed */
+static int date_hms(const char *p)
+{
+    int h = date_2digit(p);
+    int m = date_2digit(p + 3);
+    int s = date_2digit(p + 6);
+
+    if (p[2] != ':' || p[5] != ':'
+        || h < 0 || h > 23 || m < 0 || m > 59 || s < 0 || s > 60)
+        return -1;
+    return (h * 60 + m) * 60 + s;
+}
+
+static int date_make(xm_time_t *t, int year, int mon, int mday, int secs)
+{
+    int leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+
+    if (year < 0 || mon < 0 || secs < 0 || mday < 1
+        || mday > month_days[mon] + (mon == 1 && leap))
+        return XM_EBADDATE;
+
+    *t = (xm_time_days_from_civil(year, mon + 1, mday) * 86400 + secs)
+         * XM_USEC_PER_SEC;
+    return 0;
+}
+
+int xm_parse_http_date(xm_time_t *result, const char *s, size_t len)
+{
+    const char *p;
+    int year, mday;
+
+    /* "Sun, 06 Nov 1994 08:49:37 GMT", every field at a fixed place */
+    if (len == 29) {
+        if (s[3] != ',' || s[4] != ' ' || s[7] != ' ' || s[11] != ' '
+            || s[16] != ' ' || s[25] != ' ' || memcmp(s + 26, "GMT", 3)
+            || date_wday(s, 3) < 0
+            || date_2digit(s + 12) < 0 || date_2digit(s + 14) < 0)
+            return XM_EBADDATE;
+
+        year = date_2digit(s + 12) * 100 + date_2digit(s + 14);
+        return date_make(result, year, date_month(s + 8),
+                         date_2digit(s + 5), date_hms(s + 17));
+    }
+
+    /* "Sun Nov  6 08:49:37 1994" */
+    if (len == 24) {
+        if (s[3] != ' ' || s[7] != ' ' || s[10] != ' ' || s[19] != ' '
+            || date_wday(s, 3) < 0
+            || date_2digit(s + 20) < 0 || date_2digit(s + 22) < 0)
+            return XM_EBADDATE;
+
+        if (s[8] == ' ')
+            mday = (unsigned int)((unsigned char)s[9] - '0') <= 9
+                   ? s[9] - '0' : -1;
+        else
+            mday = date_2digit(s + 8);
+
+        year = date_2digit(s + 20) * 100 + date_2digit(s + 22);
+        return date_make(result, year, date_month(s + 4), mday,
+                         date_hms(s + 11));
+    }
+
+    /* "Sunday, 06-Nov-94 08:49:37 GMT", 24 bytes after the name */
+    p = len > 24 ? (const char *)memchr(s, ',', len - 23) : NULL;
+    if (p == NULL || (size_t)(p - s) + 24 != len)
+        return XM_EBADDATE;
+
+    if (p[1] != ' ' || p[4] != '-' || p[8] != '-' || p[11] != ' '
+        || p[20] != ' ' || memcmp(p + 21, "GMT", 3)
+        || date_wday(s, p - s) < 0)
+        return XM_EBADDATE;
+
+    year = date_2digit(p + 9);
+    if (year < 0)
+        return XM_EBADDATE;
+    year += year < 69 ? 2000 : 1900;
+
+    return date_make(result, year, date_month(p + 5), date_2digit(p + 2),
+                     date_hms(p + 12));
+}
+
 int xm_ctime(char *date_str, xm_time_t t)
 {
     xm_time_exp_t xt;
@@ -1208,3 +1208,119 @@ const char * xm_table_getm(xm_pool_t *p, const xm_table_t *t,
     }
 }
 
+
+/*****************************************************************
+ *
+ * Serialising tables
+ */
+
+const xm_table_sep_t xm_table_sep_headers = XM_TABLE_SEP_INIT(": ", "\n", "\n");
+
+ssize_t xm_table_serialize(const xm_array_header_t *arr,
+                           const xm_table_sep_t *sep,
+                           char *buf, size_t len)
+{
+    const xm_table_entry_t *te = (const xm_table_entry_t *)arr->elts;
+    size_t total = 0, klen, vlen, n;
+    char *d = buf;
+    int i;
+
+    for (i = 0; i < arr->nelts; i++) {
+        if (te[i].key == NULL) {
+            continue;
+        }
+
+        klen = strlen(te[i].key);
+        vlen = te[i].val ? strlen(te[i].val) : 0;
+        n = klen + sep->kv_len + vlen + sep->entry_len;
+        total += n;
+
+        if (buf == NULL) {
+            continue;
+        }
+        if (total > len) {
+            return -1;
+        }
+
+        memcpy(d, te[i].key, klen);
+        d += klen;
+        memcpy(d, sep->kv, sep->kv_len);
+        d += sep->kv_len;
+        memcpy(d, te[i].val, vlen);
+        d += vlen;
+        memcpy(d, sep->entry, sep->entry_len);
+        d += sep->entry_len;
+    }
+
+    total += sep->end_len;
+
+    if (buf != NULL) {
+        if (total > len) {
+            return -1;
+        }
+        memcpy(d, sep->end, sep->end_len);
+    }
+
+    return (ssize_t)total;
+}
+
+ssize_t xm_table_serialize_dout(const xm_array_header_t *arr,
+                                const xm_table_sep_t *sep,
+                                xm_data_output_t *dout)
+{
+    ssize_t total;
+
+    /* size and reserve first, so a failed grow leaves dout untouched */
+    total = xm_table_serialize(arr, sep, NULL, 0);
+
+    DOUT_CHECK(dout, (size_t)total);
+
+    xm_table_serialize(arr, sep, (char *)dout->pos, (size_t)total);
+    XM_DOUT_POS_UPDATE(dout, total);
+
+    return total;
+}
+
+int xm_table_iovec_count(const xm_array_header_t *arr,
+                         const xm_table_sep_t *sep)
+{
+    int per_entry = 2 + (sep->kv_len != 0) + (sep->entry_len != 0);
+
+    return arr->nelts * per_entry + (sep->end_len != 0);
+}
+
+#define IOV_ADD(iov, n, base, len)                  \
+    do {                                            \
+        if (len) {                                  \
+            (iov)[n].iov_base = (void *)(base);     \
+            (iov)[n].iov_len = (len);               \
+            n++;                                    \
+        }                                           \
+    } while (0)
+
+int xm_table_serialize_iovec(const xm_array_header_t *arr,
+                             const xm_table_sep_t *sep,
+                             struct iovec *iov, int iovcnt)
+{
+    const xm_table_entry_t *te = (const xm_table_entry_t *)arr->elts;
+    int i, n = 0;
+
+    if (iovcnt < xm_table_iovec_count(arr, sep)) {
+        return -1;
+    }
+
+    for (i = 0; i < arr->nelts; i++) {
+        if (te[i].key == NULL) {
+            continue;
+        }
+
+        IOV_ADD(iov, n, te[i].key, strlen(te[i].key));
+        IOV_ADD(iov, n, sep->kv, sep->kv_len);
+        IOV_ADD(iov, n, te[i].val, te[i].val ? strlen(te[i].val) : 0);
+        IOV_ADD(iov, n, sep->entry, sep->entry_len);
+    }
+
+    IOV_ADD(iov, n, sep->end, sep->end_len);
+
+    return n;
+}
@@ -22,7 +22,9 @@ typedef struct xm_array_header_t xm_array_header_t;
  */
 typedef struct xm_table_entry_t xm_table_entry_t;
 
+#include <sys/uio.h>
 #include "xm_mpool.h"
+#include "xm_data_output.h"
 
 /** An opaque array type */
 struct xm_array_header_t {
@@ -449,4 +451,59 @@ extern void xm_table_overlap(xm_table_t *a, const xm_table_t *b,
  */
 extern void xm_table_compress(xm_table_t *t, unsigned flags);
 
+/**
+ * Separators used to serialise a table: every entry is written as
+ * key, kv, value, entry and the whole table is followed by end.
+ */
+typedef struct {
+    const char *kv;
+    size_t kv_len;
+    const char *entry;
+    size_t entry_len;
+    const char *end;
+    size_t end_len;
+} xm_table_sep_t;
+
+#define XM_TABLE_SEP_INIT(kv, entry, end) \
+    { kv, sizeof(kv) - 1, entry, sizeof(entry) - 1, end, sizeof(end) - 1 }
+
+/** "key: value\n" lines and a blank line, as in a header block */
+extern const xm_table_sep_t xm_table_sep_headers;
+
+/**
+ * Serialise the entries of arr into buf. Each key and value is measured
+ * once and copied at a moving cursor; the result is not NUL terminated.
+ * @param buf The destination, or NULL to only compute the length
+ * @param len The size of buf
+ * @return The serialised length, or -1 if buf is too small
+ */
+extern ssize_t xm_table_serialize(const xm_array_header_t *arr,
+                                  const xm_table_sep_t *sep,
+                                  char *buf, size_t len);
+
+/**
+ * Append the serialised entries of arr to dout, growing it as needed.
+ * The length is measured and reserved before anything is written.
+ * @return The number of bytes appended, or -1 if dout cannot grow, in
+ * which case dout is left as it was
+ */
+extern ssize_t xm_table_serialize_dout(const xm_array_header_t *arr,
+                                       const xm_table_sep_t *sep,
+                                       xm_data_output_t *dout);
+
+/**
+ * The number of iovecs xm_table_serialize_iovec needs for arr.
+ */
+extern int xm_table_iovec_count(const xm_array_header_t *arr,
+                                const xm_table_sep_t *sep);
+
+/**
+ * Point iov at the keys, values and separators of arr without copying
+ * them, ready for writev. The table must outlive the iovecs.
+ * @return The number of iovecs filled, or -1 if iovcnt is too small
+ */
+extern int xm_table_serialize_iovec(const xm_array_header_t *arr,
+                                    const xm_table_sep_t *sep,
+                                    struct iovec *iov, int iovcnt);
+
 #endif /* XM_TABLES_H */
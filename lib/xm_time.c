@@ -12,23 +12,196 @@
 #include "xm_mpool.h"
 #include "xm_errno.h"
 
-#if !defined(HAVE_STRUCT_TM_TM_GMTOFF) && !defined(HAVE_STRUCT_TM___TM_GMTOFF)
-static int32_t server_gmt_offset;
-#define NO_GMTOFF_IN_STRUCT_TM
-#endif          
+#include "xm_spinlock.h"
+#include "xm_atomic.h"
 
-static int32_t get_offset(struct tm *tm)
+#define SECS_PER_DAY 86400
+
+/* Local time offsets are kept as windows [start,end) of UTC seconds over
+ * which the offset and the dst flag hold. A window is found with
+ * localtime_r once and then reused by every thread without locks until
+ * the time leaves it, normally at the next DST transition.
+ */
+#define TZ_SLOTS       8
+#define TZ_PROBE_STEP  (7 * SECS_PER_DAY)
+#define TZ_PROBES      8
+
+typedef struct {
+    volatile uint32_t seq;      /* odd while the slot is written */
+    int64_t start;
+    int64_t end;
+    int32_t offset;
+    int32_t isdst;
+} tz_window_t;
+
+static tz_window_t tz_windows[TZ_SLOTS];
+static unsigned int tz_next;
+static xm_spinlock_t tz_lock = RTE_SPINLOCK_INITIALIZER;
+
+static const int yday_offset[2][12] =
 {
-#if defined(HAVE_STRUCT_TM_TM_GMTOFF)
-    return tm->tm_gmtoff;
-#elif defined(HAVE_STRUCT_TM___TM_GMTOFF)
-    return tm->__tm_gmtoff;
-#else
+    {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334},
+    {0, 31, 60, 91, 121, 152, 182, 213, 244, 274, 305, 335}
+};
+
+static inline int is_leap(int64_t y)
+{
+    return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
+}
+
+/* Split seconds since the epoch, taken as already shifted to the wanted
+ * zone, into the calendar fields */
+static void explode_secs(xm_time_exp_t *xt, int64_t secs)
+{
+    int64_t days, rem, y;
+    int m, d;
+
+    days = secs / SECS_PER_DAY;
+    rem = secs % SECS_PER_DAY;
+    if (rem < 0) {
+        rem += SECS_PER_DAY;
+        days--;
+    }
+
+    xm_time_civil_from_days(days, &y, &m, &d);
+
+    xt->tm_sec  = (int32_t)(rem % 60);
+    xt->tm_min  = (int32_t)(rem / 60 % 60);
+    xt->tm_hour = (int32_t)(rem / 3600);
+    xt->tm_mday = d;
+    xt->tm_mon  = m - 1;
+    xt->tm_year = (int32_t)(y - 1900);
+    /* 1 Jan 1970 was a Thursday */
+    xt->tm_wday = (int32_t)((days % 7 + 11) % 7);
+    xt->tm_yday = yday_offset[is_leap(y)][m - 1] + d - 1;
+}
+
+/* The offset of tt in the local zone, straight from libc */
+static int tz_probe(int64_t tt, int32_t *offset, int32_t *isdst)
+{
+    struct tm tm;
+    time_t t = (time_t)tt;
+    int64_t local;
+
+    if (localtime_r(&t, &tm) == NULL)
+        return -1;
+
+    local = xm_time_days_from_civil((int64_t)tm.tm_year + 1900,
+                                    tm.tm_mon + 1, tm.tm_mday) * SECS_PER_DAY
+          + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+
+    *offset = (int32_t)(local - tt);
+    *isdst = tm.tm_isdst > 0;
+    return 0;
+}
+
+static inline int tz_same(int64_t tt, int32_t offset, int32_t isdst)
+{
+    int32_t o, dst;
+
+    return tz_probe(tt, &o, &dst) == 0 && o == offset && dst == isdst;
+}
+
+/* Walk from tt a week at a time towards dir until the offset changes,
+ * then bisect down to the second. Returns the last second that still has
+ * the offset of tt, or the end of the probed range. */
+static int64_t tz_edge(int64_t tt, int dir, int32_t offset, int32_t isdst)
+{
+    int64_t same = tt, diff, mid;
+    int i;
+
+    for (i = 1; i <= TZ_PROBES; i++) {
+        diff = tt + dir * i * (int64_t)TZ_PROBE_STEP;
+        if (!tz_same(diff, offset, isdst))
+            break;
+        same = diff;
+    }
+
+    if (i > TZ_PROBES)
+        return same;
+
+    while (same != diff + (dir > 0 ? -1 : 1)) {
+        mid = same + (diff - same) / 2;
+        if (tz_same(mid, offset, isdst))
+            same = mid;
+        else
+            diff = mid;
+    }
 
-    if (tm->tm_isdst)
-        return server_gmt_offset + 3600;
-    return server_gmt_offset;
-#endif
+    return same;
+}
+
+static int tz_lookup(int64_t tt, int32_t *offset, int32_t *isdst)
+{
+    tz_window_t *w;
+    uint32_t seq;
+    int64_t start, end;
+    int32_t o, dst;
+    int i;
+
+    for (i = 0; i < TZ_SLOTS; i++) {
+        w = &tz_windows[i];
+        seq = w->seq;
+        if (seq == 0 || (seq & 1))
+            continue;
+        xm_smp_rmb();
+        start = w->start;
+        end = w->end;
+        o = w->offset;
+        dst = w->isdst;
+        xm_smp_rmb();
+        if (w->seq != seq)
+            continue;
+        if (tt >= start && tt < end) {
+            *offset = o;
+            *isdst = dst;
+            return 0;
+        }
+    }
+
+    return -1;
+}
+
+static int tz_refresh(int64_t tt, int32_t *offset, int32_t *isdst)
+{
+    tz_window_t *w;
+    int64_t start, end;
+
+    if (tz_probe(tt, offset, isdst) != 0)
+        return -1;
+
+    start = tz_edge(tt, -1, *offset, *isdst);
+    end = tz_edge(tt, 1, *offset, *isdst) + 1;
+
+    xm_spinlock_lock(&tz_lock);
+    w = &tz_windows[tz_next++ % TZ_SLOTS];
+    w->seq++;
+    xm_smp_wmb();
+    w->start = start;
+    w->end = end;
+    w->offset = *offset;
+    w->isdst = *isdst;
+    xm_smp_wmb();
+    w->seq++;
+    xm_spinlock_unlock(&tz_lock);
+
+    return 0;
+}
+
+void xm_time_tz_reset(void)
+{
+    int i;
+
+    xm_spinlock_lock(&tz_lock);
+    tzset();
+    for (i = 0; i < TZ_SLOTS; i++) {
+        tz_windows[i].seq++;
+        xm_smp_wmb();
+        tz_windows[i].start = tz_windows[i].end = 0;
+        xm_smp_wmb();
+        tz_windows[i].seq++;
+    }
+    xm_spinlock_unlock(&tz_lock);
 }
 
 int xm_time_ansi_put(xm_time_t *result,
@@ -49,25 +222,22 @@ xm_time_t xm_time_now(void)
 static void explode_time(xm_time_exp_t *xt, xm_time_t t,
                          int32_t offset, int use_localtime)
 {
-    struct tm tm;
-    time_t tt = (t / XM_USEC_PER_SEC) + offset;
+    int64_t tt = (t / XM_USEC_PER_SEC) + offset;
+    int32_t isdst = 0;
+
     xt->tm_usec = t % XM_USEC_PER_SEC;
 
-    if (use_localtime)
-        tm = *localtime(&tt);
-    else
-        tm = *gmtime(&tt);
+    if (use_localtime
+        && tz_lookup(tt, &offset, &isdst) != 0
+        && tz_refresh(tt, &offset, &isdst) != 0) {
+        /* out of the range libc can convert, show it as GMT */
+        offset = 0;
+        isdst = 0;
+    }
 
-    xt->tm_sec  = tm.tm_sec;
-    xt->tm_min  = tm.tm_min;
-    xt->tm_hour = tm.tm_hour;
-    xt->tm_mday = tm.tm_mday;
-    xt->tm_mon  = tm.tm_mon;
-    xt->tm_year = tm.tm_year;
-    xt->tm_wday = tm.tm_wday;
-    xt->tm_yday = tm.tm_yday;
-    xt->tm_isdst = tm.tm_isdst;
-    xt->tm_gmtoff = get_offset(&tm);
+    explode_secs(xt, use_localtime ? tt + offset : tt);
+    xt->tm_isdst = isdst;
+    xt->tm_gmtoff = offset;
 }
 
 int xm_time_exp_tz(xm_time_exp_t *result,
@@ -98,21 +268,13 @@ int xm_time_exp_lt(xm_time_exp_t *result,
 
 int xm_time_exp_get(xm_time_t *t, xm_time_exp_t *xt)
 {
-    xm_time_t year = xt->tm_year;
     xm_time_t days;
-    static const int dayoffset[12] =
-    {306, 337, 0, 31, 61, 92, 122, 153, 184, 214, 245, 275};
-
-    /* shift new year to 1st March in order to make leap year calc easy */
 
-    if (xt->tm_mon < 2)
-        year--;
-
-    /* Find number of days since 1st March 1900 (in the Gregorian calendar). */
+    if (xt->tm_mon < 0 || xt->tm_mon > 11)
+        return XM_EBADDATE;
 
-    days = year * 365 + year / 4 - year / 100 + (year / 100 + 3) / 4;
-    days += dayoffset[xt->tm_mon] + xt->tm_mday - 1;
-    days -= 25508;              /* 1 jan 1970 is 25508 days since 1 mar 1900 */
+    days = xm_time_days_from_civil((int64_t)xt->tm_year + 1900,
+                                   xt->tm_mon + 1, xt->tm_mday);
     days = ((days * 24 + xt->tm_hour) * 60 + xt->tm_min) * 60 + xt->tm_sec;
 
     if (days < 0) {
@@ -144,47 +306,8 @@ void xm_sleep(xm_interval_time_t t)
 
 void xm_unix_setup_time(void)
 {
-#ifdef NO_GMTOFF_IN_STRUCT_TM
-    /* Precompute the offset from GMT on systems where it's not
-       in struct tm.
-
-       Note: This offset is normalized to be independent of daylight
-       savings time; if the calculation happens to be done in a
-       time/place where a daylight savings adjustment is in effect,
-       the returned offset has the same value that it would have
-       in the same location if daylight savings were not in effect.
-       The reason for this is that the returned offset can be
-       applied to a past or future timestamp in explode_time(),
-       so the DST adjustment obtained from the current time won't
-       necessarily be applicable.
-
-       mktime() is the inverse of localtime(); so, presumably,
-       passing in a struct tm made by gmtime() let's us calculate
-       the true GMT offset. However, there's a catch: if daylight
-       savings is in effect, gmtime()will set the tm_isdst field
-       and confuse mktime() into returning a time that's offset
-       by one hour. In that case, we must adjust the calculated GMT
-       offset.
-
-     */
-
-    struct timeval now;
-    time_t t1, t2;
-    struct tm t;
-
-    gettimeofday(&now, NULL);
-    t1 = now.tv_sec;
-    t2 = 0;
-
-#if XM_HAS_THREADS && defined(_POSIX_THREAD_SAFE_FUNCTIONS)
-    gmtime_r(&t1, &t);
-#else
-    t = *gmtime(&t1);
-#endif
-    t.tm_isdst = 0; /* we know this GMT time isn't daylight-savings */
-    t2 = mktime(&t);
-    server_gmt_offset = (int32_t) difftime(t1, t2);
-#endif /* NO_GMTOFF_IN_STRUCT_TM */
+    /* the offsets come from localtime_r, start over in case TZ moved */
+    xm_time_tz_reset();
 }
 
 
@@ -147,9 +147,54 @@ int xm_time_exp_get(xm_time_t *result,
  * @param result the resulting imploded time
  * @param input the input exploded time
  */
-int xm_time_exp_gmt_get(xm_time_t *result, 
+int xm_time_exp_gmt_get(xm_time_t *result,
                                                xm_time_exp_t *input);
 
+/**
+ * Days since 1 Jan 1970 of a proleptic Gregorian date, no libc involved.
+ * @param y the full year (2000, not 100)
+ * @param m the month, 1-12
+ * @param d the day of the month, 1-31
+ */
+static inline int64_t xm_time_days_from_civil(int64_t y, int m, int d)
+{
+    int64_t era, yoe, doy;
+
+    /* years start on 1st March so the leap day comes last */
+    y -= m <= 2;
+    era = (y >= 0 ? y : y - 399) / 400;
+    yoe = y - era * 400;
+    doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+
+    return era * 146097 + yoe * 365 + yoe / 4 - yoe / 100 + doy - 719468;
+}
+
+/**
+ * The inverse of xm_time_days_from_civil.
+ */
+static inline void xm_time_civil_from_days(int64_t days, int64_t *y,
+                                           int *m, int *d)
+{
+    int64_t era, doe, yoe, doy, mp;
+
+    days += 719468;
+    era = (days >= 0 ? days : days - 146096) / 146097;
+    doe = days - era * 146097;
+    yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    mp = (5 * doy + 2) / 153;
+
+    *d = (int)(doy - (153 * mp + 2) / 5 + 1);
+    *m = (int)(mp < 10 ? mp + 3 : mp - 9);
+    *y = yoe + era * 400 + (*m <= 2);
+}
+
+/**
+ * Forget the cached local time offsets, so xm_time_exp_lt picks up a
+ * changed TZ. Call it after setenv("TZ", ...) and tzset().
+ */
+void xm_time_tz_reset(void);
+
 /**
  * Sleep for the specified number of micro-seconds.
  * @param t desired amount of time to sleep.
@@ -169,6 +214,21 @@ void xm_sleep(xm_interval_time_t t);
  */
 int xm_rfc822_date(char *date_str, xm_time_t t);
 
+/**
+ * Parse an HTTP date, the inverse of xm_rfc822_date. The three forms
+ * of RFC 7231 are accepted, in GMT and case sensitive:
+ *   "Sun, 06 Nov 1994 08:49:37 GMT"   RFC 1123
+ *   "Sunday, 06-Nov-94 08:49:37 GMT"  RFC 850, years < 69 are 20xx
+ *   "Sun Nov  6 08:49:37 1994"        asctime, the day may be "06"
+ * Every field is range checked, the day against its month. The
+ * weekday must be a valid name but is not checked against the date.
+ * @param result the parsed time
+ * @param s the date, need not be NUL terminated
+ * @param len the length of s, nothing may follow the date
+ * @return 0, or XM_EBADDATE
+ */
+int xm_parse_http_date(xm_time_t *result, const char *s, size_t len);
+
 /** length of a CTIME date */
 #define XM_CTIME_LEN (25)
 /**
@@ -0,0 +1,328 @@
+/*
+ *
+ *      Filename: xm_trace.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 09:12:40
+ * Last Modified: 2026-10-18 09:12:40
+ */
+
+#include <semaphore.h>
+#include <sys/syscall.h>
+#include "xm_trace.h"
+#include "xm_spinlock.h"
+
+volatile int xm_trace_on;
+__thread xm_trace_buf_t *xm_trace_buf;
+
+static xm_trace_buf_t *trace_bufs;
+static int trace_nbufs;
+static xm_spinlock_t trace_lock = RTE_SPINLOCK_INITIALIZER;
+static size_t trace_nevents = XM_TRACE_EVENTS_DEFAULT;
+
+static pthread_key_t trace_key;
+static pthread_once_t trace_once = PTHREAD_ONCE_INIT;
+
+/*tsc and monotonic ns at the first enable*/
+static uint64_t trace_tsc0;
+static uint64_t trace_ns0;
+
+static sem_t trace_sem;
+static char *trace_path;
+
+static void trace_clock(uint64_t *tsc,uint64_t *ns){
+
+	struct timespec ts;
+
+	*tsc = xm_rdtsc();
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+	*ns = (uint64_t)ts.tv_sec*1000000000ULL+(uint64_t)ts.tv_nsec;
+}
+
+/*a thread exits: keep its events until the ring is recycled*/
+static void trace_buf_release(void *p){
+
+	((xm_trace_buf_t*)p)->free = 1;
+}
+
+static void trace_key_create(void){
+
+	pthread_key_create(&trace_key,trace_buf_release);
+}
+
+xm_trace_buf_t *xm_trace_buf_attach(void){
+
+	xm_trace_buf_t *b;
+	size_t n = trace_nevents;
+
+	pthread_once(&trace_once,trace_key_create);
+
+	xm_spinlock_lock(&trace_lock);
+
+	for(b = trace_nbufs<XM_TRACE_BUFS_MAX?NULL:trace_bufs;b;b = b->next){
+
+		if(b->free&&b->mask+1 == n)
+			break;
+	}
+
+	if(b){
+
+		b->head = 0;
+		b->tid = (int)syscall(SYS_gettid);
+		b->name[0] = '\0';
+		b->free = 0;
+	}
+
+	xm_spinlock_unlock(&trace_lock);
+
+	if(b == NULL){
+
+		b = (xm_trace_buf_t*)calloc(1,sizeof(*b)+n*sizeof(xm_trace_event_t));
+		if(b == NULL)
+			return NULL;
+
+		b->mask = n-1;
+		b->tid = (int)syscall(SYS_gettid);
+
+		xm_spinlock_lock(&trace_lock);
+		b->next = trace_bufs;
+		trace_bufs = b;
+		trace_nbufs++;
+		xm_spinlock_unlock(&trace_lock);
+	}
+
+	pthread_setspecific(trace_key,b);
+	xm_trace_buf = b;
+
+	return b;
+}
+
+void xm_trace_init(size_t nevents){
+
+	size_t n = 64;
+
+	while(n<nevents)
+		n <<= 1;
+
+	trace_nevents = n;
+}
+
+void xm_trace_enable(int on){
+
+	if(on&&trace_tsc0 == 0)
+		trace_clock(&trace_tsc0,&trace_ns0);
+
+	xm_trace_on = on;
+}
+
+void xm_trace_thread_name(const char *name){
+
+	xm_trace_buf_t *b = xm_trace_buf;
+	size_t i;
+
+	if(b == NULL&&(b = xm_trace_buf_attach()) == NULL)
+		return;
+
+	/*the name goes into the json as is*/
+	for(i = 0;i<sizeof(b->name)-1&&name[i];i++)
+		b->name[i] = name[i] == '"'||name[i] == '\\'||(unsigned char)name[i]<0x20?'_':name[i];
+
+	b->name[i] = '\0';
+}
+
+static void trace_dump_buf(FILE *fp,xm_trace_buf_t *b,xm_trace_event_t *copy,
+	double tick_ns,int pid,int *first){
+
+	const xm_trace_site_t *site;
+	uint64_t head,head2,start,valid,i,size = b->mask+1;
+	xm_trace_event_t *e;
+	int tid = b->tid,depth = 0;
+	double ts;
+
+	head = b->head;
+	xm_smp_rmb();
+
+	start = head>size?head-size:0;
+	for(i = start;i<head;i++)
+		copy[i-start] = b->ev[i&b->mask];
+
+	xm_smp_rmb();
+	head2 = b->head;
+
+	/*handed to another thread while we copied*/
+	if(head2<head)
+		return;
+
+	/*the slot of head2 may be half written too*/
+	valid = head2+1>size?head2+1-size:0;
+	if(valid<start)
+		valid = start;
+
+	if(b->name[0]){
+
+		fprintf(fp,"%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+			*first?"":",\n",pid,tid,b->name);
+		*first = 0;
+	}
+
+	for(i = valid;i<head;i++){
+
+		e = &copy[i-start];
+		site = (const xm_trace_site_t*)(e->site&~(uintptr_t)1);
+
+		if(e->site&XM_TRACE_PH_END){
+
+			/*its begin was overwritten*/
+			if(depth == 0)
+				continue;
+			depth--;
+		}
+		else{
+
+			depth++;
+		}
+
+		ts = e->tsc>trace_tsc0?(double)(e->tsc-trace_tsc0)*tick_ns/1000:0;
+
+		fprintf(fp,"%s{\"cat\":\"%s\",\"name\":\"%s\",\"ph\":\"%c\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f",
+			*first?"":",\n",site->cat,site->name,e->site&XM_TRACE_PH_END?'E':'B',pid,tid,ts);
+
+		if(e->site&XM_TRACE_PH_END)
+			fprintf(fp,"}");
+		else
+			fprintf(fp,",\"args\":{\"at\":\"%s:%d\"}}",site->file,site->line);
+
+		*first = 0;
+	}
+}
+
+int xm_trace_dump_fp(FILE *fp){
+
+	struct timespec pause = {0,10000000};
+	xm_trace_buf_t *b,*list;
+	xm_trace_event_t *copy = NULL;
+	uint64_t tsc,ns;
+	size_t ncopy = 0;
+	double tick_ns = 0;
+	int first = 1,pid = (int)getpid();
+
+	fprintf(fp,"{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+	if(trace_tsc0){
+
+		/*the longer the base the better the tick estimate, 10ms is enough*/
+		trace_clock(&tsc,&ns);
+		if(ns-trace_ns0<10000000){
+
+			nanosleep(&pause,NULL);
+			trace_clock(&tsc,&ns);
+		}
+
+		tick_ns = (double)(ns-trace_ns0)/(double)(tsc-trace_tsc0);
+	}
+
+	/*rings are only ever added at the head, the rest of the list is stable*/
+	xm_spinlock_lock(&trace_lock);
+	list = trace_bufs;
+	xm_spinlock_unlock(&trace_lock);
+
+	for(b = list;b&&tick_ns>0;b = b->next){
+
+		if(ncopy<b->mask+1){
+
+			free(copy);
+			ncopy = b->mask+1;
+			copy = (xm_trace_event_t*)malloc(ncopy*sizeof(xm_trace_event_t));
+			if(copy == NULL)
+				return ENOMEM;
+		}
+
+		trace_dump_buf(fp,b,copy,tick_ns,pid,&first);
+	}
+
+	free(copy);
+
+	fprintf(fp,"\n]}\n");
+
+	return ferror(fp)?EIO:0;
+}
+
+int xm_trace_dump(const char *path){
+
+	FILE *fp;
+	int rv;
+
+	fp = fopen(path,"w");
+	if(fp == NULL)
+		return errno;
+
+	rv = xm_trace_dump_fp(fp);
+
+	if(fclose(fp)&&rv == 0)
+		rv = errno;
+
+	return rv;
+}
+
+static void trace_sig_handler(int signo){
+
+	signo = signo;
+
+	/*the only async signal safe way out of here*/
+	sem_post(&trace_sem);
+}
+
+static void *trace_dumper(void *arg){
+
+	arg = arg;
+
+	for(;;){
+
+		if(sem_wait(&trace_sem))
+			continue;
+
+		xm_trace_dump(trace_path);
+	}
+
+	return NULL;
+}
+
+int xm_trace_signal(int signo,const char *path){
+
+	struct sigaction sa;
+	pthread_attr_t attr;
+	pthread_t th;
+	int rv;
+
+	if(trace_path)
+		return EBUSY;
+
+	trace_path = strdup(path);
+	if(trace_path == NULL)
+		return ENOMEM;
+
+	sem_init(&trace_sem,0,0);
+
+	pthread_attr_init(&attr);
+	pthread_attr_setdetachstate(&attr,PTHREAD_CREATE_DETACHED);
+	rv = pthread_create(&th,&attr,trace_dumper,NULL);
+	pthread_attr_destroy(&attr);
+
+	if(rv){
+
+		free(trace_path);
+		trace_path = NULL;
+		return rv;
+	}
+
+	memset(&sa,0,sizeof(sa));
+	sa.sa_handler = trace_sig_handler;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+
+	if(sigaction(signo,&sa,NULL))
+		return errno;
+
+	return 0;
+}
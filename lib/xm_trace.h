@@ -0,0 +1,157 @@
+/*
+ *
+ *      Filename: xm_trace.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: tracing spans in per-thread rings, dumped as chrome trace json
+ *        Create: 2026-10-18 09:12:40
+ * Last Modified: 2026-10-18 09:12:40
+ */
+
+#ifndef XM_TRACE_H
+#define XM_TRACE_H
+
+typedef struct xm_trace_site_t xm_trace_site_t;
+typedef struct xm_trace_event_t xm_trace_event_t;
+typedef struct xm_trace_buf_t xm_trace_buf_t;
+
+#include "xm_constants.h"
+#include "xm_atomic.h"
+
+#define XM_TRACE_EVENTS_DEFAULT 65536
+
+/*past this many rings those of exited threads are recycled*/
+#define XM_TRACE_BUFS_MAX 256
+
+#define XM_TRACE_PH_BEGIN 0
+#define XM_TRACE_PH_END   1
+
+/**
+ * A traced place in the code. Sites are static, so the address is
+ * the site id and nothing is registered; the dump reads the names
+ * back through it.
+ */
+struct xm_trace_site_t {
+
+	const char *cat;
+	const char *name;
+	const char *file;
+	int line;
+};
+
+/*sites are pointer aligned, bit 0 of site holds the phase*/
+struct xm_trace_event_t {
+
+	uint64_t tsc;
+	uintptr_t site;
+};
+
+/**
+ * One ring per thread. Only the owner writes ev and head; the dump
+ * reads them without a lock and drops whatever was overwritten while
+ * it copied.
+ */
+struct xm_trace_buf_t {
+
+	xm_trace_buf_t *next;
+
+	volatile uint64_t head;     /*events ever written*/
+	uint64_t mask;
+
+	volatile int free;          /*owner exited, events kept until recycled*/
+	int tid;
+	char name[16];
+
+	xm_trace_event_t ev[];
+};
+
+extern volatile int xm_trace_on;
+extern __thread xm_trace_buf_t *xm_trace_buf;
+
+static inline uint64_t xm_rdtsc(void){
+
+	uint32_t lo,hi;
+
+	asm volatile("rdtsc" : "=a"(lo),"=d"(hi));
+
+	return ((uint64_t)hi<<32)|lo;
+}
+
+extern xm_trace_buf_t *xm_trace_buf_attach(void);
+
+static inline void xm_trace_record(const xm_trace_site_t *site,uintptr_t ph){
+
+	xm_trace_buf_t *b = xm_trace_buf;
+	xm_trace_event_t *e;
+
+	if(b == NULL&&(b = xm_trace_buf_attach()) == NULL)
+		return;
+
+	e = &b->ev[b->head&b->mask];
+	e->tsc = xm_rdtsc();
+	e->site = (uintptr_t)site|ph;
+
+	/*publish the slot before the dump can see it*/
+	xm_smp_wmb();
+	b->head = b->head+1;
+}
+
+#ifndef XM_TRACE_DISABLE
+
+#define XM_TRACE_SITE(var,cat,name) \
+	static const xm_trace_site_t var = {cat,name,__FILE__,__LINE__}
+
+/*off costs one load and a not taken branch*/
+#define XM_TRACE_BEGIN(var) do{ \
+	if(xm_trace_on) \
+		xm_trace_record(&var,XM_TRACE_PH_BEGIN); \
+}while(0)
+
+#define XM_TRACE_END(var) do{ \
+	if(xm_trace_on) \
+		xm_trace_record(&var,XM_TRACE_PH_END); \
+}while(0)
+
+#else
+
+#define XM_TRACE_SITE(var,cat,name) \
+	static const xm_trace_site_t var __attribute__((unused)) = {cat,name,__FILE__,__LINE__}
+
+#define XM_TRACE_BEGIN(var) do{}while(0)
+#define XM_TRACE_END(var) do{}while(0)
+
+#endif /*XM_TRACE_DISABLE*/
+
+/**
+ * Set the ring size of threads that record their first event from now
+ * on, rounded up to a power of 2. Rings already attached keep theirs.
+ */
+extern void xm_trace_init(size_t nevents);
+
+/**
+ * Switch recording on or off. The first switch on also takes the
+ * reference the dump converts TSC ticks to time with.
+ */
+extern void xm_trace_enable(int on);
+
+/*name the calling thread in the dump, at most 15 chars are kept*/
+extern void xm_trace_thread_name(const char *name);
+
+/**
+ * Write the events of every ring as chrome trace json, which
+ * chrome://tracing and ui.perfetto.dev both load. Safe while other
+ * threads record; an end whose begin was overwritten is left out.
+ */
+extern int xm_trace_dump_fp(FILE *fp);
+
+/*@return 0 or the errno of the failed open/write*/
+extern int xm_trace_dump(const char *path);
+
+/**
+ * Dump to path whenever signo arrives. The handler only wakes a
+ * dumper thread, so the signal may hit any thread at any point.
+ * Each dump overwrites the previous one.
+ */
+extern int xm_trace_signal(int signo,const char *path);
+
+#endif /*XM_TRACE_H*/
@@ -0,0 +1,666 @@
+/*
+ *
+ *      Filename: xm_utf8.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 20:52:33
+ * Last Modified: 2026-10-18 20:52:33
+ */
+
+#include "xm_utf8.h"
+#include "xm_strbuf.h"
+#include "xm_cpu.h"
+
+#if defined(__x86_64__)||defined(__i386__)
+#include <immintrin.h>
+#define UTF8_HAVE_SSE 1
+#endif
+
+/*input converted per block, a block with a malformed sequence takes the slow path*/
+#define UTF8_BLOCK 1024
+
+/*most a single slow step writes: c %uXXXXXX c c*/
+#define UTF8_SLOW_MAX 16
+
+static const char hex_lower[] = "0123456789abcdef";
+
+typedef size_t (*utf8_prefix_fn)(const unsigned char *s,size_t len);
+typedef int (*utf8_valid_fn)(const unsigned char *s,size_t len);
+
+static size_t _ascii_prefix_scalar(const unsigned char *s,size_t len){
+
+	size_t i = 0;
+
+	while(i<len&&s[i]<0x80)
+		i++;
+
+	return i;
+}
+
+#ifdef UTF8_HAVE_SSE
+
+__attribute__((target("sse2")))
+static size_t _ascii_prefix_sse2(const unsigned char *s,size_t len){
+
+	size_t i;
+	int mask;
+
+	for(i = 0;i+16<=len;i += 16){
+
+		mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(s+i)));
+		if(mask)
+			return i+__builtin_ctz((unsigned)mask);
+	}
+
+	return i+_ascii_prefix_scalar(s+i,len-i);
+}
+
+__attribute__((target("avx2")))
+static size_t _ascii_prefix_avx2(const unsigned char *s,size_t len){
+
+	size_t i;
+	int mask;
+
+	for(i = 0;i+32<=len;i += 32){
+
+		mask = _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(s+i)));
+		if(mask)
+			return i+__builtin_ctz((unsigned)mask);
+	}
+
+	return i+_ascii_prefix_sse2(s+i,len-i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static size_t _ascii_prefix_avx512(const unsigned char *s,size_t len){
+
+	uint64_t mask;
+	size_t i;
+
+	for(i = 0;i+64<=len;i += 64){
+
+		mask = _mm512_movepi8_mask(_mm512_loadu_si512((const void*)(s+i)));
+		if(mask)
+			return i+__builtin_ctzll(mask);
+	}
+
+	return i+_ascii_prefix_avx2(s+i,len-i);
+}
+
+#endif /*UTF8_HAVE_SSE*/
+
+static size_t _ascii_prefix_resolve(const unsigned char *s,size_t len);
+
+static xm_cpu_fn_t ascii_prefix_slot = (xm_cpu_fn_t)_ascii_prefix_resolve;
+
+static const xm_cpu_impl_t ascii_prefix_impls[] = {
+
+	{XM_CPU_SCALAR,(xm_cpu_fn_t)_ascii_prefix_scalar},
+#ifdef UTF8_HAVE_SSE
+	{XM_CPU_SSE2,(xm_cpu_fn_t)_ascii_prefix_sse2},
+	{XM_CPU_AVX2,(xm_cpu_fn_t)_ascii_prefix_avx2},
+	{XM_CPU_AVX512,(xm_cpu_fn_t)_ascii_prefix_avx512},
+#endif
+};
+
+/*a fixed 4k of the kind of input the kernel sees, for the self benchmarks*/
+static unsigned char utf8_bench_buf[4096];
+
+static const unsigned char *utf8_bench_input(void){
+
+	size_t i;
+
+	if(utf8_bench_buf[0] == 0){
+
+		for(i = 0;i<sizeof(utf8_bench_buf)-3;i++){
+
+			if(i%40 == 39){
+
+				memcpy(utf8_bench_buf+i,"\xe2\x82\xac",3);
+				i += 2;
+			}
+			else{
+
+				utf8_bench_buf[i] = 'a'+i%26;
+			}
+		}
+
+		while(i<sizeof(utf8_bench_buf))
+			utf8_bench_buf[i++] = 'z';
+	}
+
+	return utf8_bench_buf;
+}
+
+static volatile size_t utf8_bench_sink;
+
+static void _ascii_prefix_bench(xm_cpu_fn_t fn,unsigned n){
+
+	const unsigned char *s = utf8_bench_input();
+	size_t i,len = sizeof(utf8_bench_buf),r = 0;
+
+	while(n--){
+
+		/*the runs between the euro signs*/
+		for(i = 0;i<len;i += r+1)
+			r = ((utf8_prefix_fn)fn)(s+i,len-i);
+
+		utf8_bench_sink = r;
+	}
+}
+
+static xm_cpu_kernel_t ascii_prefix_kernel = {
+	"utf8_ascii_prefix",&ascii_prefix_slot,(xm_cpu_fn_t)_ascii_prefix_resolve,
+	ascii_prefix_impls,XM_CPU_NIMPLS(ascii_prefix_impls),_ascii_prefix_bench,NULL,0,0
+};
+
+static size_t _ascii_prefix_resolve(const unsigned char *s,size_t len){
+
+	return ((utf8_prefix_fn)xm_cpu_resolve(&ascii_prefix_kernel))(s,len);
+}
+
+size_t xm_utf8_ascii_prefix(const unsigned char *s,size_t len){
+
+	return ((utf8_prefix_fn)ascii_prefix_slot)(s,len);
+}
+
+/*bytes 0x01-0x7f, the ones copied as they are; sse2 is baseline on x86*/
+static inline size_t _plain_prefix(const unsigned char *s,size_t len){
+
+	size_t i = 0;
+
+#ifdef __SSE2__
+	__m128i zero = _mm_setzero_si128();
+	int mask;
+
+	for(;i+16<=len;i += 16){
+
+		/*signed: 0x80-0xff are negative, 0 is not above 0*/
+		mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(s+i)),zero));
+		if(mask != 0xffff)
+			return i+__builtin_ctz((unsigned)~mask);
+	}
+#endif
+
+	while(i<len&&s[i]-1U<0x7f)
+		i++;
+
+	return i;
+}
+
+static int _valid_scalar(const unsigned char *s,size_t len){
+
+	size_t i = 0;
+	unsigned char c,b1;
+
+	while(i<len){
+
+		i += xm_utf8_ascii_prefix(s+i,len-i);
+		if(i == len)
+			break;
+
+		c = s[i];
+
+		if(c<0xc2||c>0xf4)
+			return 0;
+
+		if(c<0xe0){
+
+			if(i+1>=len||(s[i+1]&0xc0) != 0x80)
+				return 0;
+			i += 2;
+			continue;
+		}
+
+		if(i+1>=len)
+			return 0;
+
+		b1 = s[i+1];
+
+		if(c<0xf0){
+
+			if(i+2>=len||(b1&0xc0) != 0x80||(s[i+2]&0xc0) != 0x80||
+				(c == 0xe0&&b1<0xa0)||(c == 0xed&&b1>0x9f))
+				return 0;
+			i += 3;
+			continue;
+		}
+
+		if(i+3>=len||(b1&0xc0) != 0x80||(s[i+2]&0xc0) != 0x80||(s[i+3]&0xc0) != 0x80||
+			(c == 0xf0&&b1<0x90)||(c == 0xf4&&b1>0x8f))
+			return 0;
+		i += 4;
+	}
+
+	return 1;
+}
+
+#ifdef UTF8_HAVE_SSE
+
+/*
+ * The lookup algorithm of Keiser and Lemire, "Validating UTF-8 in less
+ * than one instruction per byte": three nibble lookups classify every
+ * pair of adjacent bytes, the 3rd and 4th bytes of long sequences are
+ * checked from the bytes two and three back.
+ */
+#define TOO_SHORT      (1<<0)
+#define TOO_LONG       (1<<1)
+#define OVERLONG_3     (1<<2)
+#define TOO_LARGE      (1<<3)
+#define SURROGATE      (1<<4)
+#define OVERLONG_2     (1<<5)
+#define TOO_LARGE_1000 (1<<6)
+#define OVERLONG_4     (1<<6)
+#define TWO_CONTS      (1<<7)
+#define CARRY          (TOO_SHORT|TOO_LONG|TWO_CONTS)
+
+#define T8(a,b,c,d,e,f,g,h) (char)(a),(char)(b),(char)(c),(char)(d),(char)(e),(char)(f),(char)(g),(char)(h)
+
+/*the 16 byte tables, the avx2 version repeats them in both lanes*/
+#define BYTE_1_HIGH \
+	T8(TOO_LONG,TOO_LONG,TOO_LONG,TOO_LONG,TOO_LONG,TOO_LONG,TOO_LONG,TOO_LONG), \
+	T8(TWO_CONTS,TWO_CONTS,TWO_CONTS,TWO_CONTS, \
+		TOO_SHORT|OVERLONG_2, \
+		TOO_SHORT, \
+		TOO_SHORT|OVERLONG_3|SURROGATE, \
+		TOO_SHORT|TOO_LARGE|TOO_LARGE_1000|OVERLONG_4)
+
+#define BYTE_1_LOW \
+	T8(CARRY|OVERLONG_3|OVERLONG_2|OVERLONG_4, \
+		CARRY|OVERLONG_2, \
+		CARRY, \
+		CARRY, \
+		CARRY|TOO_LARGE, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000), \
+	T8(CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000|SURROGATE, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000, \
+		CARRY|TOO_LARGE|TOO_LARGE_1000)
+
+#define BYTE_2_HIGH \
+	T8(TOO_SHORT,TOO_SHORT,TOO_SHORT,TOO_SHORT,TOO_SHORT,TOO_SHORT,TOO_SHORT,TOO_SHORT), \
+	T8(TOO_LONG|OVERLONG_2|TWO_CONTS|OVERLONG_3|TOO_LARGE_1000|OVERLONG_4, \
+		TOO_LONG|OVERLONG_2|TWO_CONTS|OVERLONG_3|TOO_LARGE, \
+		TOO_LONG|OVERLONG_2|TWO_CONTS|SURROGATE|TOO_LARGE, \
+		TOO_LONG|OVERLONG_2|TWO_CONTS|SURROGATE|TOO_LARGE, \
+		TOO_SHORT,TOO_SHORT,TOO_SHORT,TOO_SHORT)
+
+/*the last bytes of a block above these start a sequence it does not finish*/
+#define INCOMPLETE_MAX \
+	T8(0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff), \
+	T8(0xff,0xff,0xff,0xff,0xff,0xf0-1,0xe0-1,0xc0-1)
+
+#define ALL_FF T8(0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff)
+
+__attribute__((target("ssse3")))
+static inline __m128i _check_block(__m128i in,__m128i prev){
+
+	const __m128i nib = _mm_set1_epi8(0x0f);
+	const __m128i byte_1_high_tbl = _mm_setr_epi8(BYTE_1_HIGH);
+	const __m128i byte_1_low_tbl = _mm_setr_epi8(BYTE_1_LOW);
+	const __m128i byte_2_high_tbl = _mm_setr_epi8(BYTE_2_HIGH);
+
+	__m128i prev1 = _mm_alignr_epi8(in,prev,15);
+	__m128i prev2 = _mm_alignr_epi8(in,prev,14);
+	__m128i prev3 = _mm_alignr_epi8(in,prev,13);
+	__m128i sc,must23;
+
+	sc = _mm_and_si128(
+		_mm_and_si128(
+			_mm_shuffle_epi8(byte_1_high_tbl,_mm_and_si128(_mm_srli_epi16(prev1,4),nib)),
+			_mm_shuffle_epi8(byte_1_low_tbl,_mm_and_si128(prev1,nib))),
+		_mm_shuffle_epi8(byte_2_high_tbl,_mm_and_si128(_mm_srli_epi16(in,4),nib)));
+
+	/*only 111_____ two back and 1111____ three back reach 0x80*/
+	must23 = _mm_or_si128(_mm_subs_epu8(prev2,_mm_set1_epi8((char)(0xe0-0x80))),
+		_mm_subs_epu8(prev3,_mm_set1_epi8((char)(0xf0-0x80))));
+
+	return _mm_xor_si128(_mm_and_si128(must23,_mm_set1_epi8((char)0x80)),sc);
+}
+
+__attribute__((target("ssse3")))
+static int _valid_ssse3(const unsigned char *s,size_t len){
+
+	const __m128i max = _mm_setr_epi8(INCOMPLETE_MAX);
+	__m128i prev = _mm_setzero_si128(),in;
+	__m128i err = _mm_setzero_si128(),prev_inc = _mm_setzero_si128();
+	unsigned char tail[16];
+	size_t i;
+
+	for(i = 0;i+16<=len;i += 16){
+
+		in = _mm_loadu_si128((const __m128i*)(s+i));
+
+		if(_mm_movemask_epi8(in) == 0){
+
+			/*all ascii: only a sequence left open before is an error*/
+			err = _mm_or_si128(err,prev_inc);
+		}
+		else{
+
+			err = _mm_or_si128(err,_check_block(in,prev));
+			prev_inc = _mm_subs_epu8(in,max);
+		}
+
+		prev = in;
+	}
+
+	if(i<len){
+
+		/*zero padding reads as ascii, which ends any open sequence with an error*/
+		memset(tail,0,sizeof(tail));
+		memcpy(tail,s+i,len-i);
+
+		in = _mm_loadu_si128((const __m128i*)tail);
+		err = _mm_or_si128(err,_check_block(in,prev));
+		prev_inc = _mm_setzero_si128();
+	}
+
+	err = _mm_or_si128(err,prev_inc);
+
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(err,_mm_setzero_si128())) == 0xffff;
+}
+
+/*the same over 32 bytes; the bytes before a lane come from across the lane*/
+__attribute__((target("avx2")))
+static inline __m256i _check_block_avx2(__m256i in,__m256i prev){
+
+	const __m256i nib = _mm256_set1_epi8(0x0f);
+	const __m256i byte_1_high_tbl = _mm256_setr_epi8(BYTE_1_HIGH,BYTE_1_HIGH);
+	const __m256i byte_1_low_tbl = _mm256_setr_epi8(BYTE_1_LOW,BYTE_1_LOW);
+	const __m256i byte_2_high_tbl = _mm256_setr_epi8(BYTE_2_HIGH,BYTE_2_HIGH);
+
+	/*the high lane of prev, then the low lane of in*/
+	__m256i cross = _mm256_permute2x128_si256(prev,in,0x21);
+	__m256i prev1 = _mm256_alignr_epi8(in,cross,15);
+	__m256i prev2 = _mm256_alignr_epi8(in,cross,14);
+	__m256i prev3 = _mm256_alignr_epi8(in,cross,13);
+	__m256i sc,must23;
+
+	sc = _mm256_and_si256(
+		_mm256_and_si256(
+			_mm256_shuffle_epi8(byte_1_high_tbl,_mm256_and_si256(_mm256_srli_epi16(prev1,4),nib)),
+			_mm256_shuffle_epi8(byte_1_low_tbl,_mm256_and_si256(prev1,nib))),
+		_mm256_shuffle_epi8(byte_2_high_tbl,_mm256_and_si256(_mm256_srli_epi16(in,4),nib)));
+
+	must23 = _mm256_or_si256(_mm256_subs_epu8(prev2,_mm256_set1_epi8((char)(0xe0-0x80))),
+		_mm256_subs_epu8(prev3,_mm256_set1_epi8((char)(0xf0-0x80))));
+
+	return _mm256_xor_si256(_mm256_and_si256(must23,_mm256_set1_epi8((char)0x80)),sc);
+}
+
+__attribute__((target("avx2")))
+static int _valid_avx2(const unsigned char *s,size_t len){
+
+	const __m256i max = _mm256_setr_epi8(ALL_FF,ALL_FF,INCOMPLETE_MAX);
+	__m256i prev = _mm256_setzero_si256(),in;
+	__m256i err = _mm256_setzero_si256(),prev_inc = _mm256_setzero_si256();
+	unsigned char tail[32];
+	size_t i;
+
+	for(i = 0;i+32<=len;i += 32){
+
+		in = _mm256_loadu_si256((const __m256i*)(s+i));
+
+		if(_mm256_movemask_epi8(in) == 0){
+
+			err = _mm256_or_si256(err,prev_inc);
+		}
+		else{
+
+			err = _mm256_or_si256(err,_check_block_avx2(in,prev));
+			prev_inc = _mm256_subs_epu8(in,max);
+		}
+
+		prev = in;
+	}
+
+	if(i<len){
+
+		memset(tail,0,sizeof(tail));
+		memcpy(tail,s+i,len-i);
+
+		in = _mm256_loadu_si256((const __m256i*)tail);
+		err = _mm256_or_si256(err,_check_block_avx2(in,prev));
+		prev_inc = _mm256_setzero_si256();
+	}
+
+	err = _mm256_or_si256(err,prev_inc);
+
+	return _mm256_testz_si256(err,err);
+}
+
+#endif /*UTF8_HAVE_SSE*/
+
+static int _valid_resolve(const unsigned char *s,size_t len);
+
+static xm_cpu_fn_t valid_slot = (xm_cpu_fn_t)_valid_resolve;
+
+static const xm_cpu_impl_t valid_impls[] = {
+
+	{XM_CPU_SCALAR,(xm_cpu_fn_t)_valid_scalar},
+#ifdef UTF8_HAVE_SSE
+	{XM_CPU_SSSE3,(xm_cpu_fn_t)_valid_ssse3},
+	{XM_CPU_AVX2,(xm_cpu_fn_t)_valid_avx2},
+#endif
+};
+
+static void _valid_bench(xm_cpu_fn_t fn,unsigned n){
+
+	const unsigned char *s = utf8_bench_input();
+
+	while(n--)
+		utf8_bench_sink = ((utf8_valid_fn)fn)(s,sizeof(utf8_bench_buf));
+}
+
+static xm_cpu_kernel_t valid_kernel = {
+	"utf8_valid",&valid_slot,(xm_cpu_fn_t)_valid_resolve,
+	valid_impls,XM_CPU_NIMPLS(valid_impls),_valid_bench,NULL,0,0
+};
+
+static int _valid_resolve(const unsigned char *s,size_t len){
+
+	return ((utf8_valid_fn)xm_cpu_resolve(&valid_kernel))(s,len);
+}
+
+int xm_utf8_valid(const unsigned char *s,size_t len){
+
+	return ((utf8_valid_fn)valid_slot)(s,len);
+}
+
+/*%u and the code point in at least four hex digits, as "%x" printed it*/
+static inline char *_u_emit(char *o,uint32_t d){
+
+	int n = d>0xfffff?6:(d>0xffff?5:4);
+	int k;
+
+	*o++ = '%';
+	*o++ = 'u';
+
+	for(k = n-1;k>=0;k--){
+
+		o[k] = hex_lower[d&0xf];
+		d >>= 4;
+	}
+
+	return o+n;
+}
+
+/*s is known to be well formed: no checks, just decode*/
+static char *_convert_valid(char *o,const unsigned char *s,size_t len){
+
+	size_t i = 0,n;
+	unsigned char c;
+	uint32_t d;
+
+	while(i<len){
+
+		n = _plain_prefix(s+i,len-i);
+		memcpy(o,s+i,n);
+		o += n;
+		i += n;
+
+		if(i == len)
+			break;
+
+		c = s[i];
+
+		if(c == 0){
+
+			i++;
+		}
+		else if(c<0xe0){
+
+			d = ((c&0x1f)<<6)|(s[i+1]&0x3f);
+			o = _u_emit(o,d);
+			i += 2;
+		}
+		else if(c<0xf0){
+
+			d = ((c&0x0f)<<12)|((s[i+1]&0x3f)<<6)|(s[i+2]&0x3f);
+			o = _u_emit(o,d);
+			i += 3;
+		}
+		else{
+
+			d = ((c&0x07)<<18)|((s[i+1]&0x3f)<<12)|((s[i+2]&0x3f)<<6)|(s[i+3]&0x3f);
+			o = _u_emit(o,d);
+			i += 4;
+		}
+	}
+
+	return o;
+}
+
+/*the byte at k, or the NUL the historic code found just past the input*/
+#define AT(s,len,k) ((k)<(len)?(s)[k]:0)
+#define IS_CONT(b) (((b)&0xc0) == 0x80)
+
+/*
+ * One step of the historic decoder, malformed input included: a bad
+ * lead byte is dropped, 0x80-0xbf and 0xf8-0xff are copied, leads from
+ * 0xf5 are copied before their %u, and overlong or surrogate forms get
+ * their lead byte copied after it.
+ */
+static size_t _convert_step(const unsigned char *s,size_t len,size_t i,char **out,int *changed){
+
+	unsigned char c = s[i];
+	char *o = *out;
+	uint32_t d = 0;
+	int ulen = 0;
+
+	if(c<0x80){
+
+		if(c)
+			*o++ = c;
+	}
+	else if((c&0xe0) == 0xc0){
+
+		if(len>=2&&IS_CONT(AT(s,len,i+1))){
+
+			ulen = 2;
+			d = ((c&0x1f)<<6)|(s[i+1]&0x3f);
+		}
+	}
+	else if((c&0xf0) == 0xe0){
+
+		if(len>=3&&IS_CONT(AT(s,len,i+1))&&IS_CONT(AT(s,len,i+2))){
+
+			ulen = 3;
+			d = ((c&0x0f)<<12)|((s[i+1]&0x3f)<<6)|(s[i+2]&0x3f);
+		}
+	}
+	else if((c&0xf8) == 0xf0){
+
+		if(c>=0xf5)
+			*o++ = c;
+
+		if(len>=4&&IS_CONT(AT(s,len,i+1))&&IS_CONT(AT(s,len,i+2))&&IS_CONT(AT(s,len,i+3))){
+
+			ulen = 4;
+			d = ((c&0x07)<<18)|((s[i+1]&0x3f)<<12)|((s[i+2]&0x3f)<<6)|(s[i+3]&0x3f);
+		}
+	}
+	else{
+
+		*o++ = c;
+	}
+
+	if(ulen){
+
+		o = _u_emit(o,d);
+		*changed = 1;
+	}
+
+	if(d>=0xd800&&d<=0xdfff)
+		*o++ = c;
+
+	if((ulen == 4&&d<0x10000)||(ulen == 3&&d<0x800)||(ulen == 2&&d<0x80))
+		*o++ = c;
+
+	*out = o;
+
+	return ulen?i+ulen:i+1;
+}
+
+char *xm_utf8_unicode_escape(xm_pool_t *mp,const unsigned char *s,size_t len,int *changed){
+
+	xm_strbuf_t sb;
+	size_t i = 0,end,k;
+	const unsigned char *mb;
+
+	*changed = 0;
+
+	if(xm_strbuf_init(&sb,mp,len+len/4))
+		return NULL;
+
+	while(i<len){
+
+		end = i+UTF8_BLOCK;
+
+		if(end>=len){
+
+			end = len;
+		}
+		else{
+
+			/*do not cut a sequence: back up to its lead byte*/
+			for(k = end;k>end-3&&IS_CONT(s[k]);k--);
+			if(!IS_CONT(s[k]))
+				end = k;
+		}
+
+		mb = s+i+xm_utf8_ascii_prefix(s+i,end-i);
+
+		if(xm_utf8_valid(mb,s+end-mb)){
+
+			/*a %u of 6 to 8 chars per 2 to 4 bytes, 3x at most*/
+			if(xm_strbuf_reserve(&sb,3*(end-i)))
+				return xm_strbuf_finish(&sb,NULL);
+
+			if(mb<s+end)
+				*changed = 1;
+
+			sb.pos = _convert_valid(sb.pos,s+i,end-i);
+			i = end;
+			continue;
+		}
+
+		while(i<end){
+
+			if(xm_strbuf_reserve(&sb,UTF8_SLOW_MAX))
+				return xm_strbuf_finish(&sb,NULL);
+
+			i = _convert_step(s,len,i,&sb.pos,changed);
+		}
+	}
+
+	return xm_strbuf_finish(&sb,NULL);
+}
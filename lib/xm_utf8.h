@@ -0,0 +1,41 @@
+/*
+ *
+ *      Filename: xm_utf8.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: UTF-8 validation and %u transcoding
+ *        Create: 2026-10-18 20:41:07
+ * Last Modified: 2026-10-18 20:41:07
+ */
+
+#ifndef XM_UTF8_H
+#define XM_UTF8_H
+
+#include "xm_constants.h"
+#include "xm_mpool.h"
+
+/**
+ * Length of the run of ASCII bytes at the start of s, 16 to 64 bytes at
+ * a time as xm_cpu_level allows.
+ */
+extern size_t xm_utf8_ascii_prefix(const unsigned char *s,size_t len);
+
+/**
+ * Check s is well formed UTF-8 (RFC 3629): no overlong forms, no
+ * surrogates, nothing above U+10FFFF, no sequence cut at the end.
+ * Uses the SSSE3 or AVX2 lookup algorithm as xm_cpu_level allows.
+ * @return 1 if valid, 0 if not
+ */
+extern int xm_utf8_valid(const unsigned char *s,size_t len);
+
+/**
+ * Write every multibyte sequence of s as %uXXXX (at least four lowercase
+ * hex digits) and drop NUL bytes, with the quirks of the historic
+ * xm_utf8_unicode_inplace_ex kept for malformed input. Well formed runs
+ * are found with xm_utf8_valid and converted without checks.
+ * @param changed Set to 1 if any sequence was converted, else 0
+ * @return The NUL terminated pool string, NULL if no memory
+ */
+extern char *xm_utf8_unicode_escape(xm_pool_t *mp,const unsigned char *s,size_t len,int *changed);
+
+#endif /*XM_UTF8_H*/
@@ -12,6 +12,14 @@
 #include "xm_errno.h"
 #include "xm_string.h"
 #include "xm_time.h"
+#include "xm_strbuf.h"
+#include "xm_html_entities.h"
+#include "xm_utf8.h"
+#include "xm_cpu.h"
+
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
 
 /* Base64 tables used in decodeBase64Ext */
 static const char b64_pad = '=';
@@ -47,234 +55,11 @@ static const short b64_reverse_t[256] = {
  * \retval rval On Success
  */
 char *xm_utf8_unicode_inplace_ex(xm_pool_t *mp, unsigned char *input, long int input_len, int *changed) {
-    int unicode_len = 0;
-    unsigned int length = 0;
-    unsigned int d = 0, count = 0;
-    unsigned char c, *utf;
-    char *rval, *data;
-    unsigned int i, len, j;
-    unsigned int bytes_left = input_len;
-    unsigned char *unicode = NULL;
-
     *changed = 0;
 
-    len = input_len * 7 + 1;
-    data = rval = xm_palloc(mp, len);
-    if (rval == NULL) return NULL;
-
-
     if (input == NULL) return NULL;
 
-    for(i = 0; i < bytes_left;)  {
-        unicode_len = 0; d = 0;
-        utf = (unsigned char *)&input[i];
-
-        c = *utf;
-
-        /* If first byte begins with binary 0 it is single byte encoding */
-        if ((c & 0x80) == 0) {
-            /* single byte unicode (7 bit ASCII equivilent) has no validation */
-            count++;
-            if(count <= len)    {
-                if(c == 0)
-                    *data = xm_x2c(&c);
-                else
-                    *data++ = c;
-            }
-
-        }
-        /* If first byte begins with binary 110 it is two byte encoding*/
-        else if ((c & 0xE0) == 0xC0) {
-            /* check we have at least two bytes */
-            if (bytes_left < 2) unicode_len = UNICODE_ERROR_CHARACTERS_MISSING;
-            /* check second byte starts with binary 10 */
-            else if (((*(utf + 1)) & 0xC0) != 0x80) unicode_len = UNICODE_ERROR_INVALID_ENCODING;
-            else {
-                unicode_len = 2;
-                count+=6;
-                if(count <= len) {
-                    /* compute character number */
-                    d = ((c & 0x1F) << 6) | (*(utf + 1) & 0x3F);
-                    *data++ = '%';
-                    *data++ = 'u';
-                    unicode = (unsigned char*)xm_psprintf(mp, "%x", d);
-                    length = strlen((const char*)unicode);
-
-                    switch(length)  {
-                        case 1:
-                            *data++ = '0';
-                            *data++ = '0';
-                            *data++ = '0';
-                            break;
-                        case 2:
-                            *data++ = '0';
-                            *data++ = '0';
-                            break;
-                        case 3:
-                            *data++ = '0';
-                            break;
-                        case 4:
-                        case 5:
-                            break;
-
-                        default:
-                            break;
-                    }
-
-                    for(j=0; j<length; j++) {
-                        *data++ = unicode[j];
-                    }
-
-                    *changed = 1;
-                }
-            }
-        }
-        /* If first byte begins with binary 1110 it is three byte encoding */
-        else if ((c & 0xF0) == 0xE0) {
-            /* check we have at least three bytes */
-            if (bytes_left < 3) unicode_len = UNICODE_ERROR_CHARACTERS_MISSING;
-            /* check second byte starts with binary 10 */
-            else if (((*(utf + 1)) & 0xC0) != 0x80) unicode_len = UNICODE_ERROR_INVALID_ENCODING;
-            /* check third byte starts with binary 10 */
-            else if (((*(utf + 2)) & 0xC0) != 0x80) unicode_len = UNICODE_ERROR_INVALID_ENCODING;
-            else {
-                unicode_len = 3;
-                count+=6;
-                if(count <= len) {
-                    /* compute character number */
-                    d = ((c & 0x0F) << 12) | ((*(utf + 1) & 0x3F) << 6) | (*(utf + 2) & 0x3F);
-                    *data++ = '%';
-                    *data++ = 'u';
-                    unicode = (unsigned char*)xm_psprintf(mp, "%x", d);
-                    length = strlen((const char*)unicode);
-
-                    switch(length)  {
-                        case 1:
-                            *data++ = '0';
-                            *data++ = '0';
-                            *data++ = '0';
-                            break;
-                        case 2:
-                            *data++ = '0';
-                            *data++ = '0';
-                            break;
-                        case 3:
-                            *data++ = '0';
-                            break;
-                        case 4:
-                        case 5:
-                            break;
-                        default:
-                            break;
-                    }
-
-                    for(j=0; j<length; j++) {
-                        *data++ = unicode[j];
-                    }
-
-                    *changed = 1;
-
-                }
-            }
-        }
-        /* If first byte begins with binary 11110 it is four byte encoding */
-        else if ((c & 0xF8) == 0xF0) {
-            /* restrict characters to UTF-8 range (U+0000 - U+10FFFF)*/
-            if (c >= 0xF5) {
-                *data++ = c;
-            }
-            /* check we have at least four bytes */
-            if (bytes_left < 4) unicode_len = UNICODE_ERROR_CHARACTERS_MISSING;
-            /* check second byte starts with binary 10 */
-            else if (((*(utf + 1)) & 0xC0) != 0x80) unicode_len = UNICODE_ERROR_INVALID_ENCODING;
-            /* check third byte starts with binary 10 */
-            else if (((*(utf + 2)) & 0xC0) != 0x80) unicode_len = UNICODE_ERROR_INVALID_ENCODING;
-            /* check forth byte starts with binary 10 */
-            else if (((*(utf + 3)) & 0xC0) != 0x80) unicode_len = UNICODE_ERROR_INVALID_ENCODING;
-            else {
-                unicode_len = 4;
-                count+=7;
-                if(count <= len) {
-                    /* compute character number */
-                    d = ((c & 0x07) << 18) | ((*(utf + 1) & 0x3F) << 12) | ((*(utf + 2) & 0x3F) << 6) | (*(utf + 3) & 0x3F);
-                    *data++ = '%';
-                    *data++ = 'u';
-                    unicode = (unsigned char*)xm_psprintf(mp, "%x", d);
-                    length = strlen((const char*)unicode);
-
-                    switch(length)  {
-                        case 1:
-                            *data++ = '0';
-                            *data++ = '0';
-                            *data++ = '0';
-                            break;
-                        case 2:
-                            *data++ = '0';
-                            *data++ = '0';
-                            break;
-                        case 3:
-                            *data++ = '0';
-                            break;
-                        case 4:
-                        case 5:
-                            break;
-                        default:
-                            break;
-                    }
-
-                    for(j=0; j<length; j++) {
-                        *data++ = unicode[j];
-                    }
-
-                    *changed = 1;
-
-                }
-            }
-        }
-        /* any other first byte is invalid (RFC 3629) */
-        else {
-            count++;
-            if(count <= len)
-                *data++ = c;
-        }
-
-        /* invalid UTF-8 character number range (RFC 3629) */
-        if ((d >= 0xD800) && (d <= 0xDFFF)) {
-            count++;
-            if(count <= len)
-                *data++ = c;
-        }
-
-        /* check for overlong */
-        if ((unicode_len == 4) && (d < 0x010000)) {
-            /* four byte could be represented with less bytes */
-            count++;
-            if(count <= len)
-                *data++ = c;
-        }
-        else if ((unicode_len == 3) && (d < 0x0800)) {
-            /* three byte could be represented with less bytes */
-            count++;
-            if(count <= len)
-                *data++ = c;
-        }
-        else if ((unicode_len == 2) && (d < 0x80)) {
-            /* two byte could be represented with less bytes */
-            count++;
-            if(count <= len)
-                *data++ = c;
-        }
-
-        if(unicode_len > 0) {
-            i += unicode_len;
-        } else {
-            i++;
-        }
-    }
-
-    *data ='\0';
-
-    return rval;
+    return xm_utf8_unicode_escape(mp, input, input_len, changed);
 }
 
 /** \brief Validate IPv4 Netmask
@@ -870,233 +655,260 @@ char *xm_strtolower_inplace(unsigned char *str) {
     return (char *)str;
 }
 
-static char *_log_escape(xm_pool_t *p, const unsigned char *input,
-        unsigned long int input_length, int escape_quotes, int escape_colon, int escape_re);
+/*
+ * Log escaping is driven by a class table per variant: 0 copies the byte,
+ * 'x' writes it as \xHH and any other value c writes the two chars \c.
+ * The same bytes are described as "all control and high bytes" plus a
+ * short list of specials, so clean runs can be skipped 16 bytes at a time.
+ */
+typedef struct {
+    uint8_t cls[256];
+    uint8_t ctl;
+    uint8_t nspec;
+    uint8_t spec[12];
+} log_escape_t;
+
+#define LOG_ESC_CTL                                                     \
+    [0x00 ... 0x07] = 'x', ['\b'] = 'b', ['\t'] = 't', ['\n'] = 'n',    \
+    ['\v'] = 'v', [0x0c] = 'x', ['\r'] = 'r', [0x0e ... 0x1f] = 'x',    \
+    ['\\'] = '\\', [0x7f ... 0xff] = 'x'
+
+static const log_escape_t log_esc_nq = {
+    { LOG_ESC_CTL }, 1, 1, "\\"
+};
 
-char *xm_log_escape_re(xm_pool_t *mp, const char *text) {
-    return _log_escape(mp, (const unsigned char *)text, text ? strlen(text) : 0, 1, 1, 1);
-}
+static const log_escape_t log_esc_quotes = {
+    { LOG_ESC_CTL, ['"'] = '"' }, 1, 2, "\\\""
+};
 
-char *xm_log_escape(xm_pool_t *mp, const char *text) {
-    return _log_escape(mp, (const unsigned char *)text, text ? strlen(text) : 0, 1, 0, 0);
-}
+static const log_escape_t log_esc_re = {
+    { LOG_ESC_CTL, ['"'] = '"', [':'] = ':', ['+'] = '+', ['.'] = '.',
+      ['['] = '[', [']'] = ']', ['('] = '(', [')'] = ')', ['?'] = '?',
+      ['/'] = '/' },
+    1, 11, "\\\":+.[]()?/"
+};
 
-char *xm_log_escape_nq(xm_pool_t *mp, const char *text) {
-    return _log_escape(mp, (const unsigned char *)text, text ? strlen(text) : 0, 0, 0, 0);
-}
+static const log_escape_t log_esc_hex = {
+    { [0x00 ... 0x1f] = 'x', ['"'] = 'x', ['\\'] = 'x', [0x7f ... 0xff] = 'x' },
+    1, 2, "\"\\"
+};
 
-char *xm_log_escape_ex(xm_pool_t *mp, const char *text, unsigned long int text_length) {
-    return _log_escape(mp, (const unsigned char *)text, text_length, 1, 0, 0);
-}
+static const log_escape_t log_esc_nul = {
+    { [0] = 'x' }, 0, 1, { 0 }
+};
 
-char *xm_log_escape_nq_ex(xm_pool_t *mp, const char *text, unsigned long int text_length) {
-    return _log_escape(mp, (const unsigned char *)text, text_length, 0, 0, 0);
+typedef size_t (*log_escape_scan_fn)(const log_escape_t *e,
+        const unsigned char *p, size_t i, size_t len);
+
+/* Offset of the first byte at or after i that the variant escapes, or len */
+static size_t log_escape_scan_scalar(const log_escape_t *e,
+        const unsigned char *p, size_t i, size_t len)
+{
+    while (i < len && e->cls[p[i]] == 0) {
+        i++;
+    }
+
+    return i;
 }
 
-char *xm_log_escape_raw(xm_pool_t *mp, const unsigned char *text, unsigned long int text_length) {
-    unsigned char *ret = xm_palloc(mp, text_length * 4 + 1);
-    unsigned long int i, j;
+#ifdef __SSE2__
+static size_t log_escape_scan_sse2(const log_escape_t *e,
+        const unsigned char *p, size_t i, size_t len)
+{
+    __m128i x, m;
+    int j, mask;
 
-    for (i = 0, j = 0; i < text_length; i++, j += 4) {
-        ret[j] = '\\';
-        ret[j+1] = 'x';
-        xm_c2x(text[i], ret+j+2);
+    for (; i + 16 <= len; i += 16) {
+        x = _mm_loadu_si128((const __m128i *)(p + i));
+        m = _mm_setzero_si128();
+
+        /* a signed compare puts the bytes >= 0x80 below 0x20 as well */
+        if (e->ctl) {
+            m = _mm_or_si128(_mm_cmplt_epi8(x, _mm_set1_epi8(0x20)),
+                    _mm_cmpeq_epi8(x, _mm_set1_epi8(0x7f)));
+        }
+
+        for (j = 0; j < e->nspec; j++) {
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8((char)e->spec[j])));
+        }
+
+        mask = _mm_movemask_epi8(m);
+        if (mask) {
+            return i + __builtin_ctz((unsigned)mask);
+        }
     }
-    ret[text_length * 4] = '\0';
 
-    return (char *)ret;
+    return log_escape_scan_scalar(e, p, i, len);
 }
 
-char *xm_log_escape_nul(xm_pool_t *mp, const unsigned char *text, unsigned long int text_length) {
-    unsigned char *ret = xm_palloc(mp, text_length * 4 + 1);
-    unsigned long int i, j;
+__attribute__((target("avx2")))
+static size_t log_escape_scan_avx2(const log_escape_t *e,
+        const unsigned char *p, size_t i, size_t len)
+{
+    __m256i x, m;
+    int j, mask;
 
-    for (i = 0, j = 0; i < text_length; i++) {
-        if (text[i] == '\0') {
-            ret[j] = '\\';
-            ret[j+1] = 'x';
-            xm_c2x(text[i], ret+j+2);
-            j += 4;
+    for (; i + 32 <= len; i += 32) {
+        x = _mm256_loadu_si256((const __m256i *)(p + i));
+        m = _mm256_setzero_si256();
+
+        if (e->ctl) {
+            m = _mm256_or_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), x),
+                    _mm256_cmpeq_epi8(x, _mm256_set1_epi8(0x7f)));
         }
-        else {
-            ret[j] = text[i];
-            j++;
+
+        for (j = 0; j < e->nspec; j++) {
+            m = _mm256_or_si256(m, _mm256_cmpeq_epi8(x, _mm256_set1_epi8((char)e->spec[j])));
+        }
+
+        mask = _mm256_movemask_epi8(m);
+        if (mask) {
+            return i + __builtin_ctz((unsigned)mask);
         }
     }
-    ret[j] = '\0';
 
-    return (char *)ret;
+    return log_escape_scan_sse2(e, p, i, len);
 }
+#endif
 
-/**
- * Transform text to ASCII printable or hex escaped
- */
-char *xm_log_escape_hex(xm_pool_t *mp, const unsigned char *text, unsigned long int text_length) {
-    unsigned char *ret = xm_palloc(mp, text_length * 4 + 1);
-    unsigned long int i, j;
+static size_t log_escape_scan_resolve(const log_escape_t *e,
+        const unsigned char *p, size_t i, size_t len);
 
-    for (i = 0, j = 0; i < text_length; i++) {
-        if (  (text[i] == '"')
-                ||(text[i] == '\\')
-                ||(text[i] <= 0x1f)
-                ||(text[i] >= 0x7f))
-        {
-            ret[j] = '\\';
-            ret[j+1] = 'x';
-            xm_c2x(text[i], ret+j+2);
-            j += 4;
-        }
-        else {
-            ret[j] = text[i];
-            j ++;
+static xm_cpu_fn_t log_escape_scan_slot = (xm_cpu_fn_t)log_escape_scan_resolve;
+
+static const xm_cpu_impl_t log_escape_scan_impls[] = {
+    {XM_CPU_SCALAR, (xm_cpu_fn_t)log_escape_scan_scalar},
+#ifdef __SSE2__
+    {XM_CPU_SSE2, (xm_cpu_fn_t)log_escape_scan_sse2},
+    {XM_CPU_AVX2, (xm_cpu_fn_t)log_escape_scan_avx2},
+#endif
+};
+
+static volatile size_t log_escape_sink;
+
+/* A request line with a quote and a tab in it, the usual log input */
+static void log_escape_scan_bench(xm_cpu_fn_t fn, unsigned n)
+{
+    static const char line[] = "GET /search?q=%22what+is+a+cheap+flight%22&from=LHR&to=JFK"
+        "&date=2026-10-18 HTTP/1.1\tMozilla/5.0 (X11; Linux x86_64) \"quoted\" tail";
+    size_t i;
+
+    while (n--) {
+        for (i = 0; i < sizeof(line) - 1; i++) {
+            i = ((log_escape_scan_fn)fn)(&log_esc_quotes,
+                    (const unsigned char *)line, i, sizeof(line) - 1);
         }
+        log_escape_sink = i;
     }
-    ret[j] = '\0';
+}
 
-    return (char *)ret;
+static xm_cpu_kernel_t log_escape_scan_kernel = {
+    "log_escape_scan", &log_escape_scan_slot, (xm_cpu_fn_t)log_escape_scan_resolve,
+    log_escape_scan_impls, XM_CPU_NIMPLS(log_escape_scan_impls), log_escape_scan_bench,
+    NULL, 0, 0
+};
+
+static size_t log_escape_scan_resolve(const log_escape_t *e,
+        const unsigned char *p, size_t i, size_t len)
+{
+    return ((log_escape_scan_fn)xm_cpu_resolve(&log_escape_scan_kernel))(e, p, i, len);
+}
+
+static inline size_t log_escape_scan(const log_escape_t *e,
+        const unsigned char *p, size_t i, size_t len)
+{
+    return ((log_escape_scan_fn)log_escape_scan_slot)(e, p, i, len);
 }
 
 /**
- * Transform input into a form safe for logging.
+ * Transform input into a form safe for logging. A counting pass sizes the
+ * result exactly, then clean runs are copied whole.
  */
-static char *_log_escape(xm_pool_t *mp, const unsigned char *input, unsigned long int input_len,
-        int escape_quotes, int escape_colon, int escape_re)
+static char *log_escape(xm_pool_t *mp, const log_escape_t *e,
+        const unsigned char *input, size_t input_len)
 {
-    unsigned char *d = NULL;
-    char *ret = NULL;
-    unsigned long int i;
+    unsigned char *ret, *d;
+    size_t i, run, out_len = input_len;
+    uint8_t c;
 
     if (input == NULL) return NULL;
 
-    ret = xm_palloc(mp, input_len * 4 + 1);
+    for (i = log_escape_scan(e, input, 0, input_len); i < input_len;
+            i = log_escape_scan(e, input, i + 1, input_len)) {
+        out_len += e->cls[input[i]] == 'x' ? 3 : 1;
+    }
+
+    ret = xm_pnalloc(mp, out_len + 1);
     if (ret == NULL) return NULL;
-    d = (unsigned char *)ret;
-
-    i = 0;
-    while(i < input_len) {
-        switch(input[i]) {
-            case ':' :
-                if (escape_colon) {
-                    *d++ = '\\';
-                    *d++ = ':';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '"' :
-                if (escape_quotes) {
-                    *d++ = '\\';
-                    *d++ = '"';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '+' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = '+';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '.' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = '.';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case ']' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = ']';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '[' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = '[';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '(' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = '(';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case ')' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = ')';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '?' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = '?';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '/' :
-                if (escape_re) {
-                    *d++ = '\\';
-                    *d++ = '/';
-                } else {
-                    *d++ = input[i];
-                }
-                break;
-            case '\b' :
-                *d++ = '\\';
-                *d++ = 'b';
-                break;
-            case '\n' :
-                *d++ = '\\';
-                *d++ = 'n';
-                break;
-            case '\r' :
-                *d++ = '\\';
-                *d++ = 'r';
-                break;
-            case '\t' :
-                *d++ = '\\';
-                *d++ = 't';
-                break;
-            case '\v' :
-                *d++ = '\\';
-                *d++ = 'v';
-                break;
-            case '\\' :
-                *d++ = '\\';
-                *d++ = '\\';
-                break;
-            default :
-                if ((input[i] <= 0x1f)||(input[i] >= 0x7f)) {
-                    *d++ = '\\';
-                    *d++ = 'x';
-                    xm_c2x(input[i], d);
-                    d += 2;
-                } else {
-                    *d++ = input[i];
-                }
-                break;
+    d = ret;
+
+    for (i = 0; i < input_len; i = run + 1) {
+        run = log_escape_scan(e, input, i, input_len);
+
+        memcpy(d, input + i, run - i);
+        d += run - i;
+
+        if (run == input_len) break;
+
+        c = e->cls[input[run]];
+        *d++ = '\\';
+        if (c == 'x') {
+            *d++ = 'x';
+            xm_c2x(input[run], d);
+            d += 2;
+        } else {
+            *d++ = c;
         }
+    }
 
-        i++;
+    *d = '\0';
+
+    return (char *)ret;
+}
+
+char *xm_log_escape_re(xm_pool_t *mp, const char *text) {
+    return log_escape(mp, &log_esc_re, (const unsigned char *)text, text ? strlen(text) : 0);
+}
+
+char *xm_log_escape(xm_pool_t *mp, const char *text) {
+    return log_escape(mp, &log_esc_quotes, (const unsigned char *)text, text ? strlen(text) : 0);
+}
+
+char *xm_log_escape_nq(xm_pool_t *mp, const char *text) {
+    return log_escape(mp, &log_esc_nq, (const unsigned char *)text, text ? strlen(text) : 0);
+}
+
+char *xm_log_escape_ex(xm_pool_t *mp, const char *text, unsigned long int text_length) {
+    return log_escape(mp, &log_esc_quotes, (const unsigned char *)text, text_length);
+}
+
+char *xm_log_escape_nq_ex(xm_pool_t *mp, const char *text, unsigned long int text_length) {
+    return log_escape(mp, &log_esc_nq, (const unsigned char *)text, text_length);
+}
+
+char *xm_log_escape_raw(xm_pool_t *mp, const unsigned char *text, unsigned long int text_length) {
+    unsigned char *ret = xm_palloc(mp, text_length * 4 + 1);
+    unsigned long int i, j;
+
+    for (i = 0, j = 0; i < text_length; i++, j += 4) {
+        ret[j] = '\\';
+        ret[j+1] = 'x';
+        xm_c2x(text[i], ret+j+2);
     }
+    ret[text_length * 4] = '\0';
 
-    *d = 0;
+    return (char *)ret;
+}
 
-    return ret;
+char *xm_log_escape_nul(xm_pool_t *mp, const unsigned char *text, unsigned long int text_length) {
+    return log_escape(mp, &log_esc_nul, text, text_length);
+}
+
+/**
+ * Transform text to ASCII printable or hex escaped
+ */
+char *xm_log_escape_hex(xm_pool_t *mp, const unsigned char *text, unsigned long int text_length) {
+    return log_escape(mp, &log_esc_hex, text, text_length);
 }
 
 /**
@@ -1104,14 +916,12 @@ static char *_log_escape(xm_pool_t *mp, const unsigned char *input, unsigned lon
  * IMP1 Assumes NUL-terminated
  */
 
-int xm_js_decode_nonstrict_inplace(unsigned char *input, long int input_len) {
+static long int js_decode(unsigned char *input, long int input_len, long int stop, long int *consumed) {
     unsigned char *d = (unsigned char *)input;
     long int i, count;
 
-    if (input == NULL) return -1;
-
     i = count = 0;
-    while (i < input_len) {
+    while (i < stop) {
         if (input[i] == '\\') {
             /* Character is an escape. */
 
@@ -1216,7 +1026,18 @@ int xm_js_decode_nonstrict_inplace(unsigned char *input, long int input_len) {
         }
     }
 
-    *d = '\0';
+    *consumed = i;
+
+    return count;
+}
+
+int xm_js_decode_nonstrict_inplace(unsigned char *input, long int input_len) {
+    long int count, i;
+
+    if (input == NULL) return -1;
+
+    count = js_decode(input, input_len, input_len, &i);
+    input[count] = '\0';
 
     return count;
 }
@@ -1226,16 +1047,13 @@ int xm_js_decode_nonstrict_inplace(unsigned char *input, long int input_len) {
  *
  * IMP1 Assumes NUL-terminated
  */
-int xm_urldecode_nonstrict_inplace_ex(unsigned char *input, long int input_len, int *invalid_count, int *changed) {
+static long int url_decode(unsigned char *input, long int input_len, long int stop, long int *consumed,
+        int *invalid_count, int *changed) {
     unsigned char *d = (unsigned char *)input;
     long int i, count;
 
-    *changed = 0;
-
-    if (input == NULL) return -1;
-
     i = count = 0;
-    while (i < input_len) {
+    while (i < stop) {
         if (input[i] == '%') {
             /* Character is a percent sign. */
 
@@ -1275,52 +1093,196 @@ int xm_urldecode_nonstrict_inplace_ex(unsigned char *input, long int input_len,
         }
     }
 
-    *d = '\0';
+    *consumed = i;
 
     return count;
 }
 
+int xm_urldecode_nonstrict_inplace_ex(unsigned char *input, long int input_len, int *invalid_count, int *changed) {
+    long int count, i;
+
+    *changed = 0;
+
+    if (input == NULL) return -1;
+
+    count = url_decode(input, input_len, input_len, &i, invalid_count, changed);
+    input[count] = '\0';
+
+    return count;
+}
+
+static uint32_t html_ent_hash(const unsigned char *s, size_t len, uint32_t seed)
+{
+    uint32_t h = 2166136261U ^ seed;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+        h ^= s[i];
+        h *= 16777619U;
+    }
+
+    return h;
+}
+
+static const xm_html_ent_t *html_ent_find(const unsigned char *name, size_t len)
+{
+    const xm_html_ent_t *e;
+    uint32_t b;
+
+    if (len > XM_HTML_ENT_NAME_MAX) return NULL;
+
+    b = html_ent_hash(name, len, 0) % XM_HTML_ENT_BUCKETS;
+    e = &xm_html_ent_table[html_ent_hash(name, len, xm_html_ent_disp[b]) % XM_HTML_ENT_COUNT];
+
+    if ((e->len == len)&&(memcmp(xm_html_ent_names + e->off, name, len) == 0)) return e;
+
+    return NULL;
+}
+
+/*
+ * quot, amp, lt, gt and nbsp, the names decoded before the HTML5 list,
+ * in any case and only as a whole word.
+ */
+static const xm_html_ent_t *html_ent_historic(const unsigned char *name, int len)
+{
+    unsigned char lower[4];
+    int n;
+
+    if ((len < 2)||(len > 4)) return NULL;
+
+    for (n = 0; n < len; n++) lower[n] = name[n] | 0x20;
+
+    if (((len == 4)&&(!memcmp(lower, "quot", 4)||!memcmp(lower, "nbsp", 4)))
+            ||((len == 3)&&!memcmp(lower, "amp", 3))
+            ||((len == 2)&&(!memcmp(lower, "lt", 2)||!memcmp(lower, "gt", 2))))
+        return html_ent_find(lower, len);
+
+    return NULL;
+}
+
+/* UTF-8 for every code point above 0x7f */
+static int html_ent_put(unsigned char *d, uint32_t cp)
+{
+    if (cp <= 0x7f) {
+        d[0] = (unsigned char)cp;
+        return 1;
+    }
+
+    if (cp <= 0x7ff) {
+        d[0] = (unsigned char)(0xc0 | (cp >> 6));
+        d[1] = (unsigned char)(0x80 | (cp & 0x3f));
+        return 2;
+    }
+
+    if (cp <= 0xffff) {
+        d[0] = (unsigned char)(0xe0 | (cp >> 12));
+        d[1] = (unsigned char)(0x80 | ((cp >> 6) & 0x3f));
+        d[2] = (unsigned char)(0x80 | (cp & 0x3f));
+        return 3;
+    }
+
+    d[0] = (unsigned char)(0xf0 | (cp >> 18));
+    d[1] = (unsigned char)(0x80 | ((cp >> 12) & 0x3f));
+    d[2] = (unsigned char)(0x80 | ((cp >> 6) & 0x3f));
+    d[3] = (unsigned char)(0x80 | (cp & 0x3f));
+    return 4;
+}
+
+/* What HTML5 makes of &#128; to &#159;, the windows-1252 characters */
+static const uint16_t html_ent_c1[32] = {
+    0x20ac, 0x0081, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+    0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008d, 0x017d, 0x008f,
+    0x0090, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+    0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0x009d, 0x017e, 0x0178
+};
+
+/*
+ * Digits to the code point HTML5 gives them: NUL, surrogates and values
+ * past U+10FFFF are U+FFFD, however many digits follow.
+ */
+static uint32_t html_ent_number(const unsigned char *s, int len, int base)
+{
+    uint32_t v = 0;
+    int i, c;
+
+    for (i = 0; (i < len)&&(v <= 0x10ffff); i++) {
+        c = xm_isdigit(s[i]) ? s[i] - '0' : (s[i] | 0x20) - 'a' + 10;
+        v = v * base + c;
+    }
+
+    if ((v == 0)||(v > 0x10ffff)||((v >= 0xd800)&&(v <= 0xdfff))) return 0xfffd;
+    if ((v >= 0x80)&&(v <= 0x9f)) return html_ent_c1[v - 0x80];
+
+    return v;
+}
+
 /**
+ * Decode HTML entities to UTF-8: numeric ones to the code point HTML5
+ * gives them, named ones from the full HTML5 list. The historic quot,
+ * amp, lt, gt and nbsp are tried first, in any case and as whole words,
+ * so "&Lt;" stays '<' rather than U+226A. Other names are matched
+ * exactly, and those browsers accept without a ';' also as a prefix of
+ * a longer word ("&ltscript" is "<script"). A named entity whose text
+ * would be longer than its reference is left alone; a numeric one never
+ * is, "&#0" already takes the three bytes of U+FFFD.
  *
  * IMP1 Assumes NUL-terminated
  */
-int xm_html_entities_decode_inplace(xm_pool_t *mp, unsigned char *input, int input_len) {
+static int html_decode(unsigned char *input, int input_len, int stop, int *consumed) {
     unsigned char *d = input;
+    int more = stop < input_len;    /* the input goes on past input_len */
     int i, count;
 
-    if ((input == NULL)||(input_len <= 0)) return 0;
-
     i = count = 0;
-    while((i < input_len)&&(count < input_len)) {
+    while((i < stop)&&(count < input_len)) {
         int z, copy = 1;
 
+        /* Move the text up to the next ampersand in one go. */
+        if (input[i] != '&') {
+            const unsigned char *amp = memchr(&input[i], '&', input_len - i);
+            int run = (amp ? (int)(amp - input) : input_len) - i;
+
+            if (d != &input[i]) memmove(d, &input[i], run);
+            d += run;
+            i += run;
+            count += run;
+            continue;
+        }
+
         /* Require an ampersand and at least one character to
          * start looking into the entity.
          */
-        if ((input[i] == '&')&&(i + 1 < input_len)) {
-            int k, j = i + 1;
+        if (i + 1 < input_len) {
+            int k, n, j = i + 1;
 
             if (input[j] == '#') {
                 /* Numerical entity. */
                 copy++;
 
-                if (!(j + 1 < input_len)) goto HTML_ENT_OUT; /* Not enough bytes. */
+                if (!(j + 1 < input_len)) { /* Not enough bytes. */
+                    if (more) break;
+                    goto HTML_ENT_OUT;
+                }
                 j++;
 
                 if ((input[j] == 'x')||(input[j] == 'X')) {
                     /* Hexadecimal entity. */
                     copy++;
 
-                    if (!(j + 1 < input_len)) goto HTML_ENT_OUT; /* Not enough bytes. */
+                    if (!(j + 1 < input_len)) { /* Not enough bytes. */
+                        if (more) break;
+                        goto HTML_ENT_OUT;
+                    }
                     j++; /* j is the position of the first digit now. */
 
                     k = j;
                     while((j < input_len)&&(isxdigit(input[j]))) j++;
+                    if (more&&(j == input_len)) break; /* More digits may follow. */
                     if (j > k) { /* Do we have at least one digit? */
                         /* Decode the entity. */
-                        char *x = xm_pstrmemdup(mp, (const char *)&input[k], j - k);
-                        *d++ = (unsigned char)strtol(x, NULL, 16);
-                        count++;
+                        n = html_ent_put(d, html_ent_number(&input[k], j - k, 16));
+                        d += n;
+                        count += n;
 
                         /* Skip over the semicolon if it's there. */
                         if ((j < input_len)&&(input[j] == ';')) i = j + 1;
@@ -1334,11 +1296,12 @@ int xm_html_entities_decode_inplace(xm_pool_t *mp, unsigned char *input, int inp
                     /* Decimal entity. */
                     k = j;
                     while((j < input_len)&&(isdigit(input[j]))) j++;
+                    if (more&&(j == input_len)) break; /* More digits may follow. */
                     if (j > k) { /* Do we have at least one digit? */
                         /* Decode the entity. */
-                        char *x = xm_pstrmemdup(mp, (const char *)&input[k], j - k);
-                        *d++ = (unsigned char)strtol(x, NULL, 10);
-                        count++;
+                        n = html_ent_put(d, html_ent_number(&input[k], j - k, 10));
+                        d += n;
+                        count += n;
 
                         /* Skip over the semicolon if it's there. */
                         if ((j < input_len)&&(input[j] == ';')) i = j + 1;
@@ -1351,36 +1314,49 @@ int xm_html_entities_decode_inplace(xm_pool_t *mp, unsigned char *input, int inp
                 }
             } else {
                 /* Text entity. */
+                const xm_html_ent_t *e;
+                unsigned char text[8];
+                int end, len;
 
                 k = j;
                 while((j < input_len)&&(isalnum(input[j]))) j++;
-                if (j > k) { /* Do we have at least one digit? */
-                    char *x = xm_pstrmemdup(mp, (const char *)&input[k], j - k);
-
-                    /* Decode the entity. */
-                    /* ENH What about others? */
-                    if (strcasecmp(x, "quot") == 0) *d++ = '"';
-                    else
-                        if (strcasecmp(x, "amp") == 0) *d++ = '&';
-                        else
-                            if (strcasecmp(x, "lt") == 0) *d++ = '<';
-                            else
-                                if (strcasecmp(x, "gt") == 0) *d++ = '>';
-                                else
-                                    if (strcasecmp(x, "nbsp") == 0) *d++ = NBSP;
-                                    else {
-                                        /* We do no want to convert this entity, copy the raw data over. */
-                                        copy = j - k + 1;
-                                        goto HTML_ENT_OUT;
-                                    }
 
-                    count++;
+                /* The name, or its ';', may go on; past the longest name it no longer matters. */
+                if (more&&(j == input_len)&&(j - k <= XM_HTML_ENT_NAME_MAX)) break;
 
-                    /* Skip over the semicolon if it's there. */
-                    if ((j < input_len)&&(input[j] == ';')) i = j + 1;
-                    else i = j;
+                if (j > k) {
+                    len = j - k;
+                    end = ((j < input_len)&&(input[j] == ';')) ? j + 1 : j;
 
-                    continue;
+                    /* The historic names come first, so "&Lt;" stays '<' rather than U+226A. */
+                    e = html_ent_historic(&input[k], len);
+                    if (e == NULL) e = html_ent_find(&input[k], len);
+
+                    /* "&notit;" reads as "&not" followed by "it;" */
+                    for (n = len - 1 < XM_HTML_ENT_LEGACY_MAX ? len - 1 : XM_HTML_ENT_LEGACY_MAX;
+                            (e == NULL)&&(n >= 2); n--) {
+                        e = html_ent_find(&input[k], n);
+                        if ((e != NULL)&&!e->legacy) e = NULL;
+                        end = k + n;
+                    }
+
+                    if (e != NULL) {
+                        n = html_ent_put(text, e->cp1);
+                        if (e->cp2) n += html_ent_put(text + n, e->cp2);
+
+                        if (n <= end - i) {
+                            memcpy(d, text, n);
+                            d += n;
+                            count += n;
+                            i = end;
+
+                            continue;
+                        }
+                    }
+
+                    /* We do no want to convert this entity, copy the raw data over. */
+                    copy = len + 1;
+                    goto HTML_ENT_OUT;
                 }
             }
         }
@@ -1393,7 +1369,20 @@ HTML_ENT_OUT:
         }
     }
 
-    *d = '\0';
+    *consumed = i;
+
+    return count;
+}
+
+int xm_html_entities_decode_inplace(xm_pool_t *mp, unsigned char *input, int input_len) {
+    int count, i;
+
+    (void)mp;
+
+    if ((input == NULL)||(input_len <= 0)) return 0;
+
+    count = html_decode(input, input_len, input_len, &i);
+    input[count] = '\0';
 
     return count;
 }
@@ -1402,12 +1391,12 @@ HTML_ENT_OUT:
  *
  * IMP1 Assumes NUL-terminated
  */
-int xm_ansi_c_sequences_decode_inplace(unsigned char *input, int input_len) {
+static int ansi_c_decode(unsigned char *input, int input_len, int stop, int *consumed) {
     unsigned char *d = input;
     int i, count;
 
     i = count = 0;
-    while(i < input_len) {
+    while(i < stop) {
         if ((input[i] == '\\')&&(i + 1 < input_len)) {
             int c = -1;
 
@@ -1500,11 +1489,64 @@ int xm_ansi_c_sequences_decode_inplace(unsigned char *input, int input_len) {
         }
     }
 
-    *d = '\0';
+    *consumed = i;
 
     return count;
 }
 
+int xm_ansi_c_sequences_decode_inplace(unsigned char *input, int input_len) {
+    int count, i;
+
+    count = ansi_c_decode(input, input_len, input_len, &i);
+    input[count] = '\0';
+
+    return count;
+}
+
+/* Whether the path has anything for xm_normalize_path_inplace to do:
+ * "//", a "." ending a segment, or a backslash on windows. It errs on
+ * the side of yes, "a./b" takes the slow path and comes out unchanged.
+ */
+static int path_needs_normalize(const unsigned char *p, size_t len, int win)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128i a, b, m;
+
+    /* each byte against the one after it, so stop a byte short */
+    for (; i + 17 <= len; i += 16) {
+        a = _mm_loadu_si128((const __m128i *)(p + i));
+        b = _mm_loadu_si128((const __m128i *)(p + i + 1));
+
+        m = _mm_and_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8('/')),
+                _mm_or_si128(_mm_cmpeq_epi8(a, _mm_set1_epi8('/')),
+                    _mm_cmpeq_epi8(a, _mm_set1_epi8('.'))));
+        if (win) {
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(a, _mm_set1_epi8('\\')));
+        }
+
+        if (_mm_movemask_epi8(m)) {
+            return 1;
+        }
+    }
+#endif
+
+    for (; i + 1 < len; i++) {
+        if ((p[i + 1] == '/' && (p[i] == '/' || p[i] == '.'))
+            || (win && p[i] == '\\')) {
+            return 1;
+        }
+    }
+
+    if (win && p[len - 1] == '\\') {
+        return 1;
+    }
+
+    /* "x." is a name, ".", "/." and ".." are references */
+    return p[len - 1] == '.'
+        && (len == 1 || p[len - 2] == '/' || p[len - 2] == '.');
+}
+
 /**
  *
  * IMP1 Assumes NUL-terminated
@@ -1513,6 +1555,7 @@ int xm_normalize_path_inplace(unsigned char *input, int input_len, int win, int
     unsigned char *src;
     unsigned char *dst;
     unsigned char *end;
+    unsigned char *seg;
     int ldst = 0;
     int hitroot = 0;
     int done = 0;
@@ -1524,6 +1567,12 @@ int xm_normalize_path_inplace(unsigned char *input, int input_len, int win, int
     /* Need at least one byte to normalize */
     if (input_len <= 0) return 0;
 
+    /* Most paths are already normal, leave them as they are. */
+    if (!path_needs_normalize(input, input_len, win)) {
+        input[input_len] = '\0';
+        return input_len;
+    }
+
     /*
      * ENH: Deal with UNC and drive letters?
      */
@@ -1549,6 +1598,30 @@ int xm_normalize_path_inplace(unsigned char *input, int input_len, int win, int
             }
         }
 
+        /* Only the last byte of a segment needs a look, copy the others
+         * up to it in one go.
+         */
+        if ((*src != '/') && (src < end) && (*(src + 1) != '/')) {
+            seg = memchr(src + 1, '/', end - src);
+            if (win) {
+                unsigned char *bs = memchr(src + 1, '\\',
+                        ((seg != NULL) ? seg : end + 1) - (src + 1));
+                if (bs != NULL) seg = bs;
+            }
+            seg = (seg != NULL) ? seg - 1 : end;
+
+            if (dst != src) {
+                memmove(dst, src, seg - src);
+            }
+            dst += seg - src;
+            src = seg;
+
+            if (win && (src < end) && (*(src + 1) == '\\')) {
+                *(src + 1) = '/';
+                *changed = 1;
+            }
+        }
+
         /* Always normalize at the end of the input. */
         if (src == end) {
             done = 1;
@@ -1684,13 +1757,22 @@ length:
 
 
 char *xm_resolve_relative_path(xm_pool_t *pool, const char *parent_filename, const char *filename) {
+    xm_strbuf_t sb;
+    size_t flen, dlen;
+
     if (filename == NULL) return NULL;
     // TODO Support paths on operating systems other than Unix.
     if (filename[0] == '/') return (char *)filename;
 
-    return xm_pstrcat(pool, xm_pstrndup(pool, parent_filename,
-                strlen(parent_filename) - strlen(xm_filepath_name_get(parent_filename))),
-            filename, NULL);
+    flen = strlen(parent_filename);
+    dlen = flen - strlen(xm_filepath_name_get(parent_filename));
+
+    /* the parent directory and filename are written once, straight into the pool */
+    xm_strbuf_init(&sb, pool, dlen + strlen(filename));
+    xm_strbuf_append(&sb, parent_filename, dlen);
+    xm_strbuf_append_str(&sb, filename);
+
+    return xm_strbuf_finish(&sb, NULL);
 }
 
 /**
@@ -1700,14 +1782,12 @@ char *xm_resolve_relative_path(xm_pool_t *pool, const char *parent_filename, con
  *     http://www.w3.org/TR/REC-CSS2/syndata.html#q4
  *     http://www.unicode.org/roadmaps/
  */
-int xm_css_decode_inplace(unsigned char *input, long int input_len) {
+static long int css_decode(unsigned char *input, long int input_len, long int stop, long int *consumed) {
     unsigned char *d = (unsigned char *)input;
     long int i, j, count;
 
-    if (input == NULL) return -1;
-
     i = count = 0;
-    while (i < input_len) {
+    while (i < stop) {
 
         /* Is the character a backslash? */
         if (input[i] == '\\') {
@@ -1839,12 +1919,180 @@ int xm_css_decode_inplace(unsigned char *input, long int input_len) {
         }
     }
 
-    /* Terminate output string. */
-    *d = '\0';
+    *consumed = i;
+
+    return count;
+}
+
+int xm_css_decode_inplace(unsigned char *input, long int input_len) {
+    long int count, i;
+
+    if (input == NULL) return -1;
+
+    count = css_decode(input, input_len, input_len, &i);
+    input[count] = '\0';
+
+    return count;
+}
+
+/* How far past the start of a token each decoder may read */
+static const long int decode_stream_lookahead[] = {
+    2,                          /* %HH */
+    5,                          /* \uHHHH */
+    7,                          /* \HHHHHH and a space */
+    4,                          /* \xHH, \OOO */
+    1,                          /* &name; and &#digits; are held while they go on */
+    3                           /* a lead byte and three continuation bytes */
+};
+
+xm_decode_stream_t *xm_decode_stream_create(xm_pool_t *mp, int type) {
+    xm_decode_stream_t *ds;
+
+    if ((type < XM_DECODE_URL)||(type > XM_DECODE_UTF8_U)) return NULL;
+
+    ds = xm_pcalloc(mp, sizeof(*ds));
+    if (ds == NULL) return NULL;
+
+    ds->type = type;
+    ds->pool = mp;
+
+    return ds;
+}
+
+/*
+ * A step of the %u escape looks at a lead byte and the continuation
+ * bytes right after it, and stops at the first byte that is none. So
+ * the input can be cut at p when buf[p] is no continuation byte, or
+ * when the three bytes before p are: no lead is close enough to reach
+ * past p. One of the last four positions always is such a cut.
+ */
+static long int decode_stream_utf8_cut(const unsigned char *buf, long int len, long int stop) {
+    long int p;
+
+    for (p = len; p > stop; p--) {
+        if ((p < len)&&((buf[p] & 0xc0) != 0x80)) break;
+        if ((p >= 3)&&((buf[p - 1] & 0xc0) == 0x80)&&((buf[p - 2] & 0xc0) == 0x80)
+                &&((buf[p - 3] & 0xc0) == 0x80)) break;
+    }
+
+    return p;
+}
+
+static long int decode_stream_utf8(xm_decode_stream_t *ds, unsigned char *buf, long int len,
+        long int stop) {
+    xm_pool_mark_t mark;
+    long int count, consumed;
+    int changed;
+    char *s;
+
+    consumed = (stop == len) ? len : decode_stream_utf8_cut(buf, len, stop);
+
+    ds->hold_len = len - consumed;
+    memcpy(ds->hold, buf + consumed, ds->hold_len);
+
+    xm_pool_mark(ds->pool, &mark);
+
+    s = xm_utf8_unicode_escape(ds->pool, buf, consumed, &changed);
+    if (s == NULL) {
+        count = 0;
+    } else {
+        /* NUL bytes are dropped, the string holds all there is */
+        count = strlen(s);
+        memcpy(buf, s, count);
+
+        if (changed) ds->changed = 1;
+    }
+
+    xm_pool_release_to(ds->pool, &mark);
+
+    buf[count] = '\0';
 
     return count;
 }
 
+/*
+ * A numeric reference is held without its leading zeros, and with no
+ * more digits than put it past U+10FFFF, as more change nothing: it is
+ * never longer than "&#x" and 7 digits. A held name is no longer than
+ * '&' and XM_HTML_ENT_NAME_MAX.
+ */
+static long int decode_stream_html_hold(unsigned char *h, long int len) {
+    long int p = 2, max = 8, z;
+
+    if ((len < 3)||(h[0] != '&')||(h[1] != '#')) return len;
+
+    if ((h[p] == 'x')||(h[p] == 'X')) {
+        p++;
+        max = 7;
+    }
+
+    /* "&#000" is still "&#0" */
+    for (z = p; (z < len - 1)&&(h[z] == '0'); z++);
+
+    if (len - z > max) len = z + max;
+    memmove(h + p, h + z, len - z);
+
+    return p + len - z;
+}
+
+/* Decode the tokens that start before stop, and hold back the rest. */
+static long int decode_stream_run(xm_decode_stream_t *ds, unsigned char *buf, long int len,
+        long int stop) {
+    long int count, consumed;
+    int icount, iconsumed;
+
+    if (ds->type == XM_DECODE_UTF8_U) return decode_stream_utf8(ds, buf, len, stop);
+
+    switch (ds->type) {
+        case XM_DECODE_URL :
+            count = url_decode(buf, len, stop, &consumed, &ds->invalid_count, &ds->changed);
+            break;
+        case XM_DECODE_JS :
+            count = js_decode(buf, len, stop, &consumed);
+            break;
+        case XM_DECODE_CSS :
+            count = css_decode(buf, len, stop, &consumed);
+            break;
+        case XM_DECODE_ANSI_C :
+            icount = ansi_c_decode(buf, (int)len, (int)stop, &iconsumed);
+            count = icount;
+            consumed = iconsumed;
+            break;
+        default :
+            icount = html_decode(buf, (int)len, (int)stop, &iconsumed);
+            count = icount;
+            consumed = iconsumed;
+            break;
+    }
+
+    ds->hold_len = len - consumed;
+    if (ds->type == XM_DECODE_HTML) ds->hold_len = decode_stream_html_hold(buf + consumed, ds->hold_len);
+    memcpy(ds->hold, buf + consumed, ds->hold_len);
+
+    buf[count] = '\0';
+
+    return count;
+}
+
+long int xm_decode_stream_feed(xm_decode_stream_t *ds, const unsigned char *in,
+        size_t len, unsigned char *out) {
+    long int total = ds->hold_len + (long int)len;
+    long int stop = total - decode_stream_lookahead[ds->type];
+
+    memcpy(out, ds->hold, ds->hold_len);
+    memcpy(out + ds->hold_len, in, len);
+
+    return decode_stream_run(ds, out, total, stop > 0 ? stop : 0);
+}
+
+long int xm_decode_stream_finish(xm_decode_stream_t *ds, unsigned char *out) {
+    long int len = ds->hold_len;
+
+    memcpy(out, ds->hold, len);
+
+    return decode_stream_run(ds, out, len, len);
+}
+
 /**
  * @brief Transforms an xm_array_header_t to a text buffer
  *
@@ -1869,44 +2117,12 @@ int xm_css_decode_inplace(unsigned char *input, long int input_len) {
 int xm_headers_to_buffer(const xm_array_header_t *arr, char *buffer,
         int buffer_length)
 {
-    int headers_length = 0;
-    int write_to_buffer = 0;
-    int i = 0;
-    const xm_table_entry_t *te = NULL;
-
-    if (buffer != NULL && buffer_length > 0) {
-        write_to_buffer = 1;
-    }
-
-    te = (xm_table_entry_t *)arr->elts;
-    for (i = 0; i < arr->nelts; i++) {
-            char *value = te[i].val;
-            char *key = te[i].key;
-            headers_length = headers_length + strlen(value) + strlen(key) + /* \n: */ 1 +
-               /* colum */ 1 + /* space: */ 1 ;
-
-            if (write_to_buffer == 1) {
-                if (buffer_length < headers_length) {
-                    headers_length = -1;
-                    goto not_enough_memory;
-                }
-
-                sprintf(buffer, "%s%s: %s\n", buffer, key, value);
-            }
-    }
-
-    headers_length++; /* Save space for an extra '\n' between the hedaers and the request body */
-    if (write_to_buffer) {
-        if (buffer_length < headers_length) {
-            headers_length = -1;
-            goto not_enough_memory;
-        }
-
-        buffer[headers_length-1] = '\n';
+    if (buffer == NULL || buffer_length <= 0) {
+        return (int)xm_table_serialize(arr, &xm_table_sep_headers, NULL, 0);
     }
 
-not_enough_memory:
-    return headers_length;
+    return (int)xm_table_serialize(arr, &xm_table_sep_headers, buffer,
+                                   (size_t)buffer_length);
 }
 
 int xm_read_line(char *buf, int len, FILE *fp)
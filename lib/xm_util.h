@@ -11,6 +11,8 @@
 #ifndef XM_UTIL_H
 #define XM_UTIL_H
 
+typedef struct xm_decode_stream_t xm_decode_stream_t;
+
 #define UNICODE_ERROR_CHARACTERS_MISSING    -1
 #define UNICODE_ERROR_INVALID_ENCODING      -2
 #define UNICODE_ERROR_OVERLONG_CHARACTER    -3
@@ -110,6 +112,62 @@ extern char  *xm_resolve_relative_path(xm_pool_t *pool, const char *parent_filen
 
 extern int  xm_css_decode_inplace(unsigned char *input, long int input_len);
 
+/* decoders a xm_decode_stream_t can run */
+#define XM_DECODE_URL     0
+#define XM_DECODE_JS      1
+#define XM_DECODE_CSS     2
+#define XM_DECODE_ANSI_C  3
+#define XM_DECODE_HTML    4
+#define XM_DECODE_UTF8_U  5     /* xm_utf8_unicode_escape, not in place */
+
+/* bytes carried from one chunk to the next at most */
+#define XM_DECODE_STREAM_HOLD 64
+
+/* room the out buffer of xm_decode_stream_feed needs for a chunk of len */
+#define XM_DECODE_STREAM_OUT_SIZE(len) ((len) + XM_DECODE_STREAM_HOLD)
+
+/* the same for XM_DECODE_UTF8_U, where 2 bytes may become 7 */
+#define XM_DECODE_STREAM_UTF8_OUT_SIZE(len) (4 * ((len) + XM_DECODE_STREAM_HOLD))
+
+/**
+ * One of the in-place decoders run over data arriving in chunks. The
+ * bytes of an escape or entity cut by a chunk boundary are held back and
+ * decoded with the next chunk, so the output is the same as decoding the
+ * whole input at once. An HTML reference is held while it may go on,
+ * a numeric one without its leading zeros and the digits past the point
+ * where it can only be U+FFFD, so any padding fits the hold.
+ * XM_DECODE_UTF8_U holds back a UTF-8 sequence that may still go on.
+ */
+struct xm_decode_stream_t {
+    int type;
+    xm_pool_t *pool;        /* XM_DECODE_UTF8_U: scratch, released every chunk */
+    int invalid_count;      /* XM_DECODE_URL: % not followed by two hex digits */
+    int changed;            /* XM_DECODE_URL, XM_DECODE_UTF8_U: something was decoded */
+    long int hold_len;
+    unsigned char hold[XM_DECODE_STREAM_HOLD];
+};
+
+extern xm_decode_stream_t *xm_decode_stream_create(xm_pool_t *mp, int type);
+
+/**
+ * Decode the next chunk.
+ * @param out Receives the decoded bytes, NUL terminated. Must hold
+ *            XM_DECODE_STREAM_OUT_SIZE(len) bytes, or
+ *            XM_DECODE_STREAM_UTF8_OUT_SIZE(len) for XM_DECODE_UTF8_U,
+ *            may not be in.
+ * @return The number of decoded bytes
+ */
+extern long int xm_decode_stream_feed(xm_decode_stream_t *ds, const unsigned char *in,
+        size_t len, unsigned char *out);
+
+/**
+ * Decode what is still held back at the end of the input.
+ * @param out Must hold XM_DECODE_STREAM_HOLD bytes, 4 times that for
+ *            XM_DECODE_UTF8_U
+ * @return The number of decoded bytes
+ */
+extern long int xm_decode_stream_finish(xm_decode_stream_t *ds, unsigned char *out);
+
 extern unsigned char xm_is_netmask_v4(char *ip_strv4);
 
 extern unsigned char xm_is_netmask_v6(char *ip_strv6);
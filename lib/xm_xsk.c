@@ -0,0 +1,570 @@
+/*
+ *
+ *      Filename: xm_xsk.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: ---
+ *        Create: 2026-10-18 09:40:12
+ * Last Modified: 2026-10-18 09:40:12
+ */
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <poll.h>
+#include <net/if.h>
+#include "xm_xsk.h"
+#include "xm_log.h"
+
+static int _ring_mmap(int fd,xm_xsk_ring_t *r,struct xdp_ring_offset *off,
+	uint32_t size,size_t desc_size,off_t pgoff){
+
+	void *map;
+
+	r->map_size = off->desc + size*desc_size;
+
+	map = mmap(NULL,r->map_size,PROT_READ|PROT_WRITE,
+		MAP_SHARED|MAP_POPULATE,fd,pgoff);
+
+	if(map == MAP_FAILED){
+
+		xm_log(XM_LOG_ERR,"mmap xsk ring failed:%s",strerror(errno));
+		r->map = NULL;
+		return -1;
+	}
+
+	r->map = map;
+	r->mask = size-1;
+	r->size = size;
+	r->producer = (uint32_t*)((char*)map+off->producer);
+	r->consumer = (uint32_t*)((char*)map+off->consumer);
+	r->flags = (uint32_t*)((char*)map+off->flags);
+	r->ring = (char*)map+off->desc;
+
+	return 0;
+}
+
+static void _ring_munmap(xm_xsk_ring_t *r){
+
+	if(r->map){
+
+		munmap(r->map,r->map_size);
+		r->map = NULL;
+	}
+}
+
+static void *_umem_alloc(size_t size,int hugepage){
+
+	void *addr;
+
+	if(hugepage){
+
+		addr = mmap(NULL,size,PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB|MAP_POPULATE,-1,0);
+
+		if(addr != MAP_FAILED)
+			return addr;
+
+		xm_log(XM_LOG_WARN,"No hugepages for xsk umem,use normal pages!");
+	}
+
+	addr = mmap(NULL,size,PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS|MAP_POPULATE,-1,0);
+
+	return addr == MAP_FAILED?NULL:addr;
+}
+
+static int _xsk_bind(xm_xsk_t *xsk){
+
+	struct sockaddr_xdp sxdp;
+	struct xdp_options opts;
+	socklen_t optlen;
+	uint16_t wakeup = (xsk->flags&XM_XSK_F_NEED_WAKEUP)?XDP_USE_NEED_WAKEUP:0;
+
+	memset(&sxdp,0,sizeof(sxdp));
+	sxdp.sxdp_family = AF_XDP;
+	sxdp.sxdp_ifindex = xsk->ifindex;
+	sxdp.sxdp_queue_id = xsk->queue_id;
+
+	if(!(xsk->flags&XM_XSK_F_COPY)){
+
+		sxdp.sxdp_flags = XDP_ZEROCOPY|wakeup;
+
+		if(bind(xsk->fd,(struct sockaddr*)&sxdp,sizeof(sxdp)) == 0){
+
+			xsk->zero_copy = 1;
+			return 0;
+		}
+
+		xm_log(XM_LOG_WARN,"xsk zero-copy bind failed on ifindex:%d queue:%u (%s),fall back to copy mode!",
+			xsk->ifindex,xsk->queue_id,strerror(errno));
+	}
+
+	sxdp.sxdp_flags = XDP_COPY|wakeup;
+
+	if(bind(xsk->fd,(struct sockaddr*)&sxdp,sizeof(sxdp))){
+
+		xm_log(XM_LOG_ERR,"xsk bind failed on ifindex:%d queue:%u:%s",
+			xsk->ifindex,xsk->queue_id,strerror(errno));
+		return -1;
+	}
+
+	/*kernels without XDP_OPTIONS are copy mode by construction here*/
+	optlen = sizeof(opts);
+	if(getsockopt(xsk->fd,SOL_XDP,XDP_OPTIONS,&opts,&optlen) == 0)
+		xsk->zero_copy = (opts.flags&XDP_OPTIONS_ZEROCOPY)?1:0;
+	else
+		xsk->zero_copy = 0;
+
+	return 0;
+}
+
+static int _fill_ring_populate(xm_xsk_t *xsk){
+
+	uint32_t i,idx = 0;
+	uint32_t n = xsk->rx_frames;
+
+	if(xm_xsk_ring_prod_reserve(&xsk->fill,n,&idx)!=n){
+
+		xm_log(XM_LOG_ERR,"Cannot post %u frames to the xsk fill ring",n);
+		return -1;
+	}
+
+	for(i = 0;i<n;i++)
+		*xm_xsk_ring_addr(&xsk->fill,idx++) = (uint64_t)i*xsk->frame_size;
+
+	xm_xsk_ring_prod_submit(&xsk->fill,n);
+
+	return 0;
+}
+
+xm_xsk_t *xm_xsk_create(xm_pool_t *mp,const char *ifname,uint32_t queue_id,
+	uint32_t frame_num,uint32_t frame_size,uint32_t ring_size,int flags){
+
+	xm_xsk_t *xsk;
+	struct xdp_umem_reg ureg;
+	struct xdp_mmap_offsets off;
+	socklen_t optlen;
+	uint32_t i,tx_frames;
+
+	if(frame_num == 0)
+		frame_num = XM_XSK_FRAME_NUM_DEFAULT;
+	if(frame_size == 0)
+		frame_size = XM_XSK_FRAME_SIZE_DEFAULT;
+	if(ring_size == 0)
+		ring_size = XM_XSK_RING_SIZE_DEFAULT;
+
+	if(!xm_is_power_of_2(ring_size)||!xm_is_power_of_2(frame_size)){
+
+		xm_log(XM_LOG_ERR,"xsk ring size:%u and frame size:%u must be power of 2",ring_size,frame_size);
+		return NULL;
+	}
+
+	if((flags&(XM_XSK_F_RX|XM_XSK_F_TX)) == 0)
+		flags |= XM_XSK_F_RX|XM_XSK_F_TX;
+
+	xsk = (xm_xsk_t*)xm_pcalloc(mp,sizeof(*xsk));
+	if(xsk == NULL)
+		return NULL;
+
+	xsk->fd = -1;
+	xsk->flags = flags;
+	xsk->queue_id = queue_id;
+	xsk->frame_num = frame_num;
+	xsk->frame_size = frame_size;
+
+	xsk->ifindex = (int)if_nametoindex(ifname);
+	if(xsk->ifindex == 0){
+
+		xm_log(XM_LOG_ERR,"Unknown interface:%s",ifname);
+		return NULL;
+	}
+
+	/*split UMEM: rx owns the first part when both directions are used*/
+	if((flags&XM_XSK_F_RX)&&(flags&XM_XSK_F_TX))
+		xsk->rx_frames = frame_num/2;
+	else if(flags&XM_XSK_F_RX)
+		xsk->rx_frames = frame_num;
+	else
+		xsk->rx_frames = 0;
+
+	/*rx frames all sit in the fill ring at start, tx takes what it cannot hold*/
+	if(xsk->rx_frames>ring_size)
+		xsk->rx_frames = ring_size;
+
+	tx_frames = frame_num - xsk->rx_frames;
+
+	xsk->tx_free = (uint64_t*)xm_palloc(mp,sizeof(uint64_t)*(tx_frames+1));
+	if(xsk->tx_free == NULL)
+		return NULL;
+
+	for(i = 0;i<tx_frames;i++)
+		xsk->tx_free[i] = (uint64_t)(xsk->rx_frames+tx_frames-1-i)*frame_size;
+
+	xsk->tx_free_n = tx_frames;
+
+	xsk->umem_size = (size_t)frame_num*frame_size;
+	xsk->umem_area = _umem_alloc(xsk->umem_size,flags&XM_XSK_F_HUGEPAGE);
+	if(xsk->umem_area == NULL){
+
+		xm_log(XM_LOG_ERR,"Cannot alloc xsk umem,size:%lu",(unsigned long)xsk->umem_size);
+		return NULL;
+	}
+
+	xsk->fd = socket(AF_XDP,SOCK_RAW,0);
+	if(xsk->fd<0){
+
+		xm_log(XM_LOG_ERR,"Create AF_XDP socket failed:%s",strerror(errno));
+		goto fail;
+	}
+
+	memset(&ureg,0,sizeof(ureg));
+	ureg.addr = (uint64_t)(uintptr_t)xsk->umem_area;
+	ureg.len = xsk->umem_size;
+	ureg.chunk_size = frame_size;
+	ureg.headroom = 0;
+
+	if(setsockopt(xsk->fd,SOL_XDP,XDP_UMEM_REG,&ureg,sizeof(ureg))){
+
+		xm_log(XM_LOG_ERR,"Register xsk umem failed:%s",strerror(errno));
+		goto fail;
+	}
+
+	/*the kernel requires the fill and completion rings even for one direction*/
+	if(setsockopt(xsk->fd,SOL_XDP,XDP_UMEM_FILL_RING,&ring_size,sizeof(ring_size))||
+		setsockopt(xsk->fd,SOL_XDP,XDP_UMEM_COMPLETION_RING,&ring_size,sizeof(ring_size))){
+
+		xm_log(XM_LOG_ERR,"Setup xsk fill/completion ring failed:%s",strerror(errno));
+		goto fail;
+	}
+
+	if((flags&XM_XSK_F_RX)&&setsockopt(xsk->fd,SOL_XDP,XDP_RX_RING,&ring_size,sizeof(ring_size))){
+
+		xm_log(XM_LOG_ERR,"Setup xsk rx ring failed:%s",strerror(errno));
+		goto fail;
+	}
+
+	if((flags&XM_XSK_F_TX)&&setsockopt(xsk->fd,SOL_XDP,XDP_TX_RING,&ring_size,sizeof(ring_size))){
+
+		xm_log(XM_LOG_ERR,"Setup xsk tx ring failed:%s",strerror(errno));
+		goto fail;
+	}
+
+	optlen = sizeof(off);
+	if(getsockopt(xsk->fd,SOL_XDP,XDP_MMAP_OFFSETS,&off,&optlen)){
+
+		xm_log(XM_LOG_ERR,"Get xsk mmap offsets failed:%s",strerror(errno));
+		goto fail;
+	}
+
+	if(_ring_mmap(xsk->fd,&xsk->fill,&off.fr,ring_size,sizeof(uint64_t),XDP_UMEM_PGOFF_FILL_RING)||
+		_ring_mmap(xsk->fd,&xsk->comp,&off.cr,ring_size,sizeof(uint64_t),XDP_UMEM_PGOFF_COMPLETION_RING))
+		goto fail;
+
+	if((flags&XM_XSK_F_RX)&&_ring_mmap(xsk->fd,&xsk->rx,&off.rx,ring_size,sizeof(struct xdp_desc),XDP_PGOFF_RX_RING))
+		goto fail;
+
+	if((flags&XM_XSK_F_TX)&&_ring_mmap(xsk->fd,&xsk->tx,&off.tx,ring_size,sizeof(struct xdp_desc),XDP_PGOFF_TX_RING))
+		goto fail;
+
+	/*producer rings keep cached_cons one ring ahead of the consumer*/
+	xsk->fill.cached_prod = *xsk->fill.producer;
+	xsk->fill.cached_cons = *xsk->fill.consumer + ring_size;
+	xsk->comp.cached_prod = *xsk->comp.producer;
+	xsk->comp.cached_cons = *xsk->comp.consumer;
+
+	if(xsk->rx.map){
+
+		xsk->rx.cached_prod = *xsk->rx.producer;
+		xsk->rx.cached_cons = *xsk->rx.consumer;
+	}
+
+	if(xsk->tx.map){
+
+		xsk->tx.cached_prod = *xsk->tx.producer;
+		xsk->tx.cached_cons = *xsk->tx.consumer + ring_size;
+	}
+
+	if(_fill_ring_populate(xsk)||_xsk_bind(xsk))
+		goto fail;
+
+	xm_log(XM_LOG_INFO,"AF_XDP socket on %s queue:%u,mode:%s,frames:%u*%u,ring:%u",
+		ifname,queue_id,xsk->zero_copy?"zero-copy":"copy",frame_num,frame_size,ring_size);
+
+	return xsk;
+
+fail:
+	xm_xsk_destroy(xsk);
+	return NULL;
+}
+
+void xm_xsk_destroy(xm_xsk_t *xsk){
+
+	_ring_munmap(&xsk->rx);
+	_ring_munmap(&xsk->tx);
+	_ring_munmap(&xsk->fill);
+	_ring_munmap(&xsk->comp);
+
+	if(xsk->fd>=0){
+
+		close(xsk->fd);
+		xsk->fd = -1;
+	}
+
+	if(xsk->umem_area){
+
+		munmap(xsk->umem_area,xsk->umem_size);
+		xsk->umem_area = NULL;
+	}
+}
+
+uint32_t xm_xsk_tx_complete(xm_xsk_t *xsk){
+
+	uint32_t i,n,idx = 0;
+
+	if(xsk->tx_outstanding == 0)
+		return 0;
+
+	n = xm_xsk_ring_cons_peek(&xsk->comp,xsk->comp.size,&idx);
+	if(n == 0)
+		return 0;
+
+	for(i = 0;i<n;i++)
+		xsk->tx_free[xsk->tx_free_n++] = *xm_xsk_ring_addr(&xsk->comp,idx++);
+
+	xm_xsk_ring_cons_release(&xsk->comp,n);
+	xsk->tx_outstanding -= n;
+
+	return n;
+}
+
+static inline void _tx_kick(xm_xsk_t *xsk){
+
+	if(!(xsk->flags&XM_XSK_F_NEED_WAKEUP)||xm_xsk_ring_needs_wakeup(&xsk->tx)){
+
+		xsk->stats.tx_wakeups++;
+
+		/*ENOBUFS/EAGAIN/EBUSY only mean the kernel is still busy with the ring*/
+		sendto(xsk->fd,NULL,0,MSG_DONTWAIT,NULL,0);
+	}
+}
+
+uint32_t xm_xsk_tx_reserve(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n){
+
+	uint32_t i;
+	uint64_t addr;
+
+	if(xsk->tx_free_n<n)
+		xm_xsk_tx_complete(xsk);
+
+	if(xsk->tx_free_n<n){
+
+		/*completions only advance once the kernel has been kicked*/
+		if(xsk->tx_outstanding){
+
+			_tx_kick(xsk);
+			xm_xsk_tx_complete(xsk);
+		}
+
+		if(xsk->tx_free_n<n){
+
+			xsk->stats.tx_no_frame += n-xsk->tx_free_n;
+			n = xsk->tx_free_n;
+		}
+	}
+
+	for(i = 0;i<n;i++){
+
+		addr = xsk->tx_free[--xsk->tx_free_n];
+		frames[i].addr = addr;
+		frames[i].len = xsk->frame_size;
+		frames[i].data = xm_xsk_umem_data(xsk,addr);
+	}
+
+	return n;
+}
+
+uint32_t xm_xsk_tx_submit(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n){
+
+	uint32_t i,idx = 0;
+	uint32_t sent;
+	struct xdp_desc *desc;
+
+	sent = xm_xsk_ring_prod_reserve(&xsk->tx,n,&idx);
+	if(sent == 0){
+
+		/*the ring is full: let the kernel drain it,then retry once*/
+		_tx_kick(xsk);
+		xm_xsk_tx_complete(xsk);
+		sent = xm_xsk_ring_prod_reserve(&xsk->tx,n,&idx);
+	}
+
+	for(i = 0;i<sent;i++){
+
+		desc = xm_xsk_ring_desc(&xsk->tx,idx++);
+		desc->addr = frames[i].addr;
+		desc->len = frames[i].len;
+		desc->options = 0;
+	}
+
+	/*give back the frames the ring had no room for*/
+	for(i = sent;i<n;i++)
+		xsk->tx_free[xsk->tx_free_n++] = frames[i].addr;
+
+	if(sent == 0)
+		return 0;
+
+	xm_xsk_ring_prod_submit(&xsk->tx,sent);
+	xsk->tx_outstanding += sent;
+	xsk->stats.tx_packets += sent;
+
+	_tx_kick(xsk);
+
+	return sent;
+}
+
+uint32_t xm_xsk_tx_send(xm_xsk_t *xsk,const struct iovec *pkts,uint32_t n){
+
+	xm_xsk_frame_t frames[64];
+	uint32_t i,k,m,sent = 0;
+
+	while(n>0){
+
+		m = n>64?64:n;
+
+		k = xm_xsk_tx_reserve(xsk,frames,m);
+		if(k == 0)
+			break;
+
+		for(i = 0;i<k;i++){
+
+			frames[i].len = pkts[i].iov_len>xsk->frame_size?xsk->frame_size:pkts[i].iov_len;
+			memcpy(frames[i].data,pkts[i].iov_base,frames[i].len);
+		}
+
+		m = xm_xsk_tx_submit(xsk,frames,k);
+		sent += m;
+
+		if(m<k)
+			break;
+
+		pkts += k;
+		n -= k;
+	}
+
+	return sent;
+}
+
+uint32_t xm_xsk_rx_burst(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n){
+
+	uint32_t i,rcvd,idx = 0;
+	const struct xdp_desc *desc;
+
+	rcvd = xm_xsk_ring_cons_peek(&xsk->rx,n,&idx);
+	if(rcvd == 0)
+		return 0;
+
+	for(i = 0;i<rcvd;i++){
+
+		desc = xm_xsk_ring_desc(&xsk->rx,idx++);
+		frames[i].addr = desc->addr;
+		frames[i].len = desc->len;
+		frames[i].data = xm_xsk_umem_data(xsk,desc->addr);
+	}
+
+	xm_xsk_ring_cons_release(&xsk->rx,rcvd);
+	xsk->stats.rx_packets += rcvd;
+
+	return rcvd;
+}
+
+void xm_xsk_rx_release(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n){
+
+	uint32_t i,m,idx = 0;
+
+	while(n>0){
+
+		/*more than the ring holds could never be reserved at once*/
+		m = n>xsk->fill.size?xsk->fill.size:n;
+
+		/*the fill ring is as large as the rx ring, so this never spins for long*/
+		while(xm_xsk_ring_prod_reserve(&xsk->fill,m,&idx)!=m){
+
+			if(xsk->flags&XM_XSK_F_NEED_WAKEUP&&xm_xsk_ring_needs_wakeup(&xsk->fill))
+				recvfrom(xsk->fd,NULL,0,MSG_DONTWAIT,NULL,NULL);
+			else
+				xm_pause();
+		}
+
+		for(i = 0;i<m;i++)
+			*xm_xsk_ring_addr(&xsk->fill,idx++) = frames[i].addr & ~((uint64_t)xsk->frame_size-1);
+
+		xm_xsk_ring_prod_submit(&xsk->fill,m);
+
+		frames += m;
+		n -= m;
+	}
+}
+
+int xm_xsk_rx_wait(xm_xsk_t *xsk,int timeout_ms){
+
+	struct pollfd pfd;
+
+	if(xm_xsk_cons_nb_avail(&xsk->rx,1))
+		return 1;
+
+	if((xsk->flags&XM_XSK_F_NEED_WAKEUP)&&!xm_xsk_ring_needs_wakeup(&xsk->fill)&&timeout_ms == 0)
+		return 0;
+
+	xsk->stats.rx_wakeups++;
+
+	pfd.fd = xsk->fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	return poll(&pfd,1,timeout_ms);
+}
+
+int xm_xsk_stats_get(xm_xsk_t *xsk,xm_xsk_stats_t *stats){
+
+	struct xdp_statistics xs;
+	socklen_t optlen = sizeof(xs);
+
+	memset(&xs,0,sizeof(xs));
+
+	if(getsockopt(xsk->fd,SOL_XDP,XDP_STATISTICS,&xs,&optlen))
+		return -1;
+
+	xsk->stats.rx_dropped = xs.rx_dropped;
+	xsk->stats.rx_invalid_descs = xs.rx_invalid_descs;
+	xsk->stats.tx_invalid_descs = xs.tx_invalid_descs;
+
+	/*fields added in later kernels stay zero on older ones*/
+	if(optlen>=sizeof(xs)){
+
+		xsk->stats.rx_ring_full = xs.rx_ring_full;
+		xsk->stats.rx_fill_ring_empty_descs = xs.rx_fill_ring_empty_descs;
+		xsk->stats.tx_ring_empty_descs = xs.tx_ring_empty_descs;
+	}
+
+	*stats = xsk->stats;
+
+	return 0;
+}
+
+void xm_xsk_stats_dump(xm_xsk_t *xsk,FILE *fp){
+
+	xm_xsk_stats_t stats;
+
+	if(xm_xsk_stats_get(xsk,&stats))
+		stats = xsk->stats;
+
+	fprintf(fp,"Dump xsk info-------------------------------------------\n");
+	fprintf(fp,"ifindex:%d,queue:%u,mode:%s\n",xsk->ifindex,xsk->queue_id,xsk->zero_copy?"zero-copy":"copy");
+	fprintf(fp,"tx packets:%lu,tx wakeups:%lu,tx no frame:%lu\n",(unsigned long)stats.tx_packets,
+		(unsigned long)stats.tx_wakeups,(unsigned long)stats.tx_no_frame);
+	fprintf(fp,"rx packets:%lu,rx wakeups:%lu\n",(unsigned long)stats.rx_packets,(unsigned long)stats.rx_wakeups);
+	fprintf(fp,"rx dropped:%lu,rx invalid descs:%lu,tx invalid descs:%lu\n",(unsigned long)stats.rx_dropped,
+		(unsigned long)stats.rx_invalid_descs,(unsigned long)stats.tx_invalid_descs);
+	fprintf(fp,"rx ring full:%lu,fill ring empty:%lu,tx ring empty:%lu\n",(unsigned long)stats.rx_ring_full,
+		(unsigned long)stats.rx_fill_ring_empty_descs,(unsigned long)stats.tx_ring_empty_descs);
+}
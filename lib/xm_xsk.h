@@ -0,0 +1,287 @@
+/*
+ *
+ *      Filename: xm_xsk.h
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: AF_XDP socket backend for the send/recv engines
+ *        Create: 2026-10-18 09:12:40
+ * Last Modified: 2026-10-18 09:12:40
+ */
+
+#ifndef XM_XSK_H
+#define XM_XSK_H
+
+typedef struct xm_xsk_ring_t xm_xsk_ring_t;
+typedef struct xm_xsk_frame_t xm_xsk_frame_t;
+typedef struct xm_xsk_stats_t xm_xsk_stats_t;
+typedef struct xm_xsk_t xm_xsk_t;
+
+#include <linux/if_xdp.h>
+#include "xm_constants.h"
+#include "xm_atomic.h"
+#include "xm_mpool.h"
+
+#ifndef AF_XDP
+#define AF_XDP 44
+#endif
+
+#ifndef SOL_XDP
+#define SOL_XDP 283
+#endif
+
+#define XM_XSK_FRAME_SIZE_DEFAULT   2048
+#define XM_XSK_FRAME_NUM_DEFAULT    4096
+#define XM_XSK_RING_SIZE_DEFAULT    2048
+
+/*create flags*/
+#define XM_XSK_F_RX          0x01  /**< create the rx ring and fill the fill ring */
+#define XM_XSK_F_TX          0x02  /**< create the tx ring */
+#define XM_XSK_F_COPY        0x04  /**< never try zero-copy, bind in copy mode */
+#define XM_XSK_F_NEED_WAKEUP 0x08  /**< ask the kernel to set need_wakeup flags */
+#define XM_XSK_F_HUGEPAGE    0x10  /**< back the UMEM with hugepages if possible */
+
+/**
+ * One producer or consumer ring shared with the kernel.
+ * cached_prod/cached_cons are the local shadows of the shared
+ * indexes, so the shared cache lines are only touched once per batch.
+ */
+struct xm_xsk_ring_t {
+
+	uint32_t cached_prod;
+	uint32_t cached_cons;
+	uint32_t mask;
+	uint32_t size;
+
+	uint32_t *producer;
+	uint32_t *consumer;
+	uint32_t *flags;
+	void *ring;
+
+	void *map;
+	size_t map_size;
+};
+
+/**
+ * A frame handed out by xm_xsk_tx_reserve or xm_xsk_rx_burst.
+ * data points into the UMEM, addr is its UMEM offset.
+ */
+struct xm_xsk_frame_t {
+
+	uint64_t addr;
+	uint32_t len;
+	void *data;
+};
+
+struct xm_xsk_stats_t {
+
+	uint64_t tx_packets;
+	uint64_t rx_packets;
+	uint64_t tx_wakeups;
+	uint64_t rx_wakeups;
+	uint64_t tx_no_frame;
+
+	/*from XDP_STATISTICS*/
+	uint64_t rx_dropped;
+	uint64_t rx_invalid_descs;
+	uint64_t tx_invalid_descs;
+	uint64_t rx_ring_full;
+	uint64_t rx_fill_ring_empty_descs;
+	uint64_t tx_ring_empty_descs;
+};
+
+struct xm_xsk_t {
+
+	int fd;
+	int ifindex;
+	uint32_t queue_id;
+
+	int flags;
+
+	/*1 if the kernel accepted XDP_ZEROCOPY*/
+	int zero_copy;
+
+	/*UMEM shared by tx and rx: [0,rx_frames) feeds the fill ring,
+	 *the rest is the tx free stack*/
+	void *umem_area;
+	size_t umem_size;
+	uint32_t frame_size;
+	uint32_t frame_num;
+	uint32_t rx_frames;
+
+	uint64_t *tx_free;
+	uint32_t tx_free_n;
+	uint32_t tx_outstanding;
+
+	xm_xsk_ring_t rx;
+	xm_xsk_ring_t tx;
+	xm_xsk_ring_t fill;
+	xm_xsk_ring_t comp;
+
+	xm_xsk_stats_t stats;
+};
+
+/*ring helpers, the same producer/consumer protocol the kernel uses*/
+
+static inline uint32_t xm_xsk_prod_nb_free(xm_xsk_ring_t *r,uint32_t nb){
+
+	uint32_t free_entries = r->cached_cons - r->cached_prod;
+
+	if(free_entries>=nb)
+		return free_entries;
+
+	/*refresh the consumer index, cached_cons is kept size ahead*/
+	r->cached_cons = *(volatile uint32_t*)r->consumer + r->size;
+
+	return r->cached_cons - r->cached_prod;
+}
+
+static inline uint32_t xm_xsk_cons_nb_avail(xm_xsk_ring_t *r,uint32_t nb){
+
+	uint32_t entries = r->cached_prod - r->cached_cons;
+
+	if(entries == 0){
+
+		r->cached_prod = *(volatile uint32_t*)r->producer;
+		entries = r->cached_prod - r->cached_cons;
+	}
+
+	return entries>nb?nb:entries;
+}
+
+static inline uint32_t xm_xsk_ring_prod_reserve(xm_xsk_ring_t *r,uint32_t nb,uint32_t *idx){
+
+	if(xm_xsk_prod_nb_free(r,nb)<nb)
+		return 0;
+
+	*idx = r->cached_prod;
+	r->cached_prod += nb;
+
+	return nb;
+}
+
+static inline void xm_xsk_ring_prod_submit(xm_xsk_ring_t *r,uint32_t nb){
+
+	/*descriptors must be visible before the producer index*/
+	xm_smp_wmb();
+
+	*(volatile uint32_t*)r->producer = *r->producer + nb;
+}
+
+static inline uint32_t xm_xsk_ring_cons_peek(xm_xsk_ring_t *r,uint32_t nb,uint32_t *idx){
+
+	uint32_t entries = xm_xsk_cons_nb_avail(r,nb);
+
+	if(entries>0){
+
+		/*read descriptors only after the producer index*/
+		xm_smp_rmb();
+
+		*idx = r->cached_cons;
+		r->cached_cons += entries;
+	}
+
+	return entries;
+}
+
+static inline void xm_xsk_ring_cons_release(xm_xsk_ring_t *r,uint32_t nb){
+
+	/*descriptors must be read before the slots are handed back*/
+	xm_compiler_barrier();
+
+	*(volatile uint32_t*)r->consumer = *r->consumer + nb;
+}
+
+static inline int xm_xsk_ring_needs_wakeup(xm_xsk_ring_t *r){
+
+	return r->flags?(*(volatile uint32_t*)r->flags & XDP_RING_NEED_WAKEUP):1;
+}
+
+static inline uint64_t *xm_xsk_ring_addr(xm_xsk_ring_t *r,uint32_t idx){
+
+	return &((uint64_t*)r->ring)[idx & r->mask];
+}
+
+static inline struct xdp_desc *xm_xsk_ring_desc(xm_xsk_ring_t *r,uint32_t idx){
+
+	return &((struct xdp_desc*)r->ring)[idx & r->mask];
+}
+
+static inline void *xm_xsk_umem_data(xm_xsk_t *xsk,uint64_t addr){
+
+	return (char*)xsk->umem_area + addr;
+}
+
+static inline int xm_xsk_fd(xm_xsk_t *xsk){
+
+	return xsk->fd;
+}
+
+/**
+ * Create an AF_XDP socket bound to ifname/queue_id.
+ * A single UMEM of frame_num*frame_size bytes backs both rings; zero-copy
+ * is tried first and the socket falls back to copy mode on drivers that
+ * refuse it (or always when XM_XSK_F_COPY is set, e.g. veth in generic XDP mode).
+ * @param mp The pool the socket structure is allocated from
+ * @param ifname The interface name
+ * @param queue_id The interface queue to bind
+ * @param frame_num Number of UMEM frames, 0 for XM_XSK_FRAME_NUM_DEFAULT;
+ *        rx gets at most ring_size of them and tx the rest
+ * @param frame_size UMEM frame size, 0 for XM_XSK_FRAME_SIZE_DEFAULT
+ * @param ring_size Size of every ring, 0 for XM_XSK_RING_SIZE_DEFAULT
+ * @param flags XM_XSK_F_*
+ * @return The socket or NULL on failure
+ * @remark For receiving, an XDP program must redirect the queue to an
+ *         XSKMAP holding xm_xsk_fd(xsk); this module does not load one.
+ */
+extern xm_xsk_t *xm_xsk_create(xm_pool_t *mp,const char *ifname,uint32_t queue_id,
+	uint32_t frame_num,uint32_t frame_size,uint32_t ring_size,int flags);
+
+extern void xm_xsk_destroy(xm_xsk_t *xsk);
+
+/**
+ * Reserve up to n free UMEM frames for building packets in place.
+ * Completed transmissions are reclaimed first.
+ * @return The number of frames reserved; frames[i].len is the frame capacity
+ */
+extern uint32_t xm_xsk_tx_reserve(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n);
+
+/**
+ * Queue n frames previously returned by xm_xsk_tx_reserve, with their
+ * len set to the packet length, and kick the kernel if it asked for it.
+ * @return The number of frames queued; unqueued frames go back to the free stack
+ */
+extern uint32_t xm_xsk_tx_submit(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n);
+
+/**
+ * Copy n packets into UMEM frames and send them in one batch.
+ * @return The number of packets queued
+ */
+extern uint32_t xm_xsk_tx_send(xm_xsk_t *xsk,const struct iovec *pkts,uint32_t n);
+
+/**
+ * Reclaim completed tx frames.
+ * @return The number of frames reclaimed
+ */
+extern uint32_t xm_xsk_tx_complete(xm_xsk_t *xsk);
+
+/**
+ * Receive up to n frames. The frames stay owned by the caller until
+ * xm_xsk_rx_release gives them back to the fill ring.
+ * @return The number of frames received
+ */
+extern uint32_t xm_xsk_rx_burst(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n);
+
+extern void xm_xsk_rx_release(xm_xsk_t *xsk,xm_xsk_frame_t *frames,uint32_t n);
+
+/**
+ * Wait for rx descriptors; poll(2) is only entered when the kernel
+ * set need_wakeup on the fill ring or need_wakeup is not in use.
+ * @return >0 if packets may be ready, 0 on timeout, -1 on error
+ */
+extern int xm_xsk_rx_wait(xm_xsk_t *xsk,int timeout_ms);
+
+extern int xm_xsk_stats_get(xm_xsk_t *xsk,xm_xsk_stats_t *stats);
+
+extern void xm_xsk_stats_dump(xm_xsk_t *xsk,FILE *fp);
+
+#endif /*XM_XSK_H*/
@@ -0,0 +1,185 @@
+/*
+ *
+ *      Filename: xm_stat.c
+ *
+ *        Author: shajf,csp001314@gmail.com
+ *   Description: print the stats a process publishes with xm_stats
+ *        Create: 2026-10-18 16:20:41
+ * Last Modified: 2026-10-18 16:20:41
+ */
+
+#include "xm_stats.h"
+#include "xm_getopt.h"
+#include "xm_errno.h"
+
+static const xm_getopt_option_t stat_opts[] = {
+
+	{"interval",'i',1,"print the rates every this many ms"},
+	{"count",'n',1,"stop after this many intervals"},
+	{"list",'l',0,"list the names, types and units"},
+	{"help",'h',0,"this text"},
+	{NULL,0,0,NULL}
+};
+
+static void usage(const char *prog){
+
+	const xm_getopt_option_t *o;
+
+	fprintf(stderr,"usage: %s [options] /segment-name\n",prog);
+
+	for(o = stat_opts;o->name;o++)
+		fprintf(stderr,"  -%c, --%-10s %s\n",o->optch,o->name,o->description);
+}
+
+static uint64_t now_ns(void){
+
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC,&ts);
+
+	return (uint64_t)ts.tv_sec*1000000000ULL+(uint64_t)ts.tv_nsec;
+}
+
+static void print_header(const xm_stats_view_t *v){
+
+	const xm_stats_hdr_t *hdr = v->hdr;
+
+	printf("%s pid %d, %u stats, published %.1fs ago%s\n",hdr->app[0]?hdr->app:"?",
+		(int)hdr->pid,v->n,(double)(now_ns()-v->publish_ns)/1e9,
+		kill(hdr->pid,0) && errno == ESRCH?" (process gone)":"");
+}
+
+static void print_list(const xm_stats_view_t *v){
+
+	const xm_stats_desc_t *d;
+	uint32_t i;
+
+	for(i = 0;i<v->n;i++){
+
+		d = xm_stats_view_desc(v,i);
+		printf("%-40s %-8s %s\n",d->name,d->type == XM_STATS_GAUGE?"gauge":"counter",d->unit);
+	}
+}
+
+static void print_values(const xm_stats_view_t *v){
+
+	const xm_stats_desc_t *d;
+	uint32_t i;
+
+	print_header(v);
+
+	for(i = 0;i<v->n;i++){
+
+		d = xm_stats_view_desc(v,i);
+		printf("%-40s %20llu %s\n",d->name,(unsigned long long)v->values[i],d->unit);
+	}
+}
+
+/*counters as a rate over the publishes, gauges as they are*/
+static void print_rates(const xm_stats_view_t *v,const uint64_t *prev,uint32_t nprev,uint64_t prev_ns){
+
+	const xm_stats_desc_t *d;
+	double dt = (double)(v->publish_ns-prev_ns)/1e9;
+	uint32_t i;
+
+	print_header(v);
+
+	if(v->publish_ns == prev_ns){
+
+		printf("  no publish since the last read\n");
+		return;
+	}
+
+	for(i = 0;i<v->n;i++){
+
+		d = xm_stats_view_desc(v,i);
+
+		if(d->type == XM_STATS_GAUGE)
+			printf("%-40s %20llu %s\n",d->name,(unsigned long long)v->values[i],d->unit);
+		else if(i<nprev)
+			printf("%-40s %20.1f %s/s\n",d->name,(double)(v->values[i]-prev[i])/dt,d->unit);
+		else
+			printf("%-40s %20s %s/s\n",d->name,"-",d->unit);
+	}
+}
+
+int main(int argc,const char *const *argv){
+
+	xm_stats_view_t *v;
+	xm_getopt_t *opt;
+	xm_pool_t *mp;
+	const char *arg;
+	uint64_t *prev,prev_ns;
+	uint32_t nprev;
+	long interval = 0,count = -1;
+	int ch,rc,list = 0;
+
+	mp = xm_pool_create(16384);
+	if(mp == NULL)
+		return 1;
+
+	xm_getopt_init(&opt,mp,argc,argv);
+
+	while((rc = xm_getopt_long(opt,stat_opts,&ch,&arg)) == 0){
+
+		switch(ch){
+
+		case 'i': interval = atol(arg); break;
+		case 'n': count = atol(arg); break;
+		case 'l': list = 1; break;
+		default: usage(argv[0]); return ch == 'h'?0:1;
+		}
+	}
+
+	if(rc != XM_EOF||opt->ind != argc-1){
+
+		usage(argv[0]);
+		return 1;
+	}
+
+	rc = xm_stats_view_open(&v,mp,argv[opt->ind]);
+	if(rc){
+
+		fprintf(stderr,"cannot open %s: %s\n",argv[opt->ind],
+			rc == EINVAL?"not a stats segment of this version":strerror(rc));
+		return 1;
+	}
+
+	if(list){
+
+		print_list(v);
+		return 0;
+	}
+
+	if(interval<=0){
+
+		print_values(v);
+		return 0;
+	}
+
+	prev = (uint64_t*)xm_pcalloc(mp,v->hdr->max*sizeof(uint64_t));
+	if(prev == NULL){
+
+		fprintf(stderr,"no memory for %u counters\n",v->hdr->max);
+		return 1;
+	}
+
+	while(count--){
+
+		memcpy(prev,v->values,v->n*sizeof(uint64_t));
+		nprev = v->n;
+		prev_ns = v->publish_ns;
+
+		usleep((useconds_t)interval*1000);
+
+		if(xm_stats_view_read(v) == EAGAIN)
+			fprintf(stderr,"the writer is stuck in a publish, showing the last snapshot\n");
+
+		print_rates(v,prev,nprev,prev_ns);
+		fflush(stdout);
+	}
+
+	xm_pool_destroy(mp);
+
+	return 0;
+}